@@ -155,6 +155,66 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILE_CONCAT ("linux/io_uring.h" ${HDF_PREFIX}_HAVE_LINUX_IO_URING_H)
+    CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" HAVE_IO_URING_SYSCALLS)
+    if (${HDF_PREFIX}_HAVE_LINUX_IO_URING_H AND HAVE_IO_URING_SYSCALLS)
+      set (${HDF_PREFIX}_HAVE_IOURING 1)
+    else ()
+      message (STATUS "The io_uring VFD was requested but cannot be built.\nPlease check that linux/io_uring.h is available on your\nsystem, and/or re-configure without option HDF5_ENABLE_IOURING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the datatype conversion kernels for AVX2 can be built, and picked
+#  at run time
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  include (CheckCSourceCompiles)
+  CHECK_C_SOURCE_COMPILES ("
+    #include <immintrin.h>
+    __attribute__((target(\"avx2\"))) static void f(unsigned char *p)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        _mm256_storeu_si256((__m256i *)p, _mm256_shuffle_epi8(v, v));
+    }
+    int main(void)
+    {
+        unsigned char buf[32] = {0};
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports(\"avx2\"))
+            f(buf);
+        return (int)buf[0];
+    }" ${HDF_PREFIX}_HAVE_AVX2_DISPATCH)
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the CRC32C checksum can use the SSE4.2 CRC32 instruction, picked
+#  at run time
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  CHECK_C_SOURCE_COMPILES ("
+    #include <nmmintrin.h>
+    __attribute__((target(\"sse4.2\"))) static unsigned f(unsigned crc, unsigned char c)
+    {
+        return _mm_crc32_u8(crc, c);
+    }
+    int main(void)
+    {
+        unsigned crc = 0;
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports(\"sse4.2\"))
+            crc = f(crc, 1);
+        return (int)(crc & 1);
+    }" ${HDF_PREFIX}_HAVE_SSE42_CRC32C_DISPATCH)
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
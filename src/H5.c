@@ -304,6 +304,11 @@ H5_term_library(void)
          */
         pending += DOWN(L);
 
+        /* Complete any outstanding asynchronous operations first, since
+         *  they hold references on objects in the other interfaces.
+         */
+        pending += DOWN(ES_top);
+
         /* Close the "top" of various interfaces (IDs, etc) but don't shut
          *  down the whole interface yet, so that the object header messages
          *  get serialized correctly for entries in the metadata cache and the
@@ -338,6 +343,7 @@ H5_term_library(void)
              */
             pending += DOWN(A);
             pending += DOWN(D);
+            pending += DOWN(ES);
             pending += DOWN(G);
             pending += DOWN(M);
             pending += DOWN(R);
@@ -518,7 +524,9 @@ done:
  *      for the entire library.  Each "global" limit only applies to free lists
  *      of that type, so if an application sets a limit of 1 MB on each of the
  *      global lists, up to 3 MB of total storage might be allocated (1MB on
- *      each of regular, array and block type lists).
+ *      each of regular, array and block type lists).  The free lists are
+ *      garbage collected when the limits are set, and the memory kept on
+ *      them never exceeds the limits afterwards.
  *
  *      The settings for block free lists are duplicated to factory free lists.
  *      Factory free list limits cannot be set independently currently.
@@ -597,6 +605,44 @@ done:
 }   /* end H5get_free_list_sizes() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5get_free_list_stats
+ *
+ * Purpose:	Gets usage statistics for the different kinds of free lists
+ *	that the library uses to manage memory: how many blocks were handed
+ *	out, how many of those were recycled from a free list, and how many
+ *	blocks & bytes are currently kept on the lists.  Any of the arguments
+ *	may be NULL.  These statistics are global for the entire library.
+ *
+ * Parameters:
+ *  H5_free_list_stats_t *reg_stats;    OUT: Statistics for "regular" free lists
+ *  H5_free_list_stats_t *arr_stats;    OUT: Statistics for "array" free lists
+ *  H5_free_list_stats_t *blk_stats;    OUT: Statistics for "block" free lists
+ *  H5_free_list_stats_t *fac_stats;    OUT: Statistics for "factory" free lists
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_free_list_stats(H5_free_list_stats_t *reg_stats, H5_free_list_stats_t *arr_stats,
+    H5_free_list_stats_t *blk_stats, H5_free_list_stats_t *fac_stats)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "*x*x*x*x", reg_stats, arr_stats, blk_stats, fac_stats);
+
+    /* Call the free list function to actually get the statistics */
+    if(H5FL_get_free_list_stats(reg_stats, arr_stats, blk_stats, fac_stats) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't get free list statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5get_free_list_stats() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5get_alloc_stats
  *
@@ -46,6 +46,7 @@
 #include "H5Fpkg.h"             /* Files                                    */
 #include "H5FDprivate.h"        /* File drivers                             */
 #include "H5Iprivate.h"         /* IDs                                      */
+#include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Pprivate.h"         /* Property lists                           */
 #include "H5SLprivate.h"        /* Skip Lists                               */
 
@@ -1597,6 +1598,7 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr,
 {
     H5C_auto_size_ctl_t internal_config;
     hbool_t evictions_enabled;
+    enum H5C_cache_repl_policy repl_policy;
     herr_t ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -1620,6 +1622,8 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr,
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_auto_resize_config() failed")
     if(H5C_get_evictions_enabled((const H5C_t *)cache_ptr, &evictions_enabled) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_resize_enabled() failed")
+    if(H5C_get_repl_policy((const H5C_t *)cache_ptr, &repl_policy) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_repl_policy() failed")
 
     /* Set the information to return */
     if(internal_config.rpt_fcn == NULL)
@@ -1652,6 +1656,7 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr,
     config_ptr->epochs_before_eviction = (int)(internal_config.epochs_before_eviction);
     config_ptr->apply_empty_reserve    = internal_config.apply_empty_reserve;
     config_ptr->empty_reserve          = internal_config.empty_reserve;
+    config_ptr->repl_policy            = repl_policy;
 #ifdef H5_HAVE_PARALLEL
 {
     H5AC_aux_t *aux_ptr;
@@ -1756,6 +1761,31 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_hit_rate_by_type
+ *
+ * Purpose:     Wrapper function for H5C_get_cache_hit_rate_by_type().
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_cache_hit_rate_by_type(H5AC_t *cache_ptr, H5FD_mem_t type,
+    double *hit_rate_ptr, hsize_t *hits_ptr, hsize_t *misses_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5C_get_cache_hit_rate_by_type((H5C_t *)cache_ptr, type, hit_rate_ptr, hits_ptr, misses_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_hit_rate_by_type() failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_hit_rate_by_type() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -1852,6 +1882,8 @@ H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr, H5AC_cache_config_t *config
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_cache_auto_resize_config() failed")
     if(H5C_set_evictions_enabled(cache_ptr, config_ptr->evictions_enabled) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_evictions_enabled() failed")
+    if(H5C_set_repl_policy(cache_ptr, config_ptr->repl_policy) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_repl_policy() failed")
 
 #ifdef H5_HAVE_PARALLEL
 {
@@ -1942,6 +1974,11 @@ H5AC_validate_config(H5AC_cache_config_t *config_ptr)
          (config_ptr->metadata_write_strategy != H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED))
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "config_ptr->metadata_write_strategy out of range")
 
+    if((config_ptr->repl_policy != H5C_repl__lru) &&
+            (config_ptr->repl_policy != H5C_repl__2q) &&
+            (config_ptr->repl_policy != H5C_repl__arc))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "config_ptr->repl_policy out of range")
+
     if(H5AC__ext_config_2_int_config(config_ptr, &internal_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5AC__ext_config_2_int_config() failed")
 
@@ -1952,6 +1989,91 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_validate_config() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_upgrade_config()
+ *
+ * Purpose:     Copy the instance of H5AC_cache_config_t supplied by the
+ *              application into *config_ptr, translating it to the
+ *              current version of the structure if necessary.
+ *
+ *              Version 1 of the structure ends just before the
+ *              repl_policy field, so only that much of *ext_config_ptr
+ *              may be read.  The missing fields are set to their
+ *              version 1 behavior.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_upgrade_config(const H5AC_cache_config_t *ext_config_ptr,
+    H5AC_cache_config_t *config_ptr)
+{
+    herr_t ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(config_ptr);
+
+    if(ext_config_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "NULL config_ptr on entry")
+
+    if(ext_config_ptr->version == H5AC__CURR_CACHE_CONFIG_VERSION)
+        H5MM_memcpy(config_ptr, ext_config_ptr, sizeof(H5AC_cache_config_t));
+    else if(ext_config_ptr->version == H5AC__CACHE_CONFIG_VERSION_1) {
+        H5MM_memcpy(config_ptr, ext_config_ptr, offsetof(H5AC_cache_config_t, repl_policy));
+        config_ptr->version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        config_ptr->repl_policy = H5C_repl__lru;
+    } /* end else-if */
+    else
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Unknown config version")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_upgrade_config() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_downgrade_config()
+ *
+ * Purpose:     Copy the current version of H5AC_cache_config_t in
+ *              *config_ptr into the application's structure, writing
+ *              only the fields that exist in the version requested in
+ *              ext_config_ptr->version.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_downgrade_config(const H5AC_cache_config_t *config_ptr,
+    H5AC_cache_config_t *ext_config_ptr)
+{
+    int version;                    /* Version requested by application */
+    herr_t ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(config_ptr);
+    HDassert(config_ptr->version == H5AC__CURR_CACHE_CONFIG_VERSION);
+
+    if(ext_config_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "NULL config_ptr on entry")
+
+    version = ext_config_ptr->version;
+    if(version == H5AC__CURR_CACHE_CONFIG_VERSION)
+        H5MM_memcpy(ext_config_ptr, config_ptr, sizeof(H5AC_cache_config_t));
+    else if(version == H5AC__CACHE_CONFIG_VERSION_1)
+        H5MM_memcpy(ext_config_ptr, config_ptr, offsetof(H5AC_cache_config_t, repl_policy));
+    else
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Unknown config version")
+    ext_config_ptr->version = version;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_downgrade_config() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_validate_cache_image_config()
@@ -170,6 +170,7 @@ typedef H5C_notify_action_t     H5AC_notify_action_t;
 
 #define H5AC__CLASS_NO_FLAGS_SET 	H5C__CLASS_NO_FLAGS_SET
 #define H5AC__CLASS_SPECULATIVE_LOAD_FLAG H5C__CLASS_SPECULATIVE_LOAD_FLAG
+#define H5AC__CLASS_CONCURRENT_SERIALIZE_FLAG H5C__CLASS_CONCURRENT_SERIALIZE_FLAG
 
 /* The following flags should only appear in test code */
 #define H5AC__CLASS_SKIP_READS              H5C__CLASS_SKIP_READS
@@ -257,12 +258,14 @@ typedef struct H5AC_proxy_entry_t {
   /* double      empty_reserve          = */ 0.1f,                            \
   /* size_t	 dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int	metadata_write_strategy = */                                  \
-				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* enum H5C_cache_repl_policy           */                                  \
+  /*                        repl_policy = */ H5C_repl__lru                    \
 }
 #else /* H5_HAVE_PARALLEL */
 #define H5AC__DEFAULT_CACHE_CONFIG                                            \
 {                                                                             \
-  /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,     \
+  /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION, \
   /* hbool_t     rpt_fcn_enabled        = */ FALSE,                           \
   /* hbool_t     open_trace_file        = */ FALSE,                           \
   /* hbool_t     close_trace_file       = */ FALSE,                           \
@@ -293,7 +296,9 @@ typedef struct H5AC_proxy_entry_t {
   /* double      empty_reserve          = */ 0.1f,                            \
   /* size_t	 dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int	metadata_write_strategy = */                                  \
-				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* enum H5C_cache_repl_policy           */                                  \
+  /*                        repl_policy = */ H5C_repl__lru                    \
 }
 #endif /* H5_HAVE_PARALLEL */
 
@@ -413,10 +418,16 @@ H5_DLL herr_t H5AC_get_cache_size(H5AC_t *cache_ptr, size_t *max_size_ptr,
     size_t *min_clean_size_ptr, size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5AC_get_cache_flush_in_progress(H5AC_t *cache_ptr, hbool_t *flush_in_progress_ptr);
 H5_DLL herr_t H5AC_get_cache_hit_rate(H5AC_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5AC_get_cache_hit_rate_by_type(H5AC_t *cache_ptr, H5FD_mem_t type,
+    double *hit_rate_ptr, hsize_t *hits_ptr, hsize_t *misses_ptr);
 H5_DLL herr_t H5AC_reset_cache_hit_rate_stats(H5AC_t *cache_ptr);
 H5_DLL herr_t H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr,
     H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5AC_validate_config(H5AC_cache_config_t *config_ptr);
+H5_DLL herr_t H5AC_upgrade_config(const H5AC_cache_config_t *ext_config_ptr,
+    H5AC_cache_config_t *config_ptr);
+H5_DLL herr_t H5AC_downgrade_config(const H5AC_cache_config_t *config_ptr,
+    H5AC_cache_config_t *ext_config_ptr);
 
 /* Cache image routines */
 H5_DLL herr_t H5AC_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr,
@@ -436,9 +436,39 @@ extern "C" {
  *    To avoid possible messages from the past/future, all caches must
  *    wait until all caches are done before leaving the sync point.
  *
+ *
+ * Replacement Policy Configuration Field:
+ *
+ * repl_policy: Enumerated field selecting the policy used to choose
+ *    eviction candidates.  This field is only present in version 2 and
+ *    later of the structure -- version 1 instances are still accepted,
+ *    and are treated as if H5C_repl__lru was selected.  The valid values
+ *    of this field are:
+ *
+ *    H5C_repl__lru: Evict the least recently used entry.  This is the
+ *    historical (and default) behavior of the cache.
+ *
+ *    H5C_repl__2q: Entries loaded into the cache start out "cold".  A
+ *    cold entry only becomes "hot" if it is evicted and then loaded
+ *    again shortly afterwards, which is detected with a bounded list of
+ *    the addresses of recently evicted entries.  While the cold entries
+ *    occupy more than a quarter of the cache, they are evicted before
+ *    any hot entry, so a one-time scan over a large number of objects
+ *    cannot flush the working set out of the cache.
+ *
+ *    H5C_repl__arc: As H5C_repl__2q, except that an entry becomes hot
+ *    on its first cache hit, and the share of the cache reserved for
+ *    cold entries adapts to the workload -- it grows when recently
+ *    evicted cold entries are reloaded, and shrinks when recently
+ *    evicted hot entries are reloaded.
+ *
+ *    Both 2Q and ARC are deterministic, and fall back to LRU order
+ *    when no cold entry can be evicted.
+ *
  ****************************************************************************/
 
-#define H5AC__CURR_CACHE_CONFIG_VERSION     1
+#define H5AC__CACHE_CONFIG_VERSION_1        1
+#define H5AC__CURR_CACHE_CONFIG_VERSION     2
 #define H5AC__MAX_TRACE_FILE_NAME_LEN        1024
 
 #define H5AC_METADATA_WRITE_STRATEGY__PROCESS_0_ONLY    0
@@ -503,6 +533,10 @@ typedef struct H5AC_cache_config_t
     size_t                   dirty_bytes_threshold;
     int                      metadata_write_strategy;
 
+
+    /* replacement policy configuration field (version 2 and later): */
+    enum H5C_cache_repl_policy repl_policy;
+
 } H5AC_cache_config_t;
 
 
@@ -120,7 +120,7 @@ const H5AC_class_t H5AC_BT2_INT[1] = {{
     H5AC_BT2_INT_ID,                    /* Metadata client ID */
     "v2 B-tree internal node",          /* Metadata client name (for debugging) */
     H5FD_MEM_BTREE,                     /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_CONCURRENT_SERIALIZE_FLAG, /* Client class behavior flags */
     H5B2__cache_int_get_initial_load_size, /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5B2__cache_int_verify_chksum,	/* 'verify_chksum' callback */
@@ -138,7 +138,7 @@ const H5AC_class_t H5AC_BT2_LEAF[1] = {{
     H5AC_BT2_LEAF_ID,                   /* Metadata client ID */
     "v2 B-tree leaf node",              /* Metadata client name (for debugging) */
     H5FD_MEM_BTREE,                     /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_CONCURRENT_SERIALIZE_FLAG, /* Client class behavior flags */
     H5B2__cache_leaf_get_initial_load_size, /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5B2__cache_leaf_verify_chksum,	/* 'verify_chksum' callback */
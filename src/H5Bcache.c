@@ -71,7 +71,7 @@ const H5AC_class_t H5AC_BT[1] = {{
     H5AC_BT_ID,                         /* Metadata client ID */
     "v1 B-tree",                        /* Metadata client name (for debugging) */
     H5FD_MEM_BTREE,                     /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_CONCURRENT_SERIALIZE_FLAG, /* Client class behavior flags */
     H5B__cache_get_initial_load_size,   /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     NULL,				/* 'verify_chksum' callback */
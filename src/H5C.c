@@ -101,6 +101,34 @@
 #define H5C_IMAGE_EXTRA_SPACE 0
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
+/* Entries are only serialized concurrently on flush when the library keeps
+ * a separate error stack for each thread and no unsynchronized allocation
+ * tracking is compiled in.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+#define H5C_FLUSH_THREADS
+#endif
+
+/* Largest write made by merging the images of adjacent entries on flush */
+#define H5C__FLUSH_MERGE_MAX_SIZE ((size_t)(4 * 1024 * 1024))
+
+/* Whether a dirty entry may be serialized and written in a flush batch of
+ * the ring being flushed: the entry must be one the flush would write
+ * (but not one of the entries flushed last), and not one whose writes
+ * are skipped.
+ */
+#define H5C__BATCH_ENTRY(entry_ptr, ring, flush_marked_entries)              \
+    ((entry_ptr)->ring == (ring) && !(entry_ptr)->is_protected &&            \
+     !(entry_ptr)->flush_me_last &&                                          \
+     (!(flush_marked_entries) || (entry_ptr)->flush_marker) &&               \
+     (((entry_ptr)->type->flags & H5C__CLASS_SKIP_WRITES) == 0))
+
+/* Memory type of the file space holding an entry */
+#define H5C__ENTRY_MEM_TYPE(cache_ptr, entry_ptr)                            \
+    ((entry_ptr)->prefetched ?                                               \
+     (cache_ptr)->class_table_ptr[(entry_ptr)->prefetch_type_id]->mem_type : \
+     (entry_ptr)->type->mem_type)
+
 
 /******************/
 /* Local Typedefs */
@@ -109,6 +137,18 @@
 /* Alias for pointer to cache entry, for use when allocating sequences of them */
 typedef H5C_cache_entry_t *H5C_cache_entry_ptr_t;
 
+#ifdef H5C_FLUSH_THREADS
+/* Information for each thread serializing a wave of entries on flush */
+typedef struct H5C_serialize_work_t {
+    const H5F_t *f;                     /* File the entries belong to */
+    H5C_cache_entry_t **ents;           /* Entries in the wave */
+    herr_t      *status;                /* Result of serializing each entry */
+    size_t      nents;                  /* # of entries in the wave */
+    size_t      first;                  /* First entry serialized by this thread */
+    size_t      stride;                 /* Stride between entries serialized by this thread */
+} H5C_serialize_work_t;
+#endif /* H5C_FLUSH_THREADS */
+
 
 /********************/
 /* Local Prototypes */
@@ -151,6 +191,15 @@ static herr_t H5C_flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flag
 
 static herr_t H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags);
 
+static herr_t H5C__flush_ring_batch(H5F_t *f, H5C_ring_t ring, unsigned flags);
+
+static herr_t H5C__serialize_wave(H5F_t *f, H5C_cache_entry_t **ents,
+    herr_t *status, size_t nents, unsigned nthreads);
+
+#ifdef H5C_FLUSH_THREADS
+static void *H5C__serialize_worker(void *_work);
+#endif /* H5C_FLUSH_THREADS */
+
 static void * H5C_load_entry(H5F_t *             f,
 #ifdef H5_HAVE_PARALLEL
                              hbool_t             coll_access,
@@ -163,6 +212,9 @@ static herr_t H5C__mark_flush_dep_dirty(H5C_cache_entry_t * entry);
 
 static herr_t H5C__mark_flush_dep_clean(H5C_cache_entry_t * entry);
 
+static void H5C__rp_ghost_add(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr);
+static void H5C__rp_ghost_check(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
+
 static herr_t H5C__serialize_ring(H5F_t *f, H5C_ring_t ring);
 static herr_t H5C__serialize_single_entry(H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_entry_t *entry_ptr);
@@ -320,8 +372,8 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
+    if(H5C__index_resize(cache_ptr, (size_t)H5C__HASH_TABLE_MIN_LEN) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "can't allocate cache index")
 
     cache_ptr->il_len				= 0;
     cache_ptr->il_size				= (size_t)0;
@@ -380,6 +432,18 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->dLRU_tail_ptr			= NULL;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
 
+    cache_ptr->repl_policy			= H5C_repl__lru;
+    cache_ptr->rp_hot_size			= (size_t)0;
+    cache_ptr->rp_clock				= 0;
+    cache_ptr->rp_cold_target			= (size_t)0;
+    for(i = 0; i < H5C__RP_GHOST_LIST_LEN; i++) {
+        cache_ptr->rp_ghost_addrs[i]		= HADDR_UNDEF;
+        cache_ptr->rp_ghost_hot[i]		= FALSE;
+    } /* end for */
+    cache_ptr->rp_ghost_next			= 0;
+    cache_ptr->rp_ghost_cold_len		= 0;
+    cache_ptr->rp_ghost_hot_len			= 0;
+
     cache_ptr->size_increase_possible		= FALSE;
     cache_ptr->flash_size_increase_possible     = FALSE;
     cache_ptr->flash_size_increase_threshold    = 0;
@@ -463,6 +527,12 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->num_entries_in_image	= 0;
     cache_ptr->image_entries		= NULL;
     cache_ptr->image_buffer		= NULL;
+    cache_ptr->image_block		= NULL;
+    cache_ptr->image_map		= NULL;
+    cache_ptr->image_map_len		= 0;
+    cache_ptr->num_pending_image_entries	= 0;
+    cache_ptr->pending_image_entries_left	= 0;
+    cache_ptr->pending_image_entries	= NULL;
 
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled		= FALSE;
@@ -495,6 +565,9 @@ done:
             if(cache_ptr->log_info != NULL)
                 H5MM_xfree(cache_ptr->log_info);
 
+            if(cache_ptr->index != NULL)
+                H5MM_xfree(cache_ptr->index);
+
             cache_ptr->magic = 0;
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         } /* end if */
@@ -503,6 +576,69 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_create() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__index_resize
+ *
+ * Purpose:     Replace the index of the cache with an empty table of
+ *		new_slots slots, and insert all the entries of the old
+ *		table (if any) into it.  new_slots must be a power of two,
+ *		and more than twice the number of entries in the cache.
+ *
+ *		Note that the entries are moved directly from slot to slot,
+ *		without updating the index statistics.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__index_resize(H5C_t *cache_ptr, size_t new_slots)
+{
+    H5C_index_slot_t *old_index;
+    size_t old_slots;
+    unsigned shift;
+    size_t u, k;
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(cache_ptr);
+    HDassert(new_slots >= H5C__HASH_TABLE_MIN_LEN);
+    HDassert(0 == (new_slots & (new_slots - 1)));
+    HDassert((size_t)cache_ptr->index_len < new_slots / 2);
+
+    old_index = cache_ptr->index;
+    old_slots = cache_ptr->index_slots;
+
+    if(NULL == (cache_ptr->index = (H5C_index_slot_t *)H5MM_malloc(new_slots * sizeof(H5C_index_slot_t)))) {
+        cache_ptr->index = old_index;
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache index")
+    } /* end if */
+    for(u = 0; u < new_slots; u++) {
+        cache_ptr->index[u].addr = HADDR_UNDEF;
+        cache_ptr->index[u].ptr = NULL;
+    } /* end for */
+
+    for(shift = 64; ((size_t)1 << (64 - shift)) < new_slots; shift--)
+        ;
+    cache_ptr->index_slots = new_slots;
+    cache_ptr->index_shift = shift;
+
+    for(u = 0; u < old_slots; u++)
+        if(old_index[u].ptr != NULL) {
+            k = H5C__HASH_FCN(cache_ptr, old_index[u].addr);
+            while(cache_ptr->index[k].ptr != NULL)
+                k = H5C__HASH_NEXT(cache_ptr, k);
+            cache_ptr->index[k] = old_index[u];
+        } /* end if */
+
+    H5MM_xfree(old_index);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__index_resize() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_def_auto_resize_rpt_fcn
@@ -857,6 +993,10 @@ H5C_dest(H5F_t * f)
         if(H5C__generate_cache_image(f, cache_ptr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "Can't generate metadata cache image")
 
+    /* Release the rest of a cache image loaded for a R/O open */
+    if(H5C__free_pending_image(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "Can't release metadata cache image")
+
     if(cache_ptr->slist_ptr != NULL) {
         H5SL_close(cache_ptr->slist_ptr);
         cache_ptr->slist_ptr = NULL;
@@ -870,6 +1010,8 @@ H5C_dest(H5F_t * f)
     if(cache_ptr->log_info != NULL)
         H5MM_xfree(cache_ptr->log_info);
 
+    cache_ptr->index = (H5C_index_slot_t *)H5MM_xfree(cache_ptr->index);
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -1353,11 +1495,12 @@ H5C_insert_entry(H5F_t *             f,
     entry_ptr->flush_dep_ndirty_children    = 0;
     entry_ptr->flush_dep_nunser_children    = 0;
 
-    entry_ptr->ht_next = NULL;
-    entry_ptr->ht_prev = NULL;
     entry_ptr->il_next = NULL;
     entry_ptr->il_prev = NULL;
 
+    entry_ptr->rp_hot = FALSE;
+    entry_ptr->rp_last_access = cache_ptr->rp_clock;
+
     entry_ptr->next = NULL;
     entry_ptr->prev = NULL;
 
@@ -2237,6 +2380,13 @@ H5C_protect(H5F_t *		f,
     /* first check to see if the target is in cache */
     H5C__SEARCH_INDEX(cache_ptr, addr, entry_ptr, NULL)
 
+    /* If not, check the entries of a cache image loaded for a R/O open,
+     * which only become prefetched entries when first protected.
+     */
+    if(entry_ptr == NULL && cache_ptr->pending_image_entries_left > 0)
+        if(H5C__prefetch_image_entry(cache_ptr, addr, &entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't prefetch entry from cache image")
+
     if(entry_ptr != NULL) {
         if(entry_ptr->ring != ring)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, NULL, "ring type mismatch occurred for cache entry")
@@ -2329,6 +2479,15 @@ H5C_protect(H5F_t *		f,
 }
 #endif
 
+        /* Under ARC, an entry becomes hot on its first hit that isn't
+         * part of a burst of protects by the same operation.
+         */
+        if(cache_ptr->repl_policy == H5C_repl__arc && !entry_ptr->rp_hot &&
+                (cache_ptr->rp_clock - entry_ptr->rp_last_access) > H5C__RP_CORRELATED_PROTECTS) {
+            entry_ptr->rp_hot = TRUE;
+            cache_ptr->rp_hot_size += entry_ptr->size;
+        } /* end if */
+
         hit = TRUE;
         thing = (void *)entry_ptr;
 
@@ -2459,6 +2618,13 @@ H5C_protect(H5F_t *		f,
          */
         entry_ptr->flush_me_last = flush_last;
 
+        /* Under 2Q and ARC, an entry that was evicted recently starts out
+         * hot.  As above, this must be settled before the entry is inserted
+         * in the index, which tracks the size of the hot entries.
+         */
+        if(cache_ptr->repl_policy != H5C_repl__lru)
+            H5C__rp_ghost_check(cache_ptr, entry_ptr);
+
         H5C__INSERT_IN_INDEX(cache_ptr, entry_ptr, NULL)
 
         if ( ( entry_ptr->is_dirty ) && ( ! (entry_ptr->in_slist) ) ) {
@@ -2502,7 +2668,9 @@ H5C_protect(H5F_t *		f,
     	entry_ptr->dirtied = FALSE;
     } /* end else */
 
-    H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit)
+    H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, entry_ptr, hit)
+
+    entry_ptr->rp_last_access = ++cache_ptr->rp_clock;
 
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
 
@@ -2626,6 +2794,8 @@ H5C_reset_cache_hit_rate_stats(H5C_t * cache_ptr)
 
     cache_ptr->cache_hits		= 0;
     cache_ptr->cache_accesses		= 0;
+    HDmemset(cache_ptr->type_hits, 0, sizeof(cache_ptr->type_hits));
+    HDmemset(cache_ptr->type_accesses, 0, sizeof(cache_ptr->type_accesses));
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2877,6 +3047,58 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_set_evictions_enabled() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_repl_policy()
+ *
+ * Purpose:     Set the replacement policy used to select the entries
+ *              evicted by H5C__make_space_in_cache().
+ *
+ *              Changing the policy forgets which entries are hot and
+ *              which entries were evicted recently, so that the new
+ *              policy starts from the same state as a freshly created
+ *              cache.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_repl_policy(H5C_t *cache_ptr, enum H5C_cache_repl_policy repl_policy)
+{
+    H5C_cache_entry_t *entry_ptr;
+    unsigned u;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry")
+    if((repl_policy != H5C_repl__lru) && (repl_policy != H5C_repl__2q) &&
+            (repl_policy != H5C_repl__arc))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Unknown replacement policy")
+
+    if(repl_policy != cache_ptr->repl_policy) {
+        for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+            entry_ptr->rp_hot = FALSE;
+        cache_ptr->rp_hot_size = (size_t)0;
+        cache_ptr->rp_cold_target = (size_t)0;
+
+        for(u = 0; u < H5C__RP_GHOST_LIST_LEN; u++) {
+            cache_ptr->rp_ghost_addrs[u] = HADDR_UNDEF;
+            cache_ptr->rp_ghost_hot[u] = FALSE;
+        } /* end for */
+        cache_ptr->rp_ghost_next = 0;
+        cache_ptr->rp_ghost_cold_len = 0;
+        cache_ptr->rp_ghost_hot_len = 0;
+
+        cache_ptr->repl_policy = repl_policy;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_repl_policy() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_unpin_entry()
@@ -5711,6 +5933,14 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
      */
     cache_ptr->slist_changed = FALSE;
 
+    /* Serialize and write as many of the ring's entries as possible in a
+     * batch first.  The loop below flushes whatever the batch leaves
+     * dirty one entry at a time.
+     */
+    if(H5C__flush_ring_batch(f, ring, flags) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't flush batch of entries")
+    cache_ptr->slist_changed = FALSE;
+
     while((cache_ptr->slist_ring_len[ring] > 0) &&
 	    (protected_entries == 0)  &&
 	    (flushed_entries_last_pass)) {
@@ -5889,6 +6119,388 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__flush_ring() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__flush_ring_batch
+ *
+ * Purpose:     Serialize and write the dirty entries of the specified
+ *              ring in a batch, as the first step of H5C__flush_ring.
+ *
+ *              Entries are serialized in waves: each wave holds the
+ *              entries whose flush dependency children are all
+ *              serialized.  The entries of a wave whose class allows it
+ *              are serialized concurrently, by the number of threads set
+ *              with H5Pset_mdc_flush_nthreads.  The others are serialized
+ *              one at a time on this thread, since their pre_serialize
+ *              and serialize callbacks may change other entries.
+ *
+ *              Once no more entries can be serialized, the images that
+ *              are up to date are written in address order, with the
+ *              images of adjacent entries merged into a single write of
+ *              up to H5C__FLUSH_MERGE_MAX_SIZE bytes.  The entries are
+ *              then marked clean, children before their flush dependency
+ *              parents, with H5C__flush_single_entry.
+ *
+ *              Entries whose images are written in any order here, so
+ *              files opened for SWMR writing, files with a page buffer,
+ *              parallel files and files generating a cache image are
+ *              left to the regular flush.  Any entry the batch doesn't
+ *              get to, or which is changed by a client callback while
+ *              the batch is made, is also left to the regular flush.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__flush_ring_batch(H5F_t *f, H5C_ring_t ring, unsigned flags)
+{
+    H5C_t              *cache_ptr = f->shared->cache;
+    hbool_t             flush_marked_entries;
+    H5C_cache_entry_t **ents = NULL;    /* Entries of the batch, in address order */
+    herr_t             *status = NULL;  /* Result of serializing each entry */
+    size_t              nalloc = 0;     /* # of entries the arrays can hold */
+    size_t              nents;          /* # of entries in the batch */
+    size_t              nserialized = 0; /* # of entries serialized in the batch */
+    size_t              max_serialized; /* Limit on the entries serialized in the batch */
+    uint8_t            *buf = NULL;     /* Buffer for merged images */
+    size_t              buf_size = 0;   /* Size of the buffer for merged images */
+    int64_t             removed_counter; /* Value of entries_removed_counter */
+    unsigned            nthreads = 1;   /* # of threads serializing entries */
+    hbool_t             progress;       /* Whether an entry was flushed in a pass */
+    H5SL_node_t        *node_ptr;
+    size_t              u, v;           /* Local index variables */
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->slist_ptr);
+    HDassert(cache_ptr->flush_in_progress);
+
+    flush_marked_entries = ((flags & H5C__FLUSH_MARKED_ENTRIES_FLAG) != 0);
+
+    /* Check for flushes the batch can't handle */
+    if((flags & H5C__FLUSH_CLEAR_ONLY_FLAG) || cache_ptr->slist_ring_len[ring] == 0
+            || (H5F_INTENT(f) & H5F_ACC_SWMR_WRITE) || f->shared->page_buf != NULL
+            || (cache_ptr->close_warning_received && cache_ptr->image_ctl.generate_image))
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    if(cache_ptr->aux_ptr != NULL)
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+#ifdef H5C_FLUSH_THREADS
+    nthreads = f->shared->mdc_flush_nthreads;
+#endif /* H5C_FLUSH_THREADS */
+
+    /* Client callbacks may keep dirtying entries that were already
+     * serialized, so bound the work done here and leave the rest to the
+     * regular flush.
+     */
+    max_serialized = 2 * (size_t)cache_ptr->slist_ring_len[ring];
+
+    /* Serialize the entries, a wave at a time */
+    while(nserialized < max_serialized) {
+        size_t nconc = 0;               /* # of entries serialized concurrently */
+
+        /* Make room for all dirty entries in the ring */
+        if(nalloc < cache_ptr->slist_ring_len[ring]) {
+            nalloc = cache_ptr->slist_ring_len[ring];
+            if(NULL == (ents = (H5C_cache_entry_t **)H5MM_realloc(ents, nalloc * sizeof(H5C_cache_entry_t *))))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for flush batch")
+            if(NULL == (status = (herr_t *)H5MM_realloc(status, nalloc * sizeof(herr_t))))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for flush batch")
+        } /* end if */
+
+        /* Collect the wave: entries whose children are serialized, with
+         * those that may be serialized concurrently first.
+         */
+        nents = 0;
+        for(node_ptr = H5SL_first(cache_ptr->slist_ptr); node_ptr != NULL; node_ptr = H5SL_next(node_ptr)) {
+            H5C_cache_entry_t *entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
+
+            HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+            HDassert(entry_ptr->is_dirty);
+
+            if(H5C__BATCH_ENTRY(entry_ptr, ring, flush_marked_entries)
+                    && !entry_ptr->image_up_to_date
+                    && entry_ptr->flush_dep_nunser_children == 0) {
+                HDassert(nents < nalloc);
+                HDassert(!entry_ptr->prefetched);
+
+                /* Allocate the image now, as in H5C__flush_single_entry */
+                if(NULL == entry_ptr->image_ptr) {
+                    if(NULL == (entry_ptr->image_ptr = H5MM_malloc(entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+                    H5MM_memcpy(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+                } /* end if */
+
+                if((entry_ptr->type->flags & H5C__CLASS_CONCURRENT_SERIALIZE_FLAG)
+                        && NULL == entry_ptr->type->pre_serialize) {
+                    if(nconc < nents)
+                        ents[nents] = ents[nconc];
+                    ents[nconc++] = entry_ptr;
+                } /* end if */
+                else
+                    ents[nents] = entry_ptr;
+                nents++;
+            } /* end if */
+        } /* end for */
+        if(0 == nents)
+            break;
+
+        /* Note changes made to the cache by client callbacks from here on */
+        cache_ptr->slist_changed = FALSE;
+        removed_counter = cache_ptr->entries_removed_counter;
+
+        /* Serialize the entries which don't touch other entries, and tell
+         * their flush dependency parents.
+         */
+        if(nconc > 0) {
+            if(H5C__serialize_wave(f, ents, status, nconc, nthreads) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTSERIALIZE, FAIL, "can't serialize entries")
+            nserialized += nconc;
+        } /* end if */
+
+        /* Serialize the other entries with their pre_serialize callbacks,
+         * one at a time.  Stop at any change to the set of dirty entries,
+         * as the rest of the wave may no longer be valid.
+         */
+        for(u = nconc; u < nents; u++) {
+            if(cache_ptr->slist_changed || cache_ptr->entries_removed_counter != removed_counter)
+                break;
+            if(ents[u]->image_up_to_date || ents[u]->is_protected || ents[u]->flush_dep_nunser_children > 0)
+                continue;
+
+            if(H5C__generate_image(f, cache_ptr, ents[u]) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTSERIALIZE, FAIL, "can't generate entry's image")
+            nserialized++;
+        } /* end for */
+    } /* end while */
+
+    /* Collect the entries whose images are ready to be written */
+    nents = 0;
+    for(node_ptr = H5SL_first(cache_ptr->slist_ptr); node_ptr != NULL; node_ptr = H5SL_next(node_ptr)) {
+        H5C_cache_entry_t *entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
+
+        if(H5C__BATCH_ENTRY(entry_ptr, ring, flush_marked_entries)
+                && entry_ptr->image_up_to_date
+                && entry_ptr->flush_dep_nunser_children == 0) {
+            HDassert(nents < nalloc);
+            ents[nents++] = entry_ptr;
+        } /* end if */
+    } /* end for */
+    if(0 == nents)
+        HGOTO_DONE(SUCCEED)
+
+    /* Write the images in address order, merging runs of adjacent images
+     * with the same memory type.  Nothing here calls back into the cache's
+     * clients.
+     */
+    for(u = 0; u < nents; u = v) {
+        H5FD_mem_t mem_type;            /* Memory type of the run */
+        haddr_t     end_addr;           /* End of the run in the file */
+        size_t      run_size;           /* Size of the run */
+
+        mem_type = H5C__ENTRY_MEM_TYPE(cache_ptr, ents[u]);
+        end_addr = ents[u]->addr + ents[u]->size;
+        run_size = ents[u]->size;
+        for(v = u + 1; v < nents; v++) {
+            if(H5F_addr_ne(ents[v]->addr, end_addr) || H5C__ENTRY_MEM_TYPE(cache_ptr, ents[v]) != mem_type
+                    || run_size + ents[v]->size > H5C__FLUSH_MERGE_MAX_SIZE)
+                break;
+            end_addr += ents[v]->size;
+            run_size += ents[v]->size;
+        } /* end for */
+
+        if(v - u == 1) {
+            if(H5F_block_write(f, mem_type, ents[u]->addr, ents[u]->size, ents[u]->image_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write image to file")
+        } /* end if */
+        else {
+            uint8_t *p;                 /* Pointer into the buffer for merged images */
+            size_t   w;                 /* Local index variable */
+
+            if(run_size > buf_size) {
+                if(NULL == (buf = (uint8_t *)H5MM_realloc(buf, run_size)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for merged images")
+                buf_size = run_size;
+            } /* end if */
+            for(w = u, p = buf; w < v; w++) {
+                H5MM_memcpy(p, ents[w]->image_ptr, ents[w]->size);
+                p += ents[w]->size;
+            } /* end for */
+            if(H5F_block_write(f, mem_type, ents[u]->addr, run_size, buf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write merged images to file")
+        } /* end else */
+    } /* end for */
+
+    /* Finish flushing the entries, children before their flush dependency
+     * parents.  Entries changed by client callbacks in the meantime are
+     * left dirty, to be written again by the regular flush.
+     */
+    cache_ptr->slist_changed = FALSE;
+    removed_counter = cache_ptr->entries_removed_counter;
+    do {
+        progress = FALSE;
+        for(u = 0; u < nents; u++) {
+            H5C_cache_entry_t *entry_ptr = ents[u];
+
+            if(NULL == entry_ptr)
+                continue;
+            if(cache_ptr->slist_changed || cache_ptr->entries_removed_counter != removed_counter)
+                HGOTO_DONE(SUCCEED)
+            if(!entry_ptr->image_up_to_date || entry_ptr->is_protected) {
+                ents[u] = NULL;
+                continue;
+            } /* end if */
+            if(entry_ptr->flush_dep_nchildren > 0 && entry_ptr->flush_dep_ndirty_children > 0)
+                continue;
+
+            if(H5C__flush_single_entry(f, entry_ptr, flags | H5C__DURING_FLUSH_FLAG | H5C__IMAGE_WRITTEN_FLAG) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't flush entry")
+            ents[u] = NULL;
+            progress = TRUE;
+        } /* end for */
+    } while(progress);
+
+done:
+    ents = (H5C_cache_entry_t **)H5MM_xfree(ents);
+    status = (herr_t *)H5MM_xfree(status);
+    buf = (uint8_t *)H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__flush_ring_batch() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__serialize_wave
+ *
+ * Purpose:     Serialize the entries of a flush batch whose classes have
+ *              H5C__CLASS_CONCURRENT_SERIALIZE_FLAG set and no
+ *              pre_serialize callback, with NTHREADS threads (including
+ *              the calling thread), and then propagate the fact that they
+ *              are serialized to their flush dependency parents.
+ *
+ *              The entries' image buffers must be allocated on entry.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__serialize_wave(H5F_t *f, H5C_cache_entry_t **ents, herr_t *status,
+    size_t nents, unsigned H5_ATTR_NDEBUG_UNUSED nthreads)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(ents);
+    HDassert(status);
+    HDassert(nthreads > 0);
+
+#ifdef H5C_FLUSH_THREADS
+    if(nthreads > 1 && nents > 1) {
+        H5C_serialize_work_t *work = NULL;      /* Work description for each thread */
+        H5TS_thread_t *threads = NULL;          /* Helper threads */
+        unsigned nworkers;                      /* # of threads, including this one */
+        unsigned v;                             /* Local index variable */
+
+        nworkers = (unsigned)MIN(nthreads, nents);
+        if(NULL == (work = (H5C_serialize_work_t *)H5MM_malloc(nworkers * sizeof(H5C_serialize_work_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for serialize work info")
+        if(NULL == (threads = (H5TS_thread_t *)H5MM_malloc(nworkers * sizeof(H5TS_thread_t)))) {
+            work = (H5C_serialize_work_t *)H5MM_xfree(work);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for serialize threads")
+        } /* end if */
+
+        /* Hand each thread every nworkers'th entry */
+        for(v = 0; v < nworkers; v++) {
+            work[v].f = f;
+            work[v].ents = ents;
+            work[v].status = status;
+            work[v].nents = nents;
+            work[v].first = v;
+            work[v].stride = nworkers;
+        } /* end for */
+
+        /* Serialize the first share on this thread while the others run */
+        for(v = 1; v < nworkers; v++)
+            threads[v] = H5TS_create_thread(H5C__serialize_worker, NULL, &work[v]);
+        H5C__serialize_worker(&work[0]);
+        for(v = 1; v < nworkers; v++)
+            H5TS_wait_for_thread(threads[v]);
+
+        threads = (H5TS_thread_t *)H5MM_xfree(threads);
+        work = (H5C_serialize_work_t *)H5MM_xfree(work);
+    } /* end if */
+    else
+#endif /* H5C_FLUSH_THREADS */
+        for(u = 0; u < nents; u++)
+            status[u] = ents[u]->type->serialize(f, ents[u]->image_ptr, ents[u]->size, (void *)ents[u]);
+
+    /* Check for failures, and finish as H5C__generate_image does */
+    for(u = 0; u < nents; u++) {
+        H5C_cache_entry_t *entry_ptr = ents[u];
+
+        if(status[u] < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to serialize entry")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+        HDassert(0 == HDmemcmp(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE));
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+        entry_ptr->image_up_to_date = TRUE;
+
+        HDassert(entry_ptr->flush_dep_nunser_children == 0);
+        if(entry_ptr->flush_dep_nparents > 0)
+            if(H5C__mark_flush_dep_serialized(entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTNOTIFY, FAIL, "Can't propagate serialization status to fd parents")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__serialize_wave() */
+
+#ifdef H5C_FLUSH_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_worker
+ *
+ * Purpose:     Serialize this thread's share of a wave of entries.  Errors
+ *              are recorded in each entry's status and reported by the
+ *              thread that started the wave.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5C__serialize_worker(void *_work)
+{
+    H5C_serialize_work_t *work = (H5C_serialize_work_t *)_work;
+    size_t u;                   /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = work->first; u < work->nents; u += work->stride) {
+        H5C_cache_entry_t *entry_ptr = work->ents[u];
+
+        work->status[u] = entry_ptr->type->serialize(work->f, entry_ptr->image_ptr, entry_ptr->size, (void *)entry_ptr);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* H5C__serialize_worker() */
+#endif /* H5C_FLUSH_THREADS */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -5937,6 +6549,7 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
     hbool_t		destroy_entry;		/* internal flag */
     hbool_t		generate_image;		/* internal flag */
     hbool_t		update_page_buffer;	/* internal flag */
+    hbool_t		image_written;		/* internal flag */
     hbool_t		was_dirty;
     hbool_t		suppress_image_entry_writes = FALSE;
     hbool_t		suppress_image_entry_frees = FALSE;
@@ -5963,6 +6576,7 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
     during_flush           = ((flags & H5C__DURING_FLUSH_FLAG) != 0);
     generate_image         = ((flags & H5C__GENERATE_IMAGE_FLAG) != 0);
     update_page_buffer     = ((flags & H5C__UPDATE_PAGE_BUFFER_FLAG) != 0);
+    image_written          = ((flags & H5C__IMAGE_WRITTEN_FLAG) != 0);
 
     /* Set the flag for destroying the entry, based on the 'take ownership'
      * and 'destroy' flags
@@ -6083,8 +6697,12 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
          * entry_ptr->include_in_image are TRUE, or if the
          * H5AC__CLASS_SKIP_WRITES is set in the entry's type.  This
          * flag should only be used in test code
+         *
+         * The image has already been written if the entry was flushed
+         * in a batch (see H5C__flush_ring_batch).
          */
-        if((!suppress_image_entry_writes || !entry_ptr->include_in_image)
+        HDassert(!image_written || entry_ptr->image_up_to_date);
+        if(!image_written && (!suppress_image_entry_writes || !entry_ptr->include_in_image)
                 && (((entry_ptr->type->flags) & H5C__CLASS_SKIP_WRITES) == 0)) {
             H5FD_mem_t mem_type = H5FD_MEM_DEFAULT;
 
@@ -6758,13 +7376,13 @@ H5C_load_entry(H5F_t *              f,
     entry->flush_dep_nchildren          = 0;
     entry->flush_dep_ndirty_children    = 0;
     entry->flush_dep_nunser_children    = 0;
-    entry->ht_next                      = NULL;
-    entry->ht_prev                      = NULL;
     entry->il_next                      = NULL;
     entry->il_prev             	        = NULL;
 
     entry->next                         = NULL;
     entry->prev                         = NULL;
+    entry->rp_hot                       = FALSE;
+    entry->rp_last_access               = 0;
 
 #if H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS
     entry->aux_next                     = NULL;
@@ -6814,6 +7432,120 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_load_entry() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__rp_ghost_add
+ *
+ * Purpose:     Remember the address of an entry that is about to be
+ *		evicted by the 2Q or ARC replacement policies, overwriting
+ *		the oldest address remembered if necessary.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__rp_ghost_add(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr)
+{
+    uint32_t slot = cache_ptr->rp_ghost_next;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache_ptr->repl_policy != H5C_repl__lru);
+    HDassert(slot < H5C__RP_GHOST_LIST_LEN);
+
+    if(H5F_addr_defined(cache_ptr->rp_ghost_addrs[slot])) {
+        if(cache_ptr->rp_ghost_hot[slot])
+            cache_ptr->rp_ghost_hot_len--;
+        else
+            cache_ptr->rp_ghost_cold_len--;
+    } /* end if */
+
+    cache_ptr->rp_ghost_addrs[slot] = entry_ptr->addr;
+    cache_ptr->rp_ghost_hot[slot] = entry_ptr->rp_hot;
+    if(entry_ptr->rp_hot)
+        cache_ptr->rp_ghost_hot_len++;
+    else
+        cache_ptr->rp_ghost_cold_len++;
+
+    cache_ptr->rp_ghost_next = (slot + 1) % H5C__RP_GHOST_LIST_LEN;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__rp_ghost_add() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__rp_ghost_check
+ *
+ * Purpose:     Check whether an entry that is being loaded into the
+ *		cache was evicted recently under the 2Q or ARC replacement
+ *		policies.  If so, forget the eviction and mark the entry hot.
+ *
+ *		Under ARC, also adapt the share of the cache reserved for
+ *		cold entries: a reloaded cold entry shows that the cold
+ *		entries are evicted too early, and a reloaded hot entry
+ *		that the hot ones are.  As in the original algorithm, the
+ *		adjustment is scaled by the ratio of the numbers of hot and
+ *		cold evictions remembered.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__rp_ghost_check(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
+{
+    unsigned u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache_ptr->repl_policy != H5C_repl__lru);
+    HDassert(!entry_ptr->rp_hot);
+
+    for(u = 0; u < H5C__RP_GHOST_LIST_LEN; u++)
+        if(H5F_addr_eq(cache_ptr->rp_ghost_addrs[u], entry_ptr->addr)) {
+            if(cache_ptr->rp_ghost_hot[u]) {
+                HDassert(cache_ptr->rp_ghost_hot_len > 0);
+
+                if(cache_ptr->repl_policy == H5C_repl__arc) {
+                    size_t delta = entry_ptr->size;
+
+                    if(cache_ptr->rp_ghost_cold_len > cache_ptr->rp_ghost_hot_len)
+                        delta *= cache_ptr->rp_ghost_cold_len / cache_ptr->rp_ghost_hot_len;
+                    if(cache_ptr->rp_cold_target > delta)
+                        cache_ptr->rp_cold_target -= delta;
+                    else
+                        cache_ptr->rp_cold_target = 0;
+                } /* end if */
+
+                cache_ptr->rp_ghost_hot_len--;
+            } /* end if */
+            else {
+                HDassert(cache_ptr->rp_ghost_cold_len > 0);
+
+                if(cache_ptr->repl_policy == H5C_repl__arc) {
+                    size_t delta = entry_ptr->size;
+
+                    if(cache_ptr->rp_ghost_hot_len > cache_ptr->rp_ghost_cold_len)
+                        delta *= cache_ptr->rp_ghost_hot_len / cache_ptr->rp_ghost_cold_len;
+                    cache_ptr->rp_cold_target += delta;
+                    if(cache_ptr->rp_cold_target > cache_ptr->max_cache_size)
+                        cache_ptr->rp_cold_target = cache_ptr->max_cache_size;
+                } /* end if */
+
+                cache_ptr->rp_ghost_cold_len--;
+            } /* end else */
+
+            cache_ptr->rp_ghost_addrs[u] = HADDR_UNDEF;
+            entry_ptr->rp_hot = TRUE;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__rp_ghost_check() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -6863,6 +7595,9 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
     H5C_cache_entry_t *	prev_ptr;
     H5C_cache_entry_t *	next_ptr;
     uint32_t 		num_corked_entries = 0;
+    size_t		cold_target = 0;
+    hbool_t		skip_hot = FALSE;
+    hbool_t		hot_entries_skipped = FALSE;
     herr_t		ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -6885,6 +7620,18 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 
     cache_ptr->msic_in_progress = TRUE;
 
+    /* Under 2Q and ARC, spare the hot entries while the cold entries
+     * occupy more than their share of the cache.
+     */
+    if(cache_ptr->repl_policy == H5C_repl__2q) {
+        skip_hot = TRUE;
+        cold_target = cache_ptr->max_cache_size / H5C__RP_2Q_COLD_FRACTION;
+    } /* end if */
+    else if(cache_ptr->repl_policy == H5C_repl__arc) {
+        skip_hot = TRUE;
+        cold_target = cache_ptr->rp_cold_target;
+    } /* end else-if */
+
     if ( write_permitted ) {
         restart_scan = FALSE;
         initial_list_len = cache_ptr->LRU_list_len;
@@ -6923,7 +7670,17 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 	    if(prev_ptr != NULL)
 		prev_is_dirty = prev_ptr->is_dirty;
 
-	    if(entry_ptr->is_dirty &&
+            HDassert(cache_ptr->rp_hot_size <= cache_ptr->index_size);
+
+            if ( ( skip_hot ) && ( entry_ptr->rp_hot ) &&
+                 ( (cache_ptr->index_size - cache_ptr->rp_hot_size) >
+                   cold_target ) ) {
+
+                /* Skip hot entries while there are too many cold ones */
+                hot_entries_skipped = TRUE;
+                didnt_flush_entry = TRUE;
+
+	    } else if(entry_ptr->is_dirty &&
                     (entry_ptr->tag_info && entry_ptr->tag_info->corked)) {
 
                 /* Skip "dirty" corked entries.  */
@@ -6975,6 +7732,9 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
+                    if(cache_ptr->repl_policy != H5C_repl__lru)
+                        H5C__rp_ghost_add(cache_ptr, entry_ptr);
+
                     if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
                 } else {
@@ -7037,6 +7797,17 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 		    entry_ptr = prev_ptr;
 
 		}
+	    } else if ( hot_entries_skipped ) {
+
+                /* the cold entries alone couldn't free enough space --
+                 * scan the LRU again, this time without sparing the
+                 * hot entries.
+                 */
+                skip_hot = FALSE;
+                hot_entries_skipped = FALSE;
+                entries_examined = 0;
+                entry_ptr = cache_ptr->LRU_tail_ptr;
+
 	    } else {
 
 		entry_ptr = NULL;
@@ -7124,11 +7895,21 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 
             prev_ptr = entry_ptr->aux_prev;
 
-            if ( ( !(entry_ptr->prefetched_dirty) )
+            if ( ( skip_hot ) && ( entry_ptr->rp_hot ) &&
+                 ( (cache_ptr->index_size - cache_ptr->rp_hot_size) >
+                   cold_target ) ) {
+
+                /* Skip hot entries while there are too many cold ones */
+                hot_entries_skipped = TRUE;
+
+            } else if ( ( !(entry_ptr->prefetched_dirty) )
 #ifdef H5_HAVE_PARALLEL
                  && ( ! (entry_ptr->coll_access) )
 #endif /* H5_HAVE_PARALLEL */
                ) {
+                if(cache_ptr->repl_policy != H5C_repl__lru)
+                    H5C__rp_ghost_add(cache_ptr, entry_ptr);
+
                 if(H5C__flush_single_entry(f, entry_ptr,
                         H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
@@ -7141,8 +7922,23 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 	     * this function.
 	     */
 
-            entry_ptr = prev_ptr;
-	    entries_examined++;
+            if ( ( prev_ptr == NULL ) && ( hot_entries_skipped ) ) {
+
+                /* the cold entries alone couldn't free enough space --
+                 * scan the clean LRU again without sparing the hot entries.
+                 */
+                skip_hot = FALSE;
+                hot_entries_skipped = FALSE;
+                entries_examined = 0;
+                initial_list_len = cache_ptr->cLRU_list_len;
+                entry_ptr = cache_ptr->cLRU_tail_ptr;
+
+            } else {
+
+                entry_ptr = prev_ptr;
+	        entries_examined++;
+
+            }
         }
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
     }
@@ -73,7 +73,7 @@
             HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, (FAILVAL), "can't get property list")
 
 /* Common macro for the duplicated code to retrieve properties from a property list */
-#define H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_NAME, PROP_FIELD)          \
+#define H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_SLOT, PROP_FIELD)          \
     /* Check for default property list */                                     \
     if((*head)->ctx.H5_GLUE(PL,_id) == (DEF_PL))                              \
         H5MM_memcpy(&(*head)->ctx.PROP_FIELD, &H5_GLUE3(H5CX_def_,PL,_cache).PROP_FIELD, sizeof(H5_GLUE3(H5CX_def_,PL,_cache).PROP_FIELD)); \
@@ -82,7 +82,7 @@
         H5CX_RETRIEVE_PLIST(PL, FAIL)                                         \
                                                                               \
         /* Get the property */                                                \
-        if(H5P_get((*head)->ctx.PL, (PROP_NAME), &(*head)->ctx.PROP_FIELD) < 0) \
+        if(H5P_get_slot((*head)->ctx.PL, (PROP_SLOT), &(*head)->ctx.PROP_FIELD) < 0) \
             HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "can't retrieve value from API context") \
     } /* end else */                                                          \
                                                                               \
@@ -90,18 +90,18 @@
     (*head)->ctx.H5_GLUE(PROP_FIELD,_valid) = TRUE;
 
 /* Macro for the duplicated code to retrieve properties from a property list */
-#define H5CX_RETRIEVE_PROP_VALID(PL, DEF_PL, PROP_NAME, PROP_FIELD)           \
+#define H5CX_RETRIEVE_PROP_VALID(PL, DEF_PL, PROP_SLOT, PROP_FIELD)           \
     /* Check if the value has been retrieved already */                       \
     if(!(*head)->ctx.H5_GLUE(PROP_FIELD,_valid)) {                            \
-        H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_NAME, PROP_FIELD)          \
+        H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_SLOT, PROP_FIELD)          \
     } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
 /* Macro for the duplicated code to retrieve possibly set properties from a property list */
-#define H5CX_RETRIEVE_PROP_VALID_SET(PL, DEF_PL, PROP_NAME, PROP_FIELD)       \
+#define H5CX_RETRIEVE_PROP_VALID_SET(PL, DEF_PL, PROP_SLOT, PROP_FIELD)       \
     /* Check if the value has been retrieved already */                       \
     if(!((*head)->ctx.H5_GLUE(PROP_FIELD,_valid) || (*head)->ctx.H5_GLUE(PROP_FIELD,_set))) { \
-        H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_NAME, PROP_FIELD)          \
+        H5CX_RETRIEVE_PROP_COMMON(PL, DEF_PL, PROP_SLOT, PROP_FIELD)          \
     } /* end if */
 #endif /* H5_HAVE_PARALLEL */
 
@@ -209,6 +209,9 @@ typedef struct H5CX_t {
     /* Internal: Metadata cache info */
     H5AC_ring_t ring;           /* Current metadata cache ring for entries */
 
+    /* Internal: Raw data read info */
+    hbool_t unlocked_read;      /* Whether a dataset read may read raw data without the API lock */
+
 #ifdef H5_HAVE_PARALLEL
     /* Internal: Parallel I/O settings */
     hbool_t coll_metadata_read; /* Whether to use collective I/O for metadata read */
@@ -247,6 +250,10 @@ typedef struct H5CX_t {
     hbool_t err_detect_valid;   /* Whether error detection info is valid */
     H5Z_cb_t filter_cb;         /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
     hbool_t filter_cb_valid;    /* Whether filter callback function is valid */
+    unsigned filter_nthreads;   /* # of threads for chunk filter pipeline (H5D_XFER_FILTER_NTHREADS_NAME) */
+    hbool_t filter_nthreads_valid; /* Whether filter pipeline thread count is valid */
+    size_t chunk_read_gap;      /* Largest gap between merged chunk reads (H5D_XFER_CHUNK_READ_GAP_NAME) */
+    hbool_t chunk_read_gap_valid; /* Whether chunk read merge gap is valid */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     hbool_t data_transform_valid; /* Whether data transform info is valid */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
@@ -355,6 +362,8 @@ typedef struct H5CX_dxpl_cache_t {
 #endif /* H5_HAVE_PARALLEL */
     H5Z_EDC_t err_detect;           /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    unsigned filter_nthreads;       /* # of threads for chunk filter pipeline (H5D_XFER_FILTER_NTHREADS_NAME) */
+    size_t chunk_read_gap;          /* Largest gap between merged chunk reads (H5D_XFER_CHUNK_READ_GAP_NAME) */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t dt_conv_cb;       /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
@@ -530,6 +539,14 @@ H5CX__init_package(void)
     if(H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &H5CX_def_dxpl_cache.filter_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
 
+    /* Get filter pipeline thread count */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &H5CX_def_dxpl_cache.filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter pipeline thread count")
+
+    /* Get chunk read merge gap */
+    if(H5P_get(dx_plist, H5D_XFER_CHUNK_READ_GAP_NAME, &H5CX_def_dxpl_cache.chunk_read_gap) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk read merge gap")
+
     /* Look at the data transform property */
     /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
      *          to copy it and free this in the H5CX terminate routine. -QAK)
@@ -1347,7 +1364,7 @@ H5CX_set_apl(hid_t *acspl_id, const H5P_libclass_t *libclass,
                 HGOTO_ERROR(H5E_CONTEXT, H5E_BADATOM, FAIL, "can't find object for ID")
 
             /* Get the collective metadata read flag */
-            if(H5P_peek(plist, H5_COLL_MD_READ_FLAG_NAME, &md_coll_read) < 0)
+            if(H5P_peek_slot(plist, H5P_SLOT_COLL_MD_READ_FLAG, &md_coll_read) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "can't get core collective metadata read flag")
 
             /* If collective metadata read requested, set collective metadata read flag */
@@ -1693,6 +1710,30 @@ H5CX_get_ring(void)
     FUNC_LEAVE_NOAPI((*head)->ctx.ring)
 } /* end H5CX_get_ring() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_unlocked_read
+ *
+ * Purpose:     Retrieves the "read raw data without the API lock" flag
+ *              for the current API call context.
+ *
+ * Return:      TRUE / FALSE on success / <can't fail>
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5CX_get_unlocked_read(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.unlocked_read)
+} /* end H5CX_get_unlocked_read() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -1835,7 +1876,7 @@ H5CX_get_btree_split_ratios(double split_ratio[3])
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BTREE_SPLIT_RATIO_NAME, btree_split_ratio)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_BTREE_SPLIT_RATIO, btree_split_ratio)
 
     /* Get the B-tree split ratio values */
     H5MM_memcpy(split_ratio, &(*head)->ctx.btree_split_ratio, sizeof((*head)->ctx.btree_split_ratio));
@@ -1870,7 +1911,7 @@ H5CX_get_max_temp_buf(size_t *max_temp_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MAX_TEMP_BUF_NAME, max_temp_buf)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MAX_TEMP_BUF, max_temp_buf)
 
     /* Get the value */
     *max_temp_buf = (*head)->ctx.max_temp_buf;
@@ -1905,7 +1946,7 @@ H5CX_get_tconv_buf(void **tconv_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_TCONV_BUF_NAME, tconv_buf)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_TCONV_BUF, tconv_buf)
 
     /* Get the value */
     *tconv_buf = (*head)->ctx.tconv_buf;
@@ -1940,7 +1981,7 @@ H5CX_get_bkgr_buf(void **bkgr_buf)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BKGR_BUF_NAME, bkgr_buf)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_BKGR_BUF, bkgr_buf)
 
     /* Get the value */
     *bkgr_buf = (*head)->ctx.bkgr_buf;
@@ -1975,7 +2016,7 @@ H5CX_get_bkgr_buf_type(H5T_bkg_t *bkgr_buf_type)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_BKGR_BUF_TYPE_NAME, bkgr_buf_type)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_BKGR_BUF_TYPE, bkgr_buf_type)
 
     /* Get the value */
     *bkgr_buf_type = (*head)->ctx.bkgr_buf_type;
@@ -2010,7 +2051,7 @@ H5CX_get_vec_size(size_t *vec_size)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_HYPER_VECTOR_SIZE_NAME, vec_size)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_HYPER_VECTOR_SIZE, vec_size)
 
     /* Get the value */
     *vec_size = (*head)->ctx.vec_size;
@@ -2046,7 +2087,7 @@ H5CX_get_io_xfer_mode(H5FD_mpio_xfer_t *io_xfer_mode)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_IO_XFER_MODE_NAME, io_xfer_mode)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_IO_XFER_MODE, io_xfer_mode)
 
     /* Get the value */
     *io_xfer_mode = (*head)->ctx.io_xfer_mode;
@@ -2081,7 +2122,7 @@ H5CX_get_mpio_coll_opt(H5FD_mpio_collective_opt_t *mpio_coll_opt)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_COLLECTIVE_OPT_NAME, mpio_coll_opt)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_COLLECTIVE_OPT, mpio_coll_opt)
 
     /* Get the value */
     *mpio_coll_opt = (*head)->ctx.mpio_coll_opt;
@@ -2116,7 +2157,7 @@ H5CX_get_mpio_local_no_coll_cause(uint32_t *mpio_local_no_coll_cause)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID_SET(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, mpio_local_no_coll_cause)
+    H5CX_RETRIEVE_PROP_VALID_SET(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_LOCAL_NO_COLL_CAUSE, mpio_local_no_coll_cause)
 
     /* Get the value */
     *mpio_local_no_coll_cause = (*head)->ctx.mpio_local_no_coll_cause;
@@ -2151,7 +2192,7 @@ H5CX_get_mpio_global_no_coll_cause(uint32_t *mpio_global_no_coll_cause)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID_SET(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME, mpio_global_no_coll_cause)
+    H5CX_RETRIEVE_PROP_VALID_SET(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_GLOBAL_NO_COLL_CAUSE, mpio_global_no_coll_cause)
 
     /* Get the value */
     *mpio_global_no_coll_cause = (*head)->ctx.mpio_global_no_coll_cause;
@@ -2186,7 +2227,7 @@ H5CX_get_mpio_chunk_opt_mode(H5FD_mpio_chunk_opt_t *mpio_chunk_opt_mode)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME, mpio_chunk_opt_mode)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_CHUNK_OPT_HARD, mpio_chunk_opt_mode)
 
     /* Get the value */
     *mpio_chunk_opt_mode = (*head)->ctx.mpio_chunk_opt_mode;
@@ -2221,7 +2262,7 @@ H5CX_get_mpio_chunk_opt_num(unsigned *mpio_chunk_opt_num)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME, mpio_chunk_opt_num)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_CHUNK_OPT_NUM, mpio_chunk_opt_num)
 
     /* Get the value */
     *mpio_chunk_opt_num = (*head)->ctx.mpio_chunk_opt_num;
@@ -2256,7 +2297,7 @@ H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, mpio_chunk_opt_ratio)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_MPIO_CHUNK_OPT_RATIO, mpio_chunk_opt_ratio)
 
     /* Get the value */
     *mpio_chunk_opt_ratio = (*head)->ctx.mpio_chunk_opt_ratio;
@@ -2292,7 +2333,7 @@ H5CX_get_err_detect(H5Z_EDC_t *err_detect)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_EDC_NAME, err_detect)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_EDC, err_detect)
 
     /* Get the value */
     *err_detect = (*head)->ctx.err_detect;
@@ -2327,7 +2368,7 @@ H5CX_get_filter_cb(H5Z_cb_t *filter_cb)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_CB_NAME, filter_cb)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_FILTER_CB, filter_cb)
 
     /* Get the value */
     *filter_cb = (*head)->ctx.filter_cb;
@@ -2336,6 +2377,72 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_filter_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_nthreads
+ *
+ * Purpose:     Retrieves the number of threads to use for the chunk filter
+ *              pipeline for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_nthreads(unsigned *filter_nthreads)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_nthreads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_FILTER_NTHREADS, filter_nthreads)
+
+    /* Get the value */
+    *filter_nthreads = (*head)->ctx.filter_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_chunk_read_gap
+ *
+ * Purpose:     Retrieves the largest gap between chunks that are merged
+ *              into one read for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_chunk_read_gap(size_t *chunk_read_gap)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(chunk_read_gap);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_CHUNK_READ_GAP, chunk_read_gap)
+
+    /* Get the value */
+    *chunk_read_gap = (*head)->ctx.chunk_read_gap;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_chunk_read_gap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_data_transform
@@ -2378,7 +2485,7 @@ H5CX_get_data_transform(H5Z_data_xform_t **data_transform)
             /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
              *          to copy it and free this in the H5CX pop routine. -QAK)
              */
-            if(H5P_peek((*head)->ctx.dxpl, H5D_XFER_XFORM_NAME, &(*head)->ctx.data_transform) < 0)
+            if(H5P_peek_slot((*head)->ctx.dxpl, H5P_SLOT_DXFR_XFORM, &(*head)->ctx.data_transform) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
         } /* end else */
 
@@ -2432,13 +2539,13 @@ H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info)
                     HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, FAIL, "can't get default dataset transfer property list")
 
             /* Get VL datatype alloc info values */
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_ALLOC_NAME, &(*head)->ctx.vl_alloc_info.alloc_func) < 0)
+            if(H5P_get_slot((*head)->ctx.dxpl, H5P_SLOT_DXFR_VLEN_ALLOC, &(*head)->ctx.vl_alloc_info.alloc_func) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_ALLOC_INFO_NAME, &(*head)->ctx.vl_alloc_info.alloc_info) < 0)
+            if(H5P_get_slot((*head)->ctx.dxpl, H5P_SLOT_DXFR_VLEN_ALLOC_INFO, &(*head)->ctx.vl_alloc_info.alloc_info) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_FREE_NAME, &(*head)->ctx.vl_alloc_info.free_func) < 0)
+            if(H5P_get_slot((*head)->ctx.dxpl, H5P_SLOT_DXFR_VLEN_FREE, &(*head)->ctx.vl_alloc_info.free_func) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
-            if(H5P_get((*head)->ctx.dxpl, H5D_XFER_VLEN_FREE_INFO_NAME, &(*head)->ctx.vl_alloc_info.free_info) < 0)
+            if(H5P_get_slot((*head)->ctx.dxpl, H5P_SLOT_DXFR_VLEN_FREE_INFO, &(*head)->ctx.vl_alloc_info.free_info) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
         } /* end else */
 
@@ -2479,7 +2586,7 @@ H5CX_get_dt_conv_cb(H5T_conv_cb_t *dt_conv_cb)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_CB_NAME, dt_conv_cb)
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5P_SLOT_DXFR_CONV_CB, dt_conv_cb)
 
     /* Get the value */
     *dt_conv_cb = (*head)->ctx.dt_conv_cb;
@@ -2514,7 +2621,7 @@ H5CX_get_encoding(H5T_cset_t* encoding)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.lcpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(lcpl, H5P_LINK_CREATE_DEFAULT, H5P_STRCRT_CHAR_ENCODING_NAME, encoding)
+    H5CX_RETRIEVE_PROP_VALID(lcpl, H5P_LINK_CREATE_DEFAULT, H5P_SLOT_STRCRT_CHAR_ENCODING, encoding)
 
     /* Get the value */
     *encoding = (*head)->ctx.encoding;
@@ -2549,7 +2656,7 @@ H5CX_get_intermediate_group(unsigned* crt_intermed_group)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.lcpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(lcpl, H5P_LINK_CREATE_DEFAULT, H5L_CRT_INTERMEDIATE_GROUP_NAME, intermediate_group)
+    H5CX_RETRIEVE_PROP_VALID(lcpl, H5P_LINK_CREATE_DEFAULT, H5P_SLOT_LCRT_INTERMEDIATE_GROUP, intermediate_group)
 
     /* Get the value */
     *crt_intermed_group = (*head)->ctx.intermediate_group;
@@ -2584,7 +2691,7 @@ H5CX_get_nlinks(size_t *nlinks)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(lapl, H5P_LINK_ACCESS_DEFAULT, H5L_ACS_NLINKS_NAME, nlinks)
+    H5CX_RETRIEVE_PROP_VALID(lapl, H5P_LINK_ACCESS_DEFAULT, H5P_SLOT_LACS_NLINKS, nlinks)
 
     /* Get the value */
     *nlinks = (*head)->ctx.nlinks;
@@ -2619,8 +2726,8 @@ H5CX_get_libver_bounds(H5F_libver_t *low_bound, H5F_libver_t *high_bound)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.fapl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(fapl, H5P_FILE_ACCESS_DEFAULT, H5F_ACS_LIBVER_LOW_BOUND_NAME, low_bound)
-    H5CX_RETRIEVE_PROP_VALID(fapl, H5P_FILE_ACCESS_DEFAULT, H5F_ACS_LIBVER_HIGH_BOUND_NAME, high_bound)
+    H5CX_RETRIEVE_PROP_VALID(fapl, H5P_FILE_ACCESS_DEFAULT, H5P_SLOT_FACS_LIBVER_LOW_BOUND, low_bound)
+    H5CX_RETRIEVE_PROP_VALID(fapl, H5P_FILE_ACCESS_DEFAULT, H5P_SLOT_FACS_LIBVER_HIGH_BOUND, high_bound)
 
     /* Get the values */
     *low_bound = (*head)->ctx.low_bound;
@@ -2657,7 +2764,7 @@ H5CX_get_dset_min_ohdr_flag(hbool_t *dset_min_ohdr_flag)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dcpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dcpl, H5P_DATASET_CREATE_DEFAULT, H5D_CRT_MIN_DSET_HDR_SIZE_NAME, do_min_dset_ohdr)
+    H5CX_RETRIEVE_PROP_VALID(dcpl, H5P_DATASET_CREATE_DEFAULT, H5P_SLOT_DCRT_MIN_DSET_HDR_SIZE, do_min_dset_ohdr)
 
     /* Get the value */
     *dset_min_ohdr_flag = (*head)->ctx.do_min_dset_ohdr;
@@ -2708,7 +2815,7 @@ H5CX_get_ext_file_prefix(const char **extfile_prefix)
             /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
              *          to copy it and free this in the H5CX pop routine. -QAK)
              */
-            if(H5P_peek((*head)->ctx.dapl, H5D_ACS_EFILE_PREFIX_NAME, &(*head)->ctx.extfile_prefix) < 0)
+            if(H5P_peek_slot((*head)->ctx.dapl, H5P_SLOT_DACS_EFILE_PREFIX, &(*head)->ctx.extfile_prefix) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve external file prefix")
         } /* end else */
 
@@ -2765,7 +2872,7 @@ H5CX_get_vds_prefix(const char **vds_prefix)
             /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
              *          to copy it and free this in the H5CX pop routine. -QAK)
              */
-            if(H5P_peek((*head)->ctx.dapl, H5D_ACS_VDS_PREFIX_NAME, &(*head)->ctx.vds_prefix) < 0)
+            if(H5P_peek_slot((*head)->ctx.dapl, H5P_SLOT_DACS_VDS_PREFIX, &(*head)->ctx.vds_prefix) < 0)
                 HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VDS prefix")
         } /* end else */
 
@@ -2836,6 +2943,32 @@ H5CX_set_ring(H5AC_ring_t ring)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_ring() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_unlocked_read
+ *
+ * Purpose:     Sets the "read raw data without the API lock" flag for the
+ *              current API call context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_unlocked_read(hbool_t unlocked_read)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.unlocked_read = unlocked_read;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_unlocked_read() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -3497,7 +3630,7 @@ H5CX_get_ohdr_flags(uint8_t *ohdr_flags)
     HDassert(head && *head);
     HDassert(H5P_DEFAULT != (*head)->ctx.dcpl_id);
 
-    H5CX_RETRIEVE_PROP_VALID(dcpl, H5P_DATASET_CREATE_DEFAULT, H5O_CRT_OHDR_FLAGS_NAME, ohdr_flags)
+    H5CX_RETRIEVE_PROP_VALID(dcpl, H5P_DATASET_CREATE_DEFAULT, H5P_SLOT_OCRT_OHDR_FLAGS, ohdr_flags)
 
     /* Get the value */
     *ohdr_flags = (*head)->ctx.ohdr_flags;
@@ -96,6 +96,7 @@ H5_DLL herr_t H5CX_get_vol_wrap_ctx(void **wrap_ctx);
 H5_DLL herr_t H5CX_get_vol_connector_prop(H5VL_connector_prop_t *vol_connector_prop);
 H5_DLL haddr_t H5CX_get_tag(void);
 H5_DLL H5AC_ring_t H5CX_get_ring(void);
+H5_DLL hbool_t H5CX_get_unlocked_read(void);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL hbool_t H5CX_get_coll_metadata_read(void);
 H5_DLL herr_t H5CX_get_mpi_coll_datatypes(MPI_Datatype *btype, MPI_Datatype *ftype);
@@ -121,6 +122,8 @@ H5_DLL herr_t H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5CX_get_err_detect(H5Z_EDC_t *err_detect);
 H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
+H5_DLL herr_t H5CX_get_filter_nthreads(unsigned *filter_nthreads);
+H5_DLL herr_t H5CX_get_chunk_read_gap(size_t *chunk_read_gap);
 H5_DLL herr_t H5CX_get_data_transform(H5Z_data_xform_t **data_transform);
 H5_DLL herr_t H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info);
 H5_DLL herr_t H5CX_get_dt_conv_cb(H5T_conv_cb_t *cb_struct);
@@ -146,6 +149,7 @@ H5_DLL herr_t H5CX_get_libver_bounds(H5F_libver_t *low_bound, H5F_libver_t *high
 /* "Setter" routines for API context info */
 H5_DLL void H5CX_set_tag(haddr_t tag);
 H5_DLL void H5CX_set_ring(H5AC_ring_t ring);
+H5_DLL void H5CX_set_unlocked_read(hbool_t unlocked_read);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL void H5CX_set_coll_metadata_read(hbool_t cmdr);
 H5_DLL herr_t H5CX_set_mpi_coll_datatypes(MPI_Datatype btype, MPI_Datatype ftype);
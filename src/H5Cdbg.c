@@ -110,17 +110,14 @@ H5C_dump_cache(H5C_t * cache_ptr, const char *  cache_name)
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        entry_ptr = cache_ptr->index[i];
-
-        while(entry_ptr != NULL) {
-            HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
-            if(H5SL_insert(slist_ptr, entry_ptr, &(entry_ptr->addr)) < 0)
-                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't insert entry in skip list")
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+        if(H5SL_insert(slist_ptr, entry_ptr, &(entry_ptr->addr)) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't insert entry in skip list")
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end while */
-    } /* end for */
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
     /* If we get this far, all entries in the cache are listed in the
      * skip list -- scan the skip list generating the desired output.
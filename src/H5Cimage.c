@@ -122,6 +122,11 @@ static herr_t H5C__read_cache_image(H5F_t * f, H5C_t *cache_ptr);
 static herr_t H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr);
 static herr_t H5C__construct_cache_image_buffer(H5F_t *f, H5C_t *cache_ptr);
 static herr_t H5C__free_image_entries_array(H5C_t *cache_ptr);
+static herr_t H5C__index_cache_image(const H5F_t *f, H5C_t *cache_ptr);
+static int H5C__image_entry_addr_cmp(const void *_entry1, const void *_entry2);
+#ifdef H5_HAVE_SYS_MMAN_H
+static herr_t H5C__map_cache_image(H5F_t *f, H5C_t *cache_ptr);
+#endif /* H5_HAVE_SYS_MMAN_H */
 
 
 /*********************/
@@ -639,8 +644,6 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     ds_entry_ptr->flush_dep_nunser_children 	= 0;
 
     /* Initialize fields supporting the hash table: */
-    ds_entry_ptr->ht_next                   	= NULL;
-    ds_entry_ptr->ht_prev                   	= NULL;
     ds_entry_ptr->il_next                   	= NULL;
     ds_entry_ptr->il_prev                   	= NULL;
 
@@ -651,6 +654,8 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     ds_entry_ptr->aux_next                  	= NULL;
     ds_entry_ptr->aux_prev                  	= NULL;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
+    ds_entry_ptr->rp_hot                    	= FALSE;
+    ds_entry_ptr->rp_last_access                = 0;
 #ifdef H5_HAVE_PARALLEL
     pf_entry_ptr->coll_next                 	= NULL;
     pf_entry_ptr->coll_prev                 	= NULL;
@@ -862,6 +867,52 @@ H5C__free_image_entries_array(H5C_t * cache_ptr)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C__free_image_entries_array() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__free_pending_image
+ *
+ * Purpose:     Release the index of the cache image entries that have
+ *		not been protected yet, along with the cache image block
+ *		it points into, unmapping the block if it was mapped.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__free_pending_image(H5C_t *cache_ptr)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    /* The entry images point into the image block -- nothing else to free */
+    cache_ptr->pending_image_entries = (H5C_image_entry_t *)H5MM_xfree(cache_ptr->pending_image_entries);
+    cache_ptr->num_pending_image_entries = 0;
+    cache_ptr->pending_image_entries_left = 0;
+
+#ifdef H5_HAVE_SYS_MMAN_H
+    if(cache_ptr->image_map) {
+        if(HDmunmap(cache_ptr->image_map, cache_ptr->image_map_len) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't unmap metadata cache image block")
+        cache_ptr->image_map = NULL;
+        cache_ptr->image_map_len = 0;
+        cache_ptr->image_block = NULL;
+    } /* end if */
+    else
+#endif /* H5_HAVE_SYS_MMAN_H */
+        cache_ptr->image_block = H5MM_xfree(cache_ptr->image_block);
+
+#ifdef H5_HAVE_SYS_MMAN_H
+done:
+#endif /* H5_HAVE_SYS_MMAN_H */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__free_pending_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_force_cache_image_load()
@@ -1095,6 +1146,81 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__read_cache_image() */
 
+
+#ifdef H5_HAVE_SYS_MMAN_H
+/*-------------------------------------------------------------------------
+ * Function:    H5C__map_cache_image
+ *
+ * Purpose:	Map the metadata cache image block of a file opened R/O
+ *		into memory, and point cache_ptr->image_block at it.
+ *
+ *		Leaves cache_ptr->image_block NULL, so that the caller
+ *		reads the image instead, if the file driver doesn't hand
+ *		back a POSIX file descriptor of the file or the mapping
+ *		fails.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__map_cache_image(H5F_t *f, H5C_t *cache_ptr)
+{
+    void *              fd_ptr = NULL;          /* Pointer to file descriptor */
+    void *              map;                    /* Memory mapping */
+    haddr_t             eof;                    /* End of file */
+    HDoff_t             offset;                 /* Offset of image in file */
+    size_t              skip;                   /* Offset of image in first page */
+    long                page_size;              /* Size of a memory page */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(cache_ptr);
+    HDassert(H5F_addr_defined(cache_ptr->image_addr));
+    HDassert(cache_ptr->image_len > 0);
+    HDassert(NULL == cache_ptr->image_block);
+
+    /* The core driver hands back its memory buffer instead of the
+     * descriptor of its backing store.
+     */
+    if(!H5F_HAS_FEATURE(f, H5FD_FEAT_POSIX_COMPAT_HANDLE) || H5F_HAS_FEATURE(f, H5FD_FEAT_ALLOW_FILE_IMAGE))
+        HGOTO_DONE(SUCCEED)
+
+    /* Touching a mapped page beyond the end of the file raises SIGBUS,
+     * so leave truncated files to the read.
+     */
+    if(HADDR_UNDEF == (eof = H5FD_get_eof(f->shared->lf, H5FD_MEM_SUPER)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to determine file size")
+    if(H5F_addr_gt(cache_ptr->image_addr + cache_ptr->image_len, eof))
+        HGOTO_DONE(SUCCEED)
+
+    if((page_size = HDsysconf(_SC_PAGESIZE)) <= 0)
+        HGOTO_DONE(SUCCEED)
+
+    if(H5F_get_vfd_handle(f, H5P_FILE_ACCESS_DEFAULT, &fd_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get file descriptor")
+
+    /* Map from the start of the page holding the image */
+    offset = (HDoff_t)(H5FD_get_base_addr(f->shared->lf) + cache_ptr->image_addr);
+    skip = (size_t)(offset % (HDoff_t)page_size);
+    if(MAP_FAILED == (map = HDmmap(NULL, skip + (size_t)cache_ptr->image_len, PROT_READ, MAP_PRIVATE, *(int *)fd_ptr, offset - (HDoff_t)skip)))
+        HGOTO_DONE(SUCCEED)
+
+    cache_ptr->image_map = map;
+    cache_ptr->image_map_len = skip + (size_t)cache_ptr->image_len;
+    cache_ptr->image_block = (uint8_t *)map + skip;
+
+    H5C__UPDATE_STATS_FOR_CACHE_IMAGE_READ(cache_ptr)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__map_cache_image() */
+#endif /* H5_HAVE_SYS_MMAN_H */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__load_cache_image
@@ -1142,20 +1268,54 @@ H5C__load_cache_image(H5F_t *f)
         HDassert(cache_ptr->image_len > 0);
         HDassert(cache_ptr->image_buffer == NULL);
 
-        /* Allocate space for the image */
-        if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+        /* A file opened R/O keeps its cache image, and usually touches
+         * only part of it.  Unless the open is parallel or for SWMR
+         * reads, just index the image by address, and create the
+         * prefetched entry for an entry of the image when it is first
+         * protected.  Map the image block instead of reading it where
+         * possible.
+         */
+        if(!cache_ptr->delete_image && NULL == cache_ptr->aux_ptr
+                && !(H5F_INTENT(f) & H5F_ACC_SWMR_READ)) {
+#ifdef H5_HAVE_SYS_MMAN_H
+            if(H5C__map_cache_image(f, cache_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "Can't map metadata cache image block")
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+            if(NULL == cache_ptr->image_block) {
+                /* Allocate space for the image */
+                if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+
+                /* Load the image from file */
+                if(H5C__read_cache_image(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image block")
+
+                /* Keep the image until all its entries are protected */
+                cache_ptr->image_block = cache_ptr->image_buffer;
+                cache_ptr->image_buffer = NULL;
+            } /* end if */
 
-        /* Load the image from file */
-        if(H5C__read_cache_image(f, cache_ptr) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image block")
+            /* Index the entries in the image */
+            if(H5C__index_cache_image(f, cache_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't index metadata cache image block")
+        } /* end if */
+        else {
+            /* Allocate space for the image */
+            if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+
+            /* Load the image from file */
+            if(H5C__read_cache_image(f, cache_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image block")
 
-        /* Reconstruct cache contents, from image */
-        if(H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
+            /* Reconstruct cache contents, from image */
+            if(H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
 
-        /* Free the image buffer */
-        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+            /* Free the image buffer */
+            cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+        } /* end else */
 
         /* Update stats -- must do this now, as we are about
          * to discard the size of the cache image.
@@ -1233,6 +1393,124 @@ H5C_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, hsize_t len,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C_load_cache_image_on_next_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_image_entry
+ *
+ * Purpose:     Look up the supplied address in the index of the cache
+ *		image entries that have not been protected yet.  If it is
+ *		there, create the prefetched entry for it, insert it in
+ *		the cache, and return it in *entry_ptr_ptr.  Otherwise
+ *		leave *entry_ptr_ptr unchanged.
+ *
+ *		Only used for cache images loaded by R/O opens, whose
+ *		prefetched entries are never dirty, so no flush
+ *		dependencies are set up between them.  Clients recreate
+ *		the flush dependencies of the entries they deserialize.
+ *
+ *		Releases the image block once the last entry in it has
+ *		been prefetched.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__prefetch_image_entry(H5C_t *cache_ptr, haddr_t addr,
+    H5C_cache_entry_t **entry_ptr_ptr)
+{
+    H5C_image_entry_t  *ie_ptr = NULL;          /* Image entry for address */
+    H5C_cache_entry_t  *pf_entry_ptr = NULL;    /* New prefetched entry */
+    size_t              lo, hi;                 /* Search bounds */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->pending_image_entries);
+    HDassert(cache_ptr->pending_image_entries_left > 0);
+    HDassert(entry_ptr_ptr);
+
+    /* Binary search the image entries, which are sorted by address */
+    lo = 0;
+    hi = cache_ptr->num_pending_image_entries;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(H5F_addr_lt(cache_ptr->pending_image_entries[mid].addr, addr))
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+    if(lo < cache_ptr->num_pending_image_entries
+            && H5F_addr_eq(cache_ptr->pending_image_entries[lo].addr, addr))
+        ie_ptr = &(cache_ptr->pending_image_entries[lo]);
+
+    /* Nothing to do if the entry isn't in the image, or was protected
+     * before (and possibly evicted since -- it's clean on disk then).
+     */
+    if(NULL == ie_ptr || NULL == ie_ptr->image_ptr)
+        HGOTO_DONE(SUCCEED)
+    HDassert(ie_ptr->magic == H5C_IMAGE_ENTRY_T_MAGIC);
+
+    /* Allocate space for the prefetched cache entry */
+    if(NULL == (pf_entry_ptr = H5FL_CALLOC(H5C_cache_entry_t)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched cache entry")
+
+    /* Copy the entry image out of the cache image block, which is released
+     * long before the entry is.
+     */
+    if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(ie_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+    H5MM_memcpy(((uint8_t *)pf_entry_ptr->image_ptr) + ie_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    H5MM_memcpy(pf_entry_ptr->image_ptr, ie_ptr->image_ptr, ie_ptr->size);
+
+    /* Initialize the prefetched entry as H5C__reconstruct_cache_entry()
+     * does for R/O opens, less the flush dependencies.
+     * (Only need to set non-zero/NULL/FALSE fields, due to calloc() above)
+     */
+    pf_entry_ptr->magic				= H5C__H5C_CACHE_ENTRY_T_MAGIC;
+    pf_entry_ptr->cache_ptr 			= cache_ptr;
+    pf_entry_ptr->addr				= ie_ptr->addr;
+    pf_entry_ptr->size				= ie_ptr->size;
+    pf_entry_ptr->ring				= ie_ptr->ring;
+    pf_entry_ptr->age				= ie_ptr->age;
+    pf_entry_ptr->prefetch_type_id		= ie_ptr->type_id;
+    pf_entry_ptr->lru_rank			= ie_ptr->lru_rank;
+    pf_entry_ptr->image_up_to_date		= TRUE;
+    pf_entry_ptr->type				= H5AC_PREFETCHED_ENTRY;
+    pf_entry_ptr->prefetched			= TRUE;
+    pf_entry_ptr->prefetched_dirty              = ie_ptr->is_dirty;
+
+    /* Insert the prefetched entry in the index and the LRU */
+    H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_RP_FOR_INSERT_APPEND(cache_ptr, pf_entry_ptr, FAIL)
+
+    H5C__UPDATE_STATS_FOR_PREFETCH(cache_ptr, FALSE)
+
+    /* The entry's image is now owned by the prefetched entry */
+    ie_ptr->image_ptr = NULL;
+    *entry_ptr_ptr = pf_entry_ptr;
+    pf_entry_ptr = NULL;
+
+    /* Release the image once all its entries are in the cache */
+    if(--cache_ptr->pending_image_entries_left == 0)
+        if(H5C__free_pending_image(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't release metadata cache image")
+
+done:
+    if(pf_entry_ptr) {
+        pf_entry_ptr->image_ptr = H5MM_xfree(pf_entry_ptr->image_ptr);
+        pf_entry_ptr = H5FL_FREE(H5C_cache_entry_t, pf_entry_ptr);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_image_entry() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__image_entry_cmp
@@ -1287,6 +1565,161 @@ H5C__image_entry_cmp(const void *_entry1, const void *_entry2)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__image_entry_cmp() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__image_entry_addr_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on image entries, which
+ *		orders them by address.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *		first entry is considered to be respectively less than,
+ *		equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__image_entry_addr_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5C_image_entry_t *entry1 = (const H5C_image_entry_t *)_entry1;  /* Pointer to first image entry to compare */
+    const H5C_image_entry_t *entry2 = (const H5C_image_entry_t *)_entry2;  /* Pointer to second image entry to compare */
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(entry1);
+    HDassert(entry2);
+
+    if(H5F_addr_lt(entry1->addr, entry2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(entry1->addr, entry2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__image_entry_addr_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__index_cache_image
+ *
+ * Purpose:     Decode the header of the cache image block in
+ *		cache_ptr->image_block, and the headers of the entries in
+ *		it, into an array of image entries sorted by address, whose
+ *		image_ptr fields point at the entry images in the block.
+ *
+ *		This is the R/O open counterpart of
+ *		H5C__reconstruct_cache_contents(): no prefetched entries
+ *		are created until H5C__prefetch_image_entry() is called for
+ *		them, and the flush dependency parent addresses are skipped.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__index_cache_image(const H5F_t *f, H5C_t *cache_ptr)
+{
+    const uint8_t *     hdr_p;                  /* Pointer for decoding the header */
+    uint8_t *           p;                      /* Pointer into image block */
+    const uint8_t *     p_end;                  /* End of the entries in the image block */
+    size_t              entry_header_size;      /* Size of an entry header */
+    unsigned            u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->image_block);
+    HDassert(cache_ptr->image_len > 0);
+    HDassert(NULL == cache_ptr->pending_image_entries);
+
+    /* Decode metadata cache image header */
+    if(cache_ptr->image_len < H5C__cache_image_block_header_size(f) + H5F_SIZEOF_CHKSUM)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "cache image block too small")
+    hdr_p = (const uint8_t *)cache_ptr->image_block;
+    if(H5C__decode_cache_image_header(f, cache_ptr, &hdr_p) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "cache image header decode failed")
+    p = (uint8_t *)cache_ptr->image_block + H5C__cache_image_block_header_size(f);
+    p_end = (const uint8_t *)cache_ptr->image_block + cache_ptr->image_len - H5F_SIZEOF_CHKSUM;
+
+    /* Each entry takes at least its header and one byte of image */
+    entry_header_size = H5C__cache_image_block_entry_header_size(f);
+    if((size_t)cache_ptr->num_entries_in_image > (size_t)(p_end - p) / (entry_header_size + 1))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache entry count")
+
+    if(NULL == (cache_ptr->pending_image_entries = (H5C_image_entry_t *)H5MM_calloc(sizeof(H5C_image_entry_t) * (size_t)cache_ptr->num_entries_in_image)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for image entries array")
+    cache_ptr->num_pending_image_entries = (size_t)cache_ptr->num_entries_in_image;
+
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        H5C_image_entry_t  *ie_ptr = &(cache_ptr->pending_image_entries[u]);
+        const uint8_t      *q;
+        uint8_t             flags;
+        uint16_t            fd_parent_count;
+
+        if((size_t)(p_end - p) < entry_header_size)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "truncated metadata cache image entry")
+        q = p;
+
+        ie_ptr->magic = H5C_IMAGE_ENTRY_T_MAGIC;
+
+        /* Decode type id, flags, ring & age */
+        ie_ptr->type_id = (int32_t)*q++;
+        flags = *q++;
+        ie_ptr->is_dirty = (flags & H5C__MDCI_ENTRY_DIRTY_FLAG) != 0;
+        ie_ptr->ring = (H5C_ring_t)*q++;
+        if(ie_ptr->ring <= H5C_RING_UNDEFINED || ie_ptr->ring > H5C_MAX_RING_IN_IMAGE)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry ring")
+        ie_ptr->age = (int32_t)*q++;
+
+        /* Skip the flush dependency child counts */
+        q += 4;
+
+        /* Decode dependency parent count & index in LRU */
+        UINT16DECODE(q, fd_parent_count);
+        INT32DECODE(q, ie_ptr->lru_rank);
+
+        /* Decode entry offset & length */
+        H5F_addr_decode(f, &q, &ie_ptr->addr);
+        if(!H5F_addr_defined(ie_ptr->addr))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry offset")
+        H5F_DECODE_LENGTH(f, q, ie_ptr->size);
+        if(ie_ptr->size == 0 || ie_ptr->size >= H5C_MAX_ENTRY_SIZE)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry size")
+        HDassert((size_t)(q - p) == entry_header_size);
+
+        /* Skip the flush dependency parent addresses */
+        p += entry_header_size;
+        if((size_t)(p_end - p) < (size_t)fd_parent_count * H5F_SIZEOF_ADDR(f) + ie_ptr->size)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "truncated metadata cache image entry")
+        p += (size_t)fd_parent_count * H5F_SIZEOF_ADDR(f);
+
+        /* Point at the entry image */
+        ie_ptr->image_ptr = p;
+        p += ie_ptr->size;
+    } /* end for */
+
+    /* Sort the entries by address for H5C__prefetch_image_entry() */
+    HDqsort(cache_ptr->pending_image_entries, cache_ptr->num_pending_image_entries, sizeof(H5C_image_entry_t), H5C__image_entry_addr_cmp);
+    for(u = 1; u < cache_ptr->num_entries_in_image; u++)
+        if(H5F_addr_eq(cache_ptr->pending_image_entries[u - 1].addr, cache_ptr->pending_image_entries[u].addr))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "duplicate entry offset in metadata cache image")
+
+    cache_ptr->pending_image_entries_left = cache_ptr->num_pending_image_entries;
+
+done:
+    if(ret_value < 0) {
+        cache_ptr->pending_image_entries = (H5C_image_entry_t *)H5MM_xfree(cache_ptr->pending_image_entries);
+        cache_ptr->num_pending_image_entries = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__index_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_image_for_file_close
@@ -48,12 +48,25 @@
 #define H5C__MAX_EPOCH_MARKERS                  10
 
 /* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN     (64 * 1024) /* must be a power of 2 */
+#define H5C__HASH_TABLE_MIN_LEN (1024)      /* must be a power of 2 */
 #define H5C__H5C_T_MAGIC	0x005CAC0E
 
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
+/* Number of recently evicted entries remembered by the 2Q and ARC
+ * replacement policies
+ */
+#define H5C__RP_GHOST_LIST_LEN          512
+
+/* Share of the cache reserved for cold entries under the 2Q policy */
+#define H5C__RP_2Q_COLD_FRACTION        4   /* i.e. 1/4 */
+
+/* Number of protects within which repeated protects of an entry are
+ * considered correlated, and don't make the entry hot under ARC
+ */
+#define H5C__RP_CORRELATED_PROTECTS     32
+
 /****************************************************************************
  *
  * We maintain doubly linked lists of instances of H5C_cache_entry_t for a
@@ -596,11 +609,13 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  ***********************************************************************/
 
-#define H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit) \
-        (cache_ptr->cache_accesses)++;                   \
-        if ( hit ) {                                     \
-            (cache_ptr->cache_hits)++;                   \
-        }                                                \
+#define H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, entry_ptr, hit)     \
+        (cache_ptr->cache_accesses)++;                                   \
+        (cache_ptr->type_accesses[(entry_ptr)->type->mem_type])++;       \
+        if ( hit ) {                                                     \
+            (cache_ptr->cache_hits)++;                                   \
+            (cache_ptr->type_hits[(entry_ptr)->type->mem_type])++;       \
+        }                                                                \
 
 #if H5C_COLLECT_CACHE_STATS
 
@@ -977,13 +992,28 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  *                                              JRM -- 10/15/15
  *
+ *   - Replaced the fixed size chained hash table with an open addressing
+ *     table with linear probing, which doubles in size whenever it
+ *     becomes half full and halves in size when it falls below one
+ *     eighth full (but never below H5C__HASH_TABLE_MIN_LEN slots).
+ *     Each slot holds the address of its entry as well as a pointer to
+ *     it, so that a search only touches the entry it finds.  Deletions
+ *     move the following entries of the probe sequence back, so there
+ *     are no tombstones.
+ *
  ***********************************************************************/
 
-/* H5C__HASH_TABLE_LEN is defined in H5Cpkg.h.  It mut be a power of two. */
+/* H5C__HASH_FCN() maps an address to its home slot in the index.  It uses
+ * multiplicative (Fibonacci) hashing, i.e. the top bits of the address
+ * times 2^64 divided by the golden ratio, so that all bits of the address
+ * contribute to the slot.
+ */
+#define H5C__HASH_MULT          ((uint64_t)0x9E3779B97F4A7C15ULL)
 
-#define H5C__HASH_MASK		((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
+#define H5C__HASH_FCN(cache_ptr, x)                                         \
+    ((size_t)(((uint64_t)(x) * H5C__HASH_MULT) >> (cache_ptr)->index_shift))
 
-#define H5C__HASH_FCN(x)	(int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+#define H5C__HASH_NEXT(cache_ptr, k)  (((k) + 1) & ((cache_ptr)->index_slots - 1))
 
 #if H5C_DO_SANITY_CHECKS
 
@@ -992,11 +1022,8 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->magic != H5C__H5C_T_MAGIC ) ||                      \
      ( (entry_ptr) == NULL ) ||                                         \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
-     ( (entry_ptr)->ht_next != NULL ) ||                                \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
+     ( (cache_ptr)->index_len >= (cache_ptr)->index_slots ) ||          \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1047,16 +1074,8 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->index_size < (entry_ptr)->size ) ||                 \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
-     ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]         \
-       == NULL ) ||                                                     \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]       \
-       != (entry_ptr) ) &&                                              \
-       ( (entry_ptr)->ht_prev == NULL ) ) ||                            \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))] ==    \
-         (entry_ptr) ) &&                                               \
-       ( (entry_ptr)->ht_prev != NULL ) ) ||                            \
+     ( ((cache_ptr)->index)[H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr)] \
+       .ptr == NULL ) ||                                                \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1086,8 +1105,7 @@ if ( ( (cache_ptr) == NULL ) ||                                          \
      ( (entry_ptr) == NULL ) ||                                          \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                        \
      ( (entry_ptr)->size <= 0 ) ||                                       \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                 \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                 \
+     ( (cache_ptr)->index_len >= (cache_ptr)->index_slots ) ||           \
      ( (cache_ptr)->index_size !=                                        \
        ((cache_ptr)->clean_index_size +                                  \
 	(cache_ptr)->dirty_index_size) ) ||                              \
@@ -1113,8 +1131,7 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                                        \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                                         \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {                     \
+     ( (cache_ptr)->index_len >= (cache_ptr)->index_slots ) ) {             \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "pre HT search SC failed") \
 }
 
@@ -1128,26 +1145,11 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( (entry_ptr)->size <= 0 ) ||                                          \
-     ( ((cache_ptr)->index)[k] == NULL ) ||                                 \
-     ( ( ((cache_ptr)->index)[k] != (entry_ptr) ) &&                        \
-       ( (entry_ptr)->ht_prev == NULL ) ) ||                                \
-     ( ( ((cache_ptr)->index)[k] == (entry_ptr) ) &&                        \
-       ( (entry_ptr)->ht_prev != NULL ) ) ||                                \
-     ( ( (entry_ptr)->ht_prev != NULL ) &&                                  \
-       ( (entry_ptr)->ht_prev->ht_next != (entry_ptr) ) ) ||                \
-     ( ( (entry_ptr)->ht_next != NULL ) &&                                  \
-       ( (entry_ptr)->ht_next->ht_prev != (entry_ptr) ) ) ) {               \
+     ( ((cache_ptr)->index)[k].ptr != (entry_ptr) ) ||                \
+     ( ! H5F_addr_eq(((cache_ptr)->index)[k].addr, (entry_ptr)->addr) ) ) { \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "post successful HT search SC failed") \
 }
 
-/* (Keep in sync w/H5C_TEST__POST_HT_SHIFT_TO_FRONT macro in test/cache_common.h -QAK) */
-#define H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-if ( ( (cache_ptr) == NULL ) ||                                        \
-     ( ((cache_ptr)->index)[k] != (entry_ptr) ) ||                     \
-     ( (entry_ptr)->ht_prev != NULL ) ) {                              \
-    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "post HT shift to front SC failed") \
-}
-
 #define H5C__PRE_HT_ENTRY_SIZE_CHANGE_SC(cache_ptr, old_size, new_size, \
 		                         entry_ptr, was_clean)          \
 if ( ( (cache_ptr) == NULL ) ||                                         \
@@ -1307,7 +1309,6 @@ if ( ( (cache_ptr)->index_size !=                                           \
 #define H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)
 #define H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)
-#define H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val)
 #define H5C__PRE_HT_UPDATE_FOR_ENTRY_CLEAN_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_UPDATE_FOR_ENTRY_DIRTY_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_ENTRY_SIZE_CHANGE_SC(cache_ptr, old_size, new_size, \
@@ -1322,14 +1323,16 @@ if ( ( (cache_ptr)->index_size !=                                           \
 
 #define H5C__INSERT_IN_INDEX(cache_ptr, entry_ptr, fail_val)                 \
 {                                                                            \
-    int k;                                                                   \
+    size_t k;                                                                \
     H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                    \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
-    if(((cache_ptr)->index)[k] != NULL) {                                    \
-        (entry_ptr)->ht_next = ((cache_ptr)->index)[k];                      \
-        (entry_ptr)->ht_next->ht_prev = (entry_ptr);                         \
-    }                                                                        \
-    ((cache_ptr)->index)[k] = (entry_ptr);                                   \
+    if((cache_ptr)->index_len >= (cache_ptr)->index_slots / 2)               \
+        if(H5C__index_resize((cache_ptr), (cache_ptr)->index_slots * 2) < 0) \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, fail_val, "can't grow cache index") \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
+    while(((cache_ptr)->index)[k].ptr != NULL)                         \
+        k = H5C__HASH_NEXT(cache_ptr, k);                                    \
+    ((cache_ptr)->index)[k].addr = (entry_ptr)->addr;                        \
+    ((cache_ptr)->index)[k].ptr = (entry_ptr);                         \
     (cache_ptr)->index_len++;                                                \
     (cache_ptr)->index_size += (entry_ptr)->size;                            \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])++;                        \
@@ -1348,6 +1351,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
         (cache_ptr)->num_last_entries++;                                     \
         HDassert((cache_ptr)->num_last_entries <= 2);                        \
     }                                                                        \
+    if((entry_ptr)->rp_hot)                                                  \
+        (cache_ptr)->rp_hot_size += (entry_ptr)->size;                       \
     H5C__IL_DLL_APPEND((entry_ptr), (cache_ptr)->il_head,                    \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
@@ -1355,19 +1360,31 @@ if ( ( (cache_ptr)->index_size !=                                           \
     H5C__POST_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                   \
 }
 
+/* Deletion closes the hole left by the entry by moving back any of the
+ * entries that follow it in the same run of occupied slots and whose home
+ * slot is not between the hole and their current slot.
+ */
 #define H5C__DELETE_FROM_INDEX(cache_ptr, entry_ptr, fail_val)               \
 {                                                                            \
-    int k;                                                                   \
+    size_t k, j, home;                                                       \
     H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr)                              \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
-    if((entry_ptr)->ht_next)                                                 \
-        (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                \
-    if((entry_ptr)->ht_prev)                                                 \
-        (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;                \
-    if(((cache_ptr)->index)[k] == (entry_ptr))                               \
-        ((cache_ptr)->index)[k] = (entry_ptr)->ht_next;                      \
-    (entry_ptr)->ht_next = NULL;                                             \
-    (entry_ptr)->ht_prev = NULL;                                             \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
+    while(((cache_ptr)->index)[k].ptr != (entry_ptr)) {                \
+        HDassert(((cache_ptr)->index)[k].ptr != NULL);                 \
+        k = H5C__HASH_NEXT(cache_ptr, k);                                    \
+    }                                                                        \
+    for(j = H5C__HASH_NEXT(cache_ptr, k);                                    \
+            ((cache_ptr)->index)[j].ptr != NULL;                       \
+            j = H5C__HASH_NEXT(cache_ptr, j)) {                              \
+        home = H5C__HASH_FCN(cache_ptr, ((cache_ptr)->index)[j].addr);       \
+        if(((j - home) & ((cache_ptr)->index_slots - 1)) >=                  \
+                ((j - k) & ((cache_ptr)->index_slots - 1))) {                \
+            ((cache_ptr)->index)[k] = ((cache_ptr)->index)[j];               \
+            k = j;                                                           \
+        }                                                                    \
+    }                                                                        \
+    ((cache_ptr)->index)[k].addr = HADDR_UNDEF;                              \
+    ((cache_ptr)->index)[k].ptr = NULL;                                \
     (cache_ptr)->index_len--;                                                \
     (cache_ptr)->index_size -= (entry_ptr)->size;                            \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])--;                        \
@@ -1386,37 +1403,31 @@ if ( ( (cache_ptr)->index_size !=                                           \
         (cache_ptr)->num_last_entries--;                                     \
         HDassert((cache_ptr)->num_last_entries <= 1);                        \
     }                                                                        \
+    if((entry_ptr)->rp_hot)                                                  \
+        (cache_ptr)->rp_hot_size -= (entry_ptr)->size;                       \
     H5C__IL_DLL_REMOVE((entry_ptr), (cache_ptr)->il_head,                    \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)                             \
     H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)                             \
+    if((cache_ptr)->index_slots > H5C__HASH_TABLE_MIN_LEN &&                 \
+            (cache_ptr)->index_len < (cache_ptr)->index_slots / 8)           \
+        if(H5C__index_resize((cache_ptr), (cache_ptr)->index_slots / 2) < 0) \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, fail_val, "can't shrink cache index") \
 }
 
 #define H5C__SEARCH_INDEX(cache_ptr, Addr, entry_ptr, fail_val)             \
 {                                                                           \
-    int k;                                                                  \
+    size_t k;                                                               \
     int depth = 0;                                                          \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
-    entry_ptr = ((cache_ptr)->index)[k];                                    \
-    while(entry_ptr) {                                                      \
-        if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
+    while(((entry_ptr) = ((cache_ptr)->index)[k].ptr) != NULL) {      \
+        if(H5F_addr_eq(Addr, ((cache_ptr)->index)[k].addr)) {               \
             H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)   \
-            if(entry_ptr != ((cache_ptr)->index)[k]) {                      \
-                if((entry_ptr)->ht_next)                                    \
-                    (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;   \
-                HDassert((entry_ptr)->ht_prev != NULL);                     \
-                (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;       \
-                ((cache_ptr)->index)[k]->ht_prev = (entry_ptr);             \
-                (entry_ptr)->ht_next = ((cache_ptr)->index)[k];             \
-                (entry_ptr)->ht_prev = NULL;                                \
-                ((cache_ptr)->index)[k] = (entry_ptr);                      \
-                H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-            }                                                               \
             break;                                                          \
         }                                                                   \
-        (entry_ptr) = (entry_ptr)->ht_next;                                 \
+        k = H5C__HASH_NEXT(cache_ptr, k);                                   \
         (depth)++;                                                          \
     }                                                                       \
     H5C__UPDATE_STATS_FOR_HT_SEARCH(cache_ptr, (entry_ptr != NULL), depth)  \
@@ -1424,27 +1435,15 @@ if ( ( (cache_ptr)->index_size !=                                           \
 
 #define H5C__SEARCH_INDEX_NO_STATS(cache_ptr, Addr, entry_ptr, fail_val)    \
 {                                                                           \
-    int k;                                                                  \
+    size_t k;                                                               \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
-    entry_ptr = ((cache_ptr)->index)[k];                                    \
-    while(entry_ptr) {                                                      \
-        if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
+    while(((entry_ptr) = ((cache_ptr)->index)[k].ptr) != NULL) {      \
+        if(H5F_addr_eq(Addr, ((cache_ptr)->index)[k].addr)) {               \
             H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)   \
-            if(entry_ptr != ((cache_ptr)->index)[k]) {                      \
-                if((entry_ptr)->ht_next)                                    \
-                    (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;   \
-                HDassert((entry_ptr)->ht_prev != NULL);                     \
-                (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;       \
-                ((cache_ptr)->index)[k]->ht_prev = (entry_ptr);             \
-                (entry_ptr)->ht_next = ((cache_ptr)->index)[k];             \
-                (entry_ptr)->ht_prev = NULL;                                \
-                ((cache_ptr)->index)[k] = (entry_ptr);                      \
-                H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-            }                                                               \
             break;                                                          \
         }                                                                   \
-        (entry_ptr) = (entry_ptr)->ht_next;                                 \
+        k = H5C__HASH_NEXT(cache_ptr, k);                                   \
     }                                                                       \
 }
 
@@ -1495,6 +1494,10 @@ if ( ( (cache_ptr)->index_size !=                                           \
 	(cache_ptr)->clean_index_size += (new_size);                        \
         ((cache_ptr)->clean_index_ring_size[entry_ptr->ring])+= (new_size); \
     }                                                                       \
+    if((entry_ptr)->rp_hot) {                                               \
+        (cache_ptr)->rp_hot_size -= (old_size);                             \
+        (cache_ptr)->rp_hot_size += (new_size);                             \
+    }                                                                       \
     H5C__DLL_UPDATE_FOR_SIZE_CHANGE((cache_ptr)->il_len,                    \
                                     (cache_ptr)->il_size,                   \
                                     (old_size), (new_size))                 \
@@ -3452,6 +3455,26 @@ typedef struct H5C_tag_info_t {
     hbool_t corked;             /* Whether this object is corked */
 } H5C_tag_info_t;
 
+/****************************************************************************
+ *
+ * structure H5C_index_slot_t
+ *
+ * Slot of the open addressing hash table which indexes the entries in the
+ * cache by address.  The address is kept in the slot itself so that probing
+ * the table doesn't touch the entries that don't match.
+ *
+ * addr: Address of the entry in the slot, or HADDR_UNDEF if the slot is
+ *		empty.
+ *
+ * ptr:	Pointer to the entry in the slot, or NULL if the slot is
+ *		empty.
+ *
+ ****************************************************************************/
+typedef struct H5C_index_slot_t {
+    haddr_t addr;                   /* Address of the entry */
+    H5C_cache_entry_t *ptr;         /* Pointer to the entry */
+} H5C_index_slot_t;
+
 
 /****************************************************************************
  *
@@ -3646,20 +3669,24 @@ typedef struct H5C_tag_info_t {
  *		index by ring.  Note that the sum of all cells in this array
  *		must equal the value stored in dirty_index_size above.
  *
- * index:	Array of pointer to H5C_cache_entry_t of size
- *		H5C__HASH_TABLE_LEN.  At present, this value is a power
- *		of two, not the usual prime number.
+ * index:	Array of H5C_index_slot_t of length index_slots, holding the
+ *		address of and a pointer to each entry in the cache, or
+ *		NULL in empty slots.  The table uses open addressing with
+ *		linear probing: an entry is stored in the first empty slot
+ *		at or after the slot H5C__HASH_FCN() computes from its
+ *		address, wrapping around at the end of the table.
+ *
+ *		The table doubles in size whenever it becomes half full,
+ *		and halves in size whenever it falls below one eighth full,
+ *		but never shrinks below H5C__HASH_TABLE_MIN_LEN slots.
+ *		Thus probe sequences stay short however many entries the
+ *		cache holds, while a small cache keeps a small index.
  *
- *		I hope that the variable size of cache elements, the large
- *		hash table size, and the way in which HDF5 allocates space
- *		will combine to avoid problems with periodicity.  If so, we
- *		can use a trivial hash function (a bit-and and a 3 bit left
- *		shift) with some small savings.
+ * index_slots:	Number of slots in the index.  This is always a power
+ *		of two.
  *
- *		If not, it will become evident in the statistics. Changing
- *		to the usual prime number length hash table will require
- *		changing the H5C__HASH_FCN macro and the deletion of the
- *		H5C__HASH_MASK #define.  No other changes should be required.
+ * index_shift:	Number of bits the hash of an address is shifted right
+ *		to obtain a slot number, i.e. 64 - log2(index_slots).
  *
  * il_len:	Number of entries on the index list.
  *
@@ -4019,6 +4046,49 @@ typedef struct H5C_tag_info_t {
  *              This field is NULL if the list is empty.
  *
  *
+ * Fields supporting the 2Q and ARC replacement policies:
+ *
+ * Both policies are layered on the LRU list above.  Entries are marked
+ * either cold or hot (see the rp_hot field of H5C_cache_entry_t), and
+ * H5C__make_space_in_cache() skips hot entries while the cold entries
+ * occupy more than rp_cold_target bytes.  If this is not enough to free
+ * the space required (e.g. because the cold entries are all pinned or
+ * protected), the scan falls back to plain LRU order.
+ *
+ * Under 2Q, an entry is only made hot when it is loaded again shortly
+ * after being evicted, and rp_cold_target is fixed at a quarter of the
+ * maximum cache size.  Under ARC, an entry is made hot on its first hit
+ * that isn't within H5C__RP_CORRELATED_PROTECTS protects of the previous
+ * one (opening an object protects its header several times in a row, which
+ * says nothing about its reuse), and rp_cold_target grows or shrinks as recently evicted cold or hot
+ * entries are loaded again.
+ *
+ * repl_policy: The replacement policy currently in effect.
+ *
+ * rp_hot_size: Number of bytes of hot entries in the index.
+ *
+ * rp_clock:    Number of protects since the cache was created.  Compared
+ *              with the rp_last_access field of entries by ARC.
+ *
+ * rp_cold_target: Number of bytes of cold entries that the eviction scan
+ *              tolerates before it stops skipping hot entries.  Only
+ *              used by ARC, 2Q computes its target from max_cache_size.
+ *
+ * rp_ghost_addrs:  Ring buffer holding the addresses of the most recently
+ *              evicted entries.  Unused slots hold HADDR_UNDEF.
+ *
+ * rp_ghost_hot: Array of flags parallel to rp_ghost_addrs, indicating
+ *              whether the corresponding entry was hot when evicted.
+ *
+ * rp_ghost_next: Index of the slot in rp_ghost_addrs to be overwritten by
+ *              the next eviction.
+ *
+ * rp_ghost_cold_len: Number of addresses of cold entries in
+ *              rp_ghost_addrs.
+ *
+ * rp_ghost_hot_len: Number of addresses of hot entries in rp_ghost_addrs.
+ *
+ *
  * Automatic cache size adjustment:
  *
  * While the default cache size is adequate for most cases, we can run into
@@ -4177,6 +4247,15 @@ typedef struct H5C_tag_info_t {
  *	were reset.  Note that when automatic cache re-sizing is enabled,
  *	this field will be reset every automatic resize epoch.
  *
+ * type_hits: Array of int64_t, indexed by the mem_type of the entry's
+ *	class, counting the cache hits since the last time the cache hit
+ *	rate statistics were reset.  The elements sum to cache_hits.
+ *
+ * type_accesses: Array of int64_t, indexed by the mem_type of the entry's
+ *	class, counting the cache accesses since the last time the cache
+ *	hit rate statistics were reset.  The elements sum to
+ *	cache_accesses.
+ *
  *
  * Metadata cache image management related fields.
  *
@@ -4280,6 +4359,34 @@ typedef struct H5C_tag_info_t {
  *		image_len in which the metadata cache image is assembled,
  *		or NULL if that	buffer does not exist.
  *
+ * When the file is opened R/O, the metadata cache image is not turned into
+ * prefetched entries all at once.  Instead, the entries in the image are
+ * indexed by address, and each one becomes a prefetched entry the first
+ * time it is protected.  The following fields support this:
+ *
+ * image_block: Pointer to the metadata cache image block, kept while any
+ *		of its entries may still be protected, or NULL if there is
+ *		no such block.
+ *
+ * image_map:	Base address of the memory mapping of the file holding
+ *		image_block, or NULL if image_block was read into a
+ *		dynamically allocated buffer instead.
+ *
+ * image_map_len: Length of the memory mapping at image_map, or zero.
+ *
+ * num_pending_image_entries: Number of entries in pending_image_entries.
+ *
+ * pending_image_entries_left: Number of entries in pending_image_entries
+ *		that have not been protected yet.  When this drops to zero,
+ *		the array and the image block are released.
+ *
+ * pending_image_entries: Pointer to a dynamically allocated array of
+ *		instances of H5C_image_entry_t describing the entries in
+ *		image_block, sorted by address, or NULL.  The image_ptr
+ *		of each entry points into image_block, and is set to NULL
+ *		once the entry has been protected.  The flush dependency
+ *		fields are not used.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -4673,7 +4780,9 @@ struct H5C_t {
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
     size_t			dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *	        index[H5C__HASH_TABLE_LEN];
+    H5C_index_slot_t *	        index;
+    size_t                      index_slots;
+    unsigned                    index_shift;
     uint32_t                    il_len;
     size_t                      il_size;
     H5C_cache_entry_t *	        il_head;
@@ -4734,6 +4843,17 @@ struct H5C_t {
     H5C_cache_entry_t *	        dLRU_tail_ptr;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
 
+    /* Fields for the 2Q and ARC replacement policies */
+    enum H5C_cache_repl_policy  repl_policy;
+    size_t                      rp_hot_size;
+    uint64_t                    rp_clock;
+    size_t                      rp_cold_target;
+    haddr_t                     rp_ghost_addrs[H5C__RP_GHOST_LIST_LEN];
+    hbool_t                     rp_ghost_hot[H5C__RP_GHOST_LIST_LEN];
+    uint32_t                    rp_ghost_next;
+    uint32_t                    rp_ghost_cold_len;
+    uint32_t                    rp_ghost_hot_len;
+
 #ifdef H5_HAVE_PARALLEL
     /* Fields for collective metadata reads */
     uint32_t                    coll_list_len;
@@ -4769,6 +4889,8 @@ struct H5C_t {
     /* Fields for cache hit rate collection */
     int64_t			cache_hits;
     int64_t			cache_accesses;
+    int64_t			type_hits[H5FD_MEM_NTYPES];
+    int64_t			type_accesses[H5FD_MEM_NTYPES];
 
     /* fields supporting generation of a cache image on file close */
     H5C_cache_image_ctl_t	image_ctl;
@@ -4786,6 +4908,12 @@ struct H5C_t {
     uint32_t			num_entries_in_image;
     H5C_image_entry_t *		image_entries;
     void *                      image_buffer;
+    void *                      image_block;
+    void *                      image_map;
+    size_t                      image_map_len;
+    size_t                      num_pending_image_entries;
+    size_t                      pending_image_entries_left;
+    H5C_image_entry_t *         pending_image_entries;
 
     /* Free Space Manager Related fields */
     hbool_t 			rdfsm_settled;
@@ -4906,11 +5034,15 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr,
     unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
+H5_DLL herr_t H5C__prefetch_image_entry(H5C_t *cache_ptr, haddr_t addr,
+    H5C_cache_entry_t **entry_ptr_ptr);
+H5_DLL herr_t H5C__free_pending_image(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, size_t  space_needed,
     hbool_t write_permitted);
 H5_DLL herr_t H5C__flush_marked_entries(H5F_t * f);
+H5_DLL herr_t H5C__index_resize(H5C_t *cache_ptr, size_t new_slots);
 H5_DLL herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_entry_t *entry_ptr);
 H5_DLL herr_t H5C__serialize_cache(H5F_t *f);
@@ -66,6 +66,10 @@
 /* Flags for cache client class behavior */
 #define H5C__CLASS_NO_FLAGS_SET             ((unsigned)0x0)
 #define H5C__CLASS_SPECULATIVE_LOAD_FLAG    ((unsigned)0x1)
+/* The 'serialize' callback only encodes the entry into its image, and may
+ * run on another thread while other entries are serialized.
+ */
+#define H5C__CLASS_CONCURRENT_SERIALIZE_FLAG ((unsigned)0x8)
 /* The following flags may only appear in test code */
 #define H5C__CLASS_SKIP_READS               ((unsigned)0x2)
 #define H5C__CLASS_SKIP_WRITES              ((unsigned)0x4)
@@ -77,11 +81,6 @@
 
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
- *
- * However, if you need a very big cache, you should also increase the
- * size of the hash table (H5C__HASH_TABLE_LEN in H5Cpkg.h).  The current
- * upper bound on cache size is rather large for the current hash table
- * size.
  */
 #define H5C__MAX_MAX_CACHE_SIZE		((size_t)(128 * 1024 * 1024))
 #define H5C__MIN_MAX_CACHE_SIZE		((size_t)(1024))
@@ -184,6 +183,7 @@
  *      H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG
  *      H5C__GENERATE_IMAGE_FLAG
  *      H5C__UPDATE_PAGE_BUFFER_FLAG
+ *      H5C__IMAGE_WRITTEN_FLAG
  */
 #define H5C__NO_FLAGS_SET			0x00000
 #define H5C__SET_FLUSH_MARKER_FLAG		0x00001
@@ -205,6 +205,7 @@
 #define H5C__DURING_FLUSH_FLAG                  0x10000 /* Set when the entire cache is being flushed */
 #define H5C__GENERATE_IMAGE_FLAG                0x20000 /* Set during parallel I/O */
 #define H5C__UPDATE_PAGE_BUFFER_FLAG            0x40000 /* Set during parallel I/O */
+#define H5C__IMAGE_WRITTEN_FLAG                 0x80000 /* Set when a flush batch wrote the image */
 
 /* Debugging/sanity checking/statistics settings */
 #ifndef NDEBUG
@@ -1226,9 +1227,10 @@ typedef int H5C_ring_t;
  *
  * Fields supporting the hash table:
  *
- * Entries in the cache are indexed by a more or less conventional hash table.
- * If there are multiple entries in any hash bin, they are stored in a doubly
- * linked list.
+ * Entries in the cache are indexed by an open addressing hash table, which
+ * holds the address of each entry along with a pointer to it (see the
+ * index field of H5C_t in H5Cpkg.h), so no fields of the entry are needed
+ * to store it.
  *
  * Addendum:  JRM -- 10/14/15
  *
@@ -1239,16 +1241,6 @@ typedef int H5C_ring_t;
  * The il_next and il_prev fields discussed below were added to support
  * the index list.
  *
- * ht_next:	Next pointer used by the hash table to store multiple
- *		entries in a single hash bin.  This field points to the
- *		next entry in the doubly linked list of entries in the
- *		hash bin, or NULL if there is no next entry.
- *
- * ht_prev:     Prev pointer used by the hash table to store multiple
- *              entries in a single hash bin.  This field points to the
- *              previous entry in the doubly linked list of entries in
- *		the hash bin, or NULL if there is no previuos entry.
- *
  * il_next:	Next pointer used by the index to maintain a doubly linked
  *		list of all entries in the index (and thus in the cache).
  *		This field contains a pointer to the next entry in the
@@ -1332,6 +1324,23 @@ typedef int H5C_ring_t;
  *		In either case, when there is no previous item, it should
  *		be NULL.
  *
+ * 2Q and ARC:
+ *
+ * The 2Q and ARC policies are implemented on top of the Modified LRU
+ * lists above by partitioning the entries into "cold" and "hot" ones.
+ * The eviction scan skips hot entries while the cold entries occupy
+ * more than their share of the cache.  See the comments on H5C_t in
+ * H5Cpkg.h for more details.
+ *
+ * rp_hot:	Boolean flag indicating that the entry is hot.  The flag
+ *		is ignored under the LRU policy, and is cleared whenever
+ *		the replacement policy is changed.
+ *
+ * rp_last_access: Value of the rp_clock field of the cache when the
+ *		entry was last protected.  Used by ARC to tell a real
+ *		re-reference from the burst of protects that a single
+ *		operation typically makes on an entry.
+ *
  * Fields supporting the cache image feature:
  *
  * The following fields are used to store data about the entry which must
@@ -1633,8 +1642,6 @@ typedef struct H5C_cache_entry_t {
     hbool_t			pinned_from_cache;
 
     /* fields supporting the hash table: */
-    struct H5C_cache_entry_t   *ht_next;
-    struct H5C_cache_entry_t   *ht_prev;
     struct H5C_cache_entry_t   *il_next;
     struct H5C_cache_entry_t   *il_prev;
 
@@ -1645,6 +1652,8 @@ typedef struct H5C_cache_entry_t {
     struct H5C_cache_entry_t   *aux_next;
     struct H5C_cache_entry_t   *aux_prev;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
+    hbool_t                     rp_hot;
+    uint64_t                    rp_last_access;
 #ifdef H5_HAVE_PARALLEL
     struct H5C_cache_entry_t   *coll_next;
     struct H5C_cache_entry_t   *coll_prev;
@@ -2260,12 +2269,15 @@ H5_DLL herr_t H5C_get_cache_size(H5C_t *cache_ptr, size_t *max_size_ptr,
     uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5C_get_cache_flush_in_progress(H5C_t *cache_ptr, hbool_t *flush_in_progress_ptr);
 H5_DLL herr_t H5C_get_cache_hit_rate(H5C_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5C_get_cache_hit_rate_by_type(H5C_t *cache_ptr, H5FD_mem_t type,
+    double *hit_rate_ptr, hsize_t *hits_ptr, hsize_t *misses_ptr);
 H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr,
     size_t *size_ptr, hbool_t *in_cache_ptr, hbool_t *is_dirty_ptr,
     hbool_t *is_protected_ptr, hbool_t *is_pinned_ptr, hbool_t *is_corked_ptr,
     hbool_t *is_flush_dep_parent_ptr, hbool_t *is_flush_dep_child_ptr,
     hbool_t *image_up_to_date_ptr);
 H5_DLL herr_t H5C_get_evictions_enabled(const H5C_t *cache_ptr, hbool_t *evictions_enabled_ptr);
+H5_DLL herr_t H5C_get_repl_policy(const H5C_t *cache_ptr, enum H5C_cache_repl_policy *repl_policy_ptr);
 H5_DLL void * H5C_get_aux_ptr(const H5C_t *cache_ptr);
 H5_DLL herr_t H5C_image_stats(H5C_t * cache_ptr, hbool_t print_header);
 H5_DLL herr_t H5C_insert_entry(H5F_t *f, const H5C_class_t *type, haddr_t addr,
@@ -2289,6 +2301,7 @@ H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_c
 H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_image_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_evictions_enabled(H5C_t *cache_ptr, hbool_t evictions_enabled);
+H5_DLL herr_t H5C_set_repl_policy(H5C_t *cache_ptr, enum H5C_cache_repl_policy repl_policy);
 H5_DLL herr_t H5C_set_prefix(H5C_t *cache_ptr, char *prefix);
 H5_DLL herr_t H5C_stats(H5C_t *cache_ptr, const char *cache_name,
     hbool_t display_detailed_stats);
@@ -53,6 +53,13 @@ enum H5C_cache_decr_mode
     H5C_decr__age_out_with_threshold
 };
 
+enum H5C_cache_repl_policy
+{
+    H5C_repl__lru,
+    H5C_repl__2q,
+    H5C_repl__arc
+};
+
 #ifdef __cplusplus
 }
 #endif
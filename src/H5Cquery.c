@@ -224,6 +224,50 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_hit_rate_by_type
+ *
+ * Purpose:	Return the hit rate, number of hits, and number of misses
+ *		of the entries whose class has the given mem_type since
+ *		the last time the cache hit rate stats were reset.  If
+ *		there have been no such accesses, the hit rate is 0.0.
+ *		Any of the pointers may be NULL.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_hit_rate_by_type(H5C_t *cache_ptr, H5FD_mem_t type,
+    double *hit_rate_ptr, hsize_t *hits_ptr, hsize_t *misses_ptr)
+{
+    int64_t hits, accesses;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+    if((type < H5FD_MEM_DEFAULT) || (type >= H5FD_MEM_NTYPES))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad type on entry.")
+
+    hits = cache_ptr->type_hits[type];
+    accesses = cache_ptr->type_accesses[type];
+    HDassert(hits >= 0);
+    HDassert(accesses >= hits);
+
+    if(hit_rate_ptr)
+        *hit_rate_ptr = (accesses > 0) ? ((double)hits) / ((double)accesses) : 0.0f;
+    if(hits_ptr)
+        *hits_ptr = (hsize_t)hits;
+    if(misses_ptr)
+        *misses_ptr = (hsize_t)(accesses - hits);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_hit_rate_by_type() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -349,6 +393,37 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_evictions_enabled() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_repl_policy()
+ *
+ * Purpose:     Copy the current value of cache_ptr->repl_policy into
+ *              *repl_policy_ptr.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_repl_policy(const H5C_t *cache_ptr,
+                    enum H5C_cache_repl_policy *repl_policy_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL ) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+
+    if(repl_policy_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad repl_policy_ptr on entry.")
+
+    *repl_policy_ptr = cache_ptr->repl_policy;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_repl_policy() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_get_aux_ptr
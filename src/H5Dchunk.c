@@ -107,6 +107,38 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Filtered chunks are only decoded concurrently when the library keeps a
+ * separate error stack for each thread and no unsynchronized allocation or
+ * filter statistics tracking is compiled in.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK) && !defined(H5Z_DEBUG)
+#define H5D_CHUNK_FILTER_THREADS
+#endif
+
+/* # of chunks decoded by each thread for each batch of a chunked read */
+#define H5D_CHUNK_FILTER_CHUNKS_PER_THREAD 4
+
+/* Max. # of chunks, and of bytes of chunk data, in each batch of a chunked
+ * read that merges the reads of unfiltered chunks
+ */
+#define H5D_CHUNK_MERGE_MAX_CHUNKS      1024
+#define H5D_CHUNK_MERGE_MAX_BYTES       ((size_t)8 * 1024 * 1024)
+
+/* # of consecutive hash table slots, starting at the chunk's hash value,
+ * that a chunk may be cached in.  Chunks whose hash values collide share
+ * these slots instead of preempting each other.
+ */
+#define H5D_CHUNK_CACHE_NWAYS 8
+
+/* Maximum # of keys in each ghost list of the adaptive replacement cache */
+#define H5D_CHUNK_CACHE_NGHOSTS_MAX 1024
+
+/* A batch of direct chunk reads that asks for at least 1/Nth of the chunks
+ * of a dataset looks them up with one pass over the whole chunk index,
+ * smaller batches look each chunk up in turn.
+ */
+#define H5D_CHUNK_DIRECT_ITERATE_FRACTION 8
+
 /* Flags for the "edge_chunk_state" field below */
 #define H5D_RDCC_DISABLE_FILTERS 0x01u          /* Disable filters on this chunk */
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS 0x02u   /* Filters have been disabled since
@@ -130,6 +162,8 @@ typedef struct H5D_rdcc_ent_t {
     hsize_t     chunk_idx;      /*index of chunk in dataset             */
     uint8_t    *chunk;        /*the unfiltered chunk data        */
     unsigned    idx;        /*index in hash table            */
+    hsize_t     age;            /*cache's clock at last access          */
+    hbool_t     frequent;       /*accessed more than once (ARC)         */
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list    */
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list    */
     struct H5D_rdcc_ent_t *tmp_next;/*next item in temporary doubly-linked list */
@@ -228,6 +262,33 @@ typedef struct H5D_chunk_info_iter_ud_t {
     hbool_t  found;             /* Whether the chunk was found */
 } H5D_chunk_info_iter_ud_t;
 
+/* Callback info for iteration over chunks with H5Dchunk_iter */
+typedef struct H5D_chunk_iter_ud_t {
+    H5D_chunk_iter_op_t op;             /* User defined callback */
+    void *op_data;                      /* User data for user defined callback */
+    unsigned ndims;                     /* Number of dimensions in the dataset */
+    const uint32_t *chunk_dim;          /* Chunk dimensions */
+} H5D_chunk_iter_ud_t;
+
+/* A chunk in a batch of direct chunk reads */
+typedef struct H5D_chunk_direct_ent_t {
+    hsize_t     scaled[H5O_LAYOUT_NDIMS];   /* Scaled coordinates of the chunk */
+    hsize_t     index;              /* Linear index of the chunk in the dataset */
+    size_t      req;                /* Position of the chunk in the caller's arrays */
+    haddr_t     addr;               /* Address of the chunk in the file */
+    hsize_t     nbytes;             /* Size of the chunk in the file */
+    uint32_t    filter_mask;        /* Excluded filters */
+} H5D_chunk_direct_ent_t;
+
+/* Callback info for looking up a batch of direct chunk reads in one pass
+ * over the chunk index */
+typedef struct H5D_chunk_direct_iter_ud_t {
+    H5D_chunk_direct_ent_t *ents;   /* Chunks in the batch, in linear index order */
+    size_t      nents;              /* # of chunks in the batch */
+    unsigned    ndims;              /* # of dimensions of the dataset */
+    const hsize_t *down_chunks;     /* "Down" sizes of the # of chunks in each dimension */
+} H5D_chunk_direct_iter_ud_t;
+
 /* Callback info for file selection iteration */
 typedef struct H5D_chunk_file_iter_ud_t {
     H5D_chunk_map_t *fm;                /* File->memory chunk mapping info */
@@ -236,6 +297,32 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+/* Information about a chunk visited by a [batched] chunked read */
+typedef struct H5D_chunk_read_ent_t {
+    H5D_chunk_info_t *chunk_info;       /* Chunk selection info */
+    H5D_chunk_ud_t udata;               /* Chunk index info for the chunk */
+    hbool_t     prefetch;               /* Whether the chunk is fetched & decoded ahead of the scatter */
+    void        *buf;                   /* Prefetched chunk buffer (filtered, then decoded, bytes) */
+    size_t      nbytes;                 /* # of valid bytes in prefetched buffer */
+    size_t      buf_alloc;              /* Allocated size of prefetched buffer */
+    herr_t      status;                 /* Result of running the filter pipeline on the chunk */
+    hbool_t     merge;                  /* Whether the chunk is read by a merged request */
+    void        *merged_buf;            /* Chunk's bytes in the merged read buffer */
+} H5D_chunk_read_ent_t;
+
+#ifdef H5D_CHUNK_FILTER_THREADS
+/* Information for each thread decoding a batch of prefetched chunks */
+typedef struct H5D_chunk_filter_work_t {
+    const H5O_pline_t *pline;           /* I/O pipeline to run in reverse */
+    H5Z_EDC_t   err_detect;             /* Error detection info */
+    H5Z_cb_t    filter_cb;              /* I/O filter callback function */
+    H5D_chunk_read_ent_t **ents;        /* Prefetched chunks in the batch */
+    size_t      nents;                  /* # of prefetched chunks in the batch */
+    size_t      first;                  /* First chunk decoded by this thread */
+    size_t      stride;                 /* Stride between chunks decoded by this thread */
+} H5D_chunk_filter_work_t;
+#endif /* H5D_CHUNK_FILTER_THREADS */
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -270,6 +357,7 @@ static herr_t H5D__chunk_dest(H5D_t *dset);
 static int H5D__get_num_chunks_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static int H5D__get_chunk_info_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static int H5D__get_chunk_info_by_coord_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *udata);
 
 /* "Nonexistent" layout operation callback */
 static ssize_t
@@ -307,15 +395,28 @@ static herr_t H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
 static herr_t H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
+static hsize_t H5D__chunk_hash_key(const H5D_shared_t *shared, const hsize_t *scaled);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
+static unsigned H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t reset);
+static void H5D__chunk_cache_remove(H5D_shared_t *shared, H5D_rdcc_ent_t *ent);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t flush);
+static herr_t H5D__chunk_cache_preempt(const H5D_t *dset, H5D_rdcc_ent_t *ent);
+static H5D_rdcc_ent_t *H5D__chunk_cache_victim(const H5D_rdcc_t *rdcc);
+static void H5D__chunk_cache_ghost_add(H5D_shared_t *shared, const H5D_rdcc_ent_t *ent);
+static hbool_t H5D__chunk_cache_ghost_hit(H5D_rdcc_t *rdcc, hsize_t key);
+static herr_t H5D__chunk_cache_slot(const H5D_t *dset, const hsize_t *scaled,
+    unsigned *idx);
+static void H5D__chunk_cache_link(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_budget_touch(H5D_shared_t *shared);
+static void H5D__chunk_cache_budget_prune(const H5D_t *dset, size_t size);
 static hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims,
     const uint32_t *chunk_dims, const hsize_t *chunk_scaled, const hsize_t *dset_dims);
 static void *H5D__chunk_lock(const H5D_io_info_t *io_info,
-    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk);
+    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk,
+    void *prefetched);
 static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk, uint32_t naccessed);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
@@ -325,9 +426,22 @@ static herr_t H5D__chunk_collective_fill(const H5D_t *dset,
     H5D_chunk_coll_info_t *chunk_info, size_t chunk_size, const void *fill_buf);
 static int H5D__chunk_cmp_addr(const void *addr1, const void *addr2);
 #endif /* H5_HAVE_PARALLEL */
+static int H5D__chunk_read_ent_cmp_addr(const void *_ent1, const void *_ent2);
+static hbool_t H5D__chunk_is_whole_selected(const H5D_t *dset,
+    const H5D_chunk_info_t *chunk_info);
+static herr_t H5D__chunk_read_merged(const H5D_io_info_t *io_info,
+    H5D_chunk_read_ent_t *ents, size_t nents, size_t gap, void **merge_buf);
+#ifdef H5D_CHUNK_FILTER_THREADS
+static void *H5D__chunk_filter_worker(void *_work);
+static herr_t H5D__chunk_prefetch(const H5D_io_info_t *io_info,
+    H5D_chunk_read_ent_t *ents, size_t nents, unsigned nthreads);
+#endif /* H5D_CHUNK_FILTER_THREADS */
 
 static int
 H5D__chunk_dump_index_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_direct_ent_cmp_index(const void *_ent1, const void *_ent2);
+static int H5D__chunk_direct_ent_cmp_addr(const void *_ent1, const void *_ent2);
+static int H5D__chunk_direct_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -607,6 +721,282 @@ done:
 } /* end H5D__chunk_direct_read() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_ent_cmp_index
+ *
+ * Purpose:     Compare the linear indices of two chunks in a batch of
+ *              direct chunk reads.
+ *
+ * Return:      -1, 0 or 1 as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_ent_cmp_index(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = (const H5D_chunk_direct_ent_t *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = (const H5D_chunk_direct_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI((ent1->index > ent2->index) - (ent1->index < ent2->index))
+} /* H5D__chunk_direct_ent_cmp_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_ent_cmp_addr
+ *
+ * Purpose:     Compare the file addresses of two chunks in a batch of
+ *              direct chunk reads, for reading them in file order.
+ *
+ * Return:      -1, 0 or 1 as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_ent_cmp_addr(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = *(const H5D_chunk_direct_ent_t * const *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = *(const H5D_chunk_direct_ent_t * const *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->addr, ent2->addr))
+} /* H5D__chunk_direct_ent_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_iter_cb
+ *
+ * Purpose:     Chunk index iteration callback that records the address,
+ *              size and filter mask of a chunk for each entry of a batch
+ *              of direct chunk reads that asks for it.
+ *
+ * Return:      H5_ITER_CONT
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_direct_iter_ud_t *udata = (H5D_chunk_direct_iter_ud_t *)_udata;
+    hsize_t     index;                  /* Linear index of the chunk */
+    size_t      lo, hi;                 /* Bounds of the binary search */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Find the first entry for this chunk */
+    index = H5VM_array_offset_pre(udata->ndims, udata->down_chunks, chunk_rec->scaled);
+    lo = 0;
+    hi = udata->nents;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(udata->ents[mid].index < index)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    /* Fill in every entry for it (a chunk may be asked for more than once) */
+    for(; lo < udata->nents && udata->ents[lo].index == index; lo++) {
+        udata->ents[lo].addr = chunk_rec->chunk_addr;
+        udata->ents[lo].nbytes = chunk_rec->nbytes;
+        udata->ents[lo].filter_mask = chunk_rec->filter_mask;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
+} /* H5D__chunk_direct_iter_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_read_multi
+ *
+ * Purpose:     Internal routine to read or map a batch of chunks directly
+ *              from the file.  OFFSETS holds the logical offsets of the
+ *              COUNT chunks.  The chunks are looked up in linear index
+ *              order, either one by one or, for batches that cover a good
+ *              part of the dataset, with a single pass over the chunk
+ *              index.  Then, if BUFS is given, the chunks are read into
+ *              the non-NULL buffers with one vector read, in file address
+ *              order, or, if PTRS is given, PTRS is set to point at them
+ *              in a memory map of the file.
+ *
+ *              Chunks that have not been written get size 0 (and a NULL
+ *              pointer) instead of causing an error.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count, const hsize_t *offsets,
+    uint32_t *filters, hsize_t *sizes, void **bufs, const void **ptrs)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    H5D_rdcc_ent_t     *ent;            /* Chunk cache entry */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks in the batch */
+    H5D_chunk_direct_ent_t **sorted = NULL; /* Chunks to read, in file order */
+    haddr_t            *addrs = NULL;   /* File addresses of chunks to read */
+    size_t             *io_sizes = NULL;    /* Sizes of chunks to read */
+    void              **io_bufs = NULL; /* Buffers of chunks to read */
+    unsigned            ndims = dset->shared->ndims;    /* # of dataset dimensions */
+    size_t              nread = 0;      /* # of chunks to read */
+    size_t              u;              /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(count > 0);
+    HDassert(offsets);
+    HDassert(!(bufs && ptrs));
+
+    /* Compute the coordinates of the chunks */
+    if(NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_malloc(count * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+    for(u = 0; u < count; u++) {
+        hsize_t offset_copy[H5O_LAYOUT_NDIMS];  /* Internal copy of chunk offset */
+
+        if(H5D__get_offset_copy(dset, offsets + (u * ndims), offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, ents[u].scaled);
+        ents[u].scaled[ndims] = 0;
+        ents[u].index = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, ents[u].scaled);
+        ents[u].req = u;
+        ents[u].addr = HADDR_UNDEF;
+        ents[u].nbytes = 0;
+        ents[u].filter_mask = 0;
+    } /* end for */
+
+    /* Write out cached chunks that haven't been, so the file is current */
+    for(ent = dset->shared->cache.chunk.head; ent; ent = ent->next)
+        if(H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Look the chunks up in the chunk index, in index order */
+    if((*layout->ops->is_space_alloc)(&layout->storage)) {
+        H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+
+        HDqsort(ents, count, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_ent_cmp_index);
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = sc;
+
+#ifdef H5_HAVE_PARALLEL
+        /* Disable collective metadata read for chunk indexes, as for
+         * H5D__chunk_lookup() */
+        if(H5F_HAS_FEATURE(idx_info.f, H5FD_FEAT_HAS_MPI))
+            H5CX_set_coll_metadata_read(FALSE);
+#endif /* H5_HAVE_PARALLEL */
+
+        if((hsize_t)count >= layout->u.chunk.nchunks / H5D_CHUNK_DIRECT_ITERATE_FRACTION) {
+            H5D_chunk_direct_iter_ud_t udata;   /* User data for iteration */
+
+            udata.ents = ents;
+            udata.nents = count;
+            udata.ndims = ndims;
+            udata.down_chunks = layout->u.chunk.down_chunks;
+            if((sc->ops->iterate)(&idx_info, H5D__chunk_direct_iter_cb, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+        } /* end if */
+        else
+            for(u = 0; u < count; u++) {
+                H5D_chunk_ud_t udata;       /* User data for querying chunk info */
+                unsigned v;                 /* Local index variable */
+
+                /* Chunks of an offset at the end of a dimension can't exist */
+                for(v = 0; v < ndims; v++)
+                    if(ents[u].scaled[v] >= layout->u.chunk.chunks[v])
+                        break;
+                if(v < ndims)
+                    continue;
+
+                /* Reuse the answer for a chunk asked for again */
+                if(u > 0 && ents[u].index == ents[u - 1].index) {
+                    ents[u].addr = ents[u - 1].addr;
+                    ents[u].nbytes = ents[u - 1].nbytes;
+                    ents[u].filter_mask = ents[u - 1].filter_mask;
+                    continue;
+                } /* end if */
+
+                HDmemset(&udata, 0, sizeof(udata));
+                udata.common.layout = &(dset->shared->layout.u.chunk);
+                udata.common.storage = sc;
+                udata.common.scaled = ents[u].scaled;
+                udata.idx_hint = UINT_MAX;
+                udata.chunk_block.offset = HADDR_UNDEF;
+                if((sc->ops->get_addr)(&idx_info, &udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+
+                if(H5F_addr_defined(udata.chunk_block.offset)) {
+                    ents[u].addr = udata.chunk_block.offset;
+                    ents[u].nbytes = udata.chunk_block.length;
+                    ents[u].filter_mask = udata.filter_mask;
+                } /* end if */
+            } /* end for */
+    } /* end if */
+
+    /* Return the chunks' sizes & filter masks, and map them if asked to */
+    for(u = 0; u < count; u++) {
+        size_t req = ents[u].req;
+
+        if(filters)
+            filters[req] = ents[u].filter_mask;
+        if(sizes)
+            sizes[req] = ents[u].nbytes;
+        if(ptrs) {
+            ptrs[req] = NULL;
+            if(H5F_addr_defined(ents[u].addr))
+                if(H5F_shared_map_raw(H5F_SHARED(dset->oloc.file), ents[u].addr, ents[u].nbytes, &ptrs[req]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't map raw data chunk")
+        } /* end if */
+        else if(bufs && bufs[req] && H5F_addr_defined(ents[u].addr))
+            nread++;
+    } /* end for */
+
+    /* Read the chunks' bytes, in file order, with a single vector request */
+    if(nread > 0) {
+        size_t v;
+
+        if(NULL == (sorted = (H5D_chunk_direct_ent_t **)H5MM_malloc(nread * sizeof(H5D_chunk_direct_ent_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+        for(u = 0, v = 0; u < count; u++)
+            if(bufs[ents[u].req] && H5F_addr_defined(ents[u].addr))
+                sorted[v++] = &ents[u];
+        HDqsort(sorted, nread, sizeof(H5D_chunk_direct_ent_t *), H5D__chunk_direct_ent_cmp_addr);
+
+        if(NULL == (addrs = (haddr_t *)H5MM_malloc(nread * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+        if(NULL == (io_sizes = (size_t *)H5MM_malloc(nread * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+        if(NULL == (io_bufs = (void **)H5MM_malloc(nread * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+        for(u = 0; u < nread; u++) {
+            addrs[u] = sorted[u]->addr;
+            H5_CHECKED_ASSIGN(io_sizes[u], size_t, sorted[u]->nbytes, hsize_t);
+            io_bufs[u] = bufs[sorted[u]->req];
+        } /* end for */
+        if(H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, nread, addrs, io_sizes, io_bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+    } /* end if */
+
+done:
+    H5MM_xfree(io_bufs);
+    H5MM_xfree(io_sizes);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sorted);
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_read_multi() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_chunk_storage_size
  *
@@ -971,6 +1361,13 @@ H5D__chunk_init(H5F_t *f, const H5D_t * const dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if(H5P_get(dapl, H5D_ACS_CHUNK_CACHE_POLICY_NAME, &rdcc->policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache policy")
+
+    /* A dataset's cache can't hold more than the file-wide budget */
+    if(H5F_RDCC_BUDGET(f)->nbytes_max > 0)
+        rdcc->nbytes_max = MIN(rdcc->nbytes_max, H5F_RDCC_BUDGET(f)->nbytes_max);
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -981,6 +1378,18 @@ H5D__chunk_init(H5F_t *f, const H5D_t * const dset, hid_t dapl_id)
 
         /* Reset any cached chunk info for this dataset */
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+
+        /* Size the ghost lists of the adaptive replacement cache after the
+         * number of chunks the cache can hold */
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy) {
+            rdcc->arc.capacity = rdcc->nbytes_max / MAX(dset->shared->layout.u.chunk.size, 1);
+            rdcc->arc.capacity = MAX(MIN(rdcc->arc.capacity, rdcc->nslots), 1);
+            rdcc->arc.nghosts_max = MIN(rdcc->arc.capacity, H5D_CHUNK_CACHE_NGHOSTS_MAX);
+            if(NULL == (rdcc->arc.recent_ghosts = (hsize_t *)H5MM_malloc(rdcc->arc.nghosts_max * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache ghost list")
+            if(NULL == (rdcc->arc.frequent_ghosts = (hsize_t *)H5MM_malloc(rdcc->arc.nghosts_max * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache ghost list")
+        } /* end if */
     } /* end else */
 
     /* Compute scaled dimension info, if dataset dims > 1 */
@@ -1023,6 +1432,12 @@ H5D__chunk_init(H5F_t *f, const H5D_t * const dset, hid_t dapl_id)
     if(H5D__chunk_set_info(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
 
+    /* Share the file-wide budget with the other datasets */
+    if(rdcc->nslots > 0 && H5F_RDCC_BUDGET(f)->nbytes_max > 0) {
+        rdcc->budget = H5F_RDCC_BUDGET(f);
+        H5D__chunk_cache_budget_touch(dset->shared);
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_init() */
@@ -2504,6 +2919,16 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
     hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    H5D_chunk_read_ent_t single_ent;    /* Chunk info, when chunks are visited one at a time */
+    H5D_chunk_read_ent_t *ents = &single_ent;   /* Chunks in the current batch */
+    size_t      max_ents = 1;           /* Max. # of chunks in a batch */
+    size_t      nents = 0;              /* # of chunks in the current batch */
+    unsigned    filter_nthreads = 1;    /* # of threads decoding filtered chunks */
+    hbool_t     merge_chunks = FALSE;   /* Whether reads of whole unfiltered chunks are merged */
+    size_t      chunk_read_gap = 0;     /* Largest gap between chunks read by one request */
+    size_t      merge_nbytes;           /* # of bytes of chunks read by merged requests in the batch */
+    void        *merge_buf = NULL;      /* Buffer for the batch's merged reads */
+    size_t      u;                      /* Local index variable */
     herr_t    ret_value = SUCCEED;    /*return value        */
 
     FUNC_ENTER_STATIC
@@ -2552,163 +2977,652 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             skip_missing_chunks = TRUE;
     }
 
+#ifdef H5D_CHUNK_FILTER_THREADS
+    /* Check if filtered chunks should be decoded by several threads */
+    if(io_info->dset->shared->dcpl_cache.pline.nused > 0 && !fm->use_single
+            && H5SL_count(fm->sel_chunks) > 1) {
+        H5Z_cb_t filter_cb;             /* I/O filter callback function */
+
+        if(H5CX_get_filter_nthreads(&filter_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get filter pipeline thread count")
+        if(H5CX_get_filter_cb(&filter_cb) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+        /* Application callbacks and filters are only invoked on the calling thread */
+        if(filter_cb.func || !H5Z_pipeline_reentrant(&(io_info->dset->shared->dcpl_cache.pline)))
+            filter_nthreads = 1;
+#ifdef H5_HAVE_PARALLEL
+        if(io_info->using_mpi_vfd)
+            filter_nthreads = 1;
+#endif /* H5_HAVE_PARALLEL */
+    } /* end if */
+#endif /* H5D_CHUNK_FILTER_THREADS */
+
+    /* Check if reads of unfiltered chunks that are near each other in the
+     * file should be merged (chunks of files the driver keeps in a memory
+     * map are copied straight from the map instead)
+     */
+    if(io_info->dset->shared->dcpl_cache.pline.nused == 0 && !fm->use_single
+            && H5SL_count(fm->sel_chunks) > 1
+            && !H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_MEMORY_MAPPED)) {
+        if(H5CX_get_chunk_read_gap(&chunk_read_gap) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk read merge gap")
+        merge_chunks = TRUE;
+#ifdef H5_HAVE_PARALLEL
+        if(io_info->using_mpi_vfd)
+            merge_chunks = FALSE;
+#endif /* H5_HAVE_PARALLEL */
+    } /* end if */
+
+    /* Allocate space for batches of chunks to decode or read together */
+    if(filter_nthreads > 1 || merge_chunks) {
+        if(filter_nthreads > 1)
+            max_ents = (size_t)filter_nthreads * H5D_CHUNK_FILTER_CHUNKS_PER_THREAD;
+        else
+            max_ents = MIN(H5SL_count(fm->sel_chunks), (size_t)H5D_CHUNK_MERGE_MAX_CHUNKS);
+        if(NULL == (ents = (H5D_chunk_read_ent_t *)H5MM_calloc(max_ents * sizeof(H5D_chunk_read_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    } /* end if */
+    else
+        HDmemset(&single_ent, 0, sizeof(single_ent));
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
-        H5D_chunk_ud_t udata;        /* Chunk index pass-through    */
+        /* Gather the next batch of chunks */
+        nents = 0;
+        merge_nbytes = 0;
+        while(chunk_node && nents < max_ents && merge_nbytes < H5D_CHUNK_MERGE_MAX_BYTES) {
+            H5D_chunk_read_ent_t *ent = &ents[nents++];
+
+            /* Get the actual chunk information from the skip list node */
+            ent->chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+            ent->prefetch = FALSE;
+            ent->buf = NULL;
+            ent->merge = FALSE;
+            ent->merged_buf = NULL;
+
+            /* Get the info for the chunk in the file */
+            if(H5D__chunk_lookup(io_info->dset, ent->chunk_info->scaled, &ent->udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+            /* Sanity check */
+            HDassert((H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length > 0) ||
+                    (!H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length == 0));
 
-        /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+            /* Filtered chunks that must be read from the file are fetched &
+             * decoded for the whole batch at once, unless they are partial
+             * edge chunks with their filters disabled.
+             */
+            if(max_ents > 1 && H5F_addr_defined(ent->udata.chunk_block.offset)
+                    && UINT_MAX == ent->udata.idx_hint && !ent->udata.new_unfilt_chunk)
+                ent->prefetch = !((io_info->dset->shared->layout.u.chunk.flags
+                            & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS)
+                        && H5D__chunk_is_partial_edge_chunk(io_info->dset->shared->ndims,
+                            io_info->dset->shared->layout.u.chunk.dim,
+                            ent->chunk_info->scaled, io_info->dset->shared->curr_dims));
+
+            /* Unfiltered chunks that must be read from the file and are
+             * selected in whole are read for the whole batch at once, with
+             * chunks that are near each other in the file read by a single
+             * request.  Partially selected chunks still go through the
+             * chunk cache, so that reading a chunk piece by piece only
+             * reads it from the file once.
+             */
+            if(merge_chunks && H5F_addr_defined(ent->udata.chunk_block.offset)
+                    && UINT_MAX == ent->udata.idx_hint
+                    && ent->udata.chunk_block.length < H5D_CHUNK_MERGE_MAX_BYTES
+                    && H5D__chunk_is_whole_selected(io_info->dset, ent->chunk_info)) {
+                ent->merge = TRUE;
+                merge_nbytes += (size_t)ent->udata.chunk_block.length;
+            } /* end if */
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+            /* Advance to next chunk in list */
+            chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        } /* end while */
+
+#ifdef H5D_CHUNK_FILTER_THREADS
+        /* Read and decode the batch's filtered chunks */
+        if(max_ents > 1)
+            if(H5D__chunk_prefetch(io_info, ents, nents, filter_nthreads) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to prefetch raw data chunks")
+#endif /* H5D_CHUNK_FILTER_THREADS */
+
+        /* Read the batch's whole unfiltered chunks with merged requests */
+        if(merge_nbytes > 0)
+            if(H5D__chunk_read_merged(io_info, ents, nents, chunk_read_gap, &merge_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+        /* Scatter the batch's chunks into the application's buffer */
+        for(u = 0; u < nents; u++) {
+            H5D_chunk_info_t *chunk_info = ents[u].chunk_info;   /* Chunk information */
+            H5D_chunk_ud_t *udata = &ents[u].udata;  /* Chunk index pass-through */
+
+            /* A chunk that was in the cache when the batch was gathered may
+             * have been evicted by an earlier chunk in the batch since then.
+             */
+            if(u > 0 && UINT_MAX != udata->idx_hint)
+                if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+            /* Check for non-existant chunk & skip it if appropriate */
+            if(H5F_addr_defined(udata->chunk_block.offset) || UINT_MAX != udata->idx_hint
+                    || !skip_missing_chunks) {
+                H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
+                void *chunk = NULL;             /* Pointer to locked chunk buffer */
+                htri_t cacheable;               /* Whether the chunk is cacheable */
 
-        /* Check for non-existant chunk & skip it if appropriate */
-        if(H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint
-                || !skip_missing_chunks) {
-            H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
-            void *chunk = NULL;             /* Pointer to locked chunk buffer */
-            htri_t cacheable;               /* Whether the chunk is cacheable */
+                /* Set chunk's [scaled] coordinates */
+                io_info->store->chunk.scaled = chunk_info->scaled;
 
-            /* Set chunk's [scaled] coordinates */
-            io_info->store->chunk.scaled = chunk_info->scaled;
+                /* Determine if we should use the chunk cache */
+                if((cacheable = H5D__chunk_cacheable(io_info, udata->chunk_block.offset, FALSE)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
 
-            /* Determine if we should use the chunk cache */
-            if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-            if(cacheable) {
-                /* Load the chunk into cache and lock it. */
+                /* Hand cacheable chunks read by merged requests to the chunk
+                 * cache, as if they had been prefetched
+                 */
+                if(ents[u].merge && cacheable) {
+                    HDassert(NULL == ents[u].buf);
+                    if(NULL == (ents[u].buf = H5D__chunk_mem_alloc((size_t)io_info->dset->shared->layout.u.chunk.size, &(io_info->dset->shared->dcpl_cache.pline))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+                    H5MM_memcpy(ents[u].buf, ents[u].merged_buf, (size_t)udata->chunk_block.length);
+                } /* end if */
 
-                /* Compute # of bytes accessed in chunk */
-                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
-                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+                if(ents[u].merge && !cacheable) {
+                    /* Set up the storage buffer information for this chunk */
+                    cpt_store.compact.buf = ents[u].merged_buf;
 
-                /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+                    /* Point I/O info at compact I/O info for this chunk */
+                    chk_io_info = &cpt_io_info;
+                } /* end if */
+                else if(cacheable) {
+                    void *prefetched = ents[u].buf;     /* Chunk read or decoded ahead of time */
 
-                /* Set up the storage buffer information for this chunk */
-                cpt_store.compact.buf = chunk;
+                    /* Load the chunk into cache and lock it. */
 
-                /* Point I/O info at contiguous I/O info for this chunk */
-                chk_io_info = &cpt_io_info;
-            } /* end if */
-            else if(H5F_addr_defined(udata.chunk_block.offset)) {
-                /* Set up the storage address information for this chunk */
-                ctg_store.contig.dset_addr = udata.chunk_block.offset;
+                    /* Compute # of bytes accessed in chunk */
+                    H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
+                    src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
-                /* Point I/O info at temporary I/O info for this chunk */
-                chk_io_info = &ctg_io_info;
-            } /* end else if */
-            else {
-                /* Point I/O info at "nonexistent" I/O info for this chunk */
-                chk_io_info = &nonexistent_io_info;
-            } /* end else */
+                    /* Lock the chunk into the cache (which takes over any prefetched buffer) */
+                    ents[u].buf = NULL;
+                    if(NULL == (chunk = H5D__chunk_lock(io_info, udata, FALSE, FALSE, prefetched)))
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
-            /* Perform the actual read operation */
-            if((io_info->io_ops.single_read)(chk_io_info, type_info,
-                    (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+                    /* Set up the storage buffer information for this chunk */
+                    cpt_store.compact.buf = chunk;
 
-            /* Release the cache lock on the chunk. */
-            if(chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
-        } /* end if */
+                    /* Point I/O info at contiguous I/O info for this chunk */
+                    chk_io_info = &cpt_io_info;
+                } /* end if */
+                else if(H5F_addr_defined(udata->chunk_block.offset)) {
+                    /* Set up the storage address information for this chunk */
+                    ctg_store.contig.dset_addr = udata->chunk_block.offset;
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+                    /* Point I/O info at temporary I/O info for this chunk */
+                    chk_io_info = &ctg_io_info;
+                } /* end else if */
+                else {
+                    /* Point I/O info at "nonexistent" I/O info for this chunk */
+                    chk_io_info = &nonexistent_io_info;
+                } /* end else */
+
+                /* Perform the actual read operation */
+                if((io_info->io_ops.single_read)(chk_io_info, type_info,
+                        (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+
+                /* Release the cache lock on the chunk. */
+                if(chunk && H5D__chunk_unlock(io_info, udata, FALSE, chunk, src_accessed_bytes) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+            } /* end if */
+        } /* end for */
+
+        /* Release the batch's merged read buffer */
+        merge_buf = H5MM_xfree(merge_buf);
     } /* end while */
 
 done:
+    /* Release any prefetched chunks that weren't handed to the chunk cache */
+    for(u = 0; u < nents; u++)
+        if(ents[u].buf)
+            ents[u].buf = H5D__chunk_mem_xfree(ents[u].buf, &(io_info->dset->shared->dcpl_cache.pline));
+    if(ents != &single_ent)
+        ents = (H5D_chunk_read_ent_t *)H5MM_xfree(ents);
+    merge_buf = H5MM_xfree(merge_buf);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_write
- *
- * Purpose:    Writes to a chunked dataset.
+ * Function:    H5D__chunk_read_ent_cmp_addr
  *
- * Return:    Non-negative on success/Negative on failure
+ * Purpose:     Compare the file addresses of two chunks in a batch, for
+ *              sorting prefetched or merged chunks into file order.
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
+ * Return:      <0, 0, >0 (as for qsort)
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-    H5D_chunk_map_t *fm)
+static int
+H5D__chunk_read_ent_cmp_addr(const void *_ent1, const void *_ent2)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
-    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
-    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
-    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
-    herr_t    ret_value = SUCCEED;    /* Return value        */
+    const H5D_chunk_read_ent_t *ent1 = *(const H5D_chunk_read_ent_t * const *)_ent1;
+    const H5D_chunk_read_ent_t *ent2 = *(const H5D_chunk_read_ent_t * const *)_ent2;
+    int ret_value = 0;          /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.wbuf);
-    HDassert(type_info);
-    HDassert(fm);
+    ret_value = H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset);
 
-    /* Set up contiguous I/O info object */
-    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_read_ent_cmp_addr() */
 
-    /* Initialize temporary contiguous storage info */
-    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size, uint32_t);
 
-    /* Set up compact I/O info object */
-    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_is_whole_selected
+ *
+ * Purpose:     Check if every element of a chunk that lies within the
+ *              dataset's current extent is selected.
+ *
+ * Return:      TRUE if the whole chunk is selected, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_is_whole_selected(const H5D_t *dset, const H5D_chunk_info_t *chunk_info)
+{
+    const uint32_t *chunk_dims = dset->shared->layout.u.chunk.dim;   /* Chunk dimensions */
+    hsize_t     nelmts = 1;             /* # of elements of the chunk within the extent */
+    unsigned    u;                      /* Local index variable */
+    hbool_t     ret_value = FALSE;      /* Return value */
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
-    H5D_chk_idx_info_t idx_info;    /* Chunked index info */
-        H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
-        void *chunk;                    /* Pointer to locked chunk buffer */
-        H5D_chunk_ud_t udata;        /* Index pass-through    */
-        htri_t cacheable;               /* Whether the chunk is cacheable */
-        hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(chunk_info);
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+    for(u = 0; u < dset->shared->ndims; u++) {
+        hsize_t chunk_start = chunk_info->scaled[u] * chunk_dims[u];  /* Offset of chunk in dimension */
 
-        /* Look up the chunk */
-        if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        nelmts *= MIN((hsize_t)chunk_dims[u], dset->shared->curr_dims[u] - chunk_start);
+    } /* end for */
+    ret_value = (nelmts == (hsize_t)chunk_info->chunk_points);
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_is_whole_selected() */
 
-    /* Set chunk's [scaled] coordinates */
-    io_info->store->chunk.scaled = chunk_info->scaled;
 
-        /* Determine if we should use the chunk cache */
-        if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, TRUE)) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-        if(cacheable) {
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_merged
+ *
+ * Purpose:     Read the chunks in a batch that are marked for merging,
+ *              in file address order.  Chunks that are adjacent in the
+ *              file, or separated by no more than GAP bytes, are read by
+ *              a single request (and the bytes between them discarded),
+ *              and all of the requests are issued as one vector read.
+ *              On success *MERGE_BUF holds the bytes read, which the
+ *              caller must free, and each merged chunk's merged_buf
+ *              points at its bytes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_merged(const H5D_io_info_t *io_info, H5D_chunk_read_ent_t *ents,
+    size_t nents, size_t gap, void **merge_buf)
+{
+    H5D_shared_t *shared = io_info->dset->shared;   /* Shared dataset info */
+    H5D_chunk_read_ent_t **sorted = NULL;   /* Merged chunks, in file order */
+    size_t      nsorted = 0;            /* # of merged chunks */
+    haddr_t     *addrs = NULL;          /* File addresses of merged requests */
+    size_t      *sizes = NULL;          /* Sizes of merged requests */
+    void        **bufs = NULL;          /* Buffers for merged requests */
+    size_t      nruns = 0;              /* # of merged requests */
+    size_t      buf_size = 0;           /* Total size of merged requests */
+    uint8_t     *buf;                   /* Pointer into merged read buffer */
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(io_info);
+    HDassert(ents);
+    HDassert(merge_buf && NULL == *merge_buf);
+    HDassert(shared->dcpl_cache.pline.nused == 0);
+
+    /* Collect the chunks to read */
+    if(NULL == (sorted = (H5D_chunk_read_ent_t **)H5MM_malloc(nents * sizeof(H5D_chunk_read_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+    for(u = 0; u < nents; u++)
+        if(ents[u].merge)
+            sorted[nsorted++] = &ents[u];
+    if(0 == nsorted)
+        HGOTO_DONE(SUCCEED)
+
+    /* Chunks that bypass the chunk cache may have been written through the
+     * dataset's sieve buffer, so write any dirty data in it to the file first
+     */
+    if(shared->cache.contig.sieve_buf && shared->cache.contig.sieve_dirty) {
+        if(H5F_shared_block_write(H5F_SHARED(io_info->dset->oloc.file), H5FD_MEM_DRAW, shared->cache.contig.sieve_loc,
+                shared->cache.contig.sieve_size, shared->cache.contig.sieve_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+        shared->cache.contig.sieve_dirty = FALSE;
+    } /* end if */
+
+    /* Coalesce the chunks, in file order, into requests */
+    HDqsort(sorted, nsorted, sizeof(H5D_chunk_read_ent_t *), H5D__chunk_read_ent_cmp_addr);
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(nsorted * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(nsorted * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+    if(NULL == (bufs = (void **)H5MM_malloc(nsorted * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+    for(u = 0; u < nsorted; u++) {
+        haddr_t addr = sorted[u]->udata.chunk_block.offset;     /* Address of chunk */
+        size_t  len = (size_t)sorted[u]->udata.chunk_block.length;  /* Size of chunk */
+
+        /* Chunks never overlap, so the chunk starts after the last request ends */
+        HDassert(0 == nruns || H5F_addr_ge(addr, addrs[nruns - 1] + sizes[nruns - 1]));
+
+        if(nruns > 0 && (addr - (addrs[nruns - 1] + sizes[nruns - 1])) <= gap) {
+            /* Extend the request to the end of the chunk */
+            buf_size -= sizes[nruns - 1];
+            sizes[nruns - 1] = (size_t)((addr + len) - addrs[nruns - 1]);
+            buf_size += sizes[nruns - 1];
+        } /* end if */
+        else {
+            /* Start a new request */
+            addrs[nruns] = addr;
+            sizes[nruns] = len;
+            buf_size += len;
+            nruns++;
+        } /* end else */
+    } /* end for */
+
+    /* Allocate the buffer for all the requests */
+    if(NULL == (*merge_buf = H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for merged chunk read")
+
+    /* Set up each request's buffer & point the chunks at their bytes */
+    buf = (uint8_t *)*merge_buf;
+    for(u = 0, v = 0; u < nruns; u++) {
+        bufs[u] = buf;
+        while(v < nsorted && H5F_addr_lt(sorted[v]->udata.chunk_block.offset, addrs[u] + sizes[u])) {
+            sorted[v]->merged_buf = buf + (sorted[v]->udata.chunk_block.offset - addrs[u]);
+            v++;
+        } /* end while */
+        buf += sizes[u];
+    } /* end for */
+    HDassert(v == nsorted);
+
+    /* Read the chunks */
+    if(H5F_shared_vector_read(H5F_SHARED(io_info->dset->oloc.file), H5FD_MEM_DRAW, nruns, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+done:
+    if(sorted)
+        sorted = (H5D_chunk_read_ent_t **)H5MM_xfree(sorted);
+    addrs = (haddr_t *)H5MM_xfree(addrs);
+    sizes = (size_t *)H5MM_xfree(sizes);
+    bufs = (void **)H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_read_merged() */
+
+#ifdef H5D_CHUNK_FILTER_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_worker
+ *
+ * Purpose:     Run the I/O pipeline in reverse on this thread's share of
+ *              a batch of prefetched chunks.  Errors are recorded in each
+ *              chunk's status and reported by the thread that started
+ *              the batch.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_filter_worker(void *_work)
+{
+    H5D_chunk_filter_work_t *work = (H5D_chunk_filter_work_t *)_work;
+    size_t u;                   /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = work->first; u < work->nents; u += work->stride) {
+        H5D_chunk_read_ent_t *ent = work->ents[u];
+
+        ent->status = H5Z_pipeline(work->pline, H5Z_FLAG_REVERSE, &(ent->udata.filter_mask),
+                work->err_detect, work->filter_cb, &ent->nbytes, &ent->buf_alloc, &ent->buf);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* H5D__chunk_filter_worker() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch
+ *
+ * Purpose:     Read the filtered bytes of the chunks in a batch that are
+ *              marked for prefetching, in file address order, and then
+ *              run the I/O pipeline on them with NTHREADS threads
+ *              (including the calling thread).  On success each such
+ *              chunk's buffer holds its decoded bytes, ready to be handed
+ *              to H5D__chunk_lock.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch(const H5D_io_info_t *io_info, H5D_chunk_read_ent_t *ents,
+    size_t nents, unsigned nthreads)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_chunk_read_ent_t **sorted = NULL;   /* Prefetched chunks, in file order */
+    size_t      nsorted = 0;            /* # of prefetched chunks */
+    haddr_t     *addrs = NULL;          /* File addresses of prefetched chunks */
+    size_t      *sizes = NULL;          /* Sizes of prefetched chunks */
+    void        **bufs = NULL;          /* Buffers for prefetched chunks */
+    H5Z_EDC_t   err_detect;             /* Error detection info */
+    H5Z_cb_t    filter_cb;              /* I/O filter callback function */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(io_info);
+    HDassert(ents);
+    HDassert(nthreads > 0);
+    HDassert(pline->nused > 0);
+
+    /* Collect the chunks to prefetch */
+    if(NULL == (sorted = (H5D_chunk_read_ent_t **)H5MM_malloc(nents * sizeof(H5D_chunk_read_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+    for(u = 0; u < nents; u++)
+        if(ents[u].prefetch)
+            sorted[nsorted++] = &ents[u];
+    if(0 == nsorted)
+        HGOTO_DONE(SUCCEED)
+
+    /* Read the chunks' filtered bytes, in file order, with a single vector
+     * request so that drivers which can keep many reads in flight see the
+     * whole batch at once
+     */
+    HDqsort(sorted, nsorted, sizeof(H5D_chunk_read_ent_t *), H5D__chunk_read_ent_cmp_addr);
+    if(NULL == (addrs = (haddr_t *)H5MM_malloc(nsorted * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+    if(NULL == (sizes = (size_t *)H5MM_malloc(nsorted * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+    if(NULL == (bufs = (void **)H5MM_malloc(nsorted * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+    for(u = 0; u < nsorted; u++) {
+        H5D_chunk_read_ent_t *ent = sorted[u];
+
+        H5_CHECKED_ASSIGN(ent->nbytes, size_t, ent->udata.chunk_block.length, hsize_t);
+        ent->buf_alloc = ent->nbytes;
+        if(NULL == (ent->buf = H5D__chunk_mem_alloc(ent->buf_alloc, pline)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+        addrs[u] = ent->udata.chunk_block.offset;
+        sizes[u] = ent->nbytes;
+        bufs[u] = ent->buf;
+    } /* end for */
+    if(H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, nsorted, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+    /* Retrieve filter settings from API context */
+    if(H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    /* Decode the chunks */
+    if(nthreads > 1 && nsorted > 1) {
+        H5D_chunk_filter_work_t *work = NULL;   /* Work description for each thread */
+        H5TS_thread_t *threads = NULL;          /* Helper threads */
+        unsigned nworkers;                      /* # of threads, including this one */
+        unsigned v;                             /* Local index variable */
+
+        nworkers = (unsigned)MIN(nthreads, nsorted);
+        if(NULL == (work = (H5D_chunk_filter_work_t *)H5MM_malloc(nworkers * sizeof(H5D_chunk_filter_work_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter work info")
+        if(NULL == (threads = (H5TS_thread_t *)H5MM_malloc(nworkers * sizeof(H5TS_thread_t)))) {
+            work = (H5D_chunk_filter_work_t *)H5MM_xfree(work);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter threads")
+        } /* end if */
+
+        /* Hand each thread every nworkers'th chunk, in file order */
+        for(v = 0; v < nworkers; v++) {
+            work[v].pline = pline;
+            work[v].err_detect = err_detect;
+            work[v].filter_cb = filter_cb;
+            work[v].ents = sorted;
+            work[v].nents = nsorted;
+            work[v].first = v;
+            work[v].stride = nworkers;
+        } /* end for */
+
+        /* Decode the first share on this thread while the others run */
+        for(v = 1; v < nworkers; v++)
+            threads[v] = H5TS_create_thread(H5D__chunk_filter_worker, NULL, &work[v]);
+        H5D__chunk_filter_worker(&work[0]);
+        for(v = 1; v < nworkers; v++)
+            H5TS_wait_for_thread(threads[v]);
+
+        threads = (H5TS_thread_t *)H5MM_xfree(threads);
+        work = (H5D_chunk_filter_work_t *)H5MM_xfree(work);
+    } /* end if */
+    else
+        for(u = 0; u < nsorted; u++)
+            sorted[u]->status = H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(sorted[u]->udata.filter_mask),
+                    err_detect, filter_cb, &sorted[u]->nbytes, &sorted[u]->buf_alloc, &sorted[u]->buf);
+
+    /* Check for failures */
+    for(u = 0; u < nsorted; u++)
+        if(sorted[u]->status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+done:
+    if(sorted)
+        sorted = (H5D_chunk_read_ent_t **)H5MM_xfree(sorted);
+    addrs = (haddr_t *)H5MM_xfree(addrs);
+    sizes = (size_t *)H5MM_xfree(sizes);
+    bufs = (void **)H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_prefetch() */
+#endif /* H5D_CHUNK_FILTER_THREADS */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_write
+ *
+ * Purpose:    Writes to a chunked dataset.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+    H5D_chunk_map_t *fm)
+{
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
+    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
+    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
+    herr_t    ret_value = SUCCEED;    /* Return value        */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.wbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set up contiguous I/O info object */
+    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+
+    /* Initialize temporary contiguous storage info */
+    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size, uint32_t);
+
+    /* Set up compact I/O info object */
+    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
+
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while(chunk_node) {
+        H5D_chunk_info_t *chunk_info;   /* Chunk information */
+    H5D_chk_idx_info_t idx_info;    /* Chunked index info */
+        H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
+        void *chunk;                    /* Pointer to locked chunk buffer */
+        H5D_chunk_ud_t udata;        /* Index pass-through    */
+        htri_t cacheable;               /* Whether the chunk is cacheable */
+        hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
+
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+
+        /* Look up the chunk */
+        if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+
+    /* Set chunk's [scaled] coordinates */
+    io_info->store->chunk.scaled = chunk_info->scaled;
+
+        /* Determine if we should use the chunk cache */
+        if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, TRUE)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+        if(cacheable) {
             /* Load the chunk into cache.  But if the whole chunk is written,
              * simply allocate space instead of load the chunk. */
             hbool_t entire_chunk = TRUE;       /* Whether whole chunk is selected */
@@ -2724,7 +3638,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 entire_chunk = FALSE;
 
             /* Lock the chunk into the cache */
-            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
+            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -2923,9 +3837,23 @@ H5D__chunk_dest(H5D_t *dset)
     if(nerrors)
         HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Leave the file-wide budget */
+    if(rdcc->budget) {
+        if(rdcc->budget_prev)
+            rdcc->budget_prev->cache.chunk.budget_next = rdcc->budget_next;
+        else
+            rdcc->budget->head = rdcc->budget_next;
+        if(rdcc->budget_next)
+            rdcc->budget_next->cache.chunk.budget_prev = rdcc->budget_prev;
+        else
+            rdcc->budget->tail = rdcc->budget_prev;
+    } /* end if */
+
     /* Release cache structures */
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    H5MM_xfree(rdcc->arc.recent_ghosts);
+    H5MM_xfree(rdcc->arc.frequent_ghosts);
     HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
     /* Compose chunked index info struct */
@@ -3144,23 +4072,22 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_hash_val
+ * Function:    H5D__chunk_hash_key
  *
- * Purpose:    To calculate an index based on the dataset's scaled
+ * Purpose:    To calculate a key based on the dataset's scaled
  *        coordinates and sizes of the faster dimensions.
  *
- * Return:    Hash value index
+ * Return:    Hash key
  *
  * Programmer:    Vailin Choi; Nov 2014
  *
  *-------------------------------------------------------------------------
  */
-static unsigned
-H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
+static hsize_t
+H5D__chunk_hash_key(const H5D_shared_t *shared, const hsize_t *scaled)
 {
     hsize_t val;        /* Intermediate value */
     unsigned ndims = shared->ndims;      /* Rank of dataset */
-    unsigned ret = 0;   /* Value to return */
     unsigned u;         /* Local index variable */
 
     FUNC_ENTER_STATIC_NOERR
@@ -3178,13 +4105,89 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
         val ^= scaled[u];
     } /* end for */
 
+    FUNC_LEAVE_NOAPI(val)
+} /* H5D__chunk_hash_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_hash_val
+ *
+ * Purpose:    To calculate an index based on the dataset's scaled
+ *        coordinates and sizes of the faster dimensions.
+ *
+ * Return:    Hash value index
+ *
+ * Programmer:    Vailin Choi; Nov 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
+{
+    unsigned ret = 0;   /* Value to return */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(shared);
+    HDassert(scaled);
+
     /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    ret = (unsigned)(H5D__chunk_hash_key(shared, scaled) % shared->cache.chunk.nslots);
 
     FUNC_LEAVE_NOAPI(ret)
 } /* H5D__chunk_hash_val() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_find
+ *
+ * Purpose:    Look for a chunk in the slots of the cache's hash table
+ *        that it may be cached in.
+ *
+ * Return:    Index of the chunk's slot, or UINT_MAX if the chunk isn't
+ *        in the cache
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled)
+{
+    const H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Raw data chunk cache */
+    size_t nways = MIN(rdcc->nslots, H5D_CHUNK_CACHE_NWAYS); /* # of slots to look in */
+    unsigned idx;               /* Index of slot */
+    size_t w;                   /* Local index variable */
+    unsigned ret_value = UINT_MAX;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(rdcc->nslots > 0);
+
+    idx = H5D__chunk_hash_val(shared, scaled);
+    for(w = 0; w < nways; w++) {
+        const H5D_rdcc_ent_t *ent = rdcc->slot[idx];
+
+        if(ent) {
+            unsigned u;         /* Counter */
+
+            /* Check if the cache entry is the correct chunk */
+            for(u = 0; u < shared->ndims; u++)
+                if(scaled[u] != ent->scaled[u])
+                    break;
+            if(u == shared->ndims)
+                HGOTO_DONE(idx)
+        } /* end if */
+
+        if(++idx == rdcc->nslots)
+            idx = 0;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_find() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lookup
  *
@@ -3204,8 +4207,7 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
 {
     H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
     H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
-    unsigned idx;                       /* Index of chunk in cache, if present */
-    hbool_t found = FALSE;              /* In cache? */
+    unsigned idx = UINT_MAX;            /* Index of chunk in cache, if present */
     herr_t ret_value = SUCCEED;            /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -3229,29 +4231,12 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
     udata->new_unfilt_chunk = FALSE;
 
     /* Check for chunk in cache */
-    if(dset->shared->cache.chunk.nslots > 0) {
-        /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
-
-        /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if(ent) {
-            unsigned u;                  /* Counter */
-
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
-
-            /* Verify that the cache entry is the correct chunk */
-            for(u = 0; u < dset->shared->ndims; u++)
-                if(scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
-        } /* end if */
-    } /* end if */
+    if(dset->shared->cache.chunk.nslots > 0)
+        idx = H5D__chunk_cache_find(dset->shared, scaled);
 
     /* Retrieve chunk addr */
-    if(found) {
+    if(UINT_MAX != idx) {
+        ent = dset->shared->cache.chunk.slot[idx];
         udata->idx_hint = idx;
         udata->chunk_block.offset = ent->chunk_block.offset;
         udata->chunk_block.length = ent->chunk_block.length;;
@@ -3476,125 +4461,540 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             if((sc->ops->insert)(&idx_info, &udata, dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
 
-        /* Cache the chunk's info, in case it's accessed again shortly */
-        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+        /* Cache the chunk's info, in case it's accessed again shortly */
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+
+        /* Mark cache entry as clean */
+        ent->dirty = FALSE;
+
+        /* Increment # of flushed entries */
+        dset->shared->cache.chunk.stats.nflushes++;
+    } /* end if */
+
+    /* Reset, but do not free or removed from list */
+    if(reset) {
+        point_of_no_return = FALSE;
+        if(buf == ent->chunk)
+            buf = NULL;
+        if(ent->chunk != NULL)
+            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                    ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
+                    : &(dset->shared->dcpl_cache.pline)));
+    } /* end if */
+
+done:
+    /* Free the temp buffer only if it's different than the entry chunk */
+    if(buf != ent->chunk)
+        H5MM_xfree(buf);
+
+    /*
+     * If we reached the point of no return then we have no choice but to
+     * reset the entry.  This can only happen if RESET is true but the
+     * output pipeline failed.  Do not free the entry or remove it from the
+     * list.
+     */
+    if(ret_value < 0 && point_of_no_return)
+        if(ent->chunk)
+            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                    ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
+                    : &(dset->shared->dcpl_cache.pline)));
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_flush_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_remove
+ *
+ * Purpose:     Removes the specified entry from the cache and frees it,
+ *              without flushing it.  Only needs the dataset's shared
+ *              information, so the chunks of any dataset sharing the
+ *              file-wide budget can be removed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_remove(H5D_shared_t *shared, H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(ent);
+    HDassert(!ent->locked);
+    HDassert(ent->idx < rdcc->nslots);
+
+    /* Free the chunk, if it's still there */
+    if(ent->chunk != NULL)
+        ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
+                ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
+                : &(shared->dcpl_cache.pline)));
+
+    /* Keep track of the ARC's entries accessed once */
+    if(rdcc->arc.frequent == ent)
+        rdcc->arc.frequent = ent->next;
+    if(!ent->frequent && rdcc->arc.nrecent > 0)
+        rdcc->arc.nrecent--;
+
+    /* Unlink from list */
+    if(ent->prev)
+        ent->prev->next = ent->next;
+    else
+        rdcc->head = ent->next;
+    if(ent->next)
+        ent->next->prev = ent->prev;
+    else
+        rdcc->tail = ent->prev;
+    ent->prev = ent->next = NULL;
+
+    /* Unlink from temporary list */
+    if(ent->tmp_prev) {
+        HDassert(rdcc->tmp_head->tmp_next);
+        ent->tmp_prev->tmp_next = ent->tmp_next;
+        if(ent->tmp_next) {
+            ent->tmp_next->tmp_prev = ent->tmp_prev;
+            ent->tmp_next = NULL;
+        } /* end if */
+        ent->tmp_prev = NULL;
+    } /* end if */
+    else
+        /* Only clear hash table slot if the chunk was not on the temporary list
+         */
+        rdcc->slot[ent->idx] = NULL;
+
+    /* Remove from cache */
+    HDassert(rdcc->slot[ent->idx] != ent);
+    ent->idx = UINT_MAX;
+    rdcc->nbytes_used -= shared->layout.u.chunk.size;
+    --rdcc->nused;
+    if(rdcc->budget)
+        rdcc->budget->nbytes_used -= shared->layout.u.chunk.size;
+
+    /* Free */
+    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_evict
+ *
+ * Purpose:     Preempts the specified entry from the cache, flushing it to
+ *              disk if necessary.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Robb Matzke
+ *              Thursday, May 21, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
+{
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(ent);
+    HDassert(!ent->locked);
+    HDassert(ent->idx < dset->shared->cache.chunk.nslots);
+
+    if(flush) {
+        /* Flush */
+        if(H5D__chunk_flush_entry(dset, ent, TRUE) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+    } /* end if */
+
+    /* Free the chunk & remove the entry from the cache */
+    H5D__chunk_cache_remove(dset->shared, ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_preempt
+ *
+ * Purpose:     Preempts the specified entry from the cache to make room
+ *              for another chunk, flushing it to disk if necessary.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_preempt(const H5D_t *dset, H5D_rdcc_ent_t *ent)
+{
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Remember the chunk, for the adaptive replacement cache */
+    H5D__chunk_cache_ghost_add(dset->shared, ent);
+    dset->shared->cache.chunk.stats.nevictions++;
+
+    if(H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt chunk from cache")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_preempt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_victim
+ *
+ * Purpose:     Chooses the next unlocked entry to preempt under the LRU
+ *              or ARC replacement policy.  ARC preempts from the chunks
+ *              accessed once while there are more of them than its
+ *              target, and from the chunks accessed more than once
+ *              otherwise.
+ *
+ * Return:      Entry to preempt, or NULL if all entries are locked
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_victim(const H5D_rdcc_t *rdcc)
+{
+    H5D_rdcc_ent_t *ent;                /* Cache entry */
+    H5D_rdcc_ent_t *ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Try the least recently used chunk accessed more than once, first */
+    if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy
+            && (rdcc->arc.nrecent <= rdcc->arc.target || rdcc->arc.nrecent == 0))
+        for(ent = rdcc->arc.frequent; ent && !ret_value; ent = ent->next)
+            if(!ent->locked)
+                ret_value = ent;
+
+    /* Otherwise use the least recently used chunk */
+    for(ent = rdcc->head; ent && !ret_value; ent = ent->next)
+        if(!ent->locked)
+            ret_value = ent;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_victim() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_add
+ *
+ * Purpose:     Adds the key of an entry about to be preempted to the
+ *              adaptive replacement cache's ghost list for the entry's
+ *              part of the cache, dropping the list's oldest key when
+ *              it's full.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_add(H5D_shared_t *shared, const H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);
+    hsize_t *ghosts;            /* Ghost list to add to */
+    size_t *nghosts;            /* # of keys in ghost list */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy && rdcc->arc.nghosts_max > 0) {
+        if(ent->frequent) {
+            ghosts = rdcc->arc.frequent_ghosts;
+            nghosts = &rdcc->arc.nfrequent_ghosts;
+        } /* end if */
+        else {
+            ghosts = rdcc->arc.recent_ghosts;
+            nghosts = &rdcc->arc.nrecent_ghosts;
+        } /* end else */
+
+        if(*nghosts == rdcc->arc.nghosts_max) {
+            HDmemmove(ghosts, ghosts + 1, (*nghosts - 1) * sizeof(hsize_t));
+            (*nghosts)--;
+        } /* end if */
+        ghosts[(*nghosts)++] = H5D__chunk_hash_key(shared, ent->scaled);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_hit
+ *
+ * Purpose:     Looks for a chunk that is about to be cached in the
+ *              adaptive replacement cache's ghost lists.  A chunk found
+ *              there was preempted too early: the target number of
+ *              chunks accessed once is adjusted toward the part of the
+ *              cache it came from, and the chunk is cached as one
+ *              accessed more than once.
+ *
+ * Return:      TRUE if the chunk was in a ghost list, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_cache_ghost_hit(H5D_rdcc_t *rdcc, hsize_t key)
+{
+    size_t u;                   /* Local index variable */
+    hbool_t ret_value = FALSE;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy);
+
+    for(u = 0; u < rdcc->arc.nrecent_ghosts; u++)
+        if(rdcc->arc.recent_ghosts[u] == key) {
+            size_t delta = MAX(rdcc->arc.nfrequent_ghosts / rdcc->arc.nrecent_ghosts, 1);
+
+            /* Give more room to the chunks accessed once */
+            rdcc->arc.target = MIN(rdcc->arc.target + delta, rdcc->arc.capacity);
+
+            HDmemmove(rdcc->arc.recent_ghosts + u, rdcc->arc.recent_ghosts + u + 1,
+                    (rdcc->arc.nrecent_ghosts - u - 1) * sizeof(hsize_t));
+            rdcc->arc.nrecent_ghosts--;
+            HGOTO_DONE(TRUE)
+        } /* end if */
+
+    for(u = 0; u < rdcc->arc.nfrequent_ghosts; u++)
+        if(rdcc->arc.frequent_ghosts[u] == key) {
+            size_t delta = MAX(rdcc->arc.nrecent_ghosts / rdcc->arc.nfrequent_ghosts, 1);
+
+            /* Give more room to the chunks accessed more than once */
+            rdcc->arc.target = rdcc->arc.target > delta ? rdcc->arc.target - delta : 0;
+
+            HDmemmove(rdcc->arc.frequent_ghosts + u, rdcc->arc.frequent_ghosts + u + 1,
+                    (rdcc->arc.nfrequent_ghosts - u - 1) * sizeof(hsize_t));
+            rdcc->arc.nfrequent_ghosts--;
+            HGOTO_DONE(TRUE)
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_ghost_hit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_slot
+ *
+ * Purpose:     Finds a hash table slot for a chunk that is about to be
+ *              cached.  The chunk may go in any of the
+ *              H5D_CHUNK_CACHE_NWAYS slots starting at its hash value.
+ *              When none of them is free, the entry in them that is
+ *              preferred by the replacement policy (or was accessed
+ *              least recently) is preempted.
+ *
+ * Return:      Non-negative on success/Negative on failure.  *IDX is set
+ *              to UINT_MAX if all the slots hold locked entries.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_slot(const H5D_t *dset, const hsize_t *scaled, unsigned *idx)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);  /* Raw data chunk cache */
+    size_t nways = MIN(rdcc->nslots, H5D_CHUNK_CACHE_NWAYS); /* # of slots to look in */
+    hbool_t recent_first;       /* Whether to preempt chunks accessed once first */
+    H5D_rdcc_ent_t *victim = NULL;  /* Entry to preempt */
+    unsigned u;                 /* Index of slot */
+    size_t w;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(rdcc->nslots > 0);
+
+    recent_first = (H5D_CHUNK_CACHE_POLICY_ARC != rdcc->policy
+            || rdcc->arc.nrecent > rdcc->arc.target);
+
+    *idx = UINT_MAX;
+    u = H5D__chunk_hash_val(dset->shared, scaled);
+    for(w = 0; w < nways; w++) {
+        H5D_rdcc_ent_t *ent = rdcc->slot[u];
+
+        /* Use the first free slot */
+        if(NULL == ent) {
+            *idx = u;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        if(!ent->locked) {
+            unsigned d;         /* Counter */
+
+            /* Replace a stale copy of the same chunk */
+            for(d = 0; d < dset->shared->ndims; d++)
+                if(scaled[d] != ent->scaled[d])
+                    break;
+            if(d == dset->shared->ndims) {
+                victim = ent;
+                break;
+            } /* end if */
+
+            if(NULL == victim || (ent->frequent == victim->frequent ?
+                    ent->age < victim->age : ent->frequent != recent_first))
+                victim = ent;
+        } /* end if */
+
+        if(++u == rdcc->nslots)
+            u = 0;
+    } /* end for */
+
+    /* Preempt the victim, if any, to free its slot */
+    if(victim) {
+        *idx = victim->idx;
+        if(H5D__chunk_cache_preempt(dset, victim) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to preempt chunk from cache")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_slot() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_link
+ *
+ * Purpose:     Puts a new entry at the most recently used end of the
+ *              cache's list.  Under the ARC policy, chunks accessed once
+ *              go before the chunks accessed more than once.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_link(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(!ent->frequent && rdcc->arc.frequent) {
+        /* Insert before the chunks accessed more than once */
+        ent->next = rdcc->arc.frequent;
+        ent->prev = rdcc->arc.frequent->prev;
+        if(ent->prev)
+            ent->prev->next = ent;
+        else
+            rdcc->head = ent;
+        rdcc->arc.frequent->prev = ent;
+    } /* end if */
+    else {
+        /* Add it to the end of the list */
+        ent->next = NULL;
+        if(rdcc->tail) {
+            rdcc->tail->next = ent;
+            ent->prev = rdcc->tail;
+            rdcc->tail = ent;
+        } /* end if */
+        else {
+            ent->prev = NULL;
+            rdcc->head = rdcc->tail = ent;
+        } /* end else */
+        if(ent->frequent && NULL == rdcc->arc.frequent)
+            rdcc->arc.frequent = ent;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_link() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_budget_touch
+ *
+ * Purpose:     Marks a dataset's chunk cache as the most recently used
+ *              one of the file-wide budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_budget_touch(H5D_shared_t *shared)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);
+    H5F_rdcc_budget_t *budget = rdcc->budget;
+
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Mark cache entry as clean */
-        ent->dirty = FALSE;
+    HDassert(budget);
 
-        /* Increment # of flushed entries */
-        dset->shared->cache.chunk.stats.nflushes++;
-    } /* end if */
+    if(budget->tail != shared) {
+        /* Unlink from the budget's list, if already on it */
+        if(rdcc->budget_prev || budget->head == shared) {
+            if(rdcc->budget_prev)
+                rdcc->budget_prev->cache.chunk.budget_next = rdcc->budget_next;
+            else
+                budget->head = rdcc->budget_next;
+            HDassert(rdcc->budget_next);
+            rdcc->budget_next->cache.chunk.budget_prev = rdcc->budget_prev;
+        } /* end if */
 
-    /* Reset, but do not free or removed from list */
-    if(reset) {
-        point_of_no_return = FALSE;
-        if(buf == ent->chunk)
-            buf = NULL;
-        if(ent->chunk != NULL)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                    ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
-                    : &(dset->shared->dcpl_cache.pline)));
+        /* Append to the list */
+        rdcc->budget_next = NULL;
+        rdcc->budget_prev = budget->tail;
+        if(budget->tail)
+            budget->tail->cache.chunk.budget_next = shared;
+        else
+            budget->head = shared;
+        budget->tail = shared;
     } /* end if */
 
-done:
-    /* Free the temp buffer only if it's different than the entry chunk */
-    if(buf != ent->chunk)
-        H5MM_xfree(buf);
-
-    /*
-     * If we reached the point of no return then we have no choice but to
-     * reset the entry.  This can only happen if RESET is true but the
-     * output pipeline failed.  Do not free the entry or remove it from the
-     * list.
-     */
-    if(ret_value < 0 && point_of_no_return)
-        if(ent->chunk)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                    ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
-                    : &(dset->shared->dcpl_cache.pline)));
-
-    FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5D__chunk_flush_entry() */
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_budget_touch() */
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_cache_evict
- *
- * Purpose:     Preempts the specified entry from the cache, flushing it to
- *              disk if necessary.
+ * Function:    H5D__chunk_cache_budget_prune
  *
- * Return:      Non-negative on success/Negative on failure
+ * Purpose:     Makes room within the file-wide budget for a chunk of SIZE
+ *              bytes by preempting clean, unlocked chunks of the other
+ *              datasets, starting with the least recently used datasets.
+ *              Dirty chunks of other datasets are left for their own
+ *              datasets to flush, so the budget can be exceeded while
+ *              they are cached.  The dataset's own chunks are preempted
+ *              afterwards by H5D__chunk_cache_prune.
  *
- * Programmer:  Robb Matzke
- *              Thursday, May 21, 1998
+ * Return:      void
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
+static void
+H5D__chunk_cache_budget_prune(const H5D_t *dset, size_t size)
 {
-    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);
-    herr_t      ret_value = SUCCEED;       /* Return value */
+    H5F_rdcc_budget_t *budget = dset->shared->cache.chunk.budget;
+    H5D_shared_t *shared, *next;        /* Datasets sharing the budget */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity checks */
-    HDassert(dset);
-    HDassert(ent);
-    HDassert(!ent->locked);
-    HDassert(ent->idx < rdcc->nslots);
+    HDassert(budget);
 
-    if(flush) {
-        /* Flush */
-        if(H5D__chunk_flush_entry(dset, ent, TRUE) < 0)
-            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
-    } /* end if */
-    else {
-        /* Don't flush, just free chunk */
-        if(ent->chunk != NULL)
-            ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
-                    ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
-                    : &(dset->shared->dcpl_cache.pline)));
-    } /* end else */
+    for(shared = budget->head; shared && (budget->nbytes_used + size) > budget->nbytes_max; shared = next) {
+        next = shared->cache.chunk.budget_next;
 
-    /* Unlink from list */
-    if(ent->prev)
-        ent->prev->next = ent->next;
-    else
-        rdcc->head = ent->next;
-    if(ent->next)
-        ent->next->prev = ent->prev;
-    else
-        rdcc->tail = ent->prev;
-    ent->prev = ent->next = NULL;
+        if(shared != dset->shared) {
+            H5D_rdcc_ent_t *ent, *ent_next;     /* Cache entries */
 
-    /* Unlink from temporary list */
-    if(ent->tmp_prev) {
-        HDassert(rdcc->tmp_head->tmp_next);
-        ent->tmp_prev->tmp_next = ent->tmp_next;
-        if(ent->tmp_next) {
-            ent->tmp_next->tmp_prev = ent->tmp_prev;
-            ent->tmp_next = NULL;
+            for(ent = shared->cache.chunk.head; ent && (budget->nbytes_used + size) > budget->nbytes_max; ent = ent_next) {
+                ent_next = ent->next;
+                if(!ent->locked && !ent->dirty) {
+                    H5D__chunk_cache_ghost_add(shared, ent);
+                    shared->cache.chunk.stats.nevictions++;
+                    H5D__chunk_cache_remove(shared, ent);
+                } /* end if */
+            } /* end for */
         } /* end if */
-        ent->tmp_prev = NULL;
-    } /* end if */
-    else
-        /* Only clear hash table slot if the chunk was not on the temporary list
-         */
-        rdcc->slot[ent->idx] = NULL;
-
-    /* Remove from cache */
-    HDassert(rdcc->slot[ent->idx] != ent);
-    ent->idx = UINT_MAX;
-    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
-    --rdcc->nused;
-
-    /* Free */
-    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+    } /* end for */
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_evict() */
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_budget_prune() */
 
 
 /*-------------------------------------------------------------------------
@@ -3614,7 +5014,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
 static herr_t
 H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 {
-    const H5D_rdcc_t    *rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_t          *rdcc = &(dset->shared->cache.chunk);
     size_t        total = rdcc->nbytes_max;
     const int        nmeth = 2;    /*number of methods        */
     int                w[1];        /*weighting as an interval    */
@@ -3625,6 +5025,30 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 
     FUNC_ENTER_STATIC
 
+    /* Don't let the dataset's chunks exceed what's left of the file's budget */
+    if(rdcc->budget) {
+        size_t others = rdcc->budget->nbytes_used - rdcc->nbytes_used;   /* Bytes cached for other datasets */
+
+        if(others >= rdcc->budget->nbytes_max)
+            total = 0;
+        else
+            total = MIN(total, rdcc->budget->nbytes_max - others);
+    } /* end if */
+
+    /* Preempt in the replacement policy's order */
+    if(H5D_CHUNK_CACHE_POLICY_LRU == rdcc->policy || H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy) {
+        while((rdcc->nbytes_used + size) > total) {
+            if(NULL == (cur = H5D__chunk_cache_victim(rdcc)))
+                break;
+            if(H5D__chunk_cache_preempt(dset, cur) < 0)
+                nerrors++;
+        } /* end while */
+
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /*
      * Preemption is accomplished by having multiple pointers (currently two)
      * slide down the list beginning at the head. Pointer p(N+1) will start
@@ -3684,6 +5108,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
             if(n[j] == cur)
                         n[j] = cur->next;
         } /* end for */
+        rdcc->stats.nevictions++;
         if(H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
                     nerrors++;
         } /* end if */
@@ -3722,6 +5147,12 @@ done:
  *        for output functions that are about to overwrite the entire
  *        chunk.
  *
+ *        If PREFETCHED is non-NULL, it is a buffer holding the chunk's
+ *        bytes that have already been read from the file and passed
+ *        through the I/O pipeline (see H5D__chunk_prefetch).  It is
+ *        used instead of reading the chunk again and is owned by this
+ *        routine from then on.
+ *
  * Return:    Success:    Ptr to a file chunk.
  *
  *        Failure:    NULL
@@ -3733,7 +5164,7 @@ done:
  */
 static void *
 H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
-    hbool_t relax, hbool_t prev_unfilt_chunk)
+    hbool_t relax, hbool_t prev_unfilt_chunk, void *prefetched)
 {
     const H5D_t         *dset = io_info->dset;  /* Local pointer to the dataset info */
     const H5O_pline_t   *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info - always equal to the pline passed to H5D__chunk_mem_alloc */
@@ -3758,6 +5189,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     HDassert(dset);
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
     HDassert(!rdcc->tmp_head);
+    HDassert(!prefetched || (UINT_MAX == udata->idx_hint && !relax
+            && !udata->new_unfilt_chunk && !prev_unfilt_chunk));
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
@@ -3847,25 +5280,58 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             } /* end else */
         } /* end if */
 
-        /*
-         * If the chunk is not at the beginning of the cache; move it backward
-         * by one slot.  This is how we implement the LRU preemption
-         * algorithm.
-         */
-        if(ent->next) {
-            if(ent->next->next)
-                ent->next->next->prev = ent;
-            else
-                rdcc->tail = ent;
-            ent->next->prev = ent->prev;
-            if(ent->prev)
-                ent->prev->next = ent->next;
-            else
-                rdcc->head = ent->next;
-            ent->prev = ent->next;
-            ent->next = ent->next->next;
-            ent->prev->next = ent;
+        /* Remember when the chunk was used */
+        ent->age = ++rdcc->clock;
+
+        if(H5D_CHUNK_CACHE_POLICY_DEFAULT == rdcc->policy) {
+            /*
+             * If the chunk is not at the beginning of the cache; move it backward
+             * by one slot.  This is how we implement the LRU preemption
+             * algorithm.
+             */
+            if(ent->next) {
+                if(ent->next->next)
+                    ent->next->next->prev = ent;
+                else
+                    rdcc->tail = ent;
+                ent->next->prev = ent->prev;
+                if(ent->prev)
+                    ent->prev->next = ent->next;
+                else
+                    rdcc->head = ent->next;
+                ent->prev = ent->next;
+                ent->next = ent->next->next;
+                ent->prev->next = ent;
+            } /* end if */
         } /* end if */
+        else {
+            /* Under ARC, the chunk has now been accessed more than once */
+            if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy && !ent->frequent) {
+                ent->frequent = TRUE;
+                rdcc->arc.nrecent--;
+            } /* end if */
+
+            /* Move the chunk to the most recently used end of the cache */
+            if(ent->next) {
+                if(rdcc->arc.frequent == ent)
+                    rdcc->arc.frequent = ent->next;
+                ent->next->prev = ent->prev;
+                if(ent->prev)
+                    ent->prev->next = ent->next;
+                else
+                    rdcc->head = ent->next;
+                ent->prev = rdcc->tail;
+                ent->next = NULL;
+                rdcc->tail->next = ent;
+                rdcc->tail = ent;
+            } /* end if */
+            if(ent->frequent && NULL == rdcc->arc.frequent)
+                rdcc->arc.frequent = ent;
+        } /* end else */
+
+        /* Mark the dataset as the most recently used one of the file's budget */
+        if(rdcc->budget)
+            H5D__chunk_cache_budget_touch(dset->shared);
     } /* end if */
     else {
         haddr_t             chunk_addr;         /* Address of chunk on disk */
@@ -3930,8 +5396,20 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              *      or an init if it isn't.
              */
 
+            /* Check if the chunk was already read & decoded */
+            if(prefetched) {
+                HDassert(H5F_addr_defined(chunk_addr));
+                HDassert(pline == old_pline);
+
+                /* Take ownership of the chunk */
+                chunk = prefetched;
+                prefetched = NULL;
+
+                /* Increment # of cache misses */
+                rdcc->stats.nmisses++;
+            } /* end if */
             /* Check if the chunk exists on disk */
-            if(H5F_addr_defined(chunk_addr)) {
+            else if(H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc;    /* Allocated buffer size */
                 size_t buf_alloc = chunk_alloc;            /* [Re-]allocated buffer size */
 
@@ -4019,17 +5497,15 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
         /* See if the chunk can be cached */
         if(rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-            /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
+            /* Find a slot for the chunk, which fails only if all the
+             * slots it may go in are locked */
+            if(H5D__chunk_cache_slot(io_info->dset, udata->common.scaled, &udata->idx_hint) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
 
-            /* Add the chunk to the cache only if the slot is not already locked */
-            ent = rdcc->slot[udata->idx_hint];
-            if(!ent || !ent->locked) {
+            if(UINT_MAX != udata->idx_hint) {
                 /* Preempt enough things from the cache to make room */
-                if(ent) {
-                    if(H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
-                } /* end if */
+                if(rdcc->budget)
+                    H5D__chunk_cache_budget_prune(io_info->dset, chunk_size);
                 if(H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
 
@@ -4049,6 +5525,13 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
                 H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
                 ent->chunk = (uint8_t *)chunk;
+                ent->age = ++rdcc->clock;
+
+                /* A chunk preempted too early re-enters the ARC as one
+                 * accessed more than once */
+                if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy)
+                    ent->frequent = H5D__chunk_cache_ghost_hit(rdcc,
+                            H5D__chunk_hash_key(io_info->dset->shared, udata->common.scaled));
 
                 /* Add it to the cache */
                 HDassert(NULL == rdcc->slot[udata->idx_hint]);
@@ -4056,15 +5539,15 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 ent->idx = udata->idx_hint;
                 rdcc->nbytes_used += chunk_size;
                 rdcc->nused++;
+                if(rdcc->budget) {
+                    rdcc->budget->nbytes_used += chunk_size;
+                    H5D__chunk_cache_budget_touch(io_info->dset->shared);
+                } /* end if */
 
                 /* Add it to the linked list */
-                if(rdcc->tail) {
-                    rdcc->tail->next = ent;
-                    ent->prev = rdcc->tail;
-                    rdcc->tail = ent;
-                } /* end if */
-                else
-                    rdcc->head = rdcc->tail = ent;
+                H5D__chunk_cache_link(rdcc, ent);
+                if(!ent->frequent)
+                    rdcc->arc.nrecent++;
                 ent->tmp_next = NULL;
                 ent->tmp_prev = NULL;
 
@@ -4100,9 +5583,12 @@ done:
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, NULL, "Can't release fill buffer info")
 
     /* Release the chunk allocated, on error */
-    if(!ret_value)
+    if(!ret_value) {
         if(chunk)
             chunk = H5D__chunk_mem_xfree(chunk, pline);
+        if(prefetched)
+            prefetched = H5D__chunk_mem_xfree(prefetched, pline);
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
@@ -4296,6 +5782,41 @@ done:
 } /* end H5D__chunk_allocated() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__get_chunk_cache_stats
+ *
+ * Purpose:    Retrieve the statistics of a chunked dataset's raw data
+ *        chunk cache.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__get_chunk_cache_stats(const H5D_t *dset, H5D_chunk_cache_stats_t *stats)
+{
+    const H5D_rdcc_t   *rdcc;           /* Raw data chunk cache */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset);
+    HDassert(dset->shared);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(stats);
+
+    rdcc = &(dset->shared->cache.chunk);
+    stats->nhits = rdcc->stats.nhits;
+    stats->nmisses = rdcc->stats.nmisses;
+    stats->ninits = rdcc->stats.ninits;
+    stats->nevictions = rdcc->stats.nevictions;
+    stats->nflushes = rdcc->stats.nflushes;
+    stats->nbytes_used = rdcc->nbytes_used;
+    stats->nentries = (size_t)rdcc->nused;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__get_chunk_cache_stats() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_allocate
  *
@@ -4888,7 +6409,7 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[])
                     || (UINT_MAX != chk_udata.idx_hint)) {
                 /* Lock the chunk into cache.  H5D__chunk_lock will take care of
                 * updating the chunk to no longer be an edge chunk. */
-                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE)))
+                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE, NULL)))
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
                 /* Unlock the chunk */
@@ -5190,7 +6711,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
+    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
 
@@ -5845,7 +7366,7 @@ herr_t
 H5D__chunk_update_cache(H5D_t *dset)
 {
     H5D_rdcc_t         *rdcc = &(dset->shared->cache.chunk);    /*raw data chunk cache */
-    H5D_rdcc_ent_t     *ent, *next;    /*cache entry  */
+    H5D_rdcc_ent_t     *ent, *prev;    /*cache entry  */
     H5D_rdcc_ent_t     tmp_head;        /* Sentinel entry for temporary entry list */
     H5D_rdcc_ent_t     *tmp_tail;       /* Tail pointer for temporary entry list */
     herr_t              ret_value = SUCCEED;      /* Return value */
@@ -5864,59 +7385,45 @@ H5D__chunk_update_cache(H5D_t *dset)
     rdcc->tmp_head = &tmp_head;
     tmp_tail = &tmp_head;
 
-    /* Recompute the index for each cached chunk that is in a dataset */
-    for(ent = rdcc->head; ent; ent = next) {
-        unsigned        old_idx;    /* Previous index number    */
+    /* Empty the hash table, so that chunks don't collide with the old
+     * locations of chunks that haven't moved yet */
+    for(ent = rdcc->head; ent; ent = ent->next)
+        rdcc->slot[ent->idx] = NULL;
 
-        /* Get the pointer to the next cache entry */
-        next = ent->next;
+    /* Recompute the index for each cached chunk that is in a dataset, giving
+     * the most recently used chunks the first pick of the slots */
+    for(ent = rdcc->tail; ent; ent = prev) {
+        size_t          nways = MIN(rdcc->nslots, H5D_CHUNK_CACHE_NWAYS); /* # of slots to look in */
+        unsigned        idx;        /* Index of slot */
+        size_t          w;          /* Local index variable */
 
-        /* Compute the index for the chunk entry */
-        old_idx = ent->idx;   /* Save for later */
-        ent->idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
-
-        if(old_idx != ent->idx) {
-            H5D_rdcc_ent_t     *old_ent;    /* Old cache entry  */
-
-            /* Check if there is already a chunk at this chunk's new location */
-            old_ent = rdcc->slot[ent->idx];
-            if(old_ent != NULL) {
-                HDassert(old_ent->locked == FALSE);
-                HDassert(old_ent->deleted == FALSE);
-
-                /* Insert the old entry into the temporary list, but do not
-                 * evict (yet).  Make sure we do not make any calls to the index
-                 * until all chunks have updated indices! */
-                HDassert(!old_ent->tmp_next);
-                HDassert(!old_ent->tmp_prev);
-                tmp_tail->tmp_next = old_ent;
-                old_ent->tmp_prev = tmp_tail;
-                tmp_tail = old_ent;
-            } /* end if */
+        /* Get the pointer to the previous cache entry */
+        prev = ent->prev;
+
+        /* Look for a free slot among the ones the chunk may go in */
+        idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
+        for(w = 0; w < nways && rdcc->slot[idx]; w++)
+            if(++idx == rdcc->nslots)
+                idx = 0;
 
+        if(w < nways) {
             /* Insert this chunk into correct location in hash table */
-            rdcc->slot[ent->idx] = ent;
-
-            /* If this chunk was previously on the temporary list and therefore
-             * not in the hash table, remove it from the temporary list.
-             * Otherwise clear the old hash table slot. */
-            if(ent->tmp_prev) {
-                HDassert(tmp_head.tmp_next);
-                HDassert(tmp_tail != &tmp_head);
-                ent->tmp_prev->tmp_next = ent->tmp_next;
-                if(ent->tmp_next) {
-                    ent->tmp_next->tmp_prev = ent->tmp_prev;
-                    ent->tmp_next = NULL;
-                } /* end if */
-                else {
-                    HDassert(tmp_tail == ent);
-                    tmp_tail = ent->tmp_prev;
-                } /* end else */
-                ent->tmp_prev = NULL;
-            } /* end if */
-            else
-                rdcc->slot[old_idx] = NULL;
+            rdcc->slot[idx] = ent;
+            ent->idx = idx;
         } /* end if */
+        else {
+            HDassert(ent->locked == FALSE);
+            HDassert(ent->deleted == FALSE);
+
+            /* Insert the entry into the temporary list, but do not evict
+             * (yet).  Make sure we do not make any calls to the index
+             * until all chunks have updated indices! */
+            HDassert(!ent->tmp_next);
+            HDassert(!ent->tmp_prev);
+            tmp_tail->tmp_next = ent;
+            ent->tmp_prev = tmp_tail;
+            tmp_tail = ent;
+        } /* end else */
     } /* end for */
 
     /* tmp_tail is no longer needed, and will be invalidated by
@@ -6032,26 +7539,15 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     else {
         H5D_rdcc_ent_t *ent = NULL;    /* Cache entry */
         unsigned idx;                   /* Index of chunk in cache, if present */
-        unsigned u;                     /* Counter */
         H5D_shared_t *shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
         if(shared_fo && shared_fo->cache.chunk.nslots > 0) {
-            /* Determine the chunk's location in the hash table */
-            idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
-
-            /* Get the chunk cache entry for that location */
-            ent = shared_fo->cache.chunk.slot[idx];
-            if(ent) {
-                /* Speculatively set the 'found' flag */
+            /* Look for the chunk in the hash table */
+            idx = H5D__chunk_cache_find(shared_fo, chunk_rec->scaled);
+            if(UINT_MAX != idx) {
+                ent = shared_fo->cache.chunk.slot[idx];
                 udata->chunk_in_cache = TRUE;
-
-                /* Verify that the cache entry is the correct chunk */
-                for(u = 0; u < shared_fo->ndims; u++)
-                    if(chunk_rec->scaled[u] != ent->scaled[u]) {
-                        udata->chunk_in_cache = FALSE;
-                        break;
-                    } /* end if */
             } /* end if */
         } /* end if */
 
@@ -6667,10 +8163,10 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
 
     if (headers) {
         HDfprintf(H5DEBUG(AC), "H5D: raw data cache statistics\n");
-        HDfprintf(H5DEBUG(AC), "   %-18s %8s %8s %8s %8s+%-8s\n",
-            "Layer", "Hits", "Misses", "MissRate", "Inits", "Flushes");
-        HDfprintf(H5DEBUG(AC), "   %-18s %8s %8s %8s %8s-%-8s\n",
-            "-----", "----", "------", "--------", "-----", "-------");
+        HDfprintf(H5DEBUG(AC), "   %-18s %8s %8s %8s %8s+%-8s %8s\n",
+            "Layer", "Hits", "Misses", "MissRate", "Inits", "Flushes", "Evicts");
+        HDfprintf(H5DEBUG(AC), "   %-18s %8s %8s %8s %8s-%-8s %8s\n",
+            "-----", "----", "------", "--------", "-----", "-------", "------");
     }
 
 #ifdef H5AC_DEBUG
@@ -6691,9 +8187,10 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
             HDsprintf(ascii, "%7.2f%%", miss_rate);
         }
 
-        HDfprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %8d+%-9ld\n",
+        HDfprintf(H5DEBUG(AC), "   %-18s %8Hu %8Hu %7s %8Hu+%-9ld %8Hu\n",
             "raw data chunks", rdcc->stats.nhits, rdcc->stats.nmisses, ascii,
-            rdcc->stats.ninits, (long)(rdcc->stats.nflushes)-(long)(rdcc->stats.ninits));
+            rdcc->stats.ninits, (long)(rdcc->stats.nflushes)-(long)(rdcc->stats.ninits),
+            rdcc->stats.nevictions);
     }
 
 done:
@@ -7481,3 +8978,100 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__get_chunk_info_by_coord() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter_cb
+ *
+ * Purpose:     Call the user-defined function with the chunk data.  The
+ *              iterator continues if the user-defined function returns
+ *              H5_ITER_CONT, and stops if H5_ITER_STOP is returned.
+ *
+ * Return:      Success:    H5_ITER_CONT or H5_ITER_STOP
+ *              Failure:    Negative (H5_ITER_ERROR)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *udata)
+{
+    const H5D_chunk_iter_ud_t *data = (const H5D_chunk_iter_ud_t *)udata;
+    hsize_t offset[H5O_LAYOUT_NDIMS];   /* Logical offset of the chunk */
+    unsigned u;                         /* Local index variable */
+    int ret_value = H5_ITER_CONT;       /* Callback return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Compute the logical offset of the chunk */
+    for(u = 0; u < data->ndims; u++)
+        offset[u] = chunk_rec->scaled[u] * data->chunk_dim[u];
+
+    /* Make the user's callback */
+    if((ret_value = (data->op)(offset, chunk_rec->filter_mask, chunk_rec->chunk_addr, (hsize_t)chunk_rec->nbytes, data->op_data)) < 0)
+        HERROR(H5E_DATASET, H5E_CANTNEXT, "iteration operator failed");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_iter_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter
+ *
+ * Purpose:     Iterate over all the allocated chunks of a dataset in one
+ *              pass over its chunk index, making the user's callback for
+ *              each one.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iter(const H5D_t *dset, H5D_chunk_iter_op_t op, void *op_data)
+{
+    const H5D_rdcc_t   *rdcc = NULL;    /* Raw data chunk cache */
+    H5D_rdcc_ent_t     *ent;            /* Cache entry index */
+    H5D_chk_idx_info_t  idx_info;       /* Chunked index info */
+    H5D_chunk_iter_ud_t udata;          /* User data for callback */
+    herr_t              ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(dset->shared);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(op);
+
+    /* Get the raw data chunk cache */
+    rdcc = &(dset->shared->cache.chunk);
+    HDassert(rdcc);
+
+    /* Search for cached chunks that haven't been written out */
+    for(ent = rdcc->head; ent; ent = ent->next)
+        /* Flush the chunk out to disk, to make certain the size is correct later */
+        if(H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* If the dataset is not written, there are no chunks to visit */
+    if(H5F_addr_defined(idx_info.storage->idx_addr)) {
+        /* Set up user data for callback */
+        udata.op = op;
+        udata.op_data = op_data;
+        udata.ndims = dset->shared->ndims;
+        udata.chunk_dim = dset->shared->layout.u.chunk.dim;
+
+        /* Iterate over the allocated chunks, calling the user's callback for each */
+        if((dset->shared->layout.storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_iter_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+    } /* end if H5F_addr_defined */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_iter() */
+
@@ -86,6 +86,16 @@ typedef struct H5D_contig_writevv_ud_t {
     const unsigned char *wbuf;  /* Pointer to buffer to write */
 } H5D_contig_writevv_ud_t;
 
+/* Callback info for gathering extents for a vector readvv/writevv operation */
+typedef struct H5D_contig_vector_ud_t {
+    haddr_t dset_addr;          /* Address of dataset */
+    unsigned char *buf;         /* Pointer to memory buffer */
+    size_t nextents;            /* Number of extents gathered */
+    haddr_t *addrs;             /* File addresses of extents */
+    size_t *sizes;              /* Sizes of extents */
+    void **bufs;                /* Memory buffers for extents */
+} H5D_contig_vector_ud_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -108,6 +118,14 @@ static herr_t H5D__contig_flush(H5D_t *dset);
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset,
     size_t size);
+static hbool_t H5D__contig_use_vector_io(const H5D_io_info_t *io_info,
+    size_t dset_max_nseq, size_t dset_curr_seq, const size_t dset_len_arr[],
+    const hsize_t dset_off_arr[]);
+static herr_t H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off,
+    size_t len, void *_udata);
+static ssize_t H5D__contig_vectorvv(const H5D_io_info_t *io_info, hbool_t writing,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[]);
 
 
 /*********************/
@@ -145,6 +163,9 @@ H5FL_BLK_DEFINE(sieve_buf);
 /* Declare extern the free list to manage blocks of type conversion data */
 H5FL_BLK_EXTERN(type_conv);
 
+/* Declare a free list to manage prepared read handles */
+H5FL_DEFINE_STATIC(H5D_prepared_read_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -894,6 +915,211 @@ done:
 }   /* end H5D__contig_readvv_cb() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_use_vector_io
+ *
+ * Purpose:	Decide whether a list of file sequences should be handed to
+ *		the file driver as one vector I/O request, rather than going
+ *		through the sieve buffer or being issued one at a time.
+ *
+ *		Vector I/O is used when the driver supports it, and either
+ *		data sieving is not available or the sieve buffer would not
+ *		cover more than one sequence at a time for most of the list
+ *		(in which case sieving costs one system call per sequence,
+ *		while reading more data than needed).  The sequences of a
+ *		multi-dataset operation are always merged with those of the
+ *		other datasets instead.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__contig_use_vector_io(const H5D_io_info_t *io_info, size_t dset_max_nseq,
+    size_t dset_curr_seq, const size_t dset_len_arr[], const hsize_t dset_off_arr[])
+{
+    size_t sieve_buf_size;      /* Size of the dataset's sieve buffer */
+    size_t nseq;                /* Number of sequences left */
+    size_t nearby = 0;          /* # of sequences within one sieve buffer of the previous one */
+    size_t u;                   /* Local index variable */
+    hbool_t ret_value = FALSE;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(!H5F_shared_has_vector_io(io_info->f_sh))
+        HGOTO_DONE(FALSE)
+    if(io_info->io_vec || !H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE))
+        HGOTO_DONE(TRUE)
+
+    sieve_buf_size = io_info->dset->shared->cache.contig.sieve_buf_size;
+    nseq = dset_max_nseq - dset_curr_seq;
+
+    /* A single sequence too large for the sieve buffer is accessed directly,
+     * once for each memory sequence it maps to.
+     */
+    if(nseq == 1)
+        HGOTO_DONE(dset_len_arr[dset_curr_seq] > sieve_buf_size)
+
+    for(u = dset_curr_seq + 1; u < dset_max_nseq; u++)
+        if((dset_off_arr[u] + dset_len_arr[u]) - dset_off_arr[u - 1] <= sieve_buf_size)
+            nearby++;
+
+    ret_value = (nearby * 2) < (nseq - 1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_use_vector_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_readvv() and
+ *		H5D__contig_writevv() which records each extent for a
+ *		single vector I/O request.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_vector_ud_t *udata = (H5D_contig_vector_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    udata->addrs[udata->nextents] = udata->dset_addr + dst_off;
+    udata->sizes[udata->nextents] = len;
+    udata->bufs[udata->nextents] = udata->buf + src_off;
+    udata->nextents++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_vector_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vectorvv
+ *
+ * Purpose:	Reads or writes some data vectors between a dataset and a
+ *		buffer with a single vector I/O request to the file driver.
+ *
+ *		Any part of the sieve buffer covering the sequences is
+ *		flushed first, and invalidated for writes.
+ *
+ *		For multi-dataset operations, the extents are only added to
+ *		the operation's list, to be issued with those of the other
+ *		datasets.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__contig_vectorvv(const H5D_io_info_t *io_info, hbool_t writing,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
+{
+    H5D_rdcdc_t *dset_contig = &(io_info->dset->shared->cache.contig); /* Cached information about contiguous data */
+    H5D_contig_vector_ud_t udata;       /* User data for H5VM_opvv() operator */
+    haddr_t seq_start;                  /* File address of first sequence */
+    hsize_t seq_span;                   /* Bytes from first sequence's start to last sequence's end */
+    size_t max_extents;                 /* Maximum # of extents H5VM_opvv can generate */
+    ssize_t ret_value = -1;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(*dset_curr_seq < dset_max_nseq);
+
+    /* Set up user data for H5VM_opvv() */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.dset_addr = io_info->store->contig.dset_addr;
+    if(writing)
+        udata.buf = (unsigned char *)(uintptr_t)io_info->u.wbuf;
+    else
+        udata.buf = (unsigned char *)io_info->u.rbuf;
+
+    /* Check for overlap of the sequences with the sieve buffer */
+    seq_start = udata.dset_addr + dset_off_arr[*dset_curr_seq];
+    seq_span = (dset_off_arr[dset_max_nseq - 1] + dset_len_arr[dset_max_nseq - 1]) - dset_off_arr[*dset_curr_seq];
+    if(dset_contig->sieve_buf && H5F_addr_defined(dset_contig->sieve_loc) &&
+            H5F_addr_overlap(seq_start, seq_span, dset_contig->sieve_loc, dset_contig->sieve_size)) {
+        /* Flush the sieve buffer, if it's dirty */
+        if(dset_contig->sieve_dirty) {
+            if(H5F_shared_block_write(io_info->f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+            /* Reset sieve buffer dirty flag */
+            dset_contig->sieve_dirty = FALSE;
+        } /* end if */
+
+        /* Writing makes the sieve buffer's contents stale */
+        if(writing) {
+            dset_contig->sieve_loc = HADDR_UNDEF;
+            dset_contig->sieve_size = 0;
+        } /* end if */
+    } /* end if */
+
+    /* Allocate the extent arrays (each extent finishes at least one file
+     * or memory sequence)
+     */
+    max_extents = (dset_max_nseq - *dset_curr_seq) + (mem_max_nseq - *mem_curr_seq);
+    if(io_info->io_vec) {
+        H5D_io_vec_t *io_vec = io_info->io_vec;     /* Deferred extents */
+
+        HDassert(io_vec->f_sh == io_info->f_sh);
+
+        /* Gather the extents at the end of the deferred list */
+        if(H5D__io_vec_reserve(io_vec, max_extents) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't extend deferred extent list")
+        udata.addrs = io_vec->addrs + io_vec->nused;
+        udata.sizes = io_vec->sizes + io_vec->nused;
+        udata.bufs = io_vec->bufs + io_vec->nused;
+    } /* end if */
+    else {
+        if(NULL == (udata.addrs = (haddr_t *)H5MM_malloc(max_extents * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent addresses")
+        if(NULL == (udata.sizes = (size_t *)H5MM_malloc(max_extents * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent sizes")
+        if(NULL == (udata.bufs = (void **)H5MM_malloc(max_extents * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent buffers")
+    } /* end else */
+
+    /* Gather the extents */
+    if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+            mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+            H5D__contig_vector_cb, &udata)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather extents for vector I/O")
+    HDassert(udata.nextents <= max_extents);
+
+    /* Leave deferred extents for the multi-dataset operation to perform */
+    if(io_info->io_vec) {
+        io_info->io_vec->nused += udata.nextents;
+        HGOTO_DONE(ret_value)
+    } /* end if */
+
+    /* Perform the I/O */
+    if(writing) {
+        if(H5F_shared_vector_write(io_info->f_sh, H5FD_MEM_DRAW, udata.nextents,
+                udata.addrs, udata.sizes, (const void **)(uintptr_t)udata.bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else
+        if(H5F_shared_vector_read(io_info->f_sh, H5FD_MEM_DRAW, udata.nextents,
+                udata.addrs, udata.sizes, udata.bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    if(!io_info->io_vec) {
+        H5MM_xfree(udata.addrs);
+        H5MM_xfree(udata.sizes);
+        H5MM_xfree(udata.bufs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vectorvv() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv
  *
@@ -930,8 +1156,29 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Copy straight from the file's memory map, if the driver keeps one */
+    if(*dset_curr_seq < dset_max_nseq && H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_MEMORY_MAPPED)) {
+        const void *map;        /* Pointer to the dataset's data in the map */
+
+        /* Map the extent of the sequences (their offsets are increasing) */
+        if(H5F_shared_map_raw(io_info->f_sh, io_info->store->contig.dset_addr,
+                dset_off_arr[dset_max_nseq - 1] + dset_len_arr[dset_max_nseq - 1], &map) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't map raw data")
+
+        /* Call generic sequence copy routine */
+        if((ret_value = H5VM_memcpyvv(io_info->u.rbuf, mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                map, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "vectorized memcpy failed")
+    } /* end if */
+    /* Check if the sequences should be read with a single vector request */
+    else if(*dset_curr_seq < dset_max_nseq && H5D__contig_use_vector_io(io_info,
+            dset_max_nseq, *dset_curr_seq, dset_len_arr, dset_off_arr)) {
+        if((ret_value = H5D__contig_vectorvv(io_info, FALSE, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector read")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1244,8 +1491,15 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the sequences should be written with a single vector request */
+    if(*dset_curr_seq < dset_max_nseq && H5D__contig_use_vector_io(io_info,
+            dset_max_nseq, *dset_curr_seq, dset_len_arr, dset_off_arr)) {
+        if((ret_value = H5D__contig_vectorvv(io_info, TRUE, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector write")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata;    /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1590,3 +1844,223 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_copy() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_prepare_read
+ *
+ * Purpose:	Set up a handle for repeated reads of runs of elements of a
+ *		contiguous dataset into a memory datatype.  Everything
+ *		that doesn't depend on which elements are read (the file
+ *		address of the data, the datatype conversion path and the
+ *		element sizes) is looked up once, here.
+ *
+ *		Only datasets with allocated contiguous storage in the
+ *		file itself (not in external files) whose datatype can be
+ *		converted to the memory datatype without a background
+ *		buffer, and that are not in files opened with an MPI file
+ *		driver, can be prepared.
+ *
+ * Return:	Success:	Pointer to the new handle
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_prepared_read_t *
+H5D__contig_prepare_read(H5D_t *dset, hid_t mem_type_id)
+{
+    H5D_prepared_read_t *prep = NULL;   /* New prepared read */
+    const H5T_t *mem_type;              /* Memory datatype */
+    H5T_t *dst_type = NULL;             /* Copy of memory datatype */
+    htri_t relocatable;                 /* Whether the dataset's datatype is relocatable */
+    H5D_prepared_read_t *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+
+    /* Check that the dataset can be read directly */
+    if(dset->shared->layout.ops != H5D_LOPS_CONTIG)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "dataset is not stored contiguously in the file")
+    if(!H5F_addr_defined(dset->shared->layout.storage.u.contig.addr))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "dataset storage is not allocated")
+    if(H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "can't prepare reads of datasets in files opened with MPI")
+    if((relocatable = H5T_is_relocatable(dset->shared->type)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, NULL, "can't check datatype")
+    if(relocatable)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "can't prepare reads of variable-length or reference data")
+
+    /* Keep a copy of the memory datatype, so the application can close or
+     * change its own */
+    if(NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a datatype")
+    if(NULL == (dst_type = H5T_copy(mem_type, H5T_COPY_TRANSIENT)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, NULL, "unable to copy memory datatype")
+
+    /* Allocate the handle */
+    if(NULL == (prep = H5FL_CALLOC(H5D_prepared_read_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for prepared read")
+    prep->dst_type_id = H5I_INVALID_HID;
+
+    /* Look up the conversion path */
+    if(NULL == (prep->tpath = H5T_path_find(dset->shared->type, dst_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "unable to convert between src and dest datatype")
+    if(H5T_path_bkg(prep->tpath) != H5T_BKG_NO)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "can't prepare reads that need a background buffer")
+    prep->is_conv_noop = H5T_path_noop(prep->tpath);
+
+    /* Register the copy of the memory datatype, for the conversion routines */
+    if((prep->dst_type_id = H5I_register(H5I_DATATYPE, dst_type, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, NULL, "unable to register memory datatype")
+    dst_type = NULL;
+
+    /* Set up the rest of the handle */
+    prep->dset = dset;
+    prep->dset_id = H5I_INVALID_HID;
+    prep->f_sh = H5F_SHARED(dset->oloc.file);
+    prep->store.dset_addr = dset->shared->layout.storage.u.contig.addr;
+    prep->store.dset_size = dset->shared->layout.storage.u.contig.size;
+    prep->src_type_id = dset->shared->type_id;
+    prep->src_type_size = H5T_get_size(dset->shared->type);
+    prep->dst_type_size = H5T_get_size(mem_type);
+    prep->npoints = prep->store.dset_size / prep->src_type_size;
+
+    /* Set return value */
+    ret_value = prep;
+
+done:
+    if(NULL == ret_value) {
+        if(dst_type && H5T_close(dst_type) < 0)
+            HDONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, NULL, "unable to release memory datatype")
+        if(prep && H5D__contig_close_prepared(prep) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, NULL, "unable to release prepared read")
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_prepare_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_read_prepared
+ *
+ * Purpose:	Read NELMTS elements of a dataset, starting at element
+ *		OFFSET (in the dataset's elements, in row-major order),
+ *		into BUF with a handle from H5D__contig_prepare_read().
+ *
+ *		The bytes are copied from the file's memory map, or read
+ *		through the dataset's sieve buffer, or read directly, as
+ *		H5D__contig_readvv() would, and then converted in BUF
+ *		(or in a conversion buffer kept in the handle, when the
+ *		memory datatype is smaller than the dataset's).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_read_prepared(H5D_prepared_read_t *prep, hsize_t offset,
+    size_t nelmts, void *buf)
+{
+    unsigned char *rbuf;        /* Buffer to read the dataset's bytes into */
+    hsize_t dset_off;           /* Offset of the bytes in the dataset */
+    size_t len;                 /* Number of bytes to read */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(prep);
+    HDassert(buf);
+
+    /* Check the range */
+    if(offset > prep->npoints || nelmts > prep->npoints - offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "elements are out of the dataset's range")
+    if(0 == nelmts)
+        HGOTO_DONE(SUCCEED)
+
+    /* Read into the application's buffer when the conversion can be done
+     * in place there */
+    len = nelmts * prep->src_type_size;
+    if(prep->dst_type_size >= prep->src_type_size)
+        rbuf = (unsigned char *)buf;
+    else {
+        if(len > prep->tconv_buf_size) {
+            if(NULL == (prep->tconv_buf = H5FL_BLK_REALLOC(type_conv, prep->tconv_buf, len)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+            prep->tconv_buf_size = len;
+        } /* end if */
+        rbuf = (unsigned char *)prep->tconv_buf;
+    } /* end else */
+    dset_off = offset * prep->src_type_size;
+
+    /* Copy straight from the file's memory map, if the driver keeps one */
+    if(H5F_SHARED_HAS_FEATURE(prep->f_sh, H5FD_FEAT_MEMORY_MAPPED)) {
+        const void *map;        /* Pointer to the data in the map */
+
+        if(H5F_shared_map_raw(prep->f_sh, prep->store.dset_addr + dset_off, (hsize_t)len, &map) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't map raw data")
+        H5MM_memcpy(rbuf, map, len);
+    } /* end if */
+    /* Check if data sieving is enabled */
+    else if(H5F_SHARED_HAS_FEATURE(prep->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+        H5D_contig_readvv_sieve_ud_t udata;     /* User data for sieve buffer read */
+
+        udata.f_sh = prep->f_sh;
+        udata.dset_contig = &(prep->dset->shared->cache.contig);
+        udata.store_contig = &(prep->store);
+        udata.rbuf = rbuf;
+        if(H5D__contig_readvv_sieve_cb(dset_off, (hsize_t)0, len, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "sieve buffer read failed")
+    } /* end if */
+    else {
+        /* Write out any data left in the sieve buffer first */
+        if(H5D__flush_sieve_buf(prep->dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+
+        if(H5F_shared_block_read(prep->f_sh, H5FD_MEM_DRAW, prep->store.dset_addr + dset_off, len, rbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+    } /* end else */
+
+    /* Convert the elements to the memory datatype */
+    if(!prep->is_conv_noop) {
+        if(H5T_convert(prep->tpath, prep->src_type_id, prep->dst_type_id, nelmts,
+                (size_t)0, (size_t)0, rbuf, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+        if(rbuf != buf)
+            H5MM_memcpy(buf, rbuf, nelmts * prep->dst_type_size);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_read_prepared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_close_prepared
+ *
+ * Purpose:	Release a handle from H5D__contig_prepare_read().  The
+ *		caller releases the handle's hold on the dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_close_prepared(H5D_prepared_read_t *prep)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(prep);
+
+    if(prep->dst_type_id > 0 && H5I_dec_ref(prep->dst_type_id) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "unable to release memory datatype")
+    if(prep->tconv_buf)
+        prep->tconv_buf = H5FL_BLK_FREE(type_conv, prep->tconv_buf);
+    prep = H5FL_FREE(H5D_prepared_read_t, prep);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_close_prepared() */
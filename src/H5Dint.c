@@ -2659,6 +2659,7 @@ H5D__vlen_get_buf_size_cb(void H5_ATTR_UNUSED *elem, hid_t type_id,
     unsigned H5_ATTR_UNUSED ndim, const hsize_t *point, void *op_data)
 {
     H5D_vlen_bufsize_native_t *vlen_bufsize = (H5D_vlen_bufsize_native_t *)op_data;
+    H5D_dset_io_info_t dset_info;       /* Dataset I/O info */
     herr_t ret_value = H5_ITER_CONT;    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2673,7 +2674,12 @@ H5D__vlen_get_buf_size_cb(void H5_ATTR_UNUSED *elem, hid_t type_id,
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, H5_ITER_ERROR, "can't select point")
 
     /* Read in the point (with the custom VL memory allocator) */
-    if(H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace, vlen_bufsize->common.fl_tbuf) < 0)
+    dset_info.dset = vlen_bufsize->dset;
+    dset_info.mem_type_id = type_id;
+    dset_info.mem_space = vlen_bufsize->mspace;
+    dset_info.file_space = vlen_bufsize->fspace;
+    dset_info.u.rbuf = vlen_bufsize->common.fl_tbuf;
+    if(H5D__read(1, &dset_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, H5_ITER_ERROR, "can't read point")
 
 done:
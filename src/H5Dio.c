@@ -25,6 +25,7 @@
 #include "H5CXprivate.h"        /* API Contexts                             */
 #include "H5Dpkg.h"             /* Dataset functions                        */
 #include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESprivate.h"        /* Event Sets                               */
 #include "H5FLprivate.h"        /* Free Lists                               */
 #include "H5Iprivate.h"         /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
@@ -42,6 +43,45 @@
 /* Local Typedefs */
 /******************/
 
+/* A dataset read or write inserted into an event set.  The arguments are
+ * copied (or held, for the dataset) so the application may reuse or close
+ * its own IDs as soon as the operation is inserted.
+ */
+typedef struct H5D_async_io_t {
+    hid_t dset_id;              /* Dataset (an internal reference) */
+    hid_t mem_type_id;          /* Copy of the memory datatype */
+    hid_t mem_space_id;         /* Copy of the memory dataspace, or H5S_ALL */
+    hid_t file_space_id;        /* Copy of the file dataspace, or H5S_ALL */
+    hid_t dxpl_id;              /* Copy of the transfer property list */
+    void *buf;                  /* Application buffer */
+    hbool_t do_write;           /* Whether the operation is a write */
+} H5D_async_io_t;
+
+/* Sort key for the datasets of a multi-dataset operation */
+typedef struct H5D_multi_sort_t {
+    size_t file_idx;            /* Index of the first dataset in the same file */
+    haddr_t addr;               /* Address of the dataset's raw data (or index) */
+    size_t idx;                 /* Index of the dataset in the operation */
+} H5D_multi_sort_t;
+
+/* Combined raw data I/O for the datasets of a multi-dataset operation */
+typedef struct H5D_multi_io_t {
+    H5D_io_vec_t io_vec;        /* Extents for the file driver's vector I/O */
+    hbool_t unlocked;           /* Whether raw data may be read without the API lock */
+#ifdef H5_HAVE_PARALLEL
+    H5D_mpio_multi_t mpio;      /* Contiguous collective I/O */
+    H5FD_mpio_xfer_t xfer_mode; /* Transfer mode requested for the operation */
+#endif /* H5_HAVE_PARALLEL */
+} H5D_multi_io_t;
+
+/* An extent collected by a multi-dataset operation, for sorting */
+typedef struct H5D_io_vec_ent_t {
+    haddr_t addr;               /* File address of extent */
+    size_t size;                /* Size of extent */
+    void *buf;                  /* Memory buffer for extent */
+    size_t idx;                 /* Order the extent was collected in */
+} H5D_io_vec_ent_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -58,6 +98,41 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Single & multi-dataset I/O routines */
+static herr_t H5D__read_one(const H5D_dset_io_info_t *dset_info, H5D_multi_io_t *multi);
+static herr_t H5D__write_one(const H5D_dset_io_info_t *dset_info, H5D_multi_io_t *multi);
+static int H5D__multi_cmp(const void *_ent1, const void *_ent2);
+static herr_t H5D__multi_init(size_t count, const H5D_dset_io_info_t *dset_info,
+    H5D_multi_io_t *multi, H5D_multi_sort_t **order);
+static herr_t H5D__multi_set_io_vec(H5D_multi_io_t *multi, H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info);
+static herr_t H5D__multi_term(H5D_multi_io_t *multi);
+static int H5D__io_vec_cmp(const void *_ent1, const void *_ent2);
+static herr_t H5D__io_vec_flush(H5D_io_vec_t *io_vec, H5D_io_op_type_t op_type);
+
+/* Multi-dataset API routines */
+static H5VL_object_t **H5D__multi_get_vol_obj(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hbool_t *is_native);
+
+/* Unlocked read routines */
+#ifdef H5D_HAVE_UNLOCKED_READ
+static hbool_t H5D__unlocked_read_file_ok(const H5F_shared_t *f_sh);
+static hbool_t H5D__unlocked_read_ok(size_t count, H5VL_object_t * const vol_obj[]);
+static herr_t H5D__unlocked_read_hold(size_t count, const hid_t dset_id[],
+    hid_t dxpl_id, size_t *nheld);
+static herr_t H5D__unlocked_read_release(size_t count, const hid_t dset_id[],
+    hid_t dxpl_id, size_t nheld);
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
+/* Asynchronous I/O routines */
+static herr_t H5D__async_copy_space(hid_t space_id, hid_t *copy_id);
+static herr_t H5D__async_io_insert(H5VL_object_t *vol_obj, hid_t dset_id,
+    hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
+    void *buf, hbool_t do_write, hid_t es_id);
+static herr_t H5D__async_io_op(void *_io, void **req);
+static herr_t H5D__async_io_free(void *_io);
+
 
 /*********************/
 /* Package Variables */
@@ -74,6 +149,9 @@ H5FL_BLK_DEFINE(type_conv);
 /* Declare a free list to manage the H5D_chunk_map_t struct */
 H5FL_DEFINE(H5D_chunk_map_t);
 
+/* Declare a free list to manage the H5D_async_io_t struct */
+H5FL_DEFINE_STATIC(H5D_async_io_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -149,6 +227,11 @@ done:
  *              The PLIST_ID can be the constant H5P_DEFAULT in which
  *              case the default data transfer properties are used.
  *
+ *              In the thread-safe library, raw data that is read from a
+ *              file opened read-only straight into BUF is read without
+ *              holding the library's lock, so that reads from several
+ *              threads overlap.
+ *
  * Return:      SUCCEED/FAIL
  *
  * Programmer:  Robb Matzke
@@ -161,6 +244,9 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     hid_t file_space_id, hid_t dxpl_id, void *buf/*out*/)
 {
     H5VL_object_t  *vol_obj     = NULL;
+#ifdef H5D_HAVE_UNLOCKED_READ
+    size_t          nheld       = 0;            /* Number of IDs held for an unlocked read */
+#endif /* H5D_HAVE_UNLOCKED_READ */
     herr_t          ret_value   = SUCCEED;      /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -187,14 +273,112 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
+#ifdef H5D_HAVE_UNLOCKED_READ
+    /* Read the raw data without the API lock, if the file allows it */
+    if (H5D__unlocked_read_ok(1, &vol_obj)) {
+        if (H5D__unlocked_read_hold(1, &dset_id, dxpl_id, &nheld) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold on to dataset")
+        H5CX_set_unlocked_read(TRUE);
+    } /* end if */
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
     /* Read the data */
     if ((ret_value = H5VL_dataset_read(vol_obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, H5_REQUEST_NULL)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
+#ifdef H5D_HAVE_UNLOCKED_READ
+    if (nheld > 0 && H5D__unlocked_read_release(1, &dset_id, dxpl_id, nheld) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) COUNT datasets into application memory
+ *              buffers with a single call.  Element I of each array
+ *              describes the read from dataset DSET_ID[I] into BUF[I],
+ *              as the corresponding argument of H5Dread() does, and all
+ *              the reads use the transfer properties in DXPL_ID.
+ *
+ *              The datasets may be in different files.  The file I/O
+ *              for the datasets is sorted by address and combined
+ *              where possible: into one vector request to the file
+ *              driver, or one collective operation with the MPI-IO
+ *              driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    H5VL_object_t **vol_obj = NULL;     /* Datasets' VOL objects */
+    hbool_t         is_native;          /* Whether all the datasets use the native connector */
+#ifdef H5D_HAVE_UNLOCKED_READ
+    size_t          nheld = 0;          /* Number of IDs held for an unlocked read */
+#endif /* H5D_HAVE_UNLOCKED_READ */
+    size_t          u;                  /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+    if(NULL == (vol_obj = H5D__multi_get_vol_obj(count, dset_id, mem_type_id, mem_space_id, file_space_id, &is_native)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid dataset arguments")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+#ifdef H5D_HAVE_UNLOCKED_READ
+    /* Read the raw data without the API lock, if the files allow it */
+    if(is_native && H5D__unlocked_read_ok(count, vol_obj)) {
+        if(H5D__unlocked_read_hold(count, dset_id, dxpl_id, &nheld) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't hold on to datasets")
+        H5CX_set_unlocked_read(TRUE);
+    } /* end if */
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
+    /* Read the data */
+    if(is_native) {
+        if(H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count, dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5VL_dataset_read(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id, buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+#ifdef H5D_HAVE_UNLOCKED_READ
+    if(nheld > 0 && H5D__unlocked_read_release(count, dset_id, dxpl_id, nheld) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release datasets")
+#endif /* H5D_HAVE_UNLOCKED_READ */
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
@@ -246,6 +430,252 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+
+/*---------------------------------------------------------------------------
+ * Function:    H5Dread_chunks
+ *
+ * Purpose:     Reads several entire chunks from the file directly, as
+ *              H5Dread_chunk() does for one.  OFFSETS holds the logical
+ *              offsets of the COUNT chunks, one after the other.  The
+ *              chunks are looked up in the dataset's chunk index in index
+ *              order and read with a single vector request, in file
+ *              address order.
+ *
+ *              The size of each chunk in the file and its filter mask are
+ *              returned in SIZES and FILTERS (either may be NULL).  Chunks
+ *              that have not been written have size 0 and are not read.
+ *              If BUFS is NULL nothing is read, so a first call can get
+ *              the sizes needed for the buffers.  Otherwise chunk I is
+ *              read into BUFS[I], unless that is NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const hsize_t *offsets,
+    uint32_t *filters, hsize_t *sizes, void *bufs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*h*Iu*h**x", dset_id, dxpl_id, count, offsets, filters, sizes,
+             bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (count > 0 && !offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Read the raw chunks */
+    if(H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count, offsets, filters, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5Dmap_chunks
+ *
+ * Purpose:     Returns pointers to the stored (filtered) bytes of several
+ *              chunks, without copying them.  The arguments are the same
+ *              as for H5Dread_chunks(), except that PTRS[I] is set to
+ *              point to chunk I inside a read-only memory map of the file
+ *              (or to NULL for chunks that have not been written).  The
+ *              pointers stay valid until the file is closed and must not
+ *              be written through or freed.
+ *
+ *              Only files opened read-only (and not for SWMR reading)
+ *              with a file driver that stores the file in a single POSIX
+ *              file (e.g. the sec2 driver) or keeps it mapped itself (the
+ *              mmap driver) can be mapped; this call fails for other
+ *              files, which should use H5Dread_chunks() instead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dmap_chunks(hid_t dset_id, size_t count, const hsize_t *offsets,
+    uint32_t *filters, hsize_t *sizes, const void *ptrs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iz*h*Iu*h**x", dset_id, count, offsets, filters, sizes, ptrs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (count > 0 && !offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+    if (count > 0 && !ptrs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "ptrs cannot be NULL")
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Map the raw chunks */
+    if(H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_MAP, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, count, offsets, filters, sizes, ptrs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't map unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dmap_chunks() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5Dprepare_read
+ *
+ * Purpose:     Sets up a handle for many small reads of a contiguous
+ *              dataset into the memory datatype MEM_TYPE_ID, with
+ *              H5Dread_prepared().  The dataset's file address and the
+ *              datatype conversion path are looked up once, here, so that
+ *              each read costs little more than copying the bytes.
+ *
+ *              Only contiguous datasets whose storage has been allocated
+ *              in the file, whose datatype is not variable-length or a
+ *              reference and can be converted to the memory datatype
+ *              without a background buffer, can be prepared.  The handle
+ *              keeps the dataset open until it is released with
+ *              H5Dclose_prepared().
+ *
+ * Return:      Success:    Pointer to the handle
+ *              Failure:    NULL
+ *
+ *---------------------------------------------------------------------------
+ */
+H5D_prepared_read_t *
+H5Dprepare_read(hid_t dset_id, hid_t mem_type_id)
+{
+    H5VL_object_t       *vol_obj = NULL;
+    H5D_prepared_read_t *prep = NULL;
+    H5D_prepared_read_t *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_API(NULL)
+    H5TRACE2("*x", "ii", dset_id, mem_type_id);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "dset_id is not a dataset ID")
+    if (H5I_DATATYPE != H5I_get_type(mem_type_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "mem_type_id is not a datatype ID")
+
+    /* Prepare the read */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_PREPARE_READ, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, mem_type_id, &prep) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't prepare read")
+
+    /* Keep the dataset open while the handle exists */
+    if (H5I_inc_ref(dset_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, NULL, "can't increment dataset ID reference count")
+    prep->dset_id = dset_id;
+
+    /* Set return value */
+    ret_value = prep;
+
+done:
+    if (NULL == ret_value && prep)
+        if (H5D__contig_close_prepared(prep) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, NULL, "unable to release prepared read")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dprepare_read() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5Dread_prepared
+ *
+ * Purpose:     Reads NELMTS elements of a dataset prepared with
+ *              H5Dprepare_read() into BUF, starting at element OFFSET.
+ *              Elements are numbered in the order they are stored, i.e.
+ *              in row-major order for datasets with more than one
+ *              dimension, so each call reads a run of consecutive
+ *              elements (such as part of one row).
+ *
+ *              The read uses the default transfer properties; data
+ *              transforms and other settings of transfer property lists
+ *              are not available.  Data written to the dataset through
+ *              the library after the handle was created is read back.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_prepared(H5D_prepared_read_t *prep, hsize_t offset, size_t nelmts, void *buf)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "*xhz*x", prep, offset, nelmts, buf);
+
+    /* Check arguments */
+    if (!prep)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "prepared read handle cannot be NULL")
+    if (nelmts > 0 && !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL")
+
+    /* Read the elements */
+    if (H5D__contig_read_prepared(prep, offset, nelmts, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_prepared() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5Dclose_prepared
+ *
+ * Purpose:     Releases a handle from H5Dprepare_read(), and its hold on
+ *              the dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dclose_prepared(H5D_prepared_read_t *prep)
+{
+    hid_t  dset_id;                     /* ID of dataset held by the handle */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*x", prep);
+
+    /* Check arguments */
+    if (!prep)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "prepared read handle cannot be NULL")
+
+    /* Release the handle, then the dataset */
+    dset_id = prep->dset_id;
+    if (H5D__contig_close_prepared(prep) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release prepared read")
+    if (H5I_dec_app_ref(dset_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset ID reference count")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dclose_prepared() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
@@ -317,6 +747,176 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) COUNT datasets from application memory
+ *              buffers with a single call.  Element I of each array
+ *              describes the write to dataset DSET_ID[I] from BUF[I],
+ *              as the corresponding argument of H5Dwrite() does, and
+ *              all the writes use the transfer properties in DXPL_ID.
+ *
+ *              The datasets may be in different files.  The file I/O
+ *              for the datasets is sorted by address and combined
+ *              where possible, the same as for H5Dread_multi().
+ *              Selections that overlap in the file are written in the
+ *              order they appear in the arrays.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[])
+{
+    H5VL_object_t **vol_obj = NULL;     /* Datasets' VOL objects */
+    hbool_t         is_native;          /* Whether all the datasets use the native connector */
+    size_t          u;                  /* Local index variable */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+    if(NULL == (vol_obj = H5D__multi_get_vol_obj(count, dset_id, mem_type_id, mem_space_id, file_space_id, &is_native)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid dataset arguments")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the data */
+    if(is_native) {
+        if(H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL, count, dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5VL_dataset_write(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id, buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_async
+ *
+ * Purpose:     Asynchronous version of H5Dread: the read is inserted into
+ *              the event set ES_ID and this call returns without waiting
+ *              for it.  BUF must not be used until H5ESwait reports the
+ *              operation complete.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, void *buf/*out*/, hid_t es_id)
+{
+    H5VL_object_t  *vol_obj     = NULL;
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiiixi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id, buf, es_id);
+
+    /* Check arguments */
+    if (mem_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+    if (file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+    if (H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "es_id is not an event set ID")
+
+    /* Get dataset pointer */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Queue the read */
+    if (H5D__async_io_insert(vol_obj, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, FALSE, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't insert read into event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_async
+ *
+ * Purpose:     Asynchronous version of H5Dwrite: the write is inserted
+ *              into the event set ES_ID and this call returns without
+ *              waiting for it.  BUF must not be modified until H5ESwait
+ *              reports the operation complete.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, const void *buf, hid_t es_id)
+{
+    H5VL_object_t          *vol_obj = NULL;
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiii*xi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id, buf, es_id);
+
+    /* Check arguments */
+    if (mem_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+    if (file_space_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+    if (H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "es_id is not an event set ID")
+
+    /* Get dataset pointer */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Queue the write */
+    if (H5D__async_io_insert(vol_obj, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, (void *)(uintptr_t)buf, TRUE, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't insert write into event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
@@ -356,31 +956,440 @@ H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, const hsize_t *of
     if (data_size != (size_t)data_size_32)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data_size - chunks cannot be > 4 GiB")
 
-    /* Get the default dataset transfer property list if the user didn't provide one */
-    if (H5P_DEFAULT == dxpl_id)
-        dxpl_id = H5P_DATASET_XFER_DEFAULT;
-    else
-        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write chunk */
+    if(H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_WRITE, dxpl_id, H5_REQUEST_NULL, filters, offset, data_size_32, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunk() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__multi_get_vol_obj
+ *
+ * Purpose:     Checks the arguments of H5Dread_multi() or
+ *              H5Dwrite_multi() and looks up the datasets' VOL objects.
+ *              IS_NATIVE is set if all the datasets are accessed
+ *              directly through the native connector (with no
+ *              pass-through connectors), so they can be accessed
+ *              together.
+ *
+ * Return:      Success:    Array of COUNT VOL objects, to be freed by
+ *                          the caller
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5VL_object_t **
+H5D__multi_get_vol_obj(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hbool_t *is_native)
+{
+    H5VL_object_t **vol_obj = NULL;     /* Datasets' VOL objects */
+    size_t u;                           /* Local index variable */
+    H5VL_object_t **ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0);
+    HDassert(is_native);
+
+    if(NULL == dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "dset_id array not provided")
+    if(NULL == mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "mem_type_id array not provided")
+    if(NULL == mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "mem_space_id array not provided")
+    if(NULL == file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "file_space_id array not provided")
+
+    if(NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate VOL object array")
+
+    *is_native = TRUE;
+    for(u = 0; u < count; u++) {
+        if(mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid memory dataspace ID")
+        if(file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file dataspace ID")
+
+        /* Get dataset pointer */
+        if(NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "dset_id is not a dataset ID")
+
+        /* Check whether the dataset can be accessed with the others */
+        if(H5_VOL_NATIVE != vol_obj[u]->connector->cls->value)
+            *is_native = FALSE;
+    } /* end for */
+
+    ret_value = vol_obj;
+
+done:
+    if(NULL == ret_value)
+        H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_get_vol_obj() */
+
+#ifdef H5D_HAVE_UNLOCKED_READ
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__unlocked_read_file_ok
+ *
+ * Purpose:     Checks whether raw data can be read from a file without
+ *              holding the API lock: the file must be open read-only, so
+ *              that nothing in the library changes its contents, and its
+ *              driver must allow reads from several threads at once.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__unlocked_read_file_ok(const H5F_shared_t *f_sh)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(f_sh);
+
+    FUNC_LEAVE_NOAPI(!(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR)
+            && H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_CONCURRENT_READ))
+} /* end H5D__unlocked_read_file_ok() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__unlocked_read_ok
+ *
+ * Purpose:     Checks whether a read of COUNT datasets could read some of
+ *              its raw data without holding the API lock, i.e. whether
+ *              all the datasets use the native VOL connector and at least
+ *              one of them is in a file that allows it.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__unlocked_read_ok(size_t count, H5VL_object_t * const vol_obj[])
+{
+    size_t u;                           /* Local index variable */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(vol_obj);
+
+    for(u = 0; u < count; u++) {
+        const H5D_t *dset;              /* Dataset to check */
+
+        if(H5_VOL_NATIVE != vol_obj[u]->connector->cls->value)
+            HGOTO_DONE(FALSE)
+        dset = (const H5D_t *)vol_obj[u]->data;
+        if(dset->oloc.file && H5D__unlocked_read_file_ok(H5F_SHARED(dset->oloc.file)))
+            ret_value = TRUE;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__unlocked_read_ok() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__unlocked_read_hold
+ *
+ * Purpose:     Holds on to the datasets and transfer property list of a
+ *              read that gives up the API lock while reading raw data,
+ *              so that they remain usable if another thread closes their
+ *              IDs meanwhile.
+ *
+ *              NHELD is set to the number of IDs held, to be passed to
+ *              H5D__unlocked_read_release(), even when this fails.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__unlocked_read_hold(size_t count, const hid_t dset_id[], hid_t dxpl_id,
+    size_t *nheld)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset_id);
+    HDassert(nheld);
+
+    for(*nheld = 0; *nheld < count; (*nheld)++)
+        if(H5I_inc_ref(dset_id[*nheld], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset ID ref count")
+    if(H5I_inc_ref(dxpl_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINC, FAIL, "can't increment property list ID ref count")
+    (*nheld)++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__unlocked_read_hold() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__unlocked_read_release
+ *
+ * Purpose:     Releases the NHELD IDs held by H5D__unlocked_read_hold().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__unlocked_read_release(size_t count, const hid_t dset_id[], hid_t dxpl_id,
+    size_t nheld)
+{
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset_id);
+    HDassert(nheld <= count + 1);
+
+    if(nheld > count && H5I_dec_ref(dxpl_id) < 0)
+        HDONE_ERROR(H5E_PLIST, H5E_CANTDEC, FAIL, "can't release transfer property list")
+    for(u = 0; u < MIN(nheld, count); u++)
+        if(H5I_dec_ref(dset_id[u]) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__unlocked_read_release() */
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__async_copy_space
+ *
+ * Purpose:     Copies a dataspace for an asynchronous operation, into an
+ *              ID that isn't visible to the application.  H5S_ALL is
+ *              passed through unchanged.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__async_copy_space(hid_t space_id, hid_t *copy_id)
+{
+    const H5S_t *space;                 /* Dataspace to copy */
+    H5S_t       *copy = NULL;           /* Copy of the dataspace */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(copy_id);
+
+    if(H5S_ALL == space_id) {
+        *copy_id = H5S_ALL;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if(NULL == (space = (const H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+    if(NULL == (copy = H5S_copy(space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy dataspace")
+    if((*copy_id = H5I_register(H5I_DATASPACE, copy, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTREGISTER, FAIL, "can't register dataspace")
+
+done:
+    if(ret_value < 0 && copy && H5S_close(copy) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't close dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__async_copy_space() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__async_io_insert
+ *
+ * Purpose:     Sets up a dataset read or write and inserts it into an
+ *              event set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__async_io_insert(H5VL_object_t *vol_obj, hid_t dset_id, hid_t mem_type_id,
+    hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void *buf,
+    hbool_t do_write, hid_t es_id)
+{
+    H5D_async_io_t      *io = NULL;             /* Operation's arguments */
+    const H5T_t         *type;                  /* Memory datatype */
+    H5T_t               *type_copy = NULL;      /* Copy of memory datatype */
+    H5P_genplist_t      *plist;                 /* Transfer property list */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(vol_obj);
+
+    /* Set up the operation's arguments */
+    if(NULL == (io = H5FL_MALLOC(H5D_async_io_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate asynchronous I/O info")
+    io->dset_id = H5I_INVALID_HID;
+    io->mem_type_id = H5I_INVALID_HID;
+    io->mem_space_id = H5S_ALL;
+    io->file_space_id = H5S_ALL;
+    io->dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    io->buf = buf;
+    io->do_write = do_write;
+
+    /* Hold on to the dataset */
+    if(H5I_inc_ref(dset_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset ID ref count")
+    io->dset_id = dset_id;
+
+    /* Copy the memory datatype */
+    if(NULL == (type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+    if(NULL == (type_copy = H5T_copy(type, H5T_COPY_TRANSIENT)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "can't copy datatype")
+    if((io->mem_type_id = H5I_register(H5I_DATATYPE, type_copy, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "can't register datatype")
+    type_copy = NULL;
+
+    /* Copy the dataspaces */
+    if(H5D__async_copy_space(mem_space_id, &io->mem_space_id) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy memory dataspace")
+    if(H5D__async_copy_space(file_space_id, &io->file_space_id) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy file dataspace")
+
+    /* Copy the transfer property list */
+    if(H5P_DATASET_XFER_DEFAULT != dxpl_id) {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a property list")
+        if((io->dxpl_id = H5P_copy_plist(plist, FALSE)) < 0) {
+            io->dxpl_id = H5P_DATASET_XFER_DEFAULT;
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL, "can't copy transfer property list")
+        } /* end if */
+    } /* end if */
+
+    /* Insert the operation, which hands the arguments to the event set */
+    if(H5ES_insert(es_id, vol_obj->connector, H5D__async_io_op, H5D__async_io_free, io) < 0) {
+        io = NULL;
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert operation into event set")
+    } /* end if */
+    io = NULL;
+
+done:
+    if(type_copy && H5T_close_real(type_copy) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTRELEASE, FAIL, "can't close datatype")
+    if(io && H5D__async_io_free(io) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release asynchronous I/O info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__async_io_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__async_io_op
+ *
+ * Purpose:     Performs a dataset read or write inserted into an event
+ *              set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__async_io_op(void *_io, void **req)
+{
+    H5D_async_io_t      *io = (H5D_async_io_t *)_io;
+    H5VL_object_t       *vol_obj;               /* Dataset's VOL object */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io);
+
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(io->dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(io->dxpl_id);
+
+    if(io->do_write) {
+        if(H5VL_dataset_write(vol_obj, io->mem_type_id, io->mem_space_id, io->file_space_id, io->dxpl_id, io->buf, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else {
+        if(H5VL_dataset_read(vol_obj, io->mem_type_id, io->mem_space_id, io->file_space_id, io->dxpl_id, io->buf, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__async_io_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__async_io_free
+ *
+ * Purpose:     Releases the arguments of a dataset read or write inserted
+ *              into an event set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__async_io_free(void *_io)
+{
+    H5D_async_io_t      *io = (H5D_async_io_t *)_io;
+    herr_t              ret_value = SUCCEED;    /* Return value */
 
-    /* Set DXPL for operation */
-    H5CX_set_dxpl(dxpl_id);
+    FUNC_ENTER_STATIC
 
-    /* Write chunk */
-    if(H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_WRITE, dxpl_id, H5_REQUEST_NULL, filters, offset, data_size_32, buf) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+    HDassert(io);
+
+    if(H5P_DATASET_XFER_DEFAULT != io->dxpl_id && H5I_dec_ref(io->dxpl_id) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTDEC, FAIL, "can't release transfer property list")
+    if(H5S_ALL != io->file_space_id && H5I_dec_ref(io->file_space_id) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDEC, FAIL, "can't release file dataspace")
+    if(H5S_ALL != io->mem_space_id && H5I_dec_ref(io->mem_space_id) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDEC, FAIL, "can't release memory dataspace")
+    if(H5I_INVALID_HID != io->mem_type_id && H5I_dec_ref(io->mem_type_id) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "can't release memory datatype")
+    if(H5I_INVALID_HID != io->dset_id && H5I_dec_ref(io->dset_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset")
 
 done:
-    FUNC_LEAVE_API(ret_value)
-} /* end H5Dwrite_chunk() */
+    io = H5FL_FREE(H5D_async_io_t, io);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__async_io_free() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:	H5D__read
+ * Function:	H5D__read_one
  *
  * Purpose:	Reads (part of) a DATASET into application memory BUF. See
  *		H5Dread() for complete details.
  *
+ *		When MULTI is non-NULL the dataset is part of a
+ *		multi-dataset read, and raw data I/O that can be combined
+ *		with that of the other datasets is left in MULTI for
+ *		H5D__read() to perform.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -388,10 +1397,14 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
-    const H5S_t *file_space, void *buf/*out*/)
+static herr_t
+H5D__read_one(const H5D_dset_io_info_t *dset_info, H5D_multi_io_t *multi)
 {
+    H5D_t *dataset = dset_info->dset;   /* Dataset to read from */
+    hid_t mem_type_id = dset_info->mem_type_id; /* Memory datatype */
+    const H5S_t *mem_space = dset_info->mem_space;  /* Memory dataspace */
+    const H5S_t *file_space = dset_info->file_space;    /* File dataspace */
+    void *buf = dset_info->u.rbuf;      /* Buffer to read into */
     H5D_chunk_map_t *fm = NULL;         /* Chunk file<->memory mapping */
     H5D_io_info_t io_info;              /* Dataset I/O info     */
     H5D_type_info_t type_info;          /* Datatype info for operation */
@@ -415,7 +1428,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
-    FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
+    FUNC_ENTER_STATIC_TAG(dataset->oloc.addr)
 
     /* check args */
     HDassert(dataset && dataset->oloc.file);
@@ -562,6 +1575,20 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
+    /* Combine the raw data I/O with that of the other datasets, if possible */
+    if(multi) {
+#ifdef H5_HAVE_PARALLEL
+        if(io_info.io_ops.multi_read == dataset->shared->layout.ops->par_read
+                && H5D_CONTIGUOUS == dataset->shared->layout.type) {
+            if(H5D__mpio_multi_add(&multi->mpio, &io_info, &type_info, file_space, mem_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't combine collective read with other datasets")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+        if(H5D__multi_set_io_vec(multi, &io_info, &type_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't combine read with other datasets")
+    } /* end if */
+
     /* Invoke correct "high level" I/O routine */
     if((*io_info.io_ops.multi_read)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
@@ -583,15 +1610,20 @@ done:
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
-} /* end H5D__read() */
+} /* end H5D__read_one() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__write
+ * Function:	H5D__write_one
  *
  * Purpose:	Writes (part of) a DATASET to a file from application memory
  *		BUF. See H5Dwrite() for complete details.
  *
+ *		When MULTI is non-NULL the dataset is part of a
+ *		multi-dataset write, and raw data I/O that can be combined
+ *		with that of the other datasets is left in MULTI for
+ *		H5D__write() to perform.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -599,10 +1631,14 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
-    const H5S_t *file_space, const void *buf)
+static herr_t
+H5D__write_one(const H5D_dset_io_info_t *dset_info, H5D_multi_io_t *multi)
 {
+    H5D_t *dataset = dset_info->dset;   /* Dataset to write to */
+    hid_t mem_type_id = dset_info->mem_type_id; /* Memory datatype */
+    const H5S_t *mem_space = dset_info->mem_space;  /* Memory dataspace */
+    const H5S_t *file_space = dset_info->file_space;    /* File dataspace */
+    const void *buf = dset_info->u.wbuf;    /* Buffer to write from */
     H5D_chunk_map_t *fm = NULL;         /* Chunk file<->memory mapping */
     H5D_io_info_t io_info;              /* Dataset I/O info     */
     H5D_type_info_t type_info;          /* Datatype info for operation */
@@ -626,7 +1662,7 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     char        fake_char;              /* Temporary variable for NULL buffer pointers */
     herr_t	ret_value = SUCCEED;	/* Return value	*/
 
-    FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
+    FUNC_ENTER_STATIC_TAG(dataset->oloc.addr)
 
     /* check args */
     HDassert(dataset && dataset->oloc.file);
@@ -776,6 +1812,20 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
+    /* Combine the raw data I/O with that of the other datasets, if possible */
+    if(multi) {
+#ifdef H5_HAVE_PARALLEL
+        if(io_info.io_ops.multi_write == dataset->shared->layout.ops->par_write
+                && H5D_CONTIGUOUS == dataset->shared->layout.type) {
+            if(H5D__mpio_multi_add(&multi->mpio, &io_info, &type_info, file_space, mem_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't combine collective write with other datasets")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+        if(H5D__multi_set_io_vec(multi, &io_info, &type_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't combine write with other datasets")
+    } /* end if */
+
     /* Invoke correct "high level" I/O routine */
     if((*io_info.io_ops.multi_write)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
@@ -815,8 +1865,530 @@ done:
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__write_one() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read
+ *
+ * Purpose:	Reads (part of) COUNT datasets into application memory.
+ *		See H5Dread_multi() for complete details.
+ *
+ *		The datasets are processed in order of their location in
+ *		the file, and the raw data of contiguous datasets is read
+ *		with a single vector request to the file driver (or, with
+ *		collective MPI-IO, a single collective read) after all of
+ *		them have been processed.
+ *
+ *		When the API context asks for an unlocked read (see
+ *		H5Dread()), the raw data that is read directly into the
+ *		application's buffers from contiguous datasets and from
+ *		uncached chunks of files opened read-only is collected the
+ *		same way, and read with the API lock given up, so that
+ *		other threads can use the library meanwhile.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
+{
+    H5D_multi_io_t multi;               /* Combined I/O for the datasets */
+    H5D_multi_sort_t *order = NULL;     /* Order to process the datasets in */
+    hbool_t multi_init = FALSE;         /* Whether the combined I/O info has been initialized */
+    hbool_t unlocked = FALSE;           /* Whether raw data may be read without the API lock */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dset_info);
+
+#ifdef H5D_HAVE_UNLOCKED_READ
+    /* Take the request for an unlocked read, so that reads made while
+     * performing this one (of a virtual dataset's source datasets, for
+     * example) keep the lock.
+     */
+    if((unlocked = H5CX_get_unlocked_read()))
+        H5CX_set_unlocked_read(FALSE);
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
+    /* Read a single dataset directly */
+    if(1 == count && !unlocked) {
+        if(H5D__read_one(dset_info, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set up combined I/O for the datasets */
+    if(H5D__multi_init(count, dset_info, &multi, &order) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset read")
+    multi_init = TRUE;
+    multi.unlocked = unlocked;
+
+    /* Process the datasets */
+    for(u = 0; u < count; u++) {
+#ifdef H5_HAVE_PARALLEL
+        /* Start each dataset with the transfer mode that was requested */
+        if(H5CX_set_io_xfer_mode(multi.xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+        if(H5D__read_one(&dset_info[order[u].idx], &multi) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end for */
+
+    /* Perform the combined I/O */
+    if(H5D__io_vec_flush(&multi.io_vec, H5D_IO_OP_READ) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+#ifdef H5_HAVE_PARALLEL
+    if(multi.mpio.nused > 0 && H5CX_set_io_xfer_mode(multi.xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+    if(H5D__mpio_multi_io(&multi.mpio, H5D_IO_OP_READ) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+#endif /* H5_HAVE_PARALLEL */
+
+done:
+    if(multi_init && H5D__multi_term(&multi) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release multi-dataset read info")
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory.
+ *		See H5Dwrite_multi() for complete details.
+ *
+ *		The datasets are processed in order of their location in
+ *		the file, and the raw data of contiguous datasets is
+ *		written with a single vector request to the file driver
+ *		(or, with collective MPI-IO, a single collective write)
+ *		after all of them have been processed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
+{
+    H5D_multi_io_t multi;               /* Combined I/O for the datasets */
+    H5D_multi_sort_t *order = NULL;     /* Order to process the datasets in */
+    hbool_t multi_init = FALSE;         /* Whether the combined I/O info has been initialized */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dset_info);
+
+    /* Write a single dataset directly */
+    if(1 == count) {
+        if(H5D__write_one(dset_info, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set up combined I/O for the datasets */
+    if(H5D__multi_init(count, dset_info, &multi, &order) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset write")
+    multi_init = TRUE;
+
+    /* Process the datasets */
+    for(u = 0; u < count; u++) {
+#ifdef H5_HAVE_PARALLEL
+        /* Start each dataset with the transfer mode that was requested */
+        if(H5CX_set_io_xfer_mode(multi.xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+        if(H5D__write_one(&dset_info[order[u].idx], &multi) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end for */
+
+    /* Perform the combined I/O */
+    if(H5D__io_vec_flush(&multi.io_vec, H5D_IO_OP_WRITE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+#ifdef H5_HAVE_PARALLEL
+    if(multi.mpio.nused > 0 && H5CX_set_io_xfer_mode(multi.xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+    if(H5D__mpio_multi_io(&multi.mpio, H5D_IO_OP_WRITE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+#endif /* H5_HAVE_PARALLEL */
+
+done:
+    if(multi_init && H5D__multi_term(&multi) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release multi-dataset write info")
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_cmp
+ *
+ * Purpose:	Callback for qsort() to order the datasets of a
+ *		multi-dataset operation by file, then by the address of
+ *		their storage.
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__multi_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_multi_sort_t *ent1 = (const H5D_multi_sort_t *)_ent1;
+    const H5D_multi_sort_t *ent2 = (const H5D_multi_sort_t *)_ent2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(ent1->file_idx != ent2->file_idx)
+        ret_value = ent1->file_idx < ent2->file_idx ? -1 : 1;
+    else if(H5F_addr_ne(ent1->addr, ent2->addr))
+        ret_value = H5F_addr_lt(ent1->addr, ent2->addr) ? -1 : 1;
+    else if(ent1->idx != ent2->idx)
+        ret_value = ent1->idx < ent2->idx ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_init
+ *
+ * Purpose:	Sets up the combined I/O for a multi-dataset operation,
+ *		and determines the order to process the datasets in: the
+ *		datasets of each file, in the order the files first appear
+ *		in DSET_INFO, and within a file in order of address.
+ *
+ *		The order only depends on the datasets themselves, so all
+ *		processes of a parallel application process them in the
+ *		same order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_init(size_t count, const H5D_dset_io_info_t *dset_info,
+    H5D_multi_io_t *multi, H5D_multi_sort_t **order)
+{
+    H5D_multi_sort_t *ent;              /* Sort entries for the datasets */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dset_info);
+    HDassert(multi);
+    HDassert(order);
+
+    HDmemset(multi, 0, sizeof(*multi));
+#ifdef H5_HAVE_PARALLEL
+    if(H5CX_get_io_xfer_mode(&multi->xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+    if(NULL == (*order = ent = (H5D_multi_sort_t *)H5MM_malloc(count * sizeof(H5D_multi_sort_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for dataset order")
+    for(u = 0; u < count; u++) {
+        const H5D_t *dset = dset_info[u].dset;
+        const H5O_storage_t *storage = &dset->shared->layout.storage;
+
+        HDassert(dset && dset->oloc.file);
+
+        /* Find the first dataset in the same file */
+        for(v = 0; v < u; v++)
+            if(H5F_SHARED(dset_info[v].dset->oloc.file) == H5F_SHARED(dset->oloc.file))
+                break;
+        ent[u].file_idx = (v < u) ? ent[v].file_idx : u;
+
+        /* Locate the dataset's raw data */
+        if(H5D_CONTIGUOUS == storage->type)
+            ent[u].addr = storage->u.contig.addr;
+        else if(H5D_CHUNKED == storage->type)
+            ent[u].addr = storage->u.chunk.idx_addr;
+        else
+            ent[u].addr = dset->oloc.addr;
+        ent[u].idx = u;
+    } /* end for */
+    HDqsort(ent, count, sizeof(H5D_multi_sort_t), H5D__multi_cmp);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_set_io_vec
+ *
+ * Purpose:	Arranges for the raw data I/O of a dataset in a
+ *		multi-dataset operation to be left in the operation's list
+ *		of extents, when it is read or written directly between
+ *		contiguous storage and the application's buffer.
+ *
+ *		For an unlocked read of a file opened read-only, the
+ *		uncached chunks of chunked datasets are left in the list
+ *		too, to be read without the API lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_set_io_vec(H5D_multi_io_t *multi, H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info)
+{
+    const H5D_shared_t *shared = io_info->dset->shared; /* Dataset's shared info */
+    hbool_t unlocked = FALSE;           /* Whether to read the extents without the API lock */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(multi);
+    HDassert(io_info);
+    HDassert(type_info);
+
+#ifdef H5D_HAVE_UNLOCKED_READ
+    unlocked = multi->unlocked && H5D_IO_OP_READ == io_info->op_type
+            && H5D__unlocked_read_file_ok(io_info->f_sh);
+#endif /* H5D_HAVE_UNLOCKED_READ */
+
+    /* Check if the dataset's I/O can be combined */
+    if(!(H5D_CONTIGUOUS == shared->layout.type || (unlocked && H5D_CHUNKED == shared->layout.type))
+            || shared->dcpl_cache.efl.nused > 0
+            || !type_info->is_conv_noop || !type_info->is_xform_noop
+            || !H5F_shared_has_vector_io(io_info->f_sh))
+        HGOTO_DONE(SUCCEED)
+
+    /* Perform any extents collected for another file (or to be read with
+     * the API lock held differently)
+     */
+    if(multi->io_vec.nused > 0 && (multi->io_vec.f_sh != io_info->f_sh
+            || multi->io_vec.unlocked != unlocked))
+        if(H5D__io_vec_flush(&multi->io_vec, io_info->op_type) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't perform combined I/O")
+
+    multi->io_vec.f_sh = io_info->f_sh;
+    multi->io_vec.unlocked = unlocked;
+    io_info->io_vec = &multi->io_vec;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_set_io_vec() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_term
+ *
+ * Purpose:	Releases the combined I/O info for a multi-dataset
+ *		operation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_term(H5D_multi_io_t *multi)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(multi);
+
+    multi->io_vec.addrs = (haddr_t *)H5MM_xfree(multi->io_vec.addrs);
+    multi->io_vec.sizes = (size_t *)H5MM_xfree(multi->io_vec.sizes);
+    multi->io_vec.bufs = (void **)H5MM_xfree(multi->io_vec.bufs);
+    multi->io_vec.nalloc = multi->io_vec.nused = 0;
+
+#ifdef H5_HAVE_PARALLEL
+    /* Release the collective I/O info */
+    ret_value = H5D__mpio_multi_term(&multi->mpio);
+#endif /* H5_HAVE_PARALLEL */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_reserve
+ *
+ * Purpose:	Makes room for NEXTENTS more extents in a multi-dataset
+ *		operation's list of extents.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_reserve(H5D_io_vec_t *io_vec, size_t nextents)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(io_vec);
+
+    if(io_vec->nused + nextents > io_vec->nalloc) {
+        size_t nalloc = MAX(io_vec->nused + nextents, 2 * io_vec->nalloc);
+        haddr_t *addrs;
+        size_t *sizes;
+        void **bufs;
+
+        if(NULL == (addrs = (haddr_t *)H5MM_realloc(io_vec->addrs, nalloc * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent addresses")
+        io_vec->addrs = addrs;
+        if(NULL == (sizes = (size_t *)H5MM_realloc(io_vec->sizes, nalloc * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent sizes")
+        io_vec->sizes = sizes;
+        if(NULL == (bufs = (void **)H5MM_realloc(io_vec->bufs, nalloc * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent buffers")
+        io_vec->bufs = bufs;
+        io_vec->nalloc = nalloc;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_cmp
+ *
+ * Purpose:	Callback for qsort() to order extents by address, keeping
+ *		extents at the same address in the order they were
+ *		collected.
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__io_vec_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_io_vec_ent_t *ent1 = (const H5D_io_vec_ent_t *)_ent1;
+    const H5D_io_vec_ent_t *ent2 = (const H5D_io_vec_ent_t *)_ent2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_ne(ent1->addr, ent2->addr))
+        ret_value = H5F_addr_lt(ent1->addr, ent2->addr) ? -1 : 1;
+    else if(ent1->idx != ent2->idx)
+        ret_value = ent1->idx < ent2->idx ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_flush
+ *
+ * Purpose:	Performs the extents collected by a multi-dataset
+ *		operation, as a single vector request to the file driver.
+ *
+ *		The extents are sorted by address and extents adjacent in
+ *		both the file and memory are merged.  Writes that overlap
+ *		must happen in the order they were requested though, so
+ *		those are passed in their original order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_vec_flush(H5D_io_vec_t *io_vec, H5D_io_op_type_t op_type)
+{
+    H5D_io_vec_ent_t *ent = NULL;       /* Extents to sort */
+    size_t nextents = 0;                /* Number of extents after merging */
+    hbool_t overlap = FALSE;            /* Whether any writes overlap */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io_vec);
+
+    if(0 == io_vec->nused)
+        HGOTO_DONE(SUCCEED)
+    HDassert(io_vec->f_sh);
+
+    /* Sort the extents by address */
+    if(NULL == (ent = (H5D_io_vec_ent_t *)H5MM_malloc(io_vec->nused * sizeof(H5D_io_vec_ent_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for extent list")
+    for(u = 0; u < io_vec->nused; u++) {
+        ent[u].addr = io_vec->addrs[u];
+        ent[u].size = io_vec->sizes[u];
+        ent[u].buf = io_vec->bufs[u];
+        ent[u].idx = u;
+    } /* end for */
+    HDqsort(ent, io_vec->nused, sizeof(H5D_io_vec_ent_t), H5D__io_vec_cmp);
+
+    /* Check for overlapping writes */
+    if(H5D_IO_OP_WRITE == op_type)
+        for(u = 1; u < io_vec->nused; u++)
+            if(H5F_addr_lt(ent[u].addr, ent[u - 1].addr + ent[u - 1].size)) {
+                overlap = TRUE;
+                break;
+            } /* end if */
+
+    /* Merge the sorted extents */
+    if(overlap)
+        nextents = io_vec->nused;
+    else
+        for(u = 0; u < io_vec->nused; u++) {
+            if(nextents > 0
+                    && H5F_addr_eq(io_vec->addrs[nextents - 1] + io_vec->sizes[nextents - 1], ent[u].addr)
+                    && (uint8_t *)io_vec->bufs[nextents - 1] + io_vec->sizes[nextents - 1] == (uint8_t *)ent[u].buf)
+                io_vec->sizes[nextents - 1] += ent[u].size;
+            else {
+                io_vec->addrs[nextents] = ent[u].addr;
+                io_vec->sizes[nextents] = ent[u].size;
+                io_vec->bufs[nextents] = ent[u].buf;
+                nextents++;
+            } /* end else */
+        } /* end for */
+
+    /* Perform the I/O */
+    if(H5D_IO_OP_WRITE == op_type) {
+        if(H5F_shared_vector_write(io_vec->f_sh, H5FD_MEM_DRAW, nextents, io_vec->addrs, io_vec->sizes, (const void **)(uintptr_t)io_vec->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else {
+#ifdef H5D_HAVE_UNLOCKED_READ
+        if(io_vec->unlocked) {
+            if(H5F_shared_vector_read_unlocked(io_vec->f_sh, H5FD_MEM_DRAW, nextents, io_vec->addrs, io_vec->sizes, io_vec->bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unlocked vector read failed")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+#endif /* H5D_HAVE_UNLOCKED_READ */
+        if(H5F_shared_vector_read(io_vec->f_sh, H5FD_MEM_DRAW, nextents, io_vec->addrs, io_vec->sizes, io_vec->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+    } /* end else */
+
+done:
+    io_vec->nused = 0;
+    H5MM_xfree(ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_flush() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
@@ -848,6 +2420,7 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info,
     io_info->dset = dset;
     io_info->f_sh = H5F_SHARED(dset->oloc.file);
     io_info->store = store;
+    io_info->io_vec = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
@@ -743,6 +743,263 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_collective_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_add
+ *
+ * Purpose:     Adds the selection of a contiguous dataset in a
+ *              multi-dataset operation to the operation's combined
+ *              collective I/O, instead of performing the I/O for the
+ *              dataset immediately.
+ *
+ *              The datasets must be added in increasing address order
+ *              (which is the same on all processes), as the file view
+ *              for the combined operation has to be monotonic.  A
+ *              dataset in another file or overlapping the datasets
+ *              collected so far causes those to be performed first.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_add(H5D_mpio_multi_t *multi, const H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, const H5S_t *file_space, const H5S_t *mem_space)
+{
+    const H5D_contig_storage_t *store_contig = &(io_info->store->contig);    /* Contiguous storage info for this I/O operation */
+    H5D_mpio_multi_ent_t *ent = NULL;   /* Entry for the dataset */
+    hsize_t *permute_map = NULL;        /* Permutation of an out-of-order point selection */
+    hbool_t is_permuted = FALSE;        /* Whether the point selection was permuted */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(multi);
+    HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
+    HDassert(file_space);
+    HDassert(mem_space);
+
+    /* Perform the collected I/O first, if the dataset can't follow it */
+    if(multi->nused > 0 && (multi->f_sh != io_info->f_sh
+            || H5F_addr_lt(store_contig->dset_addr, multi->end_addr)))
+        if(H5D__mpio_multi_io(multi, io_info->op_type) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish combined collective MPI-IO")
+
+    /* Make room for the dataset */
+    if(multi->nused == multi->nalloc) {
+        size_t nalloc = MAX(8, 2 * multi->nalloc);
+        H5D_mpio_multi_ent_t *new_ent;
+
+        if(NULL == (new_ent = (H5D_mpio_multi_ent_t *)H5MM_realloc(multi->ent, nalloc * sizeof(H5D_mpio_multi_ent_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate combined collective I/O entries")
+        multi->ent = new_ent;
+        multi->nalloc = nalloc;
+    } /* end if */
+    ent = &multi->ent[multi->nused];
+    ent->file_derived = FALSE;
+    ent->mem_derived = FALSE;
+
+    /* Obtain disk and memory MPI derived datatype */
+    if(H5S_mpio_space_type(file_space, type_info->src_type_size, &ent->file_type,
+            &ent->file_count, &ent->file_derived, TRUE, &permute_map, &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI file type")
+    if(H5S_mpio_space_type(mem_space, type_info->src_type_size, &ent->mem_type,
+            &ent->mem_count, &ent->mem_derived, FALSE, &permute_map, &is_permuted) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "couldn't create MPI buffer type")
+
+    ent->addr = store_contig->dset_addr;
+    if(io_info->op_type == H5D_IO_OP_WRITE)
+        ent->buf = (void *)io_info->u.wbuf;     /* Casting away const OK -QAK */
+    else
+        ent->buf = io_info->u.rbuf;
+
+    multi->f_sh = io_info->f_sh;
+    multi->end_addr = store_contig->dset_addr + store_contig->dset_size;
+    multi->nused++;
+    ent = NULL;
+
+done:
+    /* Release the types of a partially added dataset */
+    if(ent) {
+        if(ent->mem_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&ent->mem_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if(ent->file_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&ent->file_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_io
+ *
+ * Purpose:     Performs the collective I/O collected for the datasets of
+ *              a multi-dataset operation with a single collective MPI-IO
+ *              call, using struct datatypes which link the selections of
+ *              all the datasets in the file and in memory.
+ *
+ *              Every process collects the same datasets, so every
+ *              process participates (with empty selections, if it has
+ *              nothing to transfer).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_io(H5D_mpio_multi_t *multi, H5D_io_op_type_t op_type)
+{
+    MPI_Datatype final_ftype = MPI_BYTE;    /* Combined file type */
+    MPI_Datatype final_mtype = MPI_BYTE;    /* Combined memory type */
+    hbool_t final_ftype_is_derived = FALSE;
+    hbool_t final_mtype_is_derived = FALSE;
+    int *file_counts = NULL;            /* Number of file types for each dataset */
+    int *mem_counts = NULL;             /* Number of memory types for each dataset */
+    MPI_Aint *file_disp = NULL;         /* File displacement of each dataset */
+    MPI_Aint *mem_disp = NULL;          /* Memory displacement of each dataset */
+    MPI_Datatype *file_types = NULL;    /* File type for each dataset */
+    MPI_Datatype *mem_types = NULL;     /* Memory type for each dataset */
+    MPI_Aint base_addr;                 /* Address of the first buffer */
+    int num_ent;                        /* Number of datasets */
+    size_t u;                           /* Local index variable */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(multi);
+
+    if(0 == multi->nused)
+        HGOTO_DONE(SUCCEED)
+    H5_CHECKED_ASSIGN(num_ent, int, multi->nused, size_t);
+
+    /* Allocate arrays for the combined types */
+    if(NULL == (file_counts = (int *)H5MM_malloc(multi->nused * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file type counts")
+    if(NULL == (mem_counts = (int *)H5MM_malloc(multi->nused * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory type counts")
+    if(NULL == (file_disp = (MPI_Aint *)H5MM_malloc(multi->nused * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file displacements")
+    if(NULL == (mem_disp = (MPI_Aint *)H5MM_malloc(multi->nused * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory displacements")
+    if(NULL == (file_types = (MPI_Datatype *)H5MM_malloc(multi->nused * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file types")
+    if(NULL == (mem_types = (MPI_Datatype *)H5MM_malloc(multi->nused * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory types")
+
+    /* Link the datasets' selections, relative to the first dataset's storage
+     * in the file and to its buffer in memory
+     */
+    if(MPI_SUCCESS != (mpi_code = MPI_Get_address(multi->ent[0].buf, &base_addr)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+    for(u = 0; u < multi->nused; u++) {
+        MPI_Aint buf_addr;              /* Address of the dataset's buffer */
+
+        HDassert(u == 0 || H5F_addr_le(multi->ent[u - 1].addr, multi->ent[u].addr));
+
+        /* (assume MPI_Aint big enough to hold the file displacement) */
+        file_counts[u] = multi->ent[u].file_count;
+        file_disp[u] = (MPI_Aint)(multi->ent[u].addr - multi->ent[0].addr);
+        file_types[u] = multi->ent[u].file_type;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Get_address(multi->ent[u].buf, &buf_addr)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+        mem_counts[u] = multi->ent[u].mem_count;
+        mem_disp[u] = buf_addr - base_addr;
+        mem_types[u] = multi->ent[u].mem_type;
+    } /* end for */
+
+    /* Create final MPI derived datatypes for the file & memory */
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_create_struct(num_ent, file_counts, file_disp, file_types, &final_ftype)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_ftype)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+    final_ftype_is_derived = TRUE;
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_create_struct(num_ent, mem_counts, mem_disp, mem_types, &final_mtype)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_struct failed", mpi_code)
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&final_mtype)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+    final_mtype_is_derived = TRUE;
+
+    /* Pass buf type, file type to the file driver */
+    if(H5CX_set_mpi_coll_datatypes(final_mtype, final_ftype) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O collective I/O datatypes")
+
+    /* Perform the combined collective I/O */
+    if(op_type == H5D_IO_OP_WRITE) {
+        if(H5F_shared_block_write(multi->f_sh, H5FD_MEM_DRAW, multi->ent[0].addr, (size_t)1, multi->ent[0].buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't finish combined collective parallel write")
+    } /* end if */
+    else {
+        if(H5F_shared_block_read(multi->f_sh, H5FD_MEM_DRAW, multi->ent[0].addr, (size_t)1, multi->ent[0].buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't finish combined collective parallel read")
+    } /* end else */
+
+    /* Set the actual I/O mode property */
+    H5CX_set_mpio_actual_io_mode(H5D_MPIO_CONTIGUOUS_COLLECTIVE);
+
+done:
+    if(final_mtype_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_mtype)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if(final_ftype_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&final_ftype)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    H5MM_xfree(mem_types);
+    H5MM_xfree(file_types);
+    H5MM_xfree(mem_disp);
+    H5MM_xfree(file_disp);
+    H5MM_xfree(mem_counts);
+    H5MM_xfree(file_counts);
+
+    /* Release the datasets' types */
+    for(u = 0; u < multi->nused; u++) {
+        if(multi->ent[u].mem_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->ent[u].mem_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if(multi->ent[u].file_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->ent[u].file_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end for */
+    multi->nused = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_multi_term
+ *
+ * Purpose:     Releases the combined collective I/O info of a
+ *              multi-dataset operation, including any datasets that
+ *              were collected but not performed (after an error).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__mpio_multi_term(H5D_mpio_multi_t *multi)
+{
+    size_t u;                           /* Local index variable */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(multi);
+
+    for(u = 0; u < multi->nused; u++) {
+        if(multi->ent[u].mem_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->ent[u].mem_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        if(multi->ent[u].file_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&multi->ent[u].file_type)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    } /* end for */
+    multi->ent = (H5D_mpio_multi_ent_t *)H5MM_xfree(multi->ent);
+    multi->nalloc = multi->nused = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_multi_term() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_collective_io
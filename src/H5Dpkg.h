@@ -50,14 +50,25 @@
     (io_info)->f_sh = H5F_SHARED((ds)->oloc.file);                      \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_WRITE;                               \
+    (io_info)->io_vec = NULL;                                           \
     (io_info)->u.wbuf = buf
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                     \
     (io_info)->dset = ds;                                               \
     (io_info)->f_sh = H5F_SHARED((ds)->oloc.file);                      \
     (io_info)->store = str;                                             \
     (io_info)->op_type = H5D_IO_OP_READ;                                \
+    (io_info)->io_vec = NULL;                                           \
     (io_info)->u.rbuf = buf
 
+/* The raw data of files opened read-only can be read without holding the
+ * library's API lock (see H5D__read), when the lock can be given up and
+ * taken back.  Memory allocation sanity checking keeps global state in
+ * H5MM, so it rules this out.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+#define H5D_HAVE_UNLOCKED_READ
+#endif
+
 /* Flags for marking aspects of a dataset dirty */
 #define H5D_MARK_SPACE  0x01
 #define H5D_MARK_LAYOUT  0x02
@@ -207,6 +218,21 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE         /* Write operation */
 } H5D_io_op_type_t;
 
+/* Raw data extents collected from the contiguous datasets of a
+ * multi-dataset read or write (or from a read that doesn't hold the API
+ * lock while it reads raw data), which are sorted by address and passed to
+ * the file driver together once all the datasets have been processed.
+ */
+typedef struct H5D_io_vec_t {
+    H5F_shared_t *f_sh;         /* File the extents are in */
+    hbool_t unlocked;           /* Whether to read the extents without the API lock */
+    size_t nalloc;              /* Number of extents allocated */
+    size_t nused;               /* Number of extents collected */
+    haddr_t *addrs;             /* File addresses of extents */
+    size_t *sizes;              /* Sizes of extents */
+    void **bufs;                /* Memory buffers for extents */
+} H5D_io_vec_t;
+
 typedef struct H5D_io_info_t {
     const H5D_t *dset;          /* Pointer to dataset being operated on */
 /* QAK: Delete the f_sh field when oloc has a shared file pointer? */
@@ -219,12 +245,51 @@ typedef struct H5D_io_info_t {
     H5D_layout_ops_t layout_ops;    /* Dataset layout I/O operation function pointers */
     H5D_io_ops_t io_ops;        /* I/O operation function pointers */
     H5D_io_op_type_t op_type;
+    H5D_io_vec_t *io_vec;       /* Where to defer contiguous extents (NULL to perform I/O immediately) */
     union {
         void *rbuf;             /* Pointer to buffer for read */
         const void *wbuf;       /* Pointer to buffer to write */
     } u;
 } H5D_io_info_t;
 
+/* One dataset's part of a (multi-dataset) read or write */
+typedef struct H5D_dset_io_info_t {
+    H5D_t *dset;                /* Dataset to access */
+    hid_t mem_type_id;          /* Memory datatype */
+    const H5S_t *mem_space;     /* Memory dataspace (NULL to use the file dataspace) */
+    const H5S_t *file_space;    /* File dataspace (NULL to use the dataset's dataspace) */
+    union {
+        void *rbuf;             /* Pointer to buffer for read */
+        const void *wbuf;       /* Pointer to buffer to write */
+    } u;
+} H5D_dset_io_info_t;
+
+#ifdef H5_HAVE_PARALLEL
+/* One dataset's selection in a combined collective operation */
+typedef struct H5D_mpio_multi_ent_t {
+    haddr_t addr;               /* Address of the dataset's storage */
+    void *buf;                  /* Memory buffer for the dataset */
+    MPI_Datatype file_type;     /* MPI type describing the selection in the file */
+    MPI_Datatype mem_type;      /* MPI type describing the selection in memory */
+    int file_count;             /* Number of file types */
+    int mem_count;              /* Number of memory types */
+    hbool_t file_derived;       /* Whether the file type was derived */
+    hbool_t mem_derived;        /* Whether the memory type was derived */
+} H5D_mpio_multi_ent_t;
+
+/* Contiguous collective I/O collected from the datasets of a multi-dataset
+ * read or write, which is performed as a single collective operation once
+ * all the datasets have been processed.
+ */
+typedef struct H5D_mpio_multi_t {
+    H5F_shared_t *f_sh;         /* File the datasets are in */
+    size_t nalloc;              /* Number of entries allocated */
+    size_t nused;               /* Number of entries collected */
+    haddr_t end_addr;           /* End of the last dataset's storage */
+    H5D_mpio_multi_ent_t *ent;  /* Entries, in increasing address order */
+} H5D_mpio_multi_t;
+#endif /* H5_HAVE_PARALLEL */
+
 
 /******************/
 /* Chunk typedefs */
@@ -396,14 +461,17 @@ typedef struct H5D_virtual_held_file_t {
 struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned    ninits;    /* Number of chunk creations        */
-        unsigned    nhits;     /* Number of cache hits            */
-        unsigned    nmisses;   /* Number of cache misses        */
-        unsigned    nflushes;  /* Number of cache flushes        */
+        hsize_t     ninits;    /* Number of chunk creations        */
+        hsize_t     nhits;     /* Number of cache hits            */
+        hsize_t     nmisses;   /* Number of cache misses        */
+        hsize_t     nevictions; /* Number of chunks preempted      */
+        hsize_t     nflushes;  /* Number of cache flushes        */
     } stats;
     size_t        nbytes_max;  /* Maximum cached raw data in bytes    */
     size_t        nslots;      /* Number of chunk slots allocated    */
     double        w0;          /* Chunk preemption policy          */
+    H5D_chunk_cache_policy_t policy; /* Replacement policy          */
+    hsize_t       clock;       /* Count of chunk accesses, ages entries */
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list        */
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list        */
     struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
@@ -411,6 +479,29 @@ typedef struct H5D_rdcc_t {
     int           nused;        /* Number of chunk slots in use        */
     H5D_chunk_cached_t last;    /* Cached copy of last chunk information */
     struct H5D_rdcc_ent_t **slot; /* Chunk slots, each points to a chunk*/
+
+    /* Adaptive replacement cache (ARC) state.  The list above holds the
+     * chunks accessed once ("recent") from the head up to 'frequent', then
+     * the chunks accessed more than once, each part in LRU order.  The ghost
+     * lists hold the hash keys of chunks recently preempted from each part.
+     */
+    struct {
+        struct H5D_rdcc_ent_t *frequent; /* First entry accessed more than once */
+        size_t    nrecent;      /* Number of entries accessed once */
+        size_t    target;       /* Target number of entries accessed once */
+        size_t    capacity;     /* Number of chunks that fit in the cache */
+        size_t    nghosts_max;  /* Capacity of each ghost list */
+        size_t    nrecent_ghosts;   /* Keys in the 'recent' ghost list */
+        size_t    nfrequent_ghosts; /* Keys in the 'frequent' ghost list */
+        hsize_t   *recent_ghosts;   /* Keys of preempted 'recent' chunks, oldest first */
+        hsize_t   *frequent_ghosts; /* Keys of preempted 'frequent' chunks, oldest first */
+    } arc;
+
+    /* File-wide budget shared with the other open datasets */
+    H5F_rdcc_budget_t *budget;  /* Budget, or NULL if the file has none */
+    struct H5D_shared_t *budget_prev; /* Dataset used less recently */
+    struct H5D_shared_t *budget_next; /* Dataset used more recently */
+
     H5SL_t        *sel_chunks;    /* Skip list containing information for each chunk selected */
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
@@ -516,6 +607,23 @@ typedef struct H5D_fill_buf_info_t {
     hbool_t     has_vlen_fill_type;     /* Whether the datatype for the fill value has a variable-length component */
 } H5D_fill_buf_info_t;
 
+/* Prepared read of a contiguous dataset (for H5Dprepare_read) */
+struct H5D_prepared_read_t {
+    H5D_t       *dset;                  /* Dataset to read */
+    hid_t       dset_id;                /* ID of dataset, held open by the handle */
+    H5F_shared_t *f_sh;                 /* Shared file the dataset is in */
+    H5D_contig_storage_t store;         /* Location & size of dataset's data */
+    hsize_t     npoints;                /* Number of elements in the dataset */
+    H5T_path_t  *tpath;                 /* Conversion path from dataset to memory datatype */
+    hbool_t     is_conv_noop;           /* Whether the conversion is a no-op */
+    hid_t       src_type_id;            /* ID of dataset's datatype */
+    hid_t       dst_type_id;            /* ID of copy of memory datatype */
+    size_t      src_type_size;          /* Size of dataset's datatype */
+    size_t      dst_type_size;          /* Size of memory datatype */
+    void        *tconv_buf;             /* Conversion buffer, for memory types smaller than the dataset's */
+    size_t      tconv_buf_size;         /* Size of conversion buffer */
+};
+
 
 /*****************************/
 /* Package Private Variables */
@@ -560,9 +668,11 @@ H5_DLL herr_t H5D__get_space_status(const H5D_t *dset, H5D_space_status_t *alloc
 H5_DLL herr_t H5D__alloc_storage(const H5D_io_info_t *io_info, H5D_time_alloc_t time_alloc, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t H5D__get_storage_size(const H5D_t *dset, hsize_t *storage_size);
 H5_DLL herr_t H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage_size);
+H5_DLL herr_t H5D__get_chunk_cache_stats(const H5D_t *dset, H5D_chunk_cache_stats_t *stats);
 H5_DLL herr_t H5D__get_num_chunks(const H5D_t *dset, const H5S_t *space, hsize_t *nchunks);
 H5_DLL herr_t H5D__get_chunk_info(const H5D_t *dset, const H5S_t *space, hsize_t chk_idx, hsize_t *coord, unsigned *filter_mask, haddr_t *offset, hsize_t *size);
 H5_DLL herr_t H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *coord, unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t H5D__chunk_iter(const H5D_t *dset, H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
 H5_DLL herr_t H5D__vlen_get_buf_size(H5D_t *dset, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t H5D__vlen_get_buf_size_gen(H5VL_object_t *vol_obj, hid_t type_id, hid_t space_id, hsize_t *size);
@@ -578,10 +688,9 @@ H5_DLL herr_t H5D__refresh(hid_t dset_id, H5D_t *dataset);
 H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 
 /* Internal I/O routines */
-H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id,
-    const H5S_t *mem_space, const H5S_t *file_space, void *buf/*out*/);
-H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
-    const H5S_t *mem_space, const H5S_t *file_space, const void *buf);
+H5_DLL herr_t H5D__read(size_t count, H5D_dset_io_info_t *dset_info);
+H5_DLL herr_t H5D__write(size_t count, H5D_dset_io_info_t *dset_info);
+H5_DLL herr_t H5D__io_vec_reserve(H5D_io_vec_t *io_vec, size_t nextents);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info,
@@ -631,6 +740,10 @@ H5_DLL herr_t H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage
     H5F_t *f_dst, H5O_storage_contig_t *storage_dst, H5T_t *src_dtype,
     H5O_copy_t *cpy_info);
 H5_DLL herr_t H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL H5D_prepared_read_t *H5D__contig_prepare_read(H5D_t *dset, hid_t mem_type_id);
+H5_DLL herr_t H5D__contig_read_prepared(H5D_prepared_read_t *prep, hsize_t offset,
+    size_t nelmts, void *buf);
+H5_DLL herr_t H5D__contig_close_prepared(H5D_prepared_read_t *prep);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr,
@@ -665,6 +778,9 @@ H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters,
          hsize_t *offset, uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset,
          uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count,
+         const hsize_t *offsets, uint32_t *filters, hsize_t *sizes, void **bufs,
+         const void **ptrs);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -740,6 +856,13 @@ H5_DLL herr_t H5D__chunk_collective_write(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, hsize_t nelmts, const H5S_t *file_space,
     const H5S_t *mem_space, H5D_chunk_map_t *fm);
 
+/* MPI-IO functions to combine the contiguous collective I/O of several
+ * datasets into one operation */
+H5_DLL herr_t H5D__mpio_multi_add(H5D_mpio_multi_t *multi, const H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, const H5S_t *file_space, const H5S_t *mem_space);
+H5_DLL herr_t H5D__mpio_multi_io(H5D_mpio_multi_t *multi, H5D_io_op_type_t op_type);
+H5_DLL herr_t H5D__mpio_multi_term(H5D_mpio_multi_t *multi);
+
 /* MPI-IO function to check if a direct I/O transfer is possible between
  * memory and the file */
 H5_DLL htri_t H5D__mpio_opt_possible(const H5D_io_info_t *io_info,
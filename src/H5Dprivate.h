@@ -51,6 +51,7 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME   "rdcc_nslots"    /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME   "rdcc_nbytes"    /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME    "rdcc_w0"        /* Preemption read chunks first */
+#define H5D_ACS_CHUNK_CACHE_POLICY_NAME     "rdcc_policy"    /* Chunk cache replacement policy */
 #define H5D_ACS_VDS_VIEW_NAME               "vds_view"       /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME         "vds_printf_gap" /* VDS printf gap size */
 #define H5D_ACS_VDS_PREFIX_NAME             "vds_prefix"     /* VDS file prefix */
@@ -83,6 +84,8 @@
 #define H5D_XFER_FILTER_CB_NAME         "filter_cb"      /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME           "type_conv_cb"   /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME             "data_transform" /* Data transform */
+#define H5D_XFER_FILTER_NTHREADS_NAME   "filter_nthreads" /* # of threads for chunk filter pipeline */
+#define H5D_XFER_CHUNK_READ_GAP_NAME    "chunk_read_gap" /* Largest gap between chunks merged into one read */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME "coll_chunk_link_hard"
@@ -101,6 +101,26 @@ typedef enum H5D_vds_view_t {
     H5D_VDS_LAST_AVAILABLE      = 1
 } H5D_vds_view_t;
 
+/* Replacement policies for the raw data chunk cache */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR    = -1,
+    H5D_CHUNK_CACHE_POLICY_DEFAULT  = 0,    /* LRU order, with partially accessed chunks kept per w0 */
+    H5D_CHUNK_CACHE_POLICY_LRU      = 1,    /* Preempt the least recently used chunk */
+    H5D_CHUNK_CACHE_POLICY_ARC      = 2,    /* Adaptive replacement cache */
+    H5D_CHUNK_CACHE_POLICY_NTYPES           /* This one must be last! */
+} H5D_chunk_cache_policy_t;
+
+/* Statistics of the raw data chunk cache of a dataset */
+typedef struct H5D_chunk_cache_stats_t {
+    hsize_t nhits;              /* Chunk accesses found in the cache */
+    hsize_t nmisses;            /* Chunk accesses read from the file */
+    hsize_t ninits;             /* Chunks created without reading the file */
+    hsize_t nevictions;         /* Chunks preempted from the cache */
+    hsize_t nflushes;           /* Chunks written to the file */
+    size_t nbytes_used;         /* Bytes of raw data currently cached */
+    size_t nentries;            /* Chunks currently cached */
+} H5D_chunk_cache_stats_t;
+
 /* Callback for H5Pset_append_flush() in a dataset access property list */
 typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
 
@@ -117,6 +137,13 @@ typedef herr_t (*H5D_scatter_func_t)(const void **src_buf/*out*/,
 typedef herr_t (*H5D_gather_func_t)(const void *dst_buf,
                                     size_t dst_buf_bytes_used, void *op_data);
 
+/* Define the operator function pointer for H5Dchunk_iter() */
+typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, unsigned filter_mask,
+                                   haddr_t addr, hsize_t size, void *op_data);
+
+/* Opaque handle for repeated reads of a contiguous dataset (H5Dprepare_read()) */
+typedef struct H5D_prepared_read_t H5D_prepared_read_t;
+
 
 /********************/
 /* Public Variables */
@@ -145,15 +172,36 @@ H5_DLL herr_t H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset, hs
 H5_DLL herr_t H5Dget_num_chunks(hid_t dset_id, hid_t fspace_id, hsize_t *nchunks);
 H5_DLL herr_t H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *coord, unsigned *filter_mask, haddr_t *addr, hsize_t *size);
 H5_DLL herr_t H5Dget_chunk_info(hid_t dset_id, hid_t fspace_id, hsize_t chk_idx, hsize_t *coord, unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t H5Dchunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL haddr_t H5Dget_offset(hid_t dset_id);
+H5_DLL herr_t H5Dget_chunk_cache_stats(hid_t dset_id, H5D_chunk_cache_stats_t *stats);
 H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_multi(size_t count, const hid_t dset_id[],
+            const hid_t mem_type_id[], const hid_t mem_space_id[],
+            const hid_t file_space_id[], hid_t plist_id, void *buf[]/*out*/);
+H5_DLL herr_t H5Dwrite_multi(size_t count, const hid_t dset_id[],
+            const hid_t mem_type_id[], const hid_t mem_space_id[],
+            const hid_t file_space_id[], hid_t plist_id, const void *buf[]);
+H5_DLL herr_t H5Dread_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+            hid_t file_space_id, hid_t plist_id, void *buf/*out*/, hid_t es_id);
+H5_DLL herr_t H5Dwrite_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+            hid_t file_space_id, hid_t plist_id, const void *buf, hid_t es_id);
 H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters,
             const hsize_t *offset, size_t data_size, const void *buf);
 H5_DLL herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id,
             const hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count,
+            const hsize_t *offsets, uint32_t *filters, hsize_t *sizes,
+            void *bufs[]/*out*/);
+H5_DLL herr_t H5Dmap_chunks(hid_t dset_id, size_t count, const hsize_t *offsets,
+            uint32_t *filters, hsize_t *sizes, const void *ptrs[]/*out*/);
+H5_DLL H5D_prepared_read_t *H5Dprepare_read(hid_t dset_id, hid_t mem_type_id);
+H5_DLL herr_t H5Dread_prepared(H5D_prepared_read_t *prep, hsize_t offset,
+            size_t nelmts, void *buf/*out*/);
+H5_DLL herr_t H5Dclose_prepared(H5D_prepared_read_t *prep);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id, hsize_t *size);
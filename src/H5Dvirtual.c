@@ -2575,6 +2575,7 @@ H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset)
 {
     H5S_t       *projected_src_space = NULL; /* File space for selection in a single source dataset */
+    H5D_dset_io_info_t dset_info;           /* Source dataset I/O info */
     herr_t      ret_value = SUCCEED;        /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2594,7 +2595,12 @@ H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "can't project virtual intersection onto source space")
 
         /* Perform read on source dataset */
-        if(H5D__read(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space, projected_src_space, io_info->u.rbuf) < 0)
+        dset_info.dset = source_dset->dset;
+        dset_info.mem_type_id = type_info->dst_type_id;
+        dset_info.mem_space = source_dset->projected_mem_space;
+        dset_info.file_space = projected_src_space;
+        dset_info.u.rbuf = io_info->u.rbuf;
+        if(H5D__read(1, &dset_info) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read source dataset")
 
         /* Close projected_src_space */
@@ -2764,6 +2770,7 @@ H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset)
 {
     H5S_t       *projected_src_space = NULL; /* File space for selection in a single source dataset */
+    H5D_dset_io_info_t dset_info;           /* Source dataset I/O info */
     herr_t      ret_value = SUCCEED;        /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2785,7 +2792,12 @@ H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "can't project virtual intersection onto source space")
 
         /* Perform write on source dataset */
-        if(H5D__write(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space, projected_src_space, io_info->u.wbuf) < 0)
+        dset_info.dset = source_dset->dset;
+        dset_info.mem_type_id = type_info->dst_type_id;
+        dset_info.mem_space = source_dset->projected_mem_space;
+        dset_info.file_space = projected_src_space;
+        dset_info.u.wbuf = io_info->u.wbuf;
+        if(H5D__write(1, &dset_info) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write to source dataset")
 
         /* Close projected_src_space */
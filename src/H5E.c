@@ -205,6 +205,7 @@ H5E__init_package(void)
 
 #ifndef H5_HAVE_THREADSAFE
     H5E_stack_g[0].nused = 0;
+    H5E_stack_g[0].paused = 0;
     H5E__set_default_auto(H5E_stack_g);
 #endif /* H5_HAVE_THREADSAFE */
 
@@ -375,6 +376,7 @@ H5E__get_stack(void)
 
         /* Set the thread-specific info */
         estack->nused = 0;
+        estack->paused = 0;
         H5E__set_default_auto(estack);
 
         /* (It's not necessary to release this in this API, it is
@@ -0,0 +1,383 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Public routines and package setup for event sets, which
+ *              track asynchronous operations until the application waits
+ *              for them.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5ESmodule.h"         /* This source code file is part of the H5ES module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESpkg.h"            /* Event Sets                               */
+#include "H5Iprivate.h"         /* IDs                                      */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5ES__close_cb(H5ES_t *es);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Package initialization variable */
+hbool_t H5_PKG_INIT_VAR = FALSE;
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Event set ID class */
+static const H5I_class_t H5I_EVENTSET_CLS[1] = {{
+    H5I_EVENTSET,               /* ID class value */
+    0,                          /* Class flags */
+    0,                          /* # of reserved IDs for class */
+    (H5I_free_t)H5ES__close_cb  /* Callback routine for closing objects of this class */
+}};
+
+/* Flag indicating "top" of interface has been initialized */
+static hbool_t H5ES_top_package_initialize_s = FALSE;
+
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5ES_init
+ *
+ * Purpose:  Initialize the interface from some other layer.
+ *
+ * Return:   Success:    non-negative
+ *
+ *           Failure:    negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES_init(void)
+{
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+    /* FUNC_ENTER() does all the work */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES_init() */
+
+
+/*-------------------------------------------------------------------------
+NAME
+    H5ES__init_package -- Initialize interface-specific information
+USAGE
+    herr_t H5ES__init_package()
+
+RETURNS
+    Non-negative on success/Negative on failure
+DESCRIPTION
+    Initializes any interface-specific data or routines.
+---------------------------------------------------------------------------
+*/
+herr_t
+H5ES__init_package(void)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Initialize the atom group for the event set IDs */
+    if(H5I_register_type(H5I_EVENTSET_CLS) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINIT, FAIL, "unable to initialize interface")
+
+    /* Mark "top" of interface as initialized, too */
+    H5ES_top_package_initialize_s = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5ES_top_term_package
+ *
+ * Purpose:  Close the "top" of the interface, releasing IDs, etc.
+ *
+ *           Closing an event set completes its outstanding operations,
+ *           which releases the references they hold on objects in
+ *           other interfaces.
+ *
+ * Return:   Success:    Positive if anything was done that might
+ *                affect other interfaces; zero otherwise.
+ *           Failure:    Negative.
+ *-------------------------------------------------------------------------
+ */
+int
+H5ES_top_term_package(void)
+{
+    int    n = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5ES_top_package_initialize_s) {
+        if(H5I_nmembers(H5I_EVENTSET) > 0) {
+            (void)H5I_clear_type(H5I_EVENTSET, FALSE, FALSE);
+            n++; /*H5I*/
+        } /* end if */
+
+        /* Mark closed */
+        if(0 == n)
+            H5ES_top_package_initialize_s = FALSE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5ES_top_term_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5ES_term_package
+ *
+ * Purpose:  Terminate this interface.
+ *
+ * Note:     Finishes shutting down the interface, after
+ *           H5ES_top_term_package() is called
+ *
+ * Return:   Success:    Positive if anything was done that might
+ *                affect other interfaces; zero otherwise.
+ *            Failure:    Negative.
+ *-------------------------------------------------------------------------
+ */
+int
+H5ES_term_package(void)
+{
+    int    n = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5_PKG_INIT_VAR) {
+        /* Sanity checks */
+        HDassert(0 == H5I_nmembers(H5I_EVENTSET));
+        HDassert(FALSE == H5ES_top_package_initialize_s);
+
+        /* Tell the worker thread to exit */
+        (void)H5ES__term_worker();
+
+        /* Destroy the event set object id group */
+        n += (H5I_dec_type_ref(H5I_EVENTSET) > 0);
+
+        /* Mark closed */
+        if(0 == n)
+            H5_PKG_INIT_VAR = FALSE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5ES_term_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__close_cb
+ *
+ * Purpose:     Called when the ref count reaches zero on the event set's ID
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__close_cb(H5ES_t *es)
+{
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(es);
+
+    /* Close the event set */
+    if(H5ES__close(es) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CLOSEERROR, FAIL, "unable to close event set");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__close_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5EScreate
+ *
+ * Purpose:     Creates an event set, for tracking the asynchronous
+ *              operations (H5Dread_async, etc.) inserted into it.
+ *
+ * Return:      Success:    An ID for the event set
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5EScreate(void)
+{
+    H5ES_t     *es = NULL;                      /* New event set */
+    hid_t       ret_value = H5I_INVALID_HID;    /* Return value */
+
+    FUNC_ENTER_API(H5I_INVALID_HID)
+    H5TRACE0("i","");
+
+    /* Create the new event set object */
+    if(NULL == (es = H5ES__create()))
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTCREATE, H5I_INVALID_HID, "can't create event set")
+
+    /* Register the new event set to get an ID for it */
+    if((ret_value = H5I_register(H5I_EVENTSET, es, TRUE)) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTREGISTER, H5I_INVALID_HID, "can't register event set")
+
+done:
+    if(H5I_INVALID_HID == ret_value)
+        if(es && H5ES__close(es) < 0)
+            HDONE_ERROR(H5E_EVENTSET, H5E_CLOSEERROR, H5I_INVALID_HID, "unable to release event set")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5EScreate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESwait
+ *
+ * Purpose:     Waits for the operations in an event set to complete, for
+ *              at most TIMEOUT nanoseconds.  H5ES_WAIT_NONE only checks
+ *              their status and H5ES_WAIT_FOREVER waits for all of them.
+ *
+ *              Completed operations are removed from the event set.  The
+ *              number of operations still in progress is returned in
+ *              NUM_IN_PROGRESS and OP_FAILED is set if any operation
+ *              inserted into the event set has failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESwait(hid_t es_id, uint64_t timeout, size_t *num_in_progress/*out*/,
+    hbool_t *op_failed/*out*/)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iULxx", es_id, timeout, num_in_progress, op_failed);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+    if(NULL == num_in_progress)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL num_in_progress pointer")
+    if(NULL == op_failed)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL op_failed pointer")
+
+    /* Wait for the operations */
+    if(H5ES__wait(es, timeout, num_in_progress, op_failed) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "can't wait on operations")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESwait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              have not completed yet.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_count(hid_t es_id, size_t *count/*out*/)
+{
+    H5ES_t     *es;                     /* Event set */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", es_id, count);
+
+    /* Check arguments */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* Retrieve the count, if requested */
+    if(count)
+        *count = H5ES__get_count(es);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESclose
+ *
+ * Purpose:     Closes an event set.  Operations still in progress are
+ *              waited for first.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESclose(hid_t es_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", es_id);
+
+    /* Check arguments */
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* Decrement the counter on the event set.  It will be freed if the
+     * count reaches zero.
+     */
+    if(H5I_dec_app_ref(es_id) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "unable to decrement ref count on event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESclose() */
+
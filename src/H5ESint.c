@@ -0,0 +1,704 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Internal routines for event sets.
+ *
+ *              An operation inserted into an event set is handed to the
+ *              VOL connector when the connector supports asynchronous
+ *              requests, and is then tracked with the connector's
+ *              request_wait or request_notify callback.
+ *
+ *              For other connectors, thread-safe builds queue the operation
+ *              for a background thread owned by the library.  The thread
+ *              takes the library's API lock before removing an operation
+ *              from the queue, so while any thread holds the API lock
+ *              every operation is either queued or complete.  This lets
+ *              H5ESwait run queued operations itself, in queue order,
+ *              instead of blocking on the background thread.
+ *
+ *              Without thread-safety there's no way to keep a second
+ *              thread out of the library, so operations are performed
+ *              when they are inserted.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5ESmodule.h"         /* This source code file is part of the H5ES module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5CXprivate.h"        /* API Contexts                             */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESpkg.h"            /* Event Sets                               */
+#include "H5FLprivate.h"        /* Free Lists                               */
+#include "H5Iprivate.h"         /* IDs                                      */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Interval for polling operations whose completion is reported through
+ * the connector's request_notify callback */
+#define H5ES_NOTIFY_POLL_NSEC   ((uint64_t)1000 * 1000)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5ES__exec(H5ES_op_cb_t op, void *op_data, void **req);
+static void H5ES__complete(H5ES_event_t *ev, H5ES_status_t status);
+static herr_t H5ES__request_notify_cb(void *ctx, H5ES_status_t status);
+static uint64_t H5ES__remaining(double start, uint64_t timeout);
+static herr_t H5ES__retire(H5ES_t *es);
+#ifdef H5ES_HAVE_WORKER
+static herr_t H5ES__queue(H5ES_event_t *ev);
+static hbool_t H5ES__run_next(void);
+static void *H5ES__worker(void *_gen);
+#endif /* H5ES_HAVE_WORKER */
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5ES_t struct */
+H5FL_DEFINE_STATIC(H5ES_t);
+
+/* Declare a free list to manage the H5ES_event_t struct */
+H5FL_DEFINE_STATIC(H5ES_event_t);
+
+#ifdef H5ES_HAVE_WORKER
+/* Queue of operations for the worker thread.  The queue pointers are
+ * protected by the queue mutex, everything else about an event by the
+ * library's API lock.
+ */
+static pthread_mutex_t H5ES_queue_mutex_s = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t H5ES_queue_cond_s = PTHREAD_COND_INITIALIZER;
+static H5ES_event_t *H5ES_queue_head_s = NULL;
+static H5ES_event_t *H5ES_queue_tail_s = NULL;
+
+/* Worker thread state: a worker exits when the generation changes */
+static hbool_t H5ES_worker_running_s = FALSE;
+static unsigned H5ES_worker_gen_s = 0;
+#endif /* H5ES_HAVE_WORKER */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__create
+ *
+ * Purpose:     Creates a new, empty event set.
+ *
+ * Return:      Success:    Pointer to the event set
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5ES_t *
+H5ES__create(void)
+{
+    H5ES_t *ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(NULL == (ret_value = H5FL_CALLOC(H5ES_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate event set")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__exec
+ *
+ * Purpose:     Performs an operation in its own API context, so that the
+ *              properties it sets up don't leak into the caller's.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__exec(H5ES_op_cb_t op, void *op_data, void **req)
+{
+    hbool_t api_ctx_pushed = FALSE;     /* Whether an API context was pushed */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(op);
+
+    if(H5CX_push() < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+
+    if((op)(op_data, req) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTOPERATE, FAIL, "asynchronous operation failed")
+
+done:
+    if(api_ctx_pushed && H5CX_pop() < 0)
+        HDONE_ERROR(H5E_EVENTSET, H5E_CANTRESET, FAIL, "can't reset API context")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__exec() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__complete
+ *
+ * Purpose:     Records the final status of an operation and releases its
+ *              data.  The error stack of a failed operation is cleared,
+ *              the failure is reported through H5ESwait instead.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5ES__complete(H5ES_event_t *ev, H5ES_status_t status)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ev);
+    HDassert(H5ES_STATUS_IN_PROGRESS != status);
+
+    if(H5ES_STATUS_FAIL == status) {
+        ev->es->err_occurred = TRUE;
+        H5E_clear_stack(NULL);
+    } /* end if */
+
+    if(ev->op_data) {
+        if((ev->free_op)(ev->op_data) < 0)
+            H5E_clear_stack(NULL);
+        ev->op_data = NULL;
+    } /* end if */
+
+    ev->track = H5ES_TRACK_NONE;
+    ev->status = status;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5ES__complete() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__request_notify_cb
+ *
+ * Purpose:     Records the completion of an operation tracked through the
+ *              connector's request_notify callback.  The event's data is
+ *              released when the application waits on the event set.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__request_notify_cb(void *ctx, H5ES_status_t status)
+{
+    H5ES_event_t *ev = (H5ES_event_t *)ctx;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ev);
+
+    ev->status = status;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5ES__request_notify_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_insert
+ *
+ * Purpose:     Inserts an operation into an event set.  OP performs the
+ *              operation on OP_DATA and FREE_OP releases OP_DATA; OP_DATA
+ *              is always released, even when this routine fails.
+ *
+ *              CONNECTOR is the VOL connector of the object operated on,
+ *              or NULL if the operation can't be handed to a connector.
+ *
+ *              A failure of the operation itself isn't an error here,
+ *              it's reported when the application waits on the event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES_insert(hid_t es_id, H5VL_t *connector, H5ES_op_cb_t op,
+    H5ES_free_cb_t free_op, void *op_data)
+{
+    H5ES_t *es;                     /* Event set */
+    H5ES_event_t *ev = NULL;        /* New event */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(op);
+    HDassert(free_op);
+
+    /* Get the event set */
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* Create the event and link it into the event set */
+    if(NULL == (ev = H5FL_CALLOC(H5ES_event_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate event")
+    ev->es = es;
+    ev->status = H5ES_STATUS_IN_PROGRESS;
+    ev->track = H5ES_TRACK_NONE;
+    ev->op = op;
+    ev->free_op = free_op;
+    ev->op_data = op_data;
+    op_data = NULL;
+    if(es->tail)
+        es->tail->next = ev;
+    else
+        es->head = ev;
+    es->tail = ev;
+
+    if(connector && (connector->cls->request_cls.wait || connector->cls->request_cls.notify)) {
+        void *token = NULL;     /* Request token from the connector */
+
+        /* Let the connector perform the operation */
+        if(H5ES__exec(ev->op, ev->op_data, &token) < 0)
+            H5ES__complete(ev, H5ES_STATUS_FAIL);
+        else if(NULL == token)
+            /* The connector completed the operation synchronously */
+            H5ES__complete(ev, H5ES_STATUS_SUCCEED);
+        else {
+            ev->request.data = token;
+            ev->request.connector = connector;
+
+            /* Prefer waiting on the request, which can be done with a timeout */
+            if(connector->cls->request_cls.wait)
+                ev->track = H5ES_TRACK_REQUEST_WAIT;
+            else {
+                ev->track = H5ES_TRACK_REQUEST_NOTIFY;
+
+                /* The connector releases the request once it has notified us */
+                if(H5VL_request_notify(&ev->request, H5ES__request_notify_cb, ev) < 0)
+                    H5ES__complete(ev, H5ES_STATUS_FAIL);
+                ev->request.data = NULL;
+            } /* end else */
+        } /* end else */
+    } /* end if */
+    else {
+#ifdef H5ES_HAVE_WORKER
+        if(H5ES__queue(ev) < 0)
+#endif /* H5ES_HAVE_WORKER */
+            H5ES__complete(ev, H5ES__exec(ev->op, ev->op_data, NULL) < 0 ? H5ES_STATUS_FAIL : H5ES_STATUS_SUCCEED);
+    } /* end else */
+
+done:
+    if(op_data)
+        (void)(free_op)(op_data);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__remaining
+ *
+ * Purpose:     Computes how much of a timeout that started at START (in
+ *              seconds) is left.
+ *
+ * Return:      Nanoseconds left of the timeout
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5ES__remaining(double start, uint64_t timeout)
+{
+    double elapsed;             /* Time spent so far, in nanoseconds */
+    uint64_t ret_value = 0;     /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5ES_WAIT_FOREVER == timeout || H5ES_WAIT_NONE == timeout)
+        ret_value = timeout;
+    else {
+        elapsed = (H5_get_time() - start) * 1.0e9;
+        if(elapsed < (double)timeout)
+            ret_value = timeout - (uint64_t)elapsed;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__remaining() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__retire
+ *
+ * Purpose:     Removes the completed operations from an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__retire(H5ES_t *es)
+{
+    H5ES_event_t *ev, *prev = NULL, *next;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(ev = es->head; ev; ev = next) {
+        next = ev->next;
+
+        if(H5ES_STATUS_IN_PROGRESS == ev->status)
+            prev = ev;
+        else {
+            /* Operations reported through request_notify complete here */
+            if(H5ES_TRACK_REQUEST_NOTIFY == ev->track)
+                H5ES__complete(ev, ev->status);
+            HDassert(NULL == ev->op_data);
+
+            if(prev)
+                prev->next = next;
+            else
+                es->head = next;
+            if(es->tail == ev)
+                es->tail = prev;
+            ev = H5FL_FREE(H5ES_event_t, ev);
+        } /* end else */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5ES__retire() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__wait
+ *
+ * Purpose:     Waits at most TIMEOUT nanoseconds for the operations in an
+ *              event set and removes the completed ones.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__wait(H5ES_t *es, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed)
+{
+    H5ES_event_t *ev;                   /* Current event */
+    double start;                       /* Time the wait started */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(es);
+
+    start = H5_get_time();
+    for(ev = es->head; ev; ev = ev->next) {
+        if(H5ES_STATUS_IN_PROGRESS != ev->status)
+            continue;
+
+        switch(ev->track) {
+            case H5ES_TRACK_QUEUED:
+#ifdef H5ES_HAVE_WORKER
+                /* Run the queue up to this event */
+                while(H5ES_STATUS_IN_PROGRESS == ev->status && H5ES__remaining(start, timeout) > 0)
+                    if(!H5ES__run_next())
+                        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "queued event is missing")
+#endif /* H5ES_HAVE_WORKER */
+                break;
+
+            case H5ES_TRACK_REQUEST_WAIT:
+                {
+                    H5ES_status_t status = H5ES_STATUS_IN_PROGRESS;
+
+                    if(H5VL_request_wait(&ev->request, H5ES__remaining(start, timeout), &status) < 0) {
+                        (void)H5VL_request_free(&ev->request);
+                        H5ES__complete(ev, H5ES_STATUS_FAIL);
+                    } /* end if */
+                    else if(H5ES_STATUS_IN_PROGRESS != status)
+                        /* The connector released the request */
+                        H5ES__complete(ev, status);
+                }
+                break;
+
+            case H5ES_TRACK_REQUEST_NOTIFY:
+                /* Nothing to wait on, the connector tells us when it's done */
+                break;
+
+            case H5ES_TRACK_NONE:
+            default:
+                HGOTO_ERROR(H5E_EVENTSET, H5E_BADVALUE, FAIL, "operation in progress isn't tracked")
+        } /* end switch */
+    } /* end for */
+
+done:
+    /* Remove the completed operations */
+    H5ES__retire(es);
+
+    if(num_in_progress)
+        *num_in_progress = H5ES__get_count(es);
+    if(op_failed)
+        *op_failed = es->err_occurred;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__wait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__get_count
+ *
+ * Purpose:     Counts the operations in an event set that haven't
+ *              completed.
+ *
+ * Return:      # of operations in progress (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5ES__get_count(const H5ES_t *es)
+{
+    const H5ES_event_t *ev;     /* Current event */
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(es);
+
+    for(ev = es->head; ev; ev = ev->next)
+        if(H5ES_STATUS_IN_PROGRESS == ev->status)
+            ret_value++;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__get_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__close
+ *
+ * Purpose:     Waits for all operations in an event set and frees it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__close(H5ES_t *es)
+{
+    size_t num_in_progress = 0;     /* # of operations in progress */
+    hbool_t op_failed = FALSE;      /* Whether an operation failed */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(es);
+
+    if(H5ES__wait(es, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "can't wait on operations")
+
+    /* Operations reported through request_notify still refer to their
+     * events, so poll until the connector is done with them */
+    while(num_in_progress > 0) {
+        H5_nanosleep(H5ES_NOTIFY_POLL_NSEC);
+        if(H5ES__wait(es, H5ES_WAIT_NONE, &num_in_progress, &op_failed) < 0)
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTWAIT, FAIL, "can't wait on operations")
+    } /* end while */
+
+    HDassert(NULL == es->head);
+    es = H5FL_FREE(H5ES_t, es);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__close() */
+
+#ifdef H5ES_HAVE_WORKER
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__queue
+ *
+ * Purpose:     Appends an event to the worker thread's queue, starting
+ *              the worker thread if needed.
+ *
+ * Return:      Non-negative on success/Negative if the event couldn't be
+ *              queued, in which case the caller performs the operation.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__queue(H5ES_event_t *ev)
+{
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ev);
+
+    pthread_mutex_lock(&H5ES_queue_mutex_s);
+
+    if(!H5ES_worker_running_s) {
+        pthread_attr_t attr;
+        pthread_t thread;
+
+        /* Nobody waits for the worker thread, it exits on its own */
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if(0 == pthread_create(&thread, &attr, H5ES__worker, (void *)(uintptr_t)H5ES_worker_gen_s))
+            H5ES_worker_running_s = TRUE;
+        pthread_attr_destroy(&attr);
+    } /* end if */
+
+    if(H5ES_worker_running_s) {
+        ev->track = H5ES_TRACK_QUEUED;
+        if(H5ES_queue_tail_s)
+            H5ES_queue_tail_s->queue_next = ev;
+        else
+            H5ES_queue_head_s = ev;
+        H5ES_queue_tail_s = ev;
+        pthread_cond_signal(&H5ES_queue_cond_s);
+    } /* end if */
+    else
+        ret_value = FAIL;
+
+    pthread_mutex_unlock(&H5ES_queue_mutex_s);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__queue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__run_next
+ *
+ * Purpose:     Removes the first event from the worker thread's queue and
+ *              performs its operation.  Must be called with the API lock
+ *              held.
+ *
+ * Return:      TRUE if an operation was performed, FALSE if the queue was
+ *              empty
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5ES__run_next(void)
+{
+    H5ES_event_t *ev;           /* Event to run */
+    hbool_t ret_value = FALSE;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    pthread_mutex_lock(&H5ES_queue_mutex_s);
+    if(NULL != (ev = H5ES_queue_head_s)) {
+        H5ES_queue_head_s = ev->queue_next;
+        if(NULL == H5ES_queue_head_s)
+            H5ES_queue_tail_s = NULL;
+        ev->queue_next = NULL;
+    } /* end if */
+    pthread_mutex_unlock(&H5ES_queue_mutex_s);
+
+    if(ev) {
+        H5ES__complete(ev, H5ES__exec(ev->op, ev->op_data, NULL) < 0 ? H5ES_STATUS_FAIL : H5ES_STATUS_SUCCEED);
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__run_next() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__worker
+ *
+ * Purpose:     Main loop of the worker thread: performs queued operations
+ *              whenever the application isn't inside the library.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5ES__worker(void *_gen)
+{
+    unsigned gen = (unsigned)(uintptr_t)_gen;   /* Generation of this worker */
+    hbool_t done = FALSE;                       /* Whether to exit */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while(!done) {
+        pthread_mutex_lock(&H5ES_queue_mutex_s);
+        while(gen == H5ES_worker_gen_s && NULL == H5ES_queue_head_s)
+            pthread_cond_wait(&H5ES_queue_cond_s, &H5ES_queue_mutex_s);
+        done = (gen != H5ES_worker_gen_s);
+        pthread_mutex_unlock(&H5ES_queue_mutex_s);
+
+        /* The queue may have been drained by H5ESwait by the time the API
+         * lock is acquired, H5ES__run_next handles that */
+        if(!done) {
+            H5_API_LOCK
+            (void)H5ES__run_next();
+            H5_API_UNLOCK
+        } /* end if */
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5ES__worker() */
+#endif /* H5ES_HAVE_WORKER */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__term_worker
+ *
+ * Purpose:     Tells the worker thread to exit, once all event sets are
+ *              closed.  The thread isn't waited for, since it may be
+ *              blocked on the API lock held by the caller.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__term_worker(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5ES_HAVE_WORKER
+    pthread_mutex_lock(&H5ES_queue_mutex_s);
+    HDassert(NULL == H5ES_queue_head_s);
+    if(H5ES_worker_running_s) {
+        H5ES_worker_gen_s++;
+        H5ES_worker_running_s = FALSE;
+        pthread_cond_broadcast(&H5ES_queue_cond_s);
+    } /* end if */
+    pthread_mutex_unlock(&H5ES_queue_mutex_s);
+#endif /* H5ES_HAVE_WORKER */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5ES__term_worker() */
+
@@ -0,0 +1,100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:    This file contains declarations which are visible only within
+ *        the H5ES package.  Source files outside the H5ES package should
+ *        include H5ESprivate.h instead.
+ */
+#if !(defined H5ES_FRIEND || defined H5ES_MODULE)
+#error "Do not include this file outside the H5ES package!"
+#endif
+
+#ifndef _H5ESpkg_H
+#define _H5ESpkg_H
+
+/* Get package's private header */
+#include "H5ESprivate.h"
+
+/* Other private headers needed by this file */
+
+
+/**************************/
+/* Package Private Macros */
+/**************************/
+
+/* Events are only handed to a background thread when the library's API
+ * lock is available to serialize the thread with the application's calls.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5ES_HAVE_WORKER
+#endif
+
+
+/****************************/
+/* Package Private Typedefs */
+/****************************/
+
+/* How an event is tracked until it completes */
+typedef enum H5ES_track_t {
+    H5ES_TRACK_NONE,            /* Operation already completed              */
+    H5ES_TRACK_QUEUED,          /* Operation queued for the library's worker thread */
+    H5ES_TRACK_REQUEST_WAIT,    /* Connector request, polled with request_wait */
+    H5ES_TRACK_REQUEST_NOTIFY   /* Connector request, completion reported through request_notify */
+} H5ES_track_t;
+
+/* Forward declaration */
+struct H5ES_t;
+
+/* An operation inserted into an event set */
+typedef struct H5ES_event_t {
+    struct H5ES_t *es;                  /* Event set the event belongs to */
+    volatile H5ES_status_t status;      /* Status of the operation */
+    H5ES_track_t track;                 /* How the event is tracked */
+
+    /* Operation to perform (while queued) */
+    H5ES_op_cb_t op;                    /* Callback performing the operation */
+    H5ES_free_cb_t free_op;             /* Callback releasing the operation's data */
+    void *op_data;                      /* Operation's data */
+
+    /* Connector request (while tracked through the VOL) */
+    H5VL_object_t request;              /* Request token & connector */
+
+    struct H5ES_event_t *next;          /* Next event in the event set */
+    struct H5ES_event_t *queue_next;    /* Next event in the worker's queue */
+} H5ES_event_t;
+
+/* An event set */
+typedef struct H5ES_t {
+    H5ES_event_t *head;                 /* First event in the set */
+    H5ES_event_t *tail;                 /* Last event in the set */
+    hbool_t err_occurred;               /* Whether any operation in the set has failed */
+} H5ES_t;
+
+
+/*****************************/
+/* Package Private Variables */
+/*****************************/
+
+
+/******************************/
+/* Package Private Prototypes */
+/******************************/
+H5_DLL H5ES_t *H5ES__create(void);
+H5_DLL herr_t H5ES__wait(H5ES_t *es, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed);
+H5_DLL size_t H5ES__get_count(const H5ES_t *es);
+H5_DLL herr_t H5ES__close(H5ES_t *es);
+H5_DLL herr_t H5ES__term_worker(void);
+
+#endif /* _H5ESpkg_H */
+
@@ -0,0 +1,58 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * This file contains private information about the H5ES module
+ */
+#ifndef _H5ESprivate_H
+#define _H5ESprivate_H
+
+/* Include package's public header */
+#include "H5ESpublic.h"
+
+/* Private headers needed by this file */
+#include "H5VLprivate.h"        /* Virtual Object Layer                     */
+
+
+/**************************/
+/* Library Private Macros */
+/**************************/
+
+
+/****************************/
+/* Library Private Typedefs */
+/****************************/
+
+/* Operation performed for an event.  When REQ is non-NULL, the operation
+ * may hand back a VOL connector request token instead of completing
+ * synchronously.
+ */
+typedef herr_t (*H5ES_op_cb_t)(void *op_data, void **req);
+
+/* Releases the operation's data once the operation has run */
+typedef herr_t (*H5ES_free_cb_t)(void *op_data);
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/******************************/
+/* Library Private Prototypes */
+/******************************/
+H5_DLL herr_t H5ES_init(void);
+H5_DLL herr_t H5ES_insert(hid_t es_id, H5VL_t *connector, H5ES_op_cb_t op,
+    H5ES_free_cb_t free_op, void *op_data);
+
+#endif /* _H5ESprivate_H */
+
@@ -15,11 +15,16 @@
 
 /* Public headers needed by this file */
 #include "H5public.h"           /* Generic Functions                    */
+#include "H5Ipublic.h"          /* IDs                                  */
 
 /*****************/
 /* Public Macros */
 /*****************/
 
+/* Timeouts for H5ESwait, in nanoseconds */
+#define H5ES_WAIT_FOREVER       (UINT64_MAX)    /* Wait until all operations complete */
+#define H5ES_WAIT_NONE          (0)             /* Don't wait for operations to complete */
+
 /*******************/
 /* Public Typedefs */
 /*******************/
@@ -45,6 +50,12 @@ typedef enum H5ES_status_t {
 extern "C" {
 #endif
 
+H5_DLL hid_t H5EScreate(void);
+H5_DLL herr_t H5ESwait(hid_t es_id, uint64_t timeout, size_t *num_in_progress,
+    hbool_t *op_failed);
+H5_DLL herr_t H5ESget_count(hid_t es_id, size_t *count);
+H5_DLL herr_t H5ESclose(hid_t es_id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -695,6 +695,15 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+    /* Check for 'default' error stack */
+    if(estack == NULL)
+    	if(NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+            HGOTO_DONE(FAIL)
+
+    /* Drop the error if the stack is paused */
+    if(estack->paused)
+        HGOTO_DONE(SUCCEED)
+
 /* Note that the variable-argument parsing for the format is identical in
  *      the H5Epush2() routine - correct errors and make changes in both
  *      places. -QAK
@@ -895,6 +904,68 @@ done:
 } /* end H5E__clear_entries() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5E_pause_stack
+ *
+ * Purpose:     Stops errors from being pushed on the current thread's
+ *              error stack until H5E_resume_stack() is called.
+ *
+ *              This is for a thread running without the API lock, since
+ *              pushing an error changes the reference counts of the
+ *              error class & message IDs.  The caller reports any
+ *              failure after taking the lock back.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_pause_stack(void)
+{
+    H5E_t *estack;                      /* Error stack to pause */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack")
+
+    estack->paused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_pause_stack() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5E_resume_stack
+ *
+ * Purpose:     Resumes pushing errors on the current thread's error
+ *              stack, after H5E_pause_stack().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_resume_stack(void)
+{
+    H5E_t *estack;                      /* Error stack to resume */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack")
+
+    HDassert(estack->paused > 0);
+    estack->paused--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_resume_stack() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5E_clear_stack
  *
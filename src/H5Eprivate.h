@@ -182,6 +182,8 @@ H5_DLL herr_t H5E_init(void);
 H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func,
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *fmt, ...)H5_ATTR_FORMAT(printf, 8, 9);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
+H5_DLL herr_t H5E_pause_stack(void);
+H5_DLL herr_t H5E_resume_stack(void);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
 
 #endif /* _H5Eprivate_H */
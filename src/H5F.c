@@ -27,6 +27,7 @@
 #include "H5CXprivate.h"        /* API Contexts                             */
 #include "H5Dprivate.h"         /* Datasets                                 */
 #include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESprivate.h"        /* Event Sets                               */
 #include "H5Fpkg.h"             /* File access                              */
 #include "H5FDprivate.h"        /* File drivers                             */
 #include "H5FLprivate.h"        /* Free lists                               */
@@ -63,6 +64,13 @@ typedef struct {
     size_t obj_count;           /* Number of objects counted so far */
 } H5F_trav_obj_ids_t;
 
+/* A flush inserted into an event set */
+typedef struct H5F_async_flush_t {
+    hid_t obj_id;               /* Object to flush (an internal reference) */
+    H5I_type_t obj_type;        /* Type of the object */
+    H5F_scope_t scope;          /* Scope of the flush */
+} H5F_async_flush_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -81,6 +89,10 @@ static int H5F__get_all_count_cb(void H5_ATTR_UNUSED *obj_ptr, hid_t H5_ATTR_UNU
 /* Callback for getting IDs for open objects in a file */
 static int H5F__get_all_ids_cb(void H5_ATTR_UNUSED *obj_ptr, hid_t obj_id, void *key);
 
+/* Callbacks for flushes inserted into event sets */
+static herr_t H5F__async_flush_op(void *_flush, void **req);
+static herr_t H5F__async_flush_free(void *_flush);
+
 
 /*********************/
 /* Package Variables */
@@ -105,6 +117,9 @@ H5FL_EXTERN(H5VL_t);
 /* Declare a free list to manage the H5VL_object_t struct */
 H5FL_EXTERN(H5VL_object_t);
 
+/* Declare a free list to manage the H5F_async_flush_t struct */
+H5FL_DEFINE_STATIC(H5F_async_flush_t);
+
 /* File ID class */
 static const H5I_class_t H5I_FILE_CLS[1] = {{
     H5I_FILE,                   /* ID class value */
@@ -852,6 +867,124 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Fflush() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__async_flush_op
+ *
+ * Purpose:     Performs a flush inserted into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__async_flush_op(void *_flush, void **req)
+{
+    H5F_async_flush_t  *flush = (H5F_async_flush_t *)_flush;
+    H5VL_object_t   *vol_obj;                       /* Object info      */
+    herr_t          ret_value = SUCCEED;            /* Return value     */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(flush);
+
+    if(NULL == (vol_obj = H5VL_vol_object(flush->obj_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid object identifier")
+
+    if(H5VL_file_specific(vol_obj, H5VL_FILE_FLUSH, H5P_DATASET_XFER_DEFAULT, req, (int)flush->obj_type, (int)flush->scope) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__async_flush_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__async_flush_free
+ *
+ * Purpose:     Releases a flush inserted into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__async_flush_free(void *_flush)
+{
+    H5F_async_flush_t  *flush = (H5F_async_flush_t *)_flush;
+    herr_t          ret_value = SUCCEED;            /* Return value     */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(flush);
+
+    if(H5I_INVALID_HID != flush->obj_id && H5I_dec_ref(flush->obj_id) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTDEC, FAIL, "can't release object")
+
+    flush = H5FL_FREE(H5F_async_flush_t, flush);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__async_flush_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fflush_async
+ *
+ * Purpose:     Asynchronous version of H5Fflush: the flush is inserted
+ *              into the event set ES_ID and this call returns without
+ *              waiting for it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id)
+{
+    H5F_async_flush_t  *flush = NULL;               /* Flush to insert  */
+    H5VL_object_t   *vol_obj = NULL;                /* Object info      */
+    H5I_type_t      obj_type;                       /* Type of object   */
+    herr_t          ret_value = SUCCEED;            /* Return value     */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iFsi", object_id, scope, es_id);
+
+    /* Get the type of object we're flushing + sanity check */
+    obj_type = H5I_get_type(object_id);
+    if(H5I_FILE != obj_type && H5I_GROUP != obj_type && H5I_DATATYPE != obj_type &&
+            H5I_DATASET != obj_type && H5I_ATTR != obj_type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* get the file object */
+    if(NULL == (vol_obj = H5VL_vol_object(object_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid object identifier")
+
+    /* Set up the flush, holding on to the object until it's done */
+    if(NULL == (flush = H5FL_MALLOC(H5F_async_flush_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate flush info")
+    flush->obj_id = H5I_INVALID_HID;
+    flush->obj_type = obj_type;
+    flush->scope = scope;
+    if(H5I_inc_ref(object_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINC, FAIL, "can't increment object ID ref count")
+    flush->obj_id = object_id;
+
+    /* Insert the flush, which hands it to the event set */
+    if(H5ES_insert(es_id, vol_obj->connector, H5F__async_flush_op, H5F__async_flush_free, flush) < 0) {
+        flush = NULL;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINSERT, FAIL, "can't insert flush into event set")
+    } /* end if */
+    flush = NULL;
+
+done:
+    if(flush && H5F__async_flush_free(flush) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't release flush info")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fflush_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fclose
@@ -1224,13 +1357,15 @@ herr_t
 H5Fget_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr)
 {
     H5VL_object_t *vol_obj = NULL;
+    H5AC_cache_config_t config;         /* Current version of the configuration */
     herr_t     ret_value = SUCCEED;     /* Return value */
 
     FUNC_ENTER_API(FAIL)
     H5TRACE2("e", "i*x", file_id, config_ptr);
 
     /* Check args */
-    if((NULL == config_ptr) || (config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION))
+    if((NULL == config_ptr) || ((config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION) &&
+            (config_ptr->version != H5AC__CACHE_CONFIG_VERSION_1)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Bad config_ptr")
 
     /* Get the file object */
@@ -1238,9 +1373,14 @@ H5Fget_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
 
     /* Get the metadata cache configuration */
-    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_MDC_CONF, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, config_ptr) < 0)
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_MDC_CONF, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, &config) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get metadata cache configuration")
 
+    /* Translate to the version of the structure supplied */
+    if(H5AC_downgrade_config(&config, config_ptr) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to translate metadata cache configuration")
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_config() */
@@ -1261,6 +1401,7 @@ herr_t
 H5Fset_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr)
 {
     H5VL_object_t *vol_obj = NULL;
+    H5AC_cache_config_t config;         /* Current version of the configuration */
     herr_t     ret_value = SUCCEED;     /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -1270,8 +1411,12 @@ H5Fset_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr)
     if(NULL == (vol_obj = (H5VL_object_t *)H5I_object(file_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
 
+    /* Translate older versions of the structure to the current one */
+    if(H5AC_upgrade_config(config_ptr, &config) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Bad config_ptr")
+
     /* Set the metadata cache configuration  */
-    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_SET_MDC_CONFIG, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, config_ptr) < 0)
+    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_SET_MDC_CONFIG, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, &config) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set metadata cache configuration")
 
 done:
@@ -1314,6 +1459,47 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mdc_hit_rate_by_type
+ *
+ * Purpose:     Retrieves the hit rate, the number of hits, and the
+ *              number of misses of the metadata cache for entries of
+ *              the given type of file memory.  Like the overall hit
+ *              rate, these are counted since the last time the hit
+ *              rate statistics were reset either manually or
+ *              automatically, so the counts for all types sum to the
+ *              totals behind H5Fget_mdc_hit_rate.  Any of the pointer
+ *              parameters may be NULL.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_mdc_hit_rate_by_type(hid_t file_id, H5F_mem_t type, double *hit_rate_ptr,
+    hsize_t *hits_ptr, hsize_t *misses_ptr)
+{
+    H5VL_object_t       *vol_obj;
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iFm*d*h*h", file_id, type, hit_rate_ptr, hits_ptr, misses_ptr);
+
+    /* Check args */
+    if(type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file memory type")
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the hit rate for the type */
+    if(H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_MDC_HR_BY_TYPE, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, type, hit_rate_ptr, hits_ptr, misses_ptr) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get MDC hit rate")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_mdc_hit_rate_by_type() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_size
@@ -1476,6 +1476,140 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDread_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Extent I begins at address ADDRS[I], is
+ *              SIZES[I] bytes long and is read into the buffer BUFS[I].
+ *              Drivers which do not provide a vector read callback have
+ *              the extents read one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    haddr_t        *rel_addrs = NULL;       /* Addresses relative to base address */
+    size_t          u;                      /* Local index variable     */
+    herr_t          ret_value = SUCCEED;    /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xMtiz*a*z**x", file, type, dxpl_id, count, addrs, sizes,
+             bufs);
+
+    /* Check arguments */
+    if(!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if(!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if(count > 0 && (!addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "address, size and buffer arrays can't be NULL")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+        addrs = rel_addrs;
+    } /* end if */
+
+    /* Call private function */
+    if(H5FD_read_vector(file, type, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDwrite_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  Extent I begins at address ADDRS[I], is
+ *              SIZES[I] bytes long and comes from the buffer BUFS[I].
+ *              Drivers which do not provide a vector write callback have
+ *              the extents written one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+    const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    haddr_t        *rel_addrs = NULL;       /* Addresses relative to base address */
+    size_t          u;                      /* Local index variable     */
+    herr_t          ret_value = SUCCEED;    /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xMtiz*a*z**x", file, type, dxpl_id, count, addrs, sizes,
+             bufs);
+
+    /* Check arguments */
+    if(!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if(!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if(count > 0 && (!addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "address, size and buffer arrays can't be NULL")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write buffer can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if(file->base_addr > 0 && count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+        addrs = rel_addrs;
+    } /* end if */
+
+    /* Call private function */
+    if(H5FD_write_vector(file, type, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FDflush
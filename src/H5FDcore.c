@@ -142,6 +142,10 @@ static herr_t H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, had
             size_t size, void *buf);
 static herr_t H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
 static herr_t H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_core_lock(H5FD_t *_file, hbool_t rw);
@@ -175,6 +179,8 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD__core_get_handle,      /* get_handle           */
     H5FD__core_read,            /* read                 */
     H5FD__core_write,           /* write                */
+    H5FD__core_read_vector,     /* read_vector          */
+    H5FD__core_write_vector,    /* write_vector         */
     H5FD__core_flush,           /* flush                */
     H5FD__core_truncate,        /* truncate             */
     H5FD_core_lock,             /* lock                 */
@@ -1397,6 +1403,70 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads COUNT extents from the memory buffer of FILE.
+ *              Extent I is SIZES[I] bytes long, begins at address ADDRS[I]
+ *              and is copied into BUFS[I].
+ *
+ * Return:      Success:    SUCCEED. Results are stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/)
+{
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && H5FD__core_read(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read extent")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes COUNT extents to the memory buffer of FILE.
+ *              Extent I is SIZES[I] bytes long, begins at address ADDRS[I]
+ *              and is copied from BUFS[I].
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && H5FD__core_write(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write extent")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
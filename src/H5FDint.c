@@ -36,6 +36,7 @@
 #include "H5Fprivate.h"         /* File access                              */
 #include "H5FDpkg.h"            /* File Drivers                             */
 #include "H5Iprivate.h"         /* IDs                                      */
+#include "H5MMprivate.h"        /* Memory management                        */
 
 
 /****************/
@@ -252,6 +253,178 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector()
+ *
+ *              Addresses are relative to the base address, as for
+ *              H5FD_read().  If the driver has no vector read callback,
+ *              the extents are passed to its read callback one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, H5FD_mem_t type, size_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    hid_t           dxpl_id = H5I_INVALID_HID;  /* DXPL for operation */
+    haddr_t        *abs_addrs = NULL;           /* Absolute addresses */
+    const haddr_t  *drv_addrs = addrs;          /* Addresses passed to driver */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check the extents against the EOA (see H5FD_read() for the SWMR
+     * read exception).
+     */
+    if(!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t     eoa;
+
+        if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        for(u = 0; u < count; u++)
+            if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+    } /* end if */
+
+    /* Convert to absolute addresses */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for(u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+        drv_addrs = abs_addrs;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if(file->cls->read_vector) {
+        if((file->cls->read_vector)(file, type, dxpl_id, count, drv_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver vector read request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0 && (file->cls->read)(file, type, dxpl_id, drv_addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector()
+ *
+ *              Addresses are relative to the base address, as for
+ *              H5FD_write().  If the driver has no vector write callback,
+ *              the extents are passed to its write callback one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, H5FD_mem_t type, size_t count,
+    const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    hid_t           dxpl_id;                    /* DXPL for operation */
+    haddr_t         eoa = HADDR_UNDEF;          /* EOA for file */
+    haddr_t        *abs_addrs = NULL;           /* Absolute addresses */
+    const haddr_t  *drv_addrs = addrs;          /* Addresses passed to driver */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check the extents against the EOA */
+    if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+    for(u = 0; u < count; u++)
+        if((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+
+    /* Convert to absolute addresses */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for(u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+        drv_addrs = abs_addrs;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if(file->cls->write_vector) {
+        if((file->cls->write_vector)(file, type, dxpl_id, count, drv_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0 && (file->cls->write)(file, type, dxpl_id, drv_addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_has_vector_io
+ *
+ * Purpose:     Check whether the file's driver provides both vector I/O
+ *              callbacks, i.e. whether handing it a list of extents is
+ *              cheaper than issuing them one at a time.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5FD_has_vector_io(const H5FD_t *file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+    HDassert(file->cls);
+
+    FUNC_LEAVE_NOAPI(file->cls->read_vector != NULL && file->cls->write_vector != NULL)
+} /* end H5FD_has_vector_io() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
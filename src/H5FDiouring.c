@@ -0,0 +1,1500 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A Linux file driver which performs its I/O through an io_uring
+ *          submission/completion queue pair instead of one synchronous
+ *          system call per request.
+ *
+ *          Vector requests (see H5FDread_vector) are kept in flight up to
+ *          the configured queue depth, so a device which can service many
+ *          requests in parallel (e.g. NVMe storage) sees them all at once.
+ *          Single requests are submitted and waited for individually.
+ *
+ *          When a non-zero alignment is set in the file access property
+ *          list, the file is opened with O_DIRECT.  Requests whose address,
+ *          size and buffer are all multiples of the alignment go straight
+ *          to the device; others are staged through aligned bounce buffers,
+ *          with unaligned writes performed as read-modify-write of the
+ *          covering blocks.
+ *
+ *          The ring is driven with the raw io_uring_setup(2) and
+ *          io_uring_enter(2) system calls, so no support library is
+ *          required.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDiouring.h"    /* io_uring file driver     */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Largest queue depth accepted by H5Pset_fapl_iouring */
+#define H5FD_IOURING_MAX_QUEUE_DEPTH    4096
+
+/* Largest number of bytes passed to the kernel in one submission.  Larger
+ * requests are split, like short transfers, into several submissions.
+ */
+#define H5FD_IOURING_MAX_IO_BYTES       ((size_t)1 << 30)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned    queue_depth;    /* Max. # of requests kept in flight        */
+    size_t      alignment;      /* O_DIRECT block size, or 0 for buffered   */
+} H5FD_iouring_fapl_t;
+
+/* The kernel's submission and completion queues, mapped into our address
+ * space.  The head/tail indices are shared with the kernel and must be
+ * accessed with acquire/release semantics.
+ */
+typedef struct H5FD_iouring_ring_t {
+    int                 fd;             /* io_uring file descriptor         */
+    unsigned            to_submit;      /* # of SQEs queued, not yet entered */
+
+    /* Submission queue */
+    unsigned            *sq_tail;       /* Tail index (we produce)          */
+    unsigned            *sq_mask;       /* Index mask                       */
+    unsigned            *sq_array;      /* Indirection array into 'sqes'    */
+    struct io_uring_sqe *sqes;          /* Submission queue entries         */
+
+    /* Completion queue */
+    unsigned            *cq_head;       /* Head index (we consume)          */
+    unsigned            *cq_tail;       /* Tail index (kernel produces)     */
+    unsigned            *cq_mask;       /* Index mask                       */
+    struct io_uring_cqe *cqes;          /* Completion queue entries         */
+
+    /* Mappings, for teardown */
+    void                *sq_ring;       /* Submission queue ring            */
+    size_t              sq_ring_size;
+    void                *cq_ring;       /* Completion queue ring (may be the same as 'sq_ring') */
+    size_t              cq_ring_size;
+    size_t              sqes_size;
+} H5FD_iouring_ring_t;
+
+/* State of one request kept in flight.  A request which isn't finished by
+ * its first submission (a short transfer, or one larger than
+ * H5FD_IOURING_MAX_IO_BYTES) is resubmitted for the remaining bytes.
+ */
+typedef struct H5FD_iouring_req_t {
+    struct iovec    iov;            /* Buffer for the current submission    */
+    unsigned char   *buf;           /* Next byte to transfer                */
+    haddr_t         addr;           /* File address of the next byte        */
+    size_t          left;           /* # of bytes still to transfer         */
+    unsigned char   *bounce;        /* Aligned bounce buffer, or NULL       */
+    unsigned char   *user_buf;      /* Caller's buffer, when bouncing       */
+    size_t          user_off;       /* Offset of caller's bytes in 'bounce' */
+    size_t          user_size;      /* # of caller's bytes                  */
+} H5FD_iouring_req_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;        /* public stuff, must be first          */
+    int                 fd;         /* the filesystem file descriptor       */
+    haddr_t             eoa;        /* end of allocated region              */
+    haddr_t             eof;        /* end of file; current file size       */
+    H5FD_iouring_fapl_t fa;         /* file access properties               */
+    H5FD_iouring_ring_t ring;       /* submission/completion queues         */
+    H5FD_iouring_req_t  *reqs;      /* 'fa.queue_depth' request slots       */
+    unsigned            *free_reqs; /* Stack of unused request slots        */
+    unsigned            nfree;      /* # of entries in 'free_reqs'          */
+    char                filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t               device;     /* file device number                   */
+    ino_t               inode;      /* file i-node number                   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t             fam_to_single;
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Whether a request can be passed to the kernel without a bounce buffer */
+#define H5FD_IOURING_IS_ALIGNED(F, A, Z, B)                                 \
+    (0 == (F)->fa.alignment ||                                              \
+        (0 == ((A) % (F)->fa.alignment) && 0 == ((Z) % (F)->fa.alignment) && \
+         0 == ((uintptr_t)(B) % (F)->fa.alignment)))
+
+/* Prototypes */
+static herr_t H5FD_iouring_term(void);
+static void *H5FD_iouring_fapl_get(H5FD_t *file);
+static void *H5FD_iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_iouring_close(H5FD_t *_file);
+static int H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_iouring_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_iouring_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD_iouring_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+static herr_t H5FD_iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries);
+static void H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring);
+static herr_t H5FD__iouring_transfer(H5FD_iouring_t *file, hbool_t writing,
+            size_t count, const haddr_t addrs[], const size_t sizes[],
+            void *const bufs[]);
+static herr_t H5FD__iouring_rmw_write(H5FD_iouring_t *file, haddr_t addr,
+            size_t size, const void *buf);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                  /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_iouring_term,          /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size           */
+    H5FD_iouring_fapl_get,      /* fapl_get             */
+    H5FD_iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_iouring_open,          /* open                 */
+    H5FD_iouring_close,         /* close                */
+    H5FD_iouring_cmp,           /* cmp                  */
+    H5FD_iouring_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_iouring_get_eoa,       /* get_eoa              */
+    H5FD_iouring_set_eoa,       /* set_eoa              */
+    H5FD_iouring_get_eof,       /* get_eof              */
+    H5FD_iouring_get_handle,    /* get_handle           */
+    H5FD_iouring_read,          /* read                 */
+    H5FD_iouring_write,         /* write                */
+    H5FD_iouring_read_vector,   /* read_vector          */
+    H5FD_iouring_write_vector,  /* write_vector         */
+    NULL,                       /* flush                */
+    H5FD_iouring_truncate,      /* truncate             */
+    H5FD_iouring_lock,          /* lock                 */
+    H5FD_iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ *              QUEUE_DEPTH is the largest number of requests the driver
+ *              keeps in flight (0 selects H5FD_IOURING_QUEUE_DEPTH_DEF).
+ *              If ALIGNMENT is non-zero the file is opened with O_DIRECT
+ *              and ALIGNMENT, which must be a power of two, is used as
+ *              both the file block size and the memory boundary for
+ *              transfers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t alignment)
+{
+    H5P_genplist_t      *plist;      /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuz", fapl_id, queue_depth, alignment);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(queue_depth > H5FD_IOURING_MAX_QUEUE_DEPTH)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+    if(alignment & (alignment - 1))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "alignment must be a power of two")
+
+    HDmemset(&fa, 0, sizeof(H5FD_iouring_fapl_t));
+    fa.queue_depth = (queue_depth > 0) ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.alignment = alignment;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/, size_t *alignment/*out*/)
+{
+    H5P_genplist_t              *plist;     /* Property list pointer */
+    const H5FD_iouring_fapl_t   *fa;
+    herr_t                      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, queue_depth, alignment);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+    if(alignment)
+        *alignment = fa->alignment;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5FD_iouring_fapl_copy(&(file->fa)))
+} /* end H5FD_iouring_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t   *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t         *new_fa = NULL;
+    void                        *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(old_fa);
+
+    if(NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Creates an io_uring instance with room for ENTRIES
+ *              submissions and maps its queues into memory.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params  params;             /* Ring parameters from the kernel */
+    unsigned char           *sq_ring;           /* Submission queue ring    */
+    unsigned char           *cq_ring;           /* Completion queue ring    */
+    herr_t                  ret_value = SUCCEED;    /* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+    HDassert(entries > 0);
+
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->sq_ring = MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sqes = (struct io_uring_sqe *)MAP_FAILED;
+
+    HDmemset(&params, 0, sizeof(params));
+    if((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring")
+
+    /* Map the queues */
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->sq_ring_size = MAX(ring->sq_ring_size, ring->cq_ring_size);
+        ring->cq_ring_size = ring->sq_ring_size;
+    } /* end if */
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    if(MAP_FAILED == (ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue")
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else
+#endif /* IORING_FEAT_SINGLE_MMAP */
+    if(MAP_FAILED == (ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_CQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion queue")
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (void *)(ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqes_size,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, (off_t)IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue entries")
+
+    /* Locate the queue indices and arrays within the mappings */
+    sq_ring = (unsigned char *)ring->sq_ring;
+    cq_ring = (unsigned char *)ring->cq_ring;
+    ring->sq_tail = (unsigned *)(void *)(sq_ring + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)(void *)(sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(void *)(sq_ring + params.sq_off.array);
+    ring->cq_head = (unsigned *)(void *)(cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(void *)(cq_ring + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)(void *)(cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(void *)(cq_ring + params.cq_off.cqes);
+
+done:
+    if(ret_value < 0)
+        H5FD__iouring_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the queues of an io_uring instance and closes it.
+ *              Handles partially initialized rings.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ring);
+
+    if(MAP_FAILED != (void *)ring->sqes)
+        munmap(ring->sqes, ring->sqes_size);
+    if(MAP_FAILED != ring->cq_ring && ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    if(MAP_FAILED != ring->sq_ring)
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    if(ring->fd >= 0)
+        HDclose(ring->fd);
+
+    ring->sqes = (struct io_uring_sqe *)MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sq_ring = MAP_FAILED;
+    ring->fd = -1;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t              *file       = NULL;     /* io_uring VFD info    */
+    int                         fd          = -1;       /* File descriptor      */
+    int                         o_flags;                /* Flags for open() call */
+    H5P_genplist_t              *plist;                 /* Property list pointer */
+    const H5FD_iouring_fapl_t   *fa;                    /* Driver properties    */
+    hbool_t                     ring_init   = FALSE;    /* Whether the ring was set up */
+    h5_stat_t                   sb;
+    unsigned                    u;                      /* Local index variable */
+    H5FD_t                      *ret_value  = NULL;     /* Return value         */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = (H5P_genplist_t *)H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+    if(fa->alignment > 0)
+        o_flags |= O_DIRECT;
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->fa = *fa;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+
+    /* Set up the ring and the request slots */
+    if(H5FD__iouring_ring_init(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to initialize io_uring")
+    ring_init = TRUE;
+    if(NULL == (file->reqs = (H5FD_iouring_req_t *)H5MM_calloc(file->fa.queue_depth * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate request slots")
+    if(NULL == (file->free_reqs = (unsigned *)H5MM_malloc(file->fa.queue_depth * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate request slots")
+    for(u = 0; u < file->fa.queue_depth; u++)
+        file->free_reqs[u] = u;
+    file->nfree = file->fa.queue_depth;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* This step is for h5repart tool only. If user wants to change file driver from
+     * family to one that uses single files (sec2, etc.) while using h5repart, this
+     * private property should be set so that in the later step, the library can ignore
+     * the family driver information saved in the superblock.
+     */
+    if(H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+        if(H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file) {
+            if(ring_init)
+                H5FD__iouring_ring_term(&file->ring);
+            H5MM_xfree(file->reqs);
+            H5MM_xfree(file->free_reqs);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+    HDassert(file->nfree == file->fa.queue_depth);
+
+    /* Tear down the ring */
+    H5FD__iouring_ring_term(&file->ring);
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file->reqs = (H5FD_iouring_req_t *)H5MM_xfree(file->reqs);
+    file->free_reqs = (unsigned *)H5MM_xfree(file->free_reqs);
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t    *f1 = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t    *f2 = (const H5FD_iouring_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;    /* io_uring VFD info */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+
+        /* Check for flags that are set by h5repart */
+        if(file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which eliminates it) */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_iouring_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_iouring_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_iouring_get_handle
+ *
+ * Purpose:        Returns the file handle of io_uring file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_enter
+ *
+ * Purpose:     Passes the queued submissions to the kernel and, if
+ *              WAIT_NR is non-zero, waits until at least that many
+ *              completions are available.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_enter(H5FD_iouring_ring_t *ring, unsigned wait_nr)
+{
+    herr_t  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+
+    do {
+        long ret;       /* # of submissions consumed */
+
+        ret = syscall(__NR_io_uring_enter, ring->fd, ring->to_submit, wait_nr,
+                wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if(ret < 0) {
+            if(EINTR == errno)
+                continue;
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "io_uring_enter failed")
+        } /* end if */
+        if(0 == ret && ring->to_submit > 0)
+            HGOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "io_uring did not accept any submissions")
+
+        HDassert((unsigned long)ret <= ring->to_submit);
+        ring->to_submit -= (unsigned)ret;
+    } while(ring->to_submit > 0);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_enter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Queues a submission for the remaining bytes of request
+ *              slot IDX.  The submission queue always has room, since it
+ *              holds at least as many entries as there are request slots.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_queue(H5FD_iouring_t *file, hbool_t writing, unsigned idx)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;        /* File's ring      */
+    H5FD_iouring_req_t  *req = &file->reqs[idx];    /* Request to queue */
+    struct io_uring_sqe *sqe;                       /* Entry to fill in */
+    unsigned            tail;                       /* Current tail     */
+    unsigned            slot;                       /* Index of 'sqe'   */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(req->left > 0);
+
+    req->iov.iov_base = req->buf;
+    req->iov.iov_len = MIN(req->left, H5FD_IOURING_MAX_IO_BYTES);
+
+    /* Only this process produces submissions, so the tail can be read
+     * without synchronization; the kernel must see the entry before the
+     * tail that publishes it.
+     */
+    tail = *ring->sq_tail;
+    slot = tail & *ring->sq_mask;
+    sqe = &ring->sqes[slot];
+    HDmemset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (uint8_t)(writing ? IORING_OP_WRITEV : IORING_OP_READV);
+    sqe->fd = file->fd;
+    sqe->off = (uint64_t)req->addr;
+    sqe->addr = (uint64_t)(uintptr_t)&req->iov;
+    sqe->len = 1;
+    sqe->user_data = (uint64_t)idx;
+    ring->sq_array[slot] = slot;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->to_submit++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_queue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_transfer
+ *
+ * Purpose:     Reads or writes COUNT extents, keeping up to the queue
+ *              depth of them in flight at once.  Extent I is SIZES[I]
+ *              bytes long, begins at address ADDRS[I] and uses buffer
+ *              BUFS[I].
+ *
+ *              Reads which reach the end of the file are padded with
+ *              zeros.  When the file was opened with O_DIRECT, unaligned
+ *              reads are staged through aligned bounce buffers and
+ *              unaligned writes are deferred until the aligned ones have
+ *              completed and then performed one at a time, so that two
+ *              extents sharing a block never race.
+ *
+ *              All requests which were submitted have completed when this
+ *              routine returns, whether or not it succeeds.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_transfer(H5FD_iouring_t *file, hbool_t writing, size_t count,
+    const haddr_t addrs[], const size_t sizes[], void *const bufs[])
+{
+    H5FD_iouring_ring_t *ring = &file->ring;    /* File's ring                  */
+    size_t      next = 0;                       /* Next extent to start         */
+    unsigned    inflight = 0;                   /* # of requests in flight      */
+    hbool_t     have_deferred = FALSE;          /* Whether writes were deferred */
+    int         err = 0;                        /* errno from the first failure */
+    haddr_t     err_addr = HADDR_UNDEF;         /* Address of the first failure */
+    size_t      u;                              /* Local index variable         */
+    herr_t      ret_value = SUCCEED;            /* Return value                 */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions before anything is in flight */
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+
+    while(next < count || inflight > 0) {
+        unsigned head;          /* Completion queue head */
+        unsigned tail;          /* Completion queue tail */
+
+        /* Start new requests while there are free slots, unless a request
+         * has failed, in which case only the ones in flight are finished
+         */
+        while(0 == err && next < count && file->nfree > 0) {
+            H5FD_iouring_req_t  *req;       /* Request for this extent */
+            unsigned            idx;        /* Request slot */
+
+            if(0 == sizes[next]) {
+                next++;
+                continue;
+            } /* end if */
+            if(!H5FD_IOURING_IS_ALIGNED(file, addrs[next], sizes[next], bufs[next]) && writing) {
+                have_deferred = TRUE;
+                next++;
+                continue;
+            } /* end if */
+
+            idx = file->free_reqs[--file->nfree];
+            req = &file->reqs[idx];
+            req->bounce = NULL;
+            if(H5FD_IOURING_IS_ALIGNED(file, addrs[next], sizes[next], bufs[next])) {
+                req->buf = (unsigned char *)bufs[next];
+                req->addr = addrs[next];
+                req->left = sizes[next];
+            } /* end if */
+            else {
+                haddr_t start = addrs[next] & ~((haddr_t)file->fa.alignment - 1);
+                haddr_t end = (addrs[next] + sizes[next] + file->fa.alignment - 1) & ~((haddr_t)file->fa.alignment - 1);
+                void    *bounce;
+
+                /* Stop starting requests if a bounce buffer can't be had,
+                 * but let the ones in flight finish
+                 */
+                if(HDposix_memalign(&bounce, file->fa.alignment, (size_t)(end - start)) != 0) {
+                    file->free_reqs[file->nfree++] = idx;
+                    err = ENOMEM;
+                    err_addr = addrs[next];
+                    break;
+                } /* end if */
+                req->bounce = (unsigned char *)bounce;
+                req->user_buf = (unsigned char *)bufs[next];
+                req->user_off = (size_t)(addrs[next] - start);
+                req->user_size = sizes[next];
+                req->buf = req->bounce;
+                req->addr = start;
+                req->left = (size_t)(end - start);
+            } /* end else */
+
+            H5FD__iouring_queue(file, writing, idx);
+            inflight++;
+            next++;
+        } /* end while */
+
+        if(0 == inflight)
+            break;
+
+        /* Submit and wait for at least one completion */
+        if(H5FD__iouring_enter(ring, 1) < 0)
+            HGOTO_ERROR(H5E_IO, writing ? H5E_WRITEERROR : H5E_READERROR, FAIL, "unable to submit I/O requests")
+
+        /* Reap the completions */
+        head = *ring->cq_head;
+        tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while(head != tail) {
+            const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            unsigned            idx = (unsigned)cqe->user_data;
+            int                 res = cqe->res;
+            H5FD_iouring_req_t  *req = &file->reqs[idx];
+
+            head++;
+
+            if(res < 0) {
+                if(-EINTR == res || -EAGAIN == res) {
+                    if(0 == err) {
+                        H5FD__iouring_queue(file, writing, idx);
+                        continue;
+                    } /* end if */
+                } /* end if */
+                else if(0 == err) {
+                    err = -res;
+                    err_addr = req->addr;
+                } /* end if */
+            } /* end if */
+            else if(!writing && (0 == res || req->addr + (haddr_t)res >= file->eof)) {
+                /* End of file: the remainder reads as zeros */
+                HDmemset(req->buf + res, 0, req->left - (size_t)res);
+                req->addr += req->left;
+                req->left = 0;
+            } /* end if */
+            else if(0 == res) {
+                if(0 == err) {
+                    err = EIO;
+                    err_addr = req->addr;
+                } /* end if */
+            } /* end if */
+            else {
+                req->buf += res;
+                req->addr += (haddr_t)res;
+                req->left -= (size_t)res;
+                if(req->left > 0 && 0 == err) {
+                    H5FD__iouring_queue(file, writing, idx);
+                    continue;
+                } /* end if */
+            } /* end else */
+
+            /* The request is finished */
+            if(0 == err && 0 == req->left) {
+                if(writing) {
+                    if(req->addr > file->eof)
+                        file->eof = req->addr;
+                } /* end if */
+                else if(req->bounce)
+                    H5MM_memcpy(req->user_buf, req->bounce + req->user_off, req->user_size);
+            } /* end if */
+            if(req->bounce) {
+                HDfree(req->bounce);
+                req->bounce = NULL;
+            } /* end if */
+            file->free_reqs[file->nfree++] = idx;
+            inflight--;
+        } /* end while */
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    } /* end while */
+
+    if(err != 0) {
+        time_t mytime = HDtime(NULL);
+
+        HGOTO_ERROR(H5E_IO, writing ? H5E_WRITEERROR : H5E_READERROR, FAIL, "io_uring %s failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', offset = %llu", writing ? "write" : "read", HDctime(&mytime), file->filename, file->fd, err, HDstrerror(err), (unsigned long long)err_addr);
+    } /* end if */
+
+    /* Perform the unaligned writes, now that the others are done */
+    if(have_deferred)
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0 && !H5FD_IOURING_IS_ALIGNED(file, addrs[u], sizes[u], bufs[u]))
+                if(H5FD__iouring_rmw_write(file, addrs[u], sizes[u], bufs[u]) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write unaligned extent")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_transfer() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_rmw_write
+ *
+ * Purpose:     Writes an extent which isn't aligned for O_DIRECT I/O by
+ *              reading the partially covered blocks at either end into an
+ *              aligned buffer, copying the caller's bytes over them and
+ *              writing all the covering blocks back.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_rmw_write(H5FD_iouring_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    size_t      align = file->fa.alignment;     /* Block size               */
+    haddr_t     start;                          /* First covering block     */
+    haddr_t     end;                            /* End of covering blocks   */
+    size_t      len;                            /* Size of covering blocks  */
+    void        *bounce = NULL;                 /* Aligned buffer           */
+    haddr_t     raddrs[2];                      /* Blocks to read           */
+    size_t      rsizes[2];
+    void        *rbufs[2];
+    size_t      nread = 0;                      /* # of blocks to read      */
+    herr_t      ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(align > 0);
+    HDassert(size > 0);
+
+    start = addr & ~((haddr_t)align - 1);
+    end = (addr + size + align - 1) & ~((haddr_t)align - 1);
+    len = (size_t)(end - start);
+    if(HDposix_memalign(&bounce, align, len) != 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate aligned bounce buffer")
+
+    /* Fetch the blocks the extent only partly covers */
+    if(addr != start) {
+        raddrs[nread] = start;
+        rsizes[nread] = align;
+        rbufs[nread] = bounce;
+        nread++;
+    } /* end if */
+    if(addr + size != end && (0 == nread || end - align != start)) {
+        raddrs[nread] = end - align;
+        rsizes[nread] = align;
+        rbufs[nread] = (unsigned char *)bounce + len - align;
+        nread++;
+    } /* end if */
+    if(nread > 0 && H5FD__iouring_transfer(file, FALSE, nread, raddrs, rsizes, rbufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read partial blocks")
+
+    /* Merge in the caller's bytes and write the blocks back */
+    H5MM_memcpy((unsigned char *)bounce + (addr - start), buf, size);
+    if(H5FD__iouring_transfer(file, TRUE, 1, &start, &len, &bounce) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write blocks")
+
+done:
+    if(bounce)
+        HDfree(bounce);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_rmw_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if(H5FD__iouring_transfer(file, FALSE, 1, &addr, &size, &buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    void            *wbuf = (void *)(uintptr_t)buf;     /* Only read from */
+    herr_t          ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
+
+    if(H5FD__iouring_transfer(file, TRUE, 1, &addr, &size, &wbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE.  Extent I is SIZES[I] bytes
+ *              long, begins at address ADDRS[I] and is stored in BUFS[I].
+ *              Up to the queue depth of extents are in flight at once.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[])
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && !H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+
+    if(H5FD__iouring_transfer(file, FALSE, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE.  Extent I is SIZES[I] bytes
+ *              long, begins at address ADDRS[I] and comes from BUFS[I].
+ *              Up to the queue depth of extents are in flight at once.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && !H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+
+    /* The buffers are only read from */
+    if(H5FD__iouring_transfer(file, TRUE, count, addrs, sizes, (void *const *)(uintptr_t)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Extend (or, after O_DIRECT writes of whole blocks, shrink) the file
+     * to match the end of the allocated region
+     */
+    if(!H5F_addr_eq(file->eoa, file->eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    int             lock_flags;                         /* file locking flags */
+    herr_t          ret_value = SUCCEED;                /* Return value     */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;    /* VFD file struct  */
+    herr_t          ret_value = SUCCEED;                /* Return value     */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
@@ -193,6 +193,8 @@ static const H5FD_class_t H5FD_mirror_g = {
     NULL,                       /* get_handle           */
     H5FD_mirror_read,           /* read                 */
     H5FD_mirror_write,          /* write                */
+    NULL,                       /* read_vector          */
+    NULL,                       /* write_vector         */
     NULL,                       /* flush                */
     H5FD_mirror_truncate,       /* truncate             */
     H5FD_mirror_lock,           /* lock                 */
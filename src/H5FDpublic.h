@@ -259,6 +259,23 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * enabled may be used as the Write-Only (W/O) channel driver.
      */
 #define H5FD_FEAT_DEFAULT_VFD_COMPATIBLE        0x00008000
+    /*
+     * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that the
+     * driver's read callbacks don't change the state of the file struct,
+     * so several threads may read from a file opened read-only at once.
+     * The library then reads the raw data of such files without holding
+     * its API lock, in thread-safe builds.
+     */
+#define H5FD_FEAT_CONCURRENT_READ       0x00010000
+    /*
+     * Defining H5FD_FEAT_MEMORY_MAPPED for a VFL driver means that the
+     * whole file is in a read-only memory map for as long as it is open.
+     * The driver's get_handle callback returns a pointer to the pointer to
+     * the start of the map, which is get_eof bytes long.  The library then
+     * copies raw data straight from the map instead of calling the read
+     * callbacks.
+     */
+#define H5FD_FEAT_MEMORY_MAPPED         0x00020000
 
 
 /* Forward declaration */
@@ -298,6 +315,12 @@ typedef struct H5FD_class_t {
                     haddr_t addr, size_t size, void *buffer);
     herr_t  (*write)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
                      haddr_t addr, size_t size, const void *buffer);
+    herr_t  (*read_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
+                    size_t count, const haddr_t addrs[], const size_t sizes[],
+                    void *bufs[]);
+    herr_t  (*write_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl,
+                    size_t count, const haddr_t addrs[], const size_t sizes[],
+                    const void *bufs[]);
     herr_t  (*flush)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
     herr_t  (*truncate)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
     herr_t  (*lock)(H5FD_t *file, hbool_t rw);
@@ -381,6 +404,12 @@ H5_DLL herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                        haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                         haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FDread_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
+                       size_t count, const haddr_t addrs[], const size_t sizes[],
+                       void *bufs[]/*out*/);
+H5_DLL herr_t H5FDwrite_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
+                        size_t count, const haddr_t addrs[], const size_t sizes[],
+                        const void *bufs[]);
 H5_DLL herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDlock(H5FD_t *file, hbool_t rw);
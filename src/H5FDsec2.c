@@ -36,6 +36,10 @@
 #include "H5MMprivate.h"    /* Memory management        */
 #include "H5Pprivate.h"     /* Property lists           */
 
+#ifdef H5_HAVE_PREADWRITEV
+#include <sys/uio.h>
+#endif /* H5_HAVE_PREADWRITEV */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SEC2_g = 0;
 
@@ -120,6 +124,15 @@ typedef struct H5FD_sec2_t {
                                  HADDR_UNDEF==(A)+(Z) ||                    \
                                 (HDoff_t)((A)+(Z))<(HDoff_t)(A))
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Maximum number of buffers passed to a single preadv/pwritev call */
+#if defined(IOV_MAX) && IOV_MAX < 1024
+#define H5FD_SEC2_MAX_IOV   IOV_MAX
+#else
+#define H5FD_SEC2_MAX_IOV   1024
+#endif
+#endif /* H5_HAVE_PREADWRITEV */
+
 /* Prototypes */
 static herr_t H5FD_sec2_term(void);
 static H5FD_t *H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -135,6 +148,10 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_sec2_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD_sec2_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_sec2_unlock(H5FD_t *_file);
@@ -167,6 +184,8 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_get_handle,       /* get_handle           */
     H5FD_sec2_read,             /* read                 */
     H5FD_sec2_write,            /* write                */
+    H5FD_sec2_read_vector,      /* read_vector          */
+    H5FD_sec2_write_vector,     /* write_vector         */
     NULL,                       /* flush                */
     H5FD_sec2_truncate,         /* truncate             */
     H5FD_sec2_lock,             /* lock                 */
@@ -536,6 +555,9 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
         *flags |= H5FD_FEAT_SUPPORTS_SWMR_IO;       /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+#ifdef H5_HAVE_PREADWRITE
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* Reads with pread() don't use the file position                   */
+#endif /* H5_HAVE_PREADWRITE */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_single)
@@ -746,16 +768,22 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
         buf = (char *)buf + bytes_read;
     } /* end while */
 
-    /* Update current position */
+#ifndef H5_HAVE_PREADWRITE
+    /* Update current position (the position isn't used with pread(), and
+     * isn't updated so that reads don't change the file struct)
+     */
     file->pos = addr;
     file->op = OP_READ;
+#endif /* H5_HAVE_PREADWRITE */
 
 done:
+#ifndef H5_HAVE_PREADWRITE
     if(ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
     } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_read() */
@@ -861,6 +889,278 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_read_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE.  Extent I is SIZES[I] bytes
+ *              long, begins at address ADDRS[I] and is read into BUFS[I].
+ *
+ *              When preadv() is available, runs of extents which are
+ *              adjacent in the file are coalesced into a single system
+ *              call which scatters into the caller's buffers.  Otherwise
+ *              the extents are read one at a time.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_read_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PREADWRITEV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* Buffers for current run  */
+#endif /* H5_HAVE_PREADWRITEV */
+    size_t          u;                          /* Local index variable     */
+    herr_t          ret_value   = SUCCEED;      /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+#ifdef H5_HAVE_PREADWRITEV
+    u = 0;
+    while(u < count) {
+        struct iovec    *curr_iov = iov;        /* First unfinished buffer  */
+        haddr_t         addr;                   /* Start of current run     */
+        size_t          size;                   /* Bytes left in current run */
+        int             niov;                   /* # of buffers left in run */
+
+        /* Skip empty extents */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Check for overflow conditions */
+        addr = addrs[u];
+        if(!H5F_addr_defined(addr))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+
+        /* Gather the run of extents which follow on from this one */
+        size = 0;
+        niov = 0;
+        do {
+            if(sizes[u] > 0) {
+                iov[niov].iov_base = bufs[u];
+                iov[niov].iov_len = sizes[u];
+                size += sizes[u];
+                niov++;
+            } /* end if */
+            u++;
+        } while(u < count && niov < H5FD_SEC2_MAX_IOV && addrs[u] == addr + size
+                && sizes[u] <= (H5_POSIX_MAX_IO_BYTES - size));
+
+        if(REGION_OVERFLOW(addr, size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+        /* Read the run, being careful of interrupted system calls, partial
+         * results, and the end of the file.
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */
+
+            do {
+                bytes_read = HDpreadv(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', total read size = %llu, buffers this sub-read = %d, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)size, niov, (unsigned long long)addr);
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                while(niov > 0) {
+                    HDmemset(curr_iov->iov_base, 0, curr_iov->iov_len);
+                    curr_iov++;
+                    niov--;
+                } /* end while */
+                break;
+            } /* end if */
+
+            HDassert(bytes_read > 0);
+            HDassert((size_t)bytes_read <= size);
+
+            size -= (size_t)bytes_read;
+            addr += (haddr_t)bytes_read;
+
+            /* Advance past the buffers that were filled */
+            while(bytes_read > 0) {
+                if((size_t)bytes_read >= curr_iov->iov_len) {
+                    bytes_read -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                    curr_iov++;
+                    niov--;
+                } /* end if */
+                else {
+                    curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_read;
+                    curr_iov->iov_len -= (size_t)bytes_read;
+                    bytes_read = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+    } /* end while */
+
+#ifndef H5_HAVE_PREADWRITE
+    /* The file position is not tracked across vector I/O */
+    file->pos = HADDR_UNDEF;
+    file->op = OP_UNKNOWN;
+#endif /* H5_HAVE_PREADWRITE */
+#else /* H5_HAVE_PREADWRITEV */
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && H5FD_sec2_read(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+#endif /* H5_HAVE_PREADWRITEV */
+
+done:
+#ifndef H5_HAVE_PREADWRITE
+    if(ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op = OP_UNKNOWN;
+    } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_write_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE.  Extent I is SIZES[I] bytes
+ *              long, begins at address ADDRS[I] and comes from BUFS[I].
+ *
+ *              When pwritev() is available, runs of extents which are
+ *              adjacent in the file are coalesced into a single system
+ *              call which gathers from the caller's buffers.  Otherwise
+ *              the extents are written one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PREADWRITEV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* Buffers for current run  */
+#endif /* H5_HAVE_PREADWRITEV */
+    size_t          u;                          /* Local index variable     */
+    herr_t          ret_value   = SUCCEED;      /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+#ifdef H5_HAVE_PREADWRITEV
+    u = 0;
+    while(u < count) {
+        struct iovec    *curr_iov = iov;        /* First unfinished buffer  */
+        haddr_t         addr;                   /* Start of current run     */
+        size_t          size;                   /* Bytes left in current run */
+        int             niov;                   /* # of buffers left in run */
+
+        /* Skip empty extents */
+        if(0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Check for overflow conditions */
+        addr = addrs[u];
+        if(!H5F_addr_defined(addr))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+
+        /* Gather the run of extents which follow on from this one */
+        size = 0;
+        niov = 0;
+        do {
+            if(sizes[u] > 0) {
+                iov[niov].iov_base = (void *)(uintptr_t)bufs[u];
+                iov[niov].iov_len = sizes[u];
+                size += sizes[u];
+                niov++;
+            } /* end if */
+            u++;
+        } while(u < count && niov < H5FD_SEC2_MAX_IOV && addrs[u] == addr + size
+                && sizes[u] <= (H5_POSIX_MAX_IO_BYTES - size));
+
+        if(REGION_OVERFLOW(addr, size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
+
+        /* Write the run, being careful of interrupted system calls and
+         * partial results
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written   */
+
+            do {
+                bytes_wrote = HDpwritev(file->fd, curr_iov, niov, (HDoff_t)addr);
+            } while(-1 == bytes_wrote && EINTR == errno);
+
+            if(-1 == bytes_wrote) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', total write size = %llu, buffers this sub-write = %d, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)size, niov, (unsigned long long)addr);
+            } /* end if */
+
+            HDassert(bytes_wrote > 0);
+            HDassert((size_t)bytes_wrote <= size);
+
+            size -= (size_t)bytes_wrote;
+            addr += (haddr_t)bytes_wrote;
+
+            /* Advance past the buffers that were written */
+            while(bytes_wrote > 0) {
+                if((size_t)bytes_wrote >= curr_iov->iov_len) {
+                    bytes_wrote -= (h5_posix_io_ret_t)curr_iov->iov_len;
+                    curr_iov++;
+                    niov--;
+                } /* end if */
+                else {
+                    curr_iov->iov_base = (char *)curr_iov->iov_base + bytes_wrote;
+                    curr_iov->iov_len -= (size_t)bytes_wrote;
+                    bytes_wrote = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+
+        /* Update eof */
+        if(addr > file->eof)
+            file->eof = addr;
+    } /* end while */
+
+    /* The file position is not tracked across vector I/O */
+    file->pos = HADDR_UNDEF;
+    file->op = OP_UNKNOWN;
+#else /* H5_HAVE_PREADWRITEV */
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0 && H5FD_sec2_write(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+#endif /* H5_HAVE_PREADWRITEV */
+
+done:
+    if(ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
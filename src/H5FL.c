@@ -34,6 +34,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 /*
  * Private type definitions
@@ -52,6 +53,24 @@ static size_t H5FL_blk_lst_mem_lim=1024*1024;   /* Default to 1024KB (1MB) limit
 static size_t H5FL_fac_glb_mem_lim=16*1024*1024; /* Default to 16MB limit on all factory free lists */
 static size_t H5FL_fac_lst_mem_lim=1024*1024;     /* Default to 1024KB (1MB) limit on each factory free list */
 
+/*
+    Block free lists round each request up to a size class, so that blocks of
+    nearby sizes share a list and the list for a size is found with an index
+    instead of a search.  Sizes up to H5FL_BLK_CLASS_SMALL_MAX are rounded to
+    a multiple of H5FL_BLK_CLASS_QUANTUM, larger ones to one of
+    H5FL_BLK_CLASS_STEPS steps between consecutive powers of two (so at most
+    25% is wasted).  Blocks too large for any class are never kept.
+ */
+#define H5FL_BLK_CLASS_QUANTUM_LOG2     4
+#define H5FL_BLK_CLASS_QUANTUM          ((size_t)1 << H5FL_BLK_CLASS_QUANTUM_LOG2)
+#define H5FL_BLK_CLASS_SMALL_MAX_LOG2   9
+#define H5FL_BLK_CLASS_SMALL_MAX        ((size_t)1 << H5FL_BLK_CLASS_SMALL_MAX_LOG2)
+#define H5FL_BLK_CLASS_STEPS_LOG2       2
+#define H5FL_BLK_CLASS_STEPS            ((size_t)1 << H5FL_BLK_CLASS_STEPS_LOG2)
+#define H5FL_BLK_CLASS_NSMALL           (H5FL_BLK_CLASS_SMALL_MAX / H5FL_BLK_CLASS_QUANTUM)
+#define H5FL_BLK_CLASS_MAX_LOG2         ((8 * sizeof(size_t)) - 2)
+#define H5FL_BLK_NCLASSES               (H5FL_BLK_CLASS_NSMALL + ((H5FL_BLK_CLASS_MAX_LOG2 - H5FL_BLK_CLASS_SMALL_MAX_LOG2) + 1) * H5FL_BLK_CLASS_STEPS)
+
 /* A garbage collection node for regular free lists */
 typedef struct H5FL_reg_gc_node_t {
     H5FL_reg_head_t *list;              /* Pointer to the head of the list to garbage collect */
@@ -62,10 +81,12 @@ typedef struct H5FL_reg_gc_node_t {
 typedef struct H5FL_reg_gc_list_t {
     size_t mem_freed;               /* Amount of free memory on list */
     struct H5FL_reg_gc_node_t *first;   /* Pointer to the first node in the list of things to garbage collect */
+    unsigned long long nalloc;      /* Number of blocks handed out */
+    unsigned long long nreuse;      /* Number of blocks handed out from a free list */
 } H5FL_reg_gc_list_t;
 
 /* The head of the list of things to garbage collect */
-static H5FL_reg_gc_list_t H5FL_reg_gc_head={0,NULL};
+static H5FL_reg_gc_list_t H5FL_reg_gc_head={0,NULL,0,0};
 
 /* A garbage collection node for array free lists */
 typedef struct H5FL_gc_arr_node_t {
@@ -77,10 +98,12 @@ typedef struct H5FL_gc_arr_node_t {
 typedef struct H5FL_gc_arr_list_t {
     size_t mem_freed;                    /* Amount of free memory on list */
     struct H5FL_gc_arr_node_t *first;    /* Pointer to the first node in the list of things to garbage collect */
+    unsigned long long nalloc;      /* Number of blocks handed out */
+    unsigned long long nreuse;      /* Number of blocks handed out from a free list */
 } H5FL_gc_arr_list_t;
 
 /* The head of the list of array things to garbage collect */
-static H5FL_gc_arr_list_t H5FL_arr_gc_head={0,NULL};
+static H5FL_gc_arr_list_t H5FL_arr_gc_head={0,NULL,0,0};
 
 /* A garbage collection node for blocks */
 typedef struct H5FL_blk_gc_node_t {
@@ -92,10 +115,12 @@ typedef struct H5FL_blk_gc_node_t {
 typedef struct H5FL_blk_gc_list_t {
     size_t mem_freed;                   /* Amount of free memory on list */
     struct H5FL_blk_gc_node_t *first;   /* Pointer to the first node in the list of things to garbage collect */
+    unsigned long long nalloc;      /* Number of blocks handed out */
+    unsigned long long nreuse;      /* Number of blocks handed out from a free list */
 } H5FL_blk_gc_list_t;
 
 /* The head of the list of PQs to garbage collect */
-static H5FL_blk_gc_list_t H5FL_blk_gc_head={0,NULL};
+static H5FL_blk_gc_list_t H5FL_blk_gc_head={0,NULL,0,0};
 
 /* A garbage collection node for factory free lists */
 struct H5FL_fac_gc_node_t {
@@ -107,6 +132,8 @@ struct H5FL_fac_gc_node_t {
 typedef struct H5FL_fac_gc_list_t {
     size_t mem_freed;               /* Amount of free memory on list */
     struct H5FL_fac_gc_node_t *first;   /* Pointer to the first node in the list of things to garbage collect */
+    unsigned long long nalloc;      /* Number of blocks handed out */
+    unsigned long long nreuse;      /* Number of blocks handed out from a free list */
 } H5FL_fac_gc_list_t;
 
 /* Data structure to store each block in factory free list */
@@ -118,7 +145,7 @@ struct H5FL_fac_node_t {
 hbool_t H5_PKG_INIT_VAR = FALSE;
 
 /* The head of the list of factory things to garbage collect */
-static H5FL_fac_gc_list_t H5FL_fac_gc_head={0,NULL};
+static H5FL_fac_gc_list_t H5FL_fac_gc_head={0,NULL,0,0};
 
 #ifdef H5FL_TRACK
 
@@ -135,8 +162,8 @@ static herr_t H5FL__reg_init(H5FL_reg_head_t *head);
 static herr_t H5FL__reg_gc(void);
 static herr_t H5FL__reg_gc_list(H5FL_reg_head_t *head);
 static int H5FL__reg_term(void);
-static H5FL_blk_node_t *H5FL__blk_find_list(H5FL_blk_node_t **head, size_t size);
-static H5FL_blk_node_t *H5FL__blk_create_list(H5FL_blk_node_t **head, size_t size);
+static size_t H5FL__blk_size_class(size_t size, size_t *class_size);
+static H5FL_blk_node_t *H5FL__blk_create_list(H5FL_blk_head_t *head, size_t idx, size_t class_size);
 static herr_t H5FL__blk_init(H5FL_blk_head_t *head);
 static herr_t H5FL__blk_gc_list(H5FL_blk_head_t *head);
 static herr_t H5FL__blk_gc(void);
@@ -364,6 +391,26 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Make certain that the free list is initialized */
     HDassert(head->init);
 
+    /* Release blocks that could never be kept within the limits directly */
+    if(head->size > H5FL_reg_lst_mem_lim || head->size > H5FL_reg_glb_mem_lim) {
+        H5MM_free(obj);
+        head->allocated--;
+        HGOTO_DONE(NULL)
+    } /* end if */
+
+    /* Make room for the block before linking it in, so that the memory
+     * kept on the free lists never exceeds the limits
+     */
+    /* First check this particular list */
+    if(head->onlist * head->size > H5FL_reg_lst_mem_lim - head->size)
+        if(H5FL__reg_gc_list(head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
+    /* Then check the global amount memory on regular free lists */
+    if(H5FL_reg_gc_head.mem_freed > H5FL_reg_glb_mem_lim - head->size)
+        if(H5FL__reg_gc() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
     /* Link into the free list */
     ((H5FL_reg_node_t *)obj)->next=head->list;
 
@@ -376,17 +423,6 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Increment the amount of "regular" freed memory globally */
     H5FL_reg_gc_head.mem_freed+=head->size;
 
-    /* Check for exceeding free list memory use limits */
-    /* First check this particular list */
-    if(head->onlist * head->size > H5FL_reg_lst_mem_lim)
-        if(H5FL__reg_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
-    /* Then check the global amount memory on regular free lists */
-    if(H5FL_reg_gc_head.mem_freed>H5FL_reg_glb_mem_lim)
-        if(H5FL__reg_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_reg_free() */
@@ -433,6 +469,9 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "regular" free list memory in use */
         H5FL_reg_gc_head.mem_freed-=(head->size);
+
+        /* Count the reuse */
+        H5FL_reg_gc_head.nreuse++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -443,6 +482,9 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
         head->allocated++;
     } /* end else */
 
+    /* Count the allocation */
+    H5FL_reg_gc_head.nalloc++;
+
 #ifdef H5FL_TRACK
     /* Copy allocation location information */
     ((H5FL_track_t *)ret_value)->stack = H5CS_copy_stack();
@@ -661,71 +703,57 @@ HDprintf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_reg_gc_head.f
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5FL__blk_find_list
- *
- * Purpose:	Finds the free list for blocks of a given size.  Also moves that
- *      free list node to the head of the priority queue (if it isn't there
- *      already).  This routine does not manage the actual free list, it just
- *      works with the priority queue.
- *
- * Return:	Success:	valid pointer to the free list node
+ * Function:	H5FL__blk_size_class
  *
- *		Failure:	NULL
+ * Purpose:	Maps a block size to its size class.
  *
- * Programmer:	Quincey Koziol
- *		Thursday, March  23, 2000
+ * Return:	Index of the size class, with the size of the blocks in that
+ *      class in *CLASS_SIZE.  H5FL_BLK_NCLASSES (with *CLASS_SIZE set to
+ *      SIZE) for blocks too large to be kept on a free list.
  *
  *-------------------------------------------------------------------------
  */
-static H5FL_blk_node_t *
-H5FL__blk_find_list(H5FL_blk_node_t **head, size_t size)
+static size_t
+H5FL__blk_size_class(size_t size, size_t *class_size)
 {
-    H5FL_blk_node_t *temp = NULL;  /* Temp. pointer to node in the native list */
+    size_t ret_value = 0;       /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Find the correct free list */
-    temp=*head;
-
-    /* Check if the node is at the head of the list */
-    if(temp && temp->size!=size) {
-        temp=temp->next;
-
-        while(temp!=NULL) {
-            /* Check if we found the correct node */
-            if(temp->size==size) {
-                /* Take the node found out of it's current position */
-                if(temp->next==NULL) {
-                    temp->prev->next=NULL;
-                } /* end if */
-                else {
-                    temp->prev->next=temp->next;
-                    temp->next->prev=temp->prev;
-                } /* end else */
-
-                /* Move the found node to the head of the list */
-                temp->prev=NULL;
-                temp->next=*head;
-                (*head)->prev=temp;
-                *head=temp;
-
-                /* Get out */
-                break;
-            } /* end if */
+    HDassert(size);
+    HDassert(class_size);
 
-            temp=temp->next;
-        } /* end while */
+    if(size <= H5FL_BLK_CLASS_SMALL_MAX) {
+        ret_value = (size - 1) >> H5FL_BLK_CLASS_QUANTUM_LOG2;
+        *class_size = (ret_value + 1) << H5FL_BLK_CLASS_QUANTUM_LOG2;
     } /* end if */
+    else {
+        unsigned log2_size;     /* Size is in (2^log2_size, 2^(log2_size+1)] */
+
+        log2_size = H5VM_log2_gen((uint64_t)(size - 1));
+        if(log2_size > H5FL_BLK_CLASS_MAX_LOG2) {
+            ret_value = H5FL_BLK_NCLASSES;
+            *class_size = size;
+        } /* end if */
+        else {
+            size_t step = (size_t)1 << (log2_size - H5FL_BLK_CLASS_STEPS_LOG2);
+            size_t sub = ((size - 1) - ((size_t)1 << log2_size)) / step;
+
+            ret_value = H5FL_BLK_CLASS_NSMALL +
+                    ((log2_size - H5FL_BLK_CLASS_SMALL_MAX_LOG2) << H5FL_BLK_CLASS_STEPS_LOG2) + sub;
+            *class_size = ((size_t)1 << log2_size) + (sub + 1) * step;
+        } /* end else */
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_size_class() */
 
-    FUNC_LEAVE_NOAPI(temp)
-} /* end H5FL__blk_find_list() */
 
-
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_create_list
  *
- * Purpose:	Creates a new free list for blocks of the given size at the
- *      head of the priority queue.
+ * Purpose:	Creates a new free list for blocks of the given size class at
+ *      the head of the priority queue.
  *
  * Return:	Success:	valid pointer to the free list node
  *
@@ -737,33 +765,39 @@ H5FL__blk_find_list(H5FL_blk_node_t **head, size_t size)
  *-------------------------------------------------------------------------
  */
 static H5FL_blk_node_t *
-H5FL__blk_create_list(H5FL_blk_node_t **head, size_t size)
+H5FL__blk_create_list(H5FL_blk_head_t *head, size_t idx, size_t class_size)
 {
     H5FL_blk_node_t *ret_value = NULL;          /* Return value */
 
     FUNC_ENTER_STATIC
 
+    HDassert(idx < H5FL_BLK_NCLASSES);
+    HDassert(NULL == head->classes[idx]);
+
     /* Allocate room for the new free list node */
     if(NULL == (ret_value = H5FL_CALLOC(H5FL_blk_node_t)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed for chunk info")
 
     /* Set the correct values for the new free list */
-    ret_value->size = size;
+    ret_value->size = class_size;
 
     /* Attach to head of priority queue */
-    if(NULL == *head)
-        *head = ret_value;
+    if(NULL == head->head)
+        head->head = ret_value;
     else {
-        ret_value->next = *head;
-        (*head)->prev = ret_value;
-        *head = ret_value;
+        ret_value->next = head->head;
+        head->head->prev = ret_value;
+        head->head = ret_value;
     } /* end else */
 
+    /* Make the list available by size class */
+    head->classes[idx] = ret_value;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL__blk_create_list() */
 
-
+
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_init
  *
@@ -786,9 +820,15 @@ H5FL__blk_init(H5FL_blk_head_t *head)
 
     FUNC_ENTER_STATIC
 
+    /* Allocate the index of free lists by size class */
+    if(NULL == (head->classes = (H5FL_blk_node_t **)H5MM_calloc(H5FL_BLK_NCLASSES * sizeof(H5FL_blk_node_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
     /* Allocate a new garbage collection node */
-    if(NULL == (new_node = (H5FL_blk_gc_node_t *)H5MM_malloc(sizeof(H5FL_blk_gc_node_t))))
+    if(NULL == (new_node = (H5FL_blk_gc_node_t *)H5MM_malloc(sizeof(H5FL_blk_gc_node_t)))) {
+        head->classes = (H5FL_blk_node_t **)H5MM_xfree(head->classes);
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
 
     /* Initialize the new garbage collection node */
     new_node->pq = head;
@@ -823,6 +863,8 @@ htri_t
 H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 {
     H5FL_blk_node_t *free_list; /* The free list of nodes of correct size */
+    size_t idx;                 /* Size class of the block */
+    size_t class_size;          /* Size of blocks in the class */
     htri_t ret_value = FAIL;    /* Return value */
 
     FUNC_ENTER_NOAPI_NOERR
@@ -832,7 +874,8 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
-    if((free_list = H5FL__blk_find_list(&(head->head), size)) != NULL && free_list->list != NULL)
+    if(head->init && (idx = H5FL__blk_size_class(size, &class_size)) < H5FL_BLK_NCLASSES
+            && (free_list = head->classes[idx]) != NULL && free_list->list != NULL)
         ret_value = TRUE;
     else
         ret_value = FALSE;
@@ -862,6 +905,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 {
     H5FL_blk_node_t *free_list; /* The free list of nodes of correct size */
     H5FL_blk_list_t *temp;      /* Temp. ptr to the new native list allocated */
+    size_t idx;                 /* Size class of the block */
+    size_t class_size;          /* Size of blocks in the class */
     void *ret_value = NULL;     /* Pointer to the block to return to the user */
 
     FUNC_ENTER_NOAPI(NULL)
@@ -875,9 +920,13 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         if(H5FL__blk_init(head) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list")
 
+    /* Get the size class for the block */
+    idx = H5FL__blk_size_class(size, &class_size);
+    free_list = (idx < H5FL_BLK_NCLASSES) ? head->classes[idx] : NULL;
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
-    if(NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
+    if(NULL != free_list && NULL != free_list->list) {
         /* Remove the first node from the free list */
         temp=free_list->list;
         free_list->list=free_list->list->next;
@@ -885,30 +934,37 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         /* Decrement the number of blocks & memory used on free list */
         free_list->onlist--;
         head->onlist--;
-        head->list_mem-=size;
+        head->list_mem-=class_size;
 
         /* Decrement the amount of global "block" free list memory in use */
-        H5FL_blk_gc_head.mem_freed-=size;
+        H5FL_blk_gc_head.mem_freed-=class_size;
+
+        /* Count the reuse */
+        H5FL_blk_gc_head.nreuse++;
     } /* end if */
     /* No free list available, or there are no nodes on the list, allocate a new node to give to the user */
     else {
         /* Check if there was no free list for native blocks of this size */
-        if(NULL == free_list)
+        if(NULL == free_list && idx < H5FL_BLK_NCLASSES)
             /* Create a new list node and insert it to the queue */
-            free_list = H5FL__blk_create_list(&(head->head), size);
-        HDassert(free_list);
+            if(NULL == (free_list = H5FL__blk_create_list(head, idx, class_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't create free list for block size")
 
         /* Allocate new node, with room for the page info header and the actual page data */
-        if(NULL == (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE + size)))
+        if(NULL == (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE + class_size)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk")
 
         /* Increment the number of blocks of this size */
-        free_list->allocated++;
+        if(free_list)
+            free_list->allocated++;
 
         /* Increment the total number of blocks allocated */
         head->allocated++;
     } /* end else */
 
+    /* Count the allocation */
+    H5FL_blk_gc_head.nalloc++;
+
     /* Initialize the block allocated */
     temp->size=size;
 
@@ -959,6 +1015,7 @@ done:
 void *
 H5FL_blk_calloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 {
+    size_t class_size = size;   /* Size of blocks in the block's size class */
     void *ret_value = NULL;     /* Pointer to the block to return to the user */
 
     FUNC_ENTER_NOAPI(NULL)
@@ -971,8 +1028,12 @@ H5FL_blk_calloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
     if (NULL==(ret_value = H5FL_blk_malloc(head,size H5FL_TRACK_INFO_INT)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
-    /* Clear the block to zeros */
-    HDmemset(ret_value,0,size);
+    /* Clear the whole block to zeros, including the rest of its size class,
+     * so that a block reused for any size in the class is still cleared
+     * (see H5FL_blk_free_block_avail)
+     */
+    (void)H5FL__blk_size_class(size, &class_size);
+    HDmemset(ret_value,0,class_size);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1000,6 +1061,7 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
 {
     H5FL_blk_node_t *free_list;      /* The free list of nodes of correct size */
     H5FL_blk_list_t *temp;      /* Temp. ptr to the new free list node allocated */
+    size_t idx;                 /* Size class of the block freed */
     size_t free_size;           /* Size of the block freed */
     void *ret_value=NULL;       /* Return value */
 
@@ -1037,17 +1099,38 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     /* Get the pointer to the native block info header in front of the native block to free */
     temp = (H5FL_blk_list_t *)((void *)((unsigned char *)block - (sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE))); /*lint !e826 Pointer-to-pointer cast is appropriate here */
 
-    /* Save the block's size for later */
-    free_size=temp->size;
+    /* Get the size class of the block */
+    idx = H5FL__blk_size_class(temp->size, &free_size);
 
 #ifdef H5FL_DEBUG
     HDmemset(temp,255,free_size + sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE);
 #endif /* H5FL_DEBUG */
 
-    /* Check if there is a free list for native blocks of this size */
-    if(NULL == (free_list = H5FL__blk_find_list(&(head->head), free_size)))
-        /* No free list available, create a new list node and insert it to the queue */
-        free_list = H5FL__blk_create_list(&(head->head), free_size);
+    /* Release blocks that could never be kept within the limits directly */
+    if(idx == H5FL_BLK_NCLASSES || free_size > H5FL_blk_lst_mem_lim || free_size > H5FL_blk_glb_mem_lim) {
+        H5MM_free(temp);
+        if(idx < H5FL_BLK_NCLASSES)
+            head->classes[idx]->allocated--;
+        head->allocated--;
+        HGOTO_DONE(NULL)
+    } /* end if */
+
+    /* Make room for the block before linking it in, so that the memory
+     * kept on the free lists never exceeds the limits.  (The block is still
+     * counted as allocated, so its free list survives garbage collection)
+     */
+    /* First check this particular list */
+    if(head->list_mem > H5FL_blk_lst_mem_lim - free_size)
+        if(H5FL__blk_gc_list(head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
+    /* Then check the global amount memory on block free lists */
+    if(H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim - free_size)
+        if(H5FL__blk_gc() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
+    /* Get the free list for blocks of this size */
+    free_list = head->classes[idx];
     HDassert(free_list);
 
     /* Prepend the free'd native block to the front of the free list */
@@ -1062,17 +1145,6 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     /* Increment the amount of "block" freed memory globally */
     H5FL_blk_gc_head.mem_freed += free_size;
 
-    /* Check for exceeding free list memory use limits */
-    /* First check this particular list */
-    if(head->list_mem > H5FL_blk_lst_mem_lim)
-        if(H5FL__blk_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
-    /* Then check the global amount memory on block free lists */
-    if(H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim)
-        if(H5FL__blk_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_free() */
@@ -1082,7 +1154,8 @@ done:
  * Function:	H5FL_blk_realloc
  *
  * Purpose:	Resizes a block.  This does things the straightforward, simple way,
- *      not actually using realloc.
+ *      not actually using realloc.  Blocks resized within their size class
+ *      are returned as is.
  *
  * Return:	Success:	NULL
  *
@@ -1107,12 +1180,16 @@ H5FL_blk_realloc(H5FL_blk_head_t *head, void *block, size_t new_size H5FL_TRACK_
     /* Check if we are actually re-allocating a block */
     if(block!=NULL) {
         H5FL_blk_list_t *temp;      /* Temp. ptr to the new block node allocated */
+        size_t new_class_size = 0;  /* Size of blocks in the new size class */
+        size_t old_class_size = 0;  /* Size of blocks in the old size class */
 
         /* Get the pointer to the chunk info header in front of the chunk to free */
         temp = (H5FL_blk_list_t *)((void *)((unsigned char *)block - (sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE))); /*lint !e826 Pointer-to-pointer cast is appropriate here */
 
-        /* check if we are actually changing the size of the buffer */
-        if(new_size!=temp->size) {
+        /* check if we are actually changing the size class of the buffer */
+        if(new_size != temp->size && (H5FL__blk_size_class(new_size, &new_class_size) == H5FL_BLK_NCLASSES
+                || H5FL__blk_size_class(temp->size, &old_class_size) == H5FL_BLK_NCLASSES
+                || new_class_size != old_class_size)) {
             size_t blk_size;           /* Temporary block size */
 
             if((ret_value=H5FL_blk_malloc(head,new_size H5FL_TRACK_INFO_INT))==NULL)
@@ -1139,6 +1216,8 @@ H5FL_blk_realloc(H5FL_blk_head_t *head, void *block, size_t new_size H5FL_TRACK_
                 trk->line = call_line;
             }
 #endif /* H5FL_TRACK */
+            /* The block already has room for the new size */
+            temp->size = new_size;
             ret_value=block;
         } /* end if */
     } /* end if */
@@ -1168,6 +1247,7 @@ static herr_t
 H5FL__blk_gc_list(H5FL_blk_head_t *head)
 {
     H5FL_blk_node_t *blk_head;     /* Temp. ptr to the free list page node */
+    size_t class_size;             /* Size of blocks in a size class */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -1222,6 +1302,9 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
             if(blk_head->next)
                 blk_head->next->prev = blk_head->prev;
 
+            /* Remove it from the size class index */
+            head->classes[H5FL__blk_size_class(blk_head->size, &class_size)] = NULL;
+
             /* Free the free list node */
             H5FL_FREE(H5FL_blk_node_t, blk_head);
         } /* end if */
@@ -1327,6 +1410,7 @@ HDprintf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_blk_gc_head.f
         else {
             /* Reset the "initialized" flag, in case we restart this list somehow (I don't know how..) */
             H5FL_blk_gc_head.first->pq->init = FALSE;
+            H5FL_blk_gc_head.first->pq->classes = (H5FL_blk_node_t **)H5MM_xfree(H5FL_blk_gc_head.first->pq->classes);
 
             /* Free the node from the garbage collection list */
             H5MM_free(H5FL_blk_gc_head.first);
@@ -1436,15 +1520,36 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Double-check that there is enough room for arrays of this size */
     HDassert((int)free_nelem<=head->maxelem);
 
+    /* Get the size of arrays with this many elements */
+    mem_size=head->list_arr[free_nelem].size;
+
+    /* Release blocks that could never be kept within the limits directly */
+    if(mem_size > H5FL_arr_lst_mem_lim || mem_size > H5FL_arr_glb_mem_lim) {
+        H5MM_free(temp);
+        head->list_arr[free_nelem].allocated--;
+        head->allocated--;
+        HGOTO_DONE(NULL)
+    } /* end if */
+
+    /* Make room for the block before linking it in, so that the memory
+     * kept on the free lists never exceeds the limits
+     */
+    /* First check this particular list */
+    if(head->list_mem > H5FL_arr_lst_mem_lim - mem_size)
+        if(H5FL__arr_gc_list(head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
+    /* Then check the global amount memory on array free lists */
+    if(H5FL_arr_gc_head.mem_freed > H5FL_arr_glb_mem_lim - mem_size)
+        if(H5FL__arr_gc() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
     /* Link into the free list */
     temp->next=head->list_arr[free_nelem].list;
 
     /* Point free list at the node freed */
     head->list_arr[free_nelem].list=temp;
 
-    /* Get the size of arrays with this many elements */
-    mem_size=head->list_arr[free_nelem].size;
-
     /* Increment the number of blocks & memory used on free list */
     head->list_arr[free_nelem].onlist++;
     head->list_mem+=mem_size;
@@ -1452,17 +1557,6 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Increment the amount of "array" freed memory globally */
     H5FL_arr_gc_head.mem_freed+=mem_size;
 
-    /* Check for exceeding free list memory use limits */
-    /* First check this particular list */
-    if(head->list_mem > H5FL_arr_lst_mem_lim)
-        if(H5FL__arr_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
-    /* Then check the global amount memory on array free lists */
-    if(H5FL_arr_gc_head.mem_freed > H5FL_arr_glb_mem_lim)
-        if(H5FL__arr_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_arr_free() */
@@ -1520,6 +1614,8 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
         /* Decrement the amount of global "array" free list memory in use */
         H5FL_arr_gc_head.mem_freed-=mem_size;
 
+        /* Count the reuse */
+        H5FL_arr_gc_head.nreuse++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -1533,6 +1629,9 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
         head->allocated++;
     } /* end else */
 
+    /* Count the allocation */
+    H5FL_arr_gc_head.nalloc++;
+
     /* Initialize the new object */
     new_obj->nelem=elem;
 
@@ -2059,6 +2158,26 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     /* Make certain that the free list is initialized */
     HDassert(head->init);
 
+    /* Release blocks that could never be kept within the limits directly */
+    if(head->size > H5FL_fac_lst_mem_lim || head->size > H5FL_fac_glb_mem_lim) {
+        H5MM_free(obj);
+        head->allocated--;
+        HGOTO_DONE(NULL)
+    } /* end if */
+
+    /* Make room for the block before linking it in, so that the memory
+     * kept on the free lists never exceeds the limits
+     */
+    /* First check this particular list */
+    if(head->onlist * head->size > H5FL_fac_lst_mem_lim - head->size)
+        if(H5FL__fac_gc_list(head) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
+    /* Then check the global amount memory on factory free lists */
+    if(H5FL_fac_gc_head.mem_freed > H5FL_fac_glb_mem_lim - head->size)
+        if(H5FL__fac_gc() < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
+
     /* Link into the free list */
     ((H5FL_fac_node_t *)obj)->next = head->list;
 
@@ -2071,17 +2190,6 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     /* Increment the amount of "factory" freed memory globally */
     H5FL_fac_gc_head.mem_freed += head->size;
 
-    /* Check for exceeding free list memory use limits */
-    /* First check this particular list */
-    if(head->onlist * head->size > H5FL_fac_lst_mem_lim)
-        if(H5FL__fac_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
-    /* Then check the global amount memory on factory free lists */
-    if(H5FL_fac_gc_head.mem_freed > H5FL_fac_glb_mem_lim)
-        if(H5FL__fac_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_fac_free() */
@@ -2125,6 +2233,9 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "factory" free list memory in use */
         H5FL_fac_gc_head.mem_freed-=(head->size);
+
+        /* Count the reuse */
+        H5FL_fac_gc_head.nreuse++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -2135,6 +2246,9 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
         head->allocated++;
     } /* end else */
 
+    /* Count the allocation */
+    H5FL_fac_gc_head.nalloc++;
+
 #ifdef H5FL_TRACK
     /* Copy allocation location information */
     ((H5FL_track_t *)ret_value)->stack = H5CS_copy_stack();
@@ -2438,7 +2552,9 @@ done:
  *      for the entire library.  Each "global" limit only applies to free lists
  *      of that type, so if an application sets a limit of 1 MB on each of the
  *      global lists, up to 3 MB of total storage might be allocated (1MB on
- *      each of regular, array and block type lists).
+ *      each of regular, array and block type lists).  The free lists are
+ *      garbage collected when the limits are set, and the memory kept on
+ *      them never exceeds the limits afterwards.
  *
  * Parameters:
  *  int reg_global_lim;  IN: The limit on all "regular" free list memory used
@@ -2464,26 +2580,33 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
 {
     herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_NOAPI_NOERR
+    FUNC_ENTER_NOAPI(FAIL)
 
     /* Set the limit variables */
     /* limit on all regular free lists */
-    H5FL_reg_glb_mem_lim = (reg_global_lim == -1 ? UINT_MAX : (size_t)reg_global_lim);
+    H5FL_reg_glb_mem_lim = (reg_global_lim == -1 ? SIZE_MAX : (size_t)reg_global_lim);
     /* limit on each regular free list */
-    H5FL_reg_lst_mem_lim = (reg_list_lim == -1 ? UINT_MAX : (size_t)reg_list_lim);
+    H5FL_reg_lst_mem_lim = (reg_list_lim == -1 ? SIZE_MAX : (size_t)reg_list_lim);
     /* limit on all array free lists */
-    H5FL_arr_glb_mem_lim = (arr_global_lim == -1 ? UINT_MAX : (size_t)arr_global_lim);
+    H5FL_arr_glb_mem_lim = (arr_global_lim == -1 ? SIZE_MAX : (size_t)arr_global_lim);
     /* limit on each array free list */
-    H5FL_arr_lst_mem_lim = (arr_list_lim == -1 ? UINT_MAX : (size_t)arr_list_lim);
+    H5FL_arr_lst_mem_lim = (arr_list_lim == -1 ? SIZE_MAX : (size_t)arr_list_lim);
     /* limit on all block free lists */
-    H5FL_blk_glb_mem_lim = (blk_global_lim == -1 ? UINT_MAX : (size_t)blk_global_lim);
+    H5FL_blk_glb_mem_lim = (blk_global_lim == -1 ? SIZE_MAX : (size_t)blk_global_lim);
     /* limit on each block free list */
-    H5FL_blk_lst_mem_lim = (blk_list_lim == -1 ? UINT_MAX : (size_t)blk_list_lim);
+    H5FL_blk_lst_mem_lim = (blk_list_lim == -1 ? SIZE_MAX : (size_t)blk_list_lim);
     /* limit on all factory free lists */
-    H5FL_fac_glb_mem_lim = (fac_global_lim == -1 ? UINT_MAX : (size_t)fac_global_lim);
+    H5FL_fac_glb_mem_lim = (fac_global_lim == -1 ? SIZE_MAX : (size_t)fac_global_lim);
     /* limit on each factory free list */
-    H5FL_fac_lst_mem_lim = (fac_list_lim == -1 ? UINT_MAX : (size_t)fac_list_lim);
+    H5FL_fac_lst_mem_lim = (fac_list_lim == -1 ? SIZE_MAX : (size_t)fac_list_lim);
 
+    /* Release what's kept on the free lists now, so the new limits hold
+     * from here on (the free routines keep them from then on)
+     */
+    if(H5FL_garbage_coll() < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect free lists")
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_set_free_list_limits() */
 
@@ -2611,3 +2734,94 @@ H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FL_get_free_list_sizes() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_stats
+ *
+ * Purpose:	Gets usage statistics for the different kinds of free lists.
+ *      These lists are global for the entire library.
+ *
+ * Parameters:
+ *  H5_free_list_stats_t *reg_stats;    OUT: Statistics for "regular" free lists
+ *  H5_free_list_stats_t *arr_stats;    OUT: Statistics for "array" free lists
+ *  H5_free_list_stats_t *blk_stats;    OUT: Statistics for "block" free lists
+ *  H5_free_list_stats_t *fac_stats;    OUT: Statistics for "factory" free lists
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_stats(H5_free_list_stats_t *reg_stats, H5_free_list_stats_t *arr_stats,
+    H5_free_list_stats_t *blk_stats, H5_free_list_stats_t *fac_stats)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Retrieve the "regular" free list statistics */
+    if(reg_stats) {
+        H5FL_reg_gc_node_t *gc_node;    /* Pointer into the list of lists */
+
+        reg_stats->total_alloc_count = H5FL_reg_gc_head.nalloc;
+        reg_stats->reuse_alloc_count = H5FL_reg_gc_head.nreuse;
+        reg_stats->curr_free_bytes = H5FL_reg_gc_head.mem_freed;
+
+        /* Walk through all the free lists, counting the blocks kept */
+        reg_stats->curr_free_blocks_count = 0;
+        for(gc_node = H5FL_reg_gc_head.first; gc_node != NULL; gc_node = gc_node->next)
+            reg_stats->curr_free_blocks_count += gc_node->list->onlist;
+    } /* end if */
+
+    /* Retrieve the "array" free list statistics */
+    if(arr_stats) {
+        H5FL_gc_arr_node_t *gc_arr_node;    /* Pointer into the list of lists */
+
+        arr_stats->total_alloc_count = H5FL_arr_gc_head.nalloc;
+        arr_stats->reuse_alloc_count = H5FL_arr_gc_head.nreuse;
+        arr_stats->curr_free_bytes = H5FL_arr_gc_head.mem_freed;
+
+        /* Walk through all the free lists, counting the blocks kept */
+        arr_stats->curr_free_blocks_count = 0;
+        for(gc_arr_node = H5FL_arr_gc_head.first; gc_arr_node != NULL; gc_arr_node = gc_arr_node->next) {
+            H5FL_arr_head_t *head = gc_arr_node->list;  /* Head of array list elements */
+
+            if(head->list_mem > 0) {
+                unsigned u;
+
+                for(u = 0; u < (unsigned)head->maxelem; u++)
+                    arr_stats->curr_free_blocks_count += head->list_arr[u].onlist;
+            } /* end if */
+        } /* end for */
+    } /* end if */
+
+    /* Retrieve the "block" free list statistics */
+    if(blk_stats) {
+        H5FL_blk_gc_node_t *gc_blk_node;    /* Pointer into the list of lists */
+
+        blk_stats->total_alloc_count = H5FL_blk_gc_head.nalloc;
+        blk_stats->reuse_alloc_count = H5FL_blk_gc_head.nreuse;
+        blk_stats->curr_free_bytes = H5FL_blk_gc_head.mem_freed;
+
+        /* Walk through all the free lists, counting the blocks kept */
+        blk_stats->curr_free_blocks_count = 0;
+        for(gc_blk_node = H5FL_blk_gc_head.first; gc_blk_node != NULL; gc_blk_node = gc_blk_node->next)
+            blk_stats->curr_free_blocks_count += gc_blk_node->pq->onlist;
+    } /* end if */
+
+    /* Retrieve the "factory" free list statistics */
+    if(fac_stats) {
+        H5FL_fac_gc_node_t *gc_fac_node;    /* Pointer into the list of lists */
+
+        fac_stats->total_alloc_count = H5FL_fac_gc_head.nalloc;
+        fac_stats->reuse_alloc_count = H5FL_fac_gc_head.nreuse;
+        fac_stats->curr_free_bytes = H5FL_fac_gc_head.mem_freed;
+
+        /* Walk through all the free lists, counting the blocks kept */
+        fac_stats->curr_free_blocks_count = 0;
+        for(gc_fac_node = H5FL_fac_gc_head.first; gc_fac_node != NULL; gc_fac_node = gc_fac_node->next)
+            fac_stats->curr_free_blocks_count += gc_fac_node->list->onlist;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FL_get_free_list_stats() */
+
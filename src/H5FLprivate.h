@@ -172,6 +172,7 @@ typedef struct H5FL_blk_head_t {
     size_t list_mem;    /* Total amount of memory in blocks on free list */
     const char *name;   /* Name of the type */
     H5FL_blk_node_t *head;  /* Pointer to first free list in queue */
+    H5FL_blk_node_t **classes;  /* Free lists in queue, indexed by size class */
 } H5FL_blk_head_t;
 
 /*
@@ -180,7 +181,7 @@ typedef struct H5FL_blk_head_t {
 #define H5FL_BLK_NAME(t)        H5_##t##_blk_free_list
 #ifndef H5_NO_BLK_FREE_LISTS
 /* Common macro for H5FL_BLK_DEFINE & H5FL_BLK_DEFINE_STATIC */
-#define H5FL_BLK_DEFINE_COMMON(t) H5FL_blk_head_t H5FL_BLK_NAME(t)={0,0,0,0,#t"_blk",NULL}
+#define H5FL_BLK_DEFINE_COMMON(t) H5FL_blk_head_t H5FL_BLK_NAME(t)={0,0,0,0,#t"_blk",NULL,NULL}
 
 /* Declare a free list to manage objects of type 't' */
 #define H5FL_BLK_DEFINE(t)  H5_DLL H5FL_BLK_DEFINE_COMMON(t)
@@ -314,7 +315,7 @@ typedef struct H5FL_seq_head_t {
 #define H5FL_SEQ_NAME(t)        H5_##t##_seq_free_list
 #ifndef H5_NO_SEQ_FREE_LISTS
 /* Common macro for H5FL_SEQ_DEFINE & H5FL_SEQ_DEFINE_STATIC */
-#define H5FL_SEQ_DEFINE_COMMON(t) H5FL_seq_head_t H5FL_SEQ_NAME(t)={{0,0,0,0,#t"_seq",NULL},sizeof(t)}
+#define H5FL_SEQ_DEFINE_COMMON(t) H5FL_seq_head_t H5FL_SEQ_NAME(t)={{0,0,0,0,#t"_seq",NULL,NULL},sizeof(t)}
 
 /* Declare a free list to manage sequences of type 't' */
 #define H5FL_SEQ_DEFINE(t)  H5_DLL H5FL_SEQ_DEFINE_COMMON(t)
@@ -429,6 +430,9 @@ H5_DLL herr_t H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim,
     int fac_global_lim, int fac_list_lim);
 H5_DLL herr_t H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size,
     size_t *blk_size, size_t *fac_size);
+H5_DLL herr_t H5FL_get_free_list_stats(H5_free_list_stats_t *reg_stats,
+    H5_free_list_stats_t *arr_stats, H5_free_list_stats_t *blk_stats,
+    H5_free_list_stats_t *fac_stats);
 H5_DLL int   H5FL_term_interface(void);
 
 #endif
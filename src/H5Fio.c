@@ -209,6 +209,343 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_shared_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_has_vector_io
+ *
+ * Purpose:     Check whether the file driver accepts lists of extents
+ *              for raw data I/O, so that callers with many small pieces
+ *              should prefer H5F_shared_vector_read/write.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_shared_has_vector_io(const H5F_shared_t *f_sh)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f_sh);
+
+    FUNC_LEAVE_NOAPI(H5FD_has_vector_io(f_sh->lf))
+} /* end H5F_shared_has_vector_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__vector_bypass_ok
+ *
+ * Purpose:     Check whether a list of extents can be handed directly to
+ *              the file driver, bypassing the page buffer and metadata
+ *              accumulator.  This is only the case when there is no page
+ *              buffer and none of the extents overlap the accumulator.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5F__vector_bypass_ok(const H5F_shared_t *f_sh, size_t count,
+    const haddr_t addrs[], const size_t sizes[])
+{
+    size_t      u;                      /* Local index variable */
+    hbool_t     ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(f_sh->page_buf)
+        HGOTO_DONE(FALSE)
+
+    if((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.size > 0)
+        for(u = 0; u < count; u++)
+            if(H5F_addr_overlap(addrs[u], sizes[u], f_sh->accum.loc, f_sh->accum.size))
+                HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__vector_bypass_ok() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_read
+ *
+ * Purpose:     Reads a list of extents from a file.  Extent I begins at
+ *              address ADDRS[I] (relative to the base address), is
+ *              SIZES[I] bytes long and is read into BUFS[I].
+ *
+ *              The whole list is passed to the file driver in one call
+ *              unless the page buffer or metadata accumulator could hold
+ *              newer copies of any of the extents, in which case they are
+ *              read one at a time with H5F_shared_block_read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count,
+    const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/)
+{
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    if(H5F__vector_bypass_ok(f_sh, count, addrs, sizes)) {
+        /* Check for attempting I/O on 'temporary' file address */
+        for(u = 0; u < count; u++) {
+            HDassert(H5F_addr_defined(addrs[u]));
+            if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+        } /* end for */
+
+        /* Treat global heap as raw data */
+        map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+        if(H5FD_read_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5F_shared_block_read(f_sh, type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read() */
+
+
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_read_unlocked
+ *
+ * Purpose:     Reads a list of raw data extents from a file opened
+ *              read-only, as H5F_shared_vector_read() does, but gives up
+ *              the library's API lock while the file driver reads them,
+ *              so that other threads can use the library meanwhile.
+ *
+ *              Nothing in the library changes the contents of a file
+ *              opened read-only, and the driver must advertise
+ *              H5FD_FEAT_CONCURRENT_READ.  When the page buffer or
+ *              metadata accumulator are involved the extents are read
+ *              with the lock held.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read_unlocked(H5F_shared_t *f_sh, H5FD_mem_t type,
+    size_t count, const haddr_t addrs[], const size_t sizes[],
+    void *bufs[]/*out*/)
+{
+    unsigned int lock_count = 0;        /* Number of times the API lock was held */
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    herr_t      read_ret;               /* Return value from the driver */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(!(f_sh->flags & H5F_ACC_RDWR));
+    HDassert(f_sh->lf->feature_flags & H5FD_FEAT_CONCURRENT_READ);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    if(!H5F__vector_bypass_ok(f_sh, count, addrs, sizes)) {
+        if(H5F_shared_vector_read(f_sh, type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Errors can't be pushed without the lock, so any failure in the
+     * driver is reported after taking the lock back.
+     */
+    if(H5E_pause_stack() < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTSET, FAIL, "can't pause error stack")
+    if(H5_API_RELEASE_LOCK(lock_count) != 0) {
+        H5E_resume_stack();
+        HGOTO_ERROR(H5E_IO, H5E_CANTUNLOCK, FAIL, "can't release API lock")
+    } /* end if */
+
+    read_ret = H5FD_read_vector(f_sh->lf, map_type, count, addrs, sizes, bufs);
+
+    if(H5_API_REACQUIRE_LOCK(lock_count) != 0) {
+        H5E_resume_stack();
+        HGOTO_ERROR(H5E_IO, H5E_CANTLOCK, FAIL, "can't reacquire API lock")
+    } /* end if */
+    if(H5E_resume_stack() < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't resume error stack")
+    if(read_ret < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read_unlocked() */
+#endif /* defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS) */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_map_raw
+ *
+ * Purpose:     Points *PTR at the SIZE bytes at address ADDR (relative to
+ *              the base address) in a read-only memory map of the file.
+ *              Files whose driver keeps them mapped (H5FD_FEAT_MEMORY_MAPPED)
+ *              use the driver's map.  Otherwise the whole file is mapped
+ *              the first time, and stays mapped until the file is closed.
+ *
+ *              Only files opened read-only (and not for SWMR reading),
+ *              whose driver keeps the file in a single POSIX file, can be
+ *              mapped by the library.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_map_raw(H5F_shared_t *f_sh, haddr_t addr, hsize_t size, const void **ptr)
+{
+    haddr_t     base_addr;              /* Base address of the file */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(ptr);
+
+    base_addr = H5FD_get_base_addr(f_sh->lf);
+
+    /* Use the driver's map of the file, if it has one */
+    if(H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_MEMORY_MAPPED)) {
+        void       *map_ptr = NULL;     /* Pointer to the driver's map */
+        haddr_t     eof;                /* End of file */
+
+        if(HADDR_UNDEF == (eof = H5FD_get_eof(f_sh->lf, H5FD_MEM_DRAW)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to determine file size")
+        if(addr + size > eof)
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "address is beyond the end of the file")
+        if(H5FD_get_vfd_handle(f_sh->lf, H5P_FILE_ACCESS_DEFAULT, &map_ptr) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get file map")
+
+        *ptr = (const uint8_t *)(*(void **)map_ptr) + base_addr + addr;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+#ifdef H5_HAVE_SYS_MMAN_H
+    if(NULL == f_sh->raw_map) {
+        void       *fd_ptr = NULL;      /* Pointer to file descriptor */
+        void       *map;                /* Memory mapping */
+        haddr_t     eof;                /* End of file */
+
+        /* The file can't change under the map, and must be a POSIX file
+         * (the core driver hands back its memory buffer instead of the
+         * descriptor of its backing store)
+         */
+        if((f_sh->flags & (H5F_ACC_RDWR | H5F_ACC_SWMR_READ)) != 0)
+            HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "only files opened read-only can be memory mapped")
+        if(!H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_POSIX_COMPAT_HANDLE) || H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_ALLOW_FILE_IMAGE))
+            HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "file driver doesn't support memory mapping")
+
+        if(HADDR_UNDEF == (eof = H5FD_get_eof(f_sh->lf, H5FD_MEM_DRAW)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to determine file size")
+        if(base_addr + eof > (haddr_t)SIZE_MAX)
+            HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "file too large to memory map")
+        if(H5FD_get_vfd_handle(f_sh->lf, H5P_FILE_ACCESS_DEFAULT, &fd_ptr) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get file descriptor")
+
+        if(MAP_FAILED == (map = HDmmap(NULL, (size_t)(base_addr + eof), PROT_READ, MAP_PRIVATE, *(int *)fd_ptr, (HDoff_t)0)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to memory map file")
+        f_sh->raw_map = map;
+        f_sh->raw_map_len = (size_t)(base_addr + eof);
+    } /* end if */
+
+    /* Touching the map beyond the end of the file raises SIGBUS */
+    if(base_addr + addr + size > (haddr_t)f_sh->raw_map_len)
+        HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "address is beyond the end of the file")
+
+    *ptr = (const uint8_t *)f_sh->raw_map + base_addr + addr;
+#else /* H5_HAVE_SYS_MMAN_H */
+    HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "memory mapping is not supported on this platform")
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_map_raw() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_shared_vector_write
+ *
+ * Purpose:     Writes a list of extents to a file.  Extent I begins at
+ *              address ADDRS[I] (relative to the base address), is
+ *              SIZES[I] bytes long and comes from BUFS[I].
+ *
+ *              The whole list is passed to the file driver in one call
+ *              unless the page buffer or metadata accumulator hold data
+ *              for any of the extents, in which case they are written one
+ *              at a time with H5F_shared_block_write.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_write(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count,
+    const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    if(H5F__vector_bypass_ok(f_sh, count, addrs, sizes)) {
+        /* Check for attempting I/O on 'temporary' file address */
+        for(u = 0; u < count; u++) {
+            HDassert(H5F_addr_defined(addrs[u]));
+            if(H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+        } /* end for */
+
+        /* Treat global heap as raw data */
+        map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+        if(H5FD_write_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else
+        for(u = 0; u < count; u++)
+            if(H5F_shared_block_write(f_sh, type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_write() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_write
@@ -284,6 +284,7 @@ struct H5F_shared_t {
                                         /* close option.  This structure is     */
                                         /* fixed at creation time and should    */
                                         /* not change thereafter.               */
+    unsigned    mdc_flush_nthreads; /* # of threads serializing metadata cache entries on flush */
     hbool_t     use_mdc_logging; /* Set when metadata logging is desired */
     hbool_t     start_mdc_log_on_access; /* set when mdc logging should  */
                                 /* begin on file access/create          */
@@ -294,6 +295,7 @@ struct H5F_shared_t {
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
+    H5F_rdcc_budget_t rdcc_budget; /* Budget of all raw data chunk caches */
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
@@ -359,6 +361,10 @@ struct H5F_shared_t {
 
     char               *extpath;        /* Path for searching target external link file                 */
 
+    /* Read-only memory map of the whole file, for H5Dmap_chunks */
+    void               *raw_map;        /* Start of the map, or NULL when not mapped */
+    size_t              raw_map_len;    /* Length of the map */
+
 #ifdef H5_HAVE_PARALLEL
     H5P_coll_md_read_flag_t coll_md_read;  /* Do all metadata reads collectively */
     hbool_t             coll_md_write;  /* Do all metadata writes collectively */
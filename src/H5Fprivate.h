@@ -315,6 +315,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)      ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)          ((F)->shared->rdcc_w0)
+#define H5F_RDCC_BUDGET(F)      (&(F)->shared->rdcc_budget)
 #define H5F_SIEVE_BUF_SIZE(F)   ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)           ((F)->shared->gc_ref)
 #define H5F_STORE_MSG_CRT_IDX(F)    ((F)->shared->store_msg_crt_idx)
@@ -377,6 +378,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)      (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)          (H5F_rdcc_w0(F))
+#define H5F_RDCC_BUDGET(F)      (H5F_rdcc_budget(F))
 #define H5F_SIEVE_BUF_SIZE(F)   (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)           (H5F_gc_ref(F))
 #define H5F_STORE_MSG_CRT_IDX(F) (H5F_store_msg_crt_idx(F))
@@ -481,9 +483,11 @@ typedef struct H5F_t H5F_t;
 
 /* ========= File Access properties ============ */
 #define H5F_ACS_META_CACHE_INIT_CONFIG_NAME    "mdc_initCacheCfg" /* Initial metadata cache resize configuration */
+#define H5F_ACS_META_CACHE_FLUSH_NTHREADS_NAME  "mdc_flush_nthreads" /* # of threads serializing metadata cache entries on flush */
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME       "rdcc_nslots"   /* Size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_NAME       "rdcc_nbytes"   /* Size of raw data chunk cache(bytes) */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME        "rdcc_w0"       /* Preemption read chunks first */
+#define H5F_ACS_DATA_CACHE_BUDGET_NAME          "rdcc_budget"   /* File-wide limit of raw data chunk caches(bytes) */
 #define H5F_ACS_ALIGN_THRHD_NAME                "threshold"     /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                      "align"         /* Alignment */
 #define H5F_ACS_META_BLOCK_SIZE_NAME            "meta_block_size" /* Minimum metadata allocation block size (when aggregating metadata allocations) */
@@ -656,6 +660,7 @@ typedef struct H5F_t H5F_t;
 
 /* Forward declarations (for prototypes & type definitions) */
 struct H5B_class_t;
+struct H5D_shared_t;
 struct H5UC_t;
 struct H5O_loc_t;
 struct H5HG_heap_t;
@@ -682,6 +687,14 @@ typedef struct H5F_block_t {
     hsize_t length;             /* Length of the block in the file */
 } H5F_block_t;
 
+/* File-wide budget for the raw data chunk caches of the open datasets */
+typedef struct H5F_rdcc_budget_t {
+    size_t nbytes_max;          /* Limit on raw data cached, 0 for none (bytes) */
+    size_t nbytes_used;         /* Raw data cached by all datasets (bytes) */
+    struct H5D_shared_t *head;  /* Dataset whose cache was used least recently */
+    struct H5D_shared_t *tail;  /* Dataset whose cache was used most recently */
+} H5F_rdcc_budget_t;
+
 /* Enum for free space manager state */
 typedef enum H5F_fs_state_t {
     H5F_FS_STATE_CLOSED = 0,                /* Free space manager is closed */
@@ -783,6 +796,7 @@ H5_DLL hbool_t H5F_get_evict_on_close(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double H5F_rdcc_w0(const H5F_t *f);
+H5_DLL H5F_rdcc_budget_t *H5F_rdcc_budget(const H5F_t *f);
 H5_DLL size_t H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned H5F_gc_ref(const H5F_t *f);
 H5_DLL hbool_t H5F_store_msg_crt_idx(const H5F_t *f);
@@ -821,6 +835,13 @@ H5_DLL herr_t H5F_shared_block_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t
 H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL hbool_t H5F_shared_has_vector_io(const H5F_shared_t *f_sh);
+H5_DLL herr_t H5F_shared_vector_read(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/);
+H5_DLL herr_t H5F_shared_vector_write(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+H5_DLL herr_t H5F_shared_vector_read_unlocked(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[]/*out*/);
+#endif /* defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS) */
+H5_DLL herr_t H5F_shared_map_raw(H5F_shared_t *f_sh, haddr_t addr, hsize_t size, const void **ptr);
 
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
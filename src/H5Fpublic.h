@@ -233,6 +233,7 @@ H5_DLL hid_t  H5Fopen(const char *filename, unsigned flags,
                 hid_t access_plist);
 H5_DLL hid_t  H5Freopen(hid_t file_id);
 H5_DLL herr_t H5Fflush(hid_t object_id, H5F_scope_t scope);
+H5_DLL herr_t H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id);
 H5_DLL herr_t H5Fclose(hid_t file_id);
 H5_DLL herr_t H5Fdelete(const char *filename, hid_t fapl_id);
 H5_DLL hid_t  H5Fget_create_plist(hid_t file_id);
@@ -254,6 +255,8 @@ H5_DLL herr_t H5Fget_mdc_config(hid_t file_id,
 H5_DLL herr_t H5Fset_mdc_config(hid_t file_id,
                 H5AC_cache_config_t * config_ptr);
 H5_DLL herr_t H5Fget_mdc_hit_rate(hid_t file_id, double * hit_rate_ptr);
+H5_DLL herr_t H5Fget_mdc_hit_rate_by_type(hid_t file_id, H5F_mem_t type,
+    double *hit_rate_ptr, hsize_t *hits_ptr, hsize_t *misses_ptr);
 H5_DLL herr_t H5Fget_mdc_size(hid_t file_id,
                               size_t * max_size_ptr,
                               size_t * min_clean_size_ptr,
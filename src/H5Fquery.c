@@ -676,6 +676,28 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_rdcc_budget
+ *
+ * Purpose:  Retrieve the file-wide budget of the raw data chunk caches
+ *           of the datasets open in the file.
+ *
+ * Return:   Pointer to the budget (can't fail)
+ *-------------------------------------------------------------------------
+ */
+H5F_rdcc_budget_t *
+H5F_rdcc_budget(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(&f->shared->rdcc_budget)
+} /* end H5F_rdcc_budget() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
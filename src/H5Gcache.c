@@ -90,7 +90,7 @@ const H5AC_class_t H5AC_SNODE[1] = {{
     H5AC_SNODE_ID,                      /* Metadata client ID */
     "Symbol table node",                /* Metadata client name (for debugging) */
     H5FD_MEM_BTREE,                     /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_CONCURRENT_SERIALIZE_FLAG, /* Client class behavior flags */
     H5G__cache_node_get_initial_load_size,      /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     NULL,				/* 'verify_chksum' callback */
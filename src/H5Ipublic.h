@@ -48,6 +48,7 @@ typedef enum H5I_type_t {
     H5I_ERROR_MSG,              /* type ID for error messages                   */
     H5I_ERROR_STACK,            /* type ID for error stacks                     */
     H5I_SPACE_SEL_ITER,         /* type ID for dataspace selection iterator     */
+    H5I_EVENTSET,               /* type ID for event sets                       */
     H5I_NTYPES                  /* number of library types, MUST BE LAST!       */
 } H5I_type_t;
 
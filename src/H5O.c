@@ -33,9 +33,11 @@
 #include "H5private.h"          /* Generic Functions                        */
 #include "H5CXprivate.h"        /* API Contexts                             */
 #include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESprivate.h"        /* Event Sets                               */
 #include "H5Fprivate.h"         /* File access                              */
 #include "H5Iprivate.h"         /* IDs                                      */
 #include "H5Lprivate.h"         /* Links                                    */
+#include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Opkg.h"             /* Object headers                           */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -60,6 +62,10 @@
 /* Local Prototypes */
 /********************/
 
+/* Callbacks for closes inserted into event sets */
+static herr_t H5O__async_close_op(void *_obj_id, void **req);
+static herr_t H5O__async_close_free(void *_obj_id);
+
 
 /*********************/
 /* Package Variables */
@@ -1252,6 +1258,7 @@ H5Oclose(hid_t object_id)
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
         case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_CANTRELEASE, FAIL, "not a valid file object ID (dataset, group, or datatype)")
@@ -1262,6 +1269,117 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Oclose() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__async_close_op
+ *
+ * Purpose:     Performs a close inserted into an event set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__async_close_op(void *_obj_id, void H5_ATTR_UNUSED **req)
+{
+    hid_t        obj_id = *(const hid_t *)_obj_id;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Closing an ID can't be handed to the VOL connector as a request */
+    if(H5I_dec_app_ref(obj_id) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "unable to close object")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__async_close_op() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__async_close_free
+ *
+ * Purpose:     Releases a close inserted into an event set.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__async_close_free(void *_obj_id)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5MM_xfree(_obj_id);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__async_close_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Oclose_async
+ *
+ * Purpose:     Asynchronous version of H5Oclose: the close is inserted
+ *              into the event set ES_ID, after any operations already
+ *              inserted on the object, and this call returns without
+ *              waiting for it.  OBJECT_ID must not be used afterwards.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Oclose_async(hid_t object_id, hid_t es_id)
+{
+    hid_t       *obj_id_ptr = NULL;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ii", object_id, es_id);
+
+    /* Check arguments */
+    switch(H5I_get_type(object_id)) {
+        case H5I_GROUP:
+        case H5I_DATATYPE:
+        case H5I_DATASET:
+        case H5I_MAP:
+            if(H5I_object(object_id) == NULL)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a valid object")
+            break;
+
+        case H5I_UNINIT:
+        case H5I_BADID:
+        case H5I_FILE:
+        case H5I_DATASPACE:
+        case H5I_ATTR:
+        case H5I_VFL:
+        case H5I_VOL:
+        case H5I_GENPROP_CLS:
+        case H5I_GENPROP_LST:
+        case H5I_ERROR_CLASS:
+        case H5I_ERROR_MSG:
+        case H5I_ERROR_STACK:
+        case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
+        case H5I_NTYPES:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_CANTRELEASE, FAIL, "not a valid file object ID (dataset, group, or datatype)")
+        break;
+    } /* end switch */
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set")
+
+    /* Insert the close */
+    if(NULL == (obj_id_ptr = (hid_t *)H5MM_malloc(sizeof(hid_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate close info")
+    *obj_id_ptr = object_id;
+    if(H5ES_insert(es_id, NULL, H5O__async_close_op, H5O__async_close_free, obj_id_ptr) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "can't insert close into event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Oclose_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_disable_mdc_flushes
@@ -215,6 +215,7 @@ H5_DLL herr_t H5Ovisit_by_name3(hid_t loc_id, const char *obj_name,
     H5_index_t idx_type, H5_iter_order_t order, H5O_iterate2_t op,
     void *op_data, unsigned fields, hid_t lapl_id);
 H5_DLL herr_t H5Oclose(hid_t object_id);
+H5_DLL herr_t H5Oclose_async(hid_t object_id, hid_t es_id);
 H5_DLL herr_t H5Oflush(hid_t obj_id);
 H5_DLL herr_t H5Orefresh(hid_t oid);
 H5_DLL herr_t H5Odisable_mdc_flushes(hid_t object_id);
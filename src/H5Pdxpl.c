@@ -138,6 +138,16 @@
 /* Definitions for filter callback function property */
 #define H5D_XFER_FILTER_CB_SIZE     sizeof(H5Z_cb_t)
 #define H5D_XFER_FILTER_CB_DEF      {NULL,NULL}
+/* Definitions for filter pipeline thread count property */
+#define H5D_XFER_FILTER_NTHREADS_SIZE   sizeof(unsigned)
+#define H5D_XFER_FILTER_NTHREADS_DEF    1
+#define H5D_XFER_FILTER_NTHREADS_ENC    H5P__encode_unsigned
+#define H5D_XFER_FILTER_NTHREADS_DEC    H5P__decode_unsigned
+/* Definitions for chunk read merge gap property */
+#define H5D_XFER_CHUNK_READ_GAP_SIZE    sizeof(size_t)
+#define H5D_XFER_CHUNK_READ_GAP_DEF     4096
+#define H5D_XFER_CHUNK_READ_GAP_ENC     H5P__encode_size_t
+#define H5D_XFER_CHUNK_READ_GAP_DEC     H5P__decode_size_t
 /* Definitions for type conversion callback function property */
 #define H5D_XFER_CONV_CB_SIZE       sizeof(H5T_conv_cb_t)
 #define H5D_XFER_CONV_CB_DEF        {NULL,NULL}
@@ -248,6 +258,8 @@ static const H5D_mpio_actual_io_mode_t H5D_def_mpio_actual_io_mode_g = H5D_MPIO_
 static const H5D_mpio_no_collective_cause_t H5D_def_mpio_no_collective_cause_g = H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF;
 static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;            /* Default value for EDC property */
 static const H5Z_cb_t H5D_def_filter_cb_g = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
+static const unsigned H5D_def_filter_nthreads_g = H5D_XFER_FILTER_NTHREADS_DEF; /* Default value for filter pipeline thread count */
+static const size_t H5D_def_chunk_read_gap_g = H5D_XFER_CHUNK_READ_GAP_DEF; /* Default value for chunk read merge gap */
 static const H5T_conv_cb_t H5D_def_conv_cb_g = H5D_XFER_CONV_CB_DEF;       /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF;          /* Default value for data transform */
 
@@ -388,6 +400,18 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the filter pipeline thread count property */
+    if(H5P__register_real(pclass, H5D_XFER_FILTER_NTHREADS_NAME, H5D_XFER_FILTER_NTHREADS_SIZE, &H5D_def_filter_nthreads_g,
+            NULL, NULL, NULL, H5D_XFER_FILTER_NTHREADS_ENC, H5D_XFER_FILTER_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the chunk read merge gap property */
+    if(H5P__register_real(pclass, H5D_XFER_CHUNK_READ_GAP_NAME, H5D_XFER_CHUNK_READ_GAP_SIZE, &H5D_def_chunk_read_gap_g,
+            NULL, NULL, NULL, H5D_XFER_CHUNK_READ_GAP_ENC, H5D_XFER_CHUNK_READ_GAP_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the type conversion callback property */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if(H5P__register_real(pclass, H5D_XFER_CONV_CB_NAME, H5D_XFER_CONV_CB_SIZE, &H5D_def_conv_cb_g,
@@ -1726,6 +1750,157 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_nthreads
+ *
+ * Purpose:	Given a dataset transfer property list, set the number of
+ *              threads used to run the I/O filter pipeline on chunks read
+ *              from a filtered (e.g. compressed) chunked dataset.  The
+ *              compressed bytes for a batch of chunks are read from the
+ *              file in address order and are then decoded concurrently,
+ *              before the data is scattered into the application's buffer.
+ *
+ *              A value of 1 (the default) decodes chunks serially on the
+ *              calling thread.  Concurrent decoding is only performed in
+ *              thread-safe builds of the library and only when every filter
+ *              in the dataset's pipeline is a library-internal filter known
+ *              to be reentrant and no filter callback is set; otherwise
+ *              the value is ignored.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_nthreads
+ *
+ * Purpose:	Reads the value previously set with H5Pset_filter_nthreads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_read_gap
+ *
+ * Purpose:	Given a dataset transfer property list, set the largest gap,
+ *              in bytes, between two unfiltered chunks in the file that are
+ *              still read with a single request.  When a read selects whole
+ *              chunks of an unfiltered chunked dataset, the chunks are
+ *              sorted by file address and chunks that are contiguous, or
+ *              separated by no more than GAP bytes, are read together; the
+ *              bytes in the gaps are read and discarded.
+ *
+ *              A value of 0 only merges chunks that are exactly adjacent
+ *              in the file.  The default is 4096 bytes.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_read_gap(hid_t plist_id, size_t gap)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, gap);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_CHUNK_READ_GAP_NAME, &gap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_read_gap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_read_gap
+ *
+ * Purpose:	Reads the value previously set with H5Pset_chunk_read_gap().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_read_gap(hid_t plist_id, size_t *gap/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, gap);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(gap)
+        if(H5P_get(plist, H5D_XFER_CHUNK_READ_GAP_NAME, gap) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_read_gap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__dxfr_io_xfer_mode_enc
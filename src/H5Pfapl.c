@@ -63,6 +63,11 @@
 #define H5F_ACS_META_CACHE_INIT_CONFIG_ENC    H5P__facc_cache_config_enc
 #define H5F_ACS_META_CACHE_INIT_CONFIG_DEC    H5P__facc_cache_config_dec
 #define H5F_ACS_META_CACHE_INIT_CONFIG_CMP      H5P__facc_cache_config_cmp
+/* Definitions for the # of threads serializing metadata cache entries on flush */
+#define H5F_ACS_META_CACHE_FLUSH_NTHREADS_SIZE  sizeof(unsigned)
+#define H5F_ACS_META_CACHE_FLUSH_NTHREADS_DEF   1
+#define H5F_ACS_META_CACHE_FLUSH_NTHREADS_ENC   H5P__encode_unsigned
+#define H5F_ACS_META_CACHE_FLUSH_NTHREADS_DEC   H5P__decode_unsigned
 /* Definitions for size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_SIZE       sizeof(size_t)
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_DEF        521
@@ -78,6 +83,11 @@
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF         0.75f
 #define H5F_ACS_PREEMPT_READ_CHUNKS_ENC         H5P__encode_double
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEC         H5P__decode_double
+/* Definition for the file-wide budget of the raw data chunk caches */
+#define H5F_ACS_DATA_CACHE_BUDGET_SIZE          sizeof(size_t)
+#define H5F_ACS_DATA_CACHE_BUDGET_DEF           0
+#define H5F_ACS_DATA_CACHE_BUDGET_ENC           H5P__encode_size_t
+#define H5F_ACS_DATA_CACHE_BUDGET_DEC           H5P__decode_size_t
 /* Definition for threshold for alignment */
 #define H5F_ACS_ALIGN_THRHD_SIZE                sizeof(hsize_t)
 #define H5F_ACS_ALIGN_THRHD_DEF                 H5F_ALIGN_THRHD_DEF
@@ -406,9 +416,11 @@ const H5P_libclass_t H5P_CLS_FACC[1] = {{
 
 /* Property value defaults */
 static const H5AC_cache_config_t H5F_def_mdc_initCacheCfg_g = H5F_ACS_META_CACHE_INIT_CONFIG_DEF;  /* Default metadata cache settings */
+static const unsigned H5F_def_mdc_flush_nthreads_g = H5F_ACS_META_CACHE_FLUSH_NTHREADS_DEF;    /* Default # of metadata cache flush threads */
 static const size_t H5F_def_rdcc_nslots_g = H5F_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
 static const size_t H5F_def_rdcc_nbytes_g = H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
 static const double H5F_def_rdcc_w0_g = H5F_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+static const size_t H5F_def_rdcc_budget_g = H5F_ACS_DATA_CACHE_BUDGET_DEF;         /* Default file-wide raw data chunk cache budget */
 static const hsize_t H5F_def_threshold_g = H5F_ACS_ALIGN_THRHD_DEF;                /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF;                      /* Default allocation alignment value */
 static const hsize_t H5F_def_meta_block_size_g = H5F_ACS_META_BLOCK_SIZE_DEF;      /* Default metadata allocation block size */
@@ -475,6 +487,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, H5F_ACS_META_CACHE_INIT_CONFIG_CMP, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the # of threads serializing metadata cache entries on flush */
+    if(H5P__register_real(pclass, H5F_ACS_META_CACHE_FLUSH_NTHREADS_NAME, H5F_ACS_META_CACHE_FLUSH_NTHREADS_SIZE, &H5F_def_mdc_flush_nthreads_g,
+            NULL, NULL, NULL, H5F_ACS_META_CACHE_FLUSH_NTHREADS_ENC, H5F_ACS_META_CACHE_FLUSH_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the size of raw data chunk cache (elements) */
     if(H5P__register_real(pclass, H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME, H5F_ACS_DATA_CACHE_NUM_SLOTS_SIZE, &H5F_def_rdcc_nslots_g,
             NULL, NULL, NULL, H5F_ACS_DATA_CACHE_NUM_SLOTS_ENC, H5F_ACS_DATA_CACHE_NUM_SLOTS_DEC,
@@ -493,6 +511,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the file-wide budget of the raw data chunk caches */
+    if(H5P__register_real(pclass, H5F_ACS_DATA_CACHE_BUDGET_NAME, H5F_ACS_DATA_CACHE_BUDGET_SIZE, &H5F_def_rdcc_budget_g,
+            NULL, NULL, NULL, H5F_ACS_DATA_CACHE_BUDGET_ENC, H5F_ACS_DATA_CACHE_BUDGET_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if(H5P__register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &H5F_def_threshold_g,
             NULL, NULL, NULL, H5F_ACS_ALIGN_THRHD_ENC, H5F_ACS_ALIGN_THRHD_DEC,
@@ -1681,6 +1705,75 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_cache_budget
+ *
+ * Purpose:     Sets a limit on the bytes of raw data cached by the chunk
+ *              caches of all datasets open in a file.  When a dataset
+ *              needs room in its chunk cache beyond the limit, clean
+ *              chunks are first preempted from the datasets used least
+ *              recently.  Each dataset's cache is still bounded by its
+ *              own RDCC_NBYTES value.
+ *
+ *              A value of zero (the default) sets no file-wide limit.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_budget(hid_t fapl_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_DATA_CACHE_BUDGET_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache budget")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_budget() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_cache_budget
+ *
+ * Purpose:     Retrieves the file-wide limit on the raw data chunk caches
+ *              set with H5Pset_chunk_cache_budget.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_budget(hid_t fapl_id, size_t *nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(nbytes)
+        if(H5P_get(plist, H5F_ACS_DATA_CACHE_BUDGET_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache budget")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_budget() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_image_config
@@ -1794,6 +1887,7 @@ herr_t
 H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
 {
     H5P_genplist_t *plist;      /* Property list pointer */
+    H5AC_cache_config_t config; /* Current version of the configuration */
     herr_t ret_value = SUCCEED;   /* return value */
 
     FUNC_ENTER_API(FAIL)
@@ -1803,17 +1897,16 @@ H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
     if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
         HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
 
+    /* translate older versions of the structure to the current one */
+    if(H5AC_upgrade_config(config_ptr, &config) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown metadata cache configuration version")
+
     /* validate the new configuration */
-    if(H5AC_validate_config(config_ptr) < 0)
+    if(H5AC_validate_config(&config) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid metadata cache configuration")
 
     /* set the modified config */
-
-    /* If we ever support multiple versions of H5AC_cache_config_t, we
-     * will have to test the version and do translation here.
-     */
-
-    if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, config_ptr) < 0)
+    if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, &config) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache initial config")
 
 done:
@@ -1842,6 +1935,7 @@ herr_t
 H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
 {
     H5P_genplist_t *plist;      /* Property list pointer */
+    H5AC_cache_config_t config; /* Current version of the configuration */
     herr_t ret_value = SUCCEED;   /* return value */
 
     FUNC_ENTER_API(FAIL)
@@ -1855,22 +1949,102 @@ H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
     if(config_ptr == NULL)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL config_ptr on entry.")
 
-    if(config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION)
+    if((config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION) &&
+            (config_ptr->version != H5AC__CACHE_CONFIG_VERSION_1))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown config version.")
 
-    /* If we ever support multiple versions of H5AC_cache_config_t, we
-     * will have to get the canonical version here, and then translate
-     * to the version of the structure supplied.
-     */
-
     /* Get the current initial metadata cache resize configuration */
-    if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, config_ptr) < 0)
+    if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, &config) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache initial resize config")
 
+    /* translate to the version of the structure supplied */
+    if(H5AC_downgrade_config(&config, config_ptr) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't translate metadata cache initial resize config")
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_mdc_config() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_flush_nthreads
+ *
+ * Purpose:     Sets the number of threads (including the calling thread)
+ *              that serialize dirty metadata cache entries when the cache
+ *              is flushed, e.g. by H5Fflush or H5Fclose.  Entries are
+ *              serialized in waves that respect their flush dependencies,
+ *              and the images are then written in file address order,
+ *              with adjacent images merged into larger writes.
+ *
+ *              A value of 1 (the default) serializes all entries on the
+ *              calling thread.  Entries are only serialized concurrently
+ *              in thread-safe builds of the library, and only for the
+ *              kinds of metadata whose encoding touches no other entry
+ *              (B-tree nodes, symbol table nodes, and extensible and
+ *              fixed array data blocks).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_flush_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_META_CACHE_FLUSH_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache flush threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_mdc_flush_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_flush_nthreads
+ *
+ * Purpose:     Retrieves the number of threads set with
+ *              H5Pset_mdc_flush_nthreads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_flush_nthreads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(nthreads)
+        if(H5P_get(plist, H5F_ACS_META_CACHE_FLUSH_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata cache flush threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_mdc_flush_nthreads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_gc_references
@@ -3475,6 +3649,9 @@ H5P__facc_cache_config_cmp(const void *_config1, const void *_config2, size_t H5
     if(config1->metadata_write_strategy < config2->metadata_write_strategy) HGOTO_DONE(-1);
     if(config1->metadata_write_strategy > config2->metadata_write_strategy) HGOTO_DONE(1);
 
+    if(config1->repl_policy < config2->repl_policy) HGOTO_DONE(-1);
+    if(config1->repl_policy > config2->repl_policy) HGOTO_DONE(1);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_cmp() */
@@ -3602,6 +3779,9 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
 
         /* int */
         INT32ENCODE(*pp, (int32_t)config->metadata_write_strategy);
+
+        /* enum */
+        *(*pp)++ = (uint8_t)config->repl_policy;
     } /* end if */
 
     /* Compute encoded size of variably-encoded values */
@@ -3617,7 +3797,7 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
     *size += 1 + H5VM_limit_enc_size(enc_value);
 
     /* Compute encoded size of fixed-size values */
-    *size += (5 + (sizeof(unsigned) * 8) + (sizeof(double) * 8) +
+    *size += (6 + (sizeof(unsigned) * 8) + (sizeof(double) * 8) +
             (sizeof(int32_t) * 4) + sizeof(int64_t) +
             H5AC__MAX_TRACE_FILE_NAME_LEN + 1);
 
@@ -3755,6 +3935,15 @@ H5P__facc_cache_config_dec(const void **_pp, void *_value)
     /* int */
     INT32DECODE(*pp, config->metadata_write_strategy);
 
+    /* Version 1 encodings end here, and are upgraded to the current
+     * version of the structure with the LRU replacement policy.
+     */
+    if(config->version == H5AC__CACHE_CONFIG_VERSION_1)
+        config->version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    else
+        /* enum */
+        config->repl_policy = (enum H5C_cache_repl_policy)*(*pp)++;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_dec() */
@@ -30,11 +30,14 @@
 #ifdef H5_HAVE_PARALLEL
 #include "H5ACprivate.h"        /* Metadata cache                       */
 #endif /* H5_HAVE_PARALLEL */
+#include "H5Dprivate.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
 #include "H5FLprivate.h"	/* Free lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5Lprivate.h"		/* Links		  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Oprivate.h"		/* Object headers		  	*/
 #include "H5Ppkg.h"		/* Property lists		  	*/
 
 
@@ -113,6 +116,8 @@ static herr_t H5P__free_prop(H5P_genprop_t *prop);
 static int H5P__cmp_prop(const H5P_genprop_t *prop1, const H5P_genprop_t *prop2);
 static herr_t H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op,
     H5P_do_pclass_op_t pclass_op, void *udata);
+static herr_t H5P__do_prop_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot,
+    H5P_do_plist_op_t plist_op, H5P_do_pclass_op_t pclass_op, void *udata);
 static int H5P__open_class_path_cb(void *_obj, hid_t H5_ATTR_UNUSED id, void *_key);
 static H5P_genprop_t *H5P__find_prop_pclass(H5P_genclass_t *pclass, const char *name);
 static herr_t H5P__free_prop_cb(void *item, void H5_ATTR_UNUSED *key, void *op_data);
@@ -361,6 +366,44 @@ H5_DLLVAR const H5P_libclass_t H5P_CLS_ACRT[1];         /* Attribute creation */
 static unsigned H5P_next_rev = 0;
 #define H5P_GET_NEXT_REV        (H5P_next_rev++)
 
+/* Names of the properties with a slot, indexed by H5P_prop_slot_t */
+static const char * const H5P_slot_name_g[H5P_NSLOTS] = {
+    NULL,                                       /* H5P_SLOT_NONE */
+    H5D_XFER_BTREE_SPLIT_RATIO_NAME,
+    H5D_XFER_MAX_TEMP_BUF_NAME,
+    H5D_XFER_TCONV_BUF_NAME,
+    H5D_XFER_BKGR_BUF_NAME,
+    H5D_XFER_BKGR_BUF_TYPE_NAME,
+    H5D_XFER_HYPER_VECTOR_SIZE_NAME,
+    H5D_XFER_IO_XFER_MODE_NAME,
+    H5D_XFER_MPIO_COLLECTIVE_OPT_NAME,
+    H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME,
+    H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME,
+    H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME,
+    H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME,
+    H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME,
+    H5D_XFER_EDC_NAME,
+    H5D_XFER_FILTER_CB_NAME,
+    H5D_XFER_FILTER_NTHREADS_NAME,
+    H5D_XFER_CHUNK_READ_GAP_NAME,
+    H5D_XFER_XFORM_NAME,
+    H5D_XFER_VLEN_ALLOC_NAME,
+    H5D_XFER_VLEN_ALLOC_INFO_NAME,
+    H5D_XFER_VLEN_FREE_NAME,
+    H5D_XFER_VLEN_FREE_INFO_NAME,
+    H5D_XFER_CONV_CB_NAME,
+    H5P_STRCRT_CHAR_ENCODING_NAME,
+    H5L_CRT_INTERMEDIATE_GROUP_NAME,
+    H5L_ACS_NLINKS_NAME,
+    H5F_ACS_LIBVER_LOW_BOUND_NAME,
+    H5F_ACS_LIBVER_HIGH_BOUND_NAME,
+    H5_COLL_MD_READ_FLAG_NAME,
+    H5D_CRT_MIN_DSET_HDR_SIZE_NAME,
+    H5O_CRT_OHDR_FLAGS_NAME,
+    H5D_ACS_EFILE_PREFIX_NAME,
+    H5D_ACS_VDS_PREFIX_NAME
+};
+
 /* List of all property list classes in the library */
 /* (order here is not important, they will be initialized in the proper
  *      order according to their parent class dependencies)
@@ -669,8 +712,9 @@ H5P_term_package(void)
     Internal routine to call a property list callback routine and update
     the property list accordingly.
  USAGE
-    herr_t H5P__do_prop_cb1(slist,prop,cb)
+    herr_t H5P__do_prop_cb1(slist,slots,prop,cb)
         H5SL_t *slist;          IN/OUT: Skip list to hold changed properties
+        H5P_genprop_t **slots;  IN/OUT: Slot array of the property list
         H5P_genprop_t *prop;    IN: Property to call callback for
         H5P_prp_cb1_t *cb;      IN: Callback routine to call
  RETURNS
@@ -685,7 +729,8 @@ H5P_term_package(void)
  REVISION LOG
 --------------------------------------------------------------------------*/
 static herr_t
-H5P__do_prop_cb1(H5SL_t *slist, H5P_genprop_t *prop, H5P_prp_cb1_t cb)
+H5P__do_prop_cb1(H5SL_t *slist, H5P_genprop_t **slots, H5P_genprop_t *prop,
+    H5P_prp_cb1_t cb)
 {
     void *tmp_value = NULL;         /* Temporary value buffer */
     H5P_genprop_t *pcopy = NULL;    /* Copy of property to insert into skip list */
@@ -716,7 +761,7 @@ H5P__do_prop_cb1(H5SL_t *slist, H5P_genprop_t *prop, H5P_prp_cb1_t cb)
     H5MM_memcpy(pcopy->value, tmp_value, prop->size);
 
     /* Insert the changed property into the property list */
-    if(H5P__add_prop(slist, pcopy) < 0)
+    if(H5P__add_prop(slist, slots, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "Can't insert property into skip list")
 
 done:
@@ -784,7 +829,7 @@ H5P__copy_pclass(H5P_genclass_t *pclass)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL,"Can't copy property")
 
             /* Insert the initialized property into the property list */
-            if(H5P__add_prop(new_pclass->props,pcopy) < 0)
+            if(H5P__add_prop(new_pclass->props, new_pclass->slots, pcopy) < 0)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, NULL,"Can't insert property into class")
 
             /* Increment property count for class */
@@ -919,7 +964,7 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
             } /* end if */
 
             /* Insert the initialized property into the property list */
-            if(H5P__add_prop(new_plist->props,new_prop) < 0) {
+            if(H5P__add_prop(new_plist->props, new_plist->slots, new_prop) < 0) {
                 H5P__free_prop(new_prop);
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, H5I_INVALID_HID, "Can't insert property into list")
             } /* end if */
@@ -956,7 +1001,7 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
                     /* Call property copy callback, if it exists */
                     if(tmp->copy) {
                         /* Call the callback & insert changed value into skip list (if necessary) */
-                        if(H5P__do_prop_cb1(new_plist->props, tmp, tmp->copy) < 0)
+                        if(H5P__do_prop_cb1(new_plist->props, new_plist->slots, tmp, tmp->copy) < 0)
                             HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, H5I_INVALID_HID, "Can't create property")
                     } /* end if */
 
@@ -1166,6 +1211,7 @@ H5P__create_prop(const char *name, size_t size, H5P_prop_within_t type,
     H5P_prp_close_func_t prp_close)
 {
     H5P_genprop_t *prop = NULL;      /* Pointer to new property copied */
+    unsigned u;                      /* Local index variable */
     H5P_genprop_t *ret_value = NULL; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -1184,6 +1230,14 @@ H5P__create_prop(const char *name, size_t size, H5P_prop_within_t type,
     prop->size = size;
     prop->type = type;
 
+    /* Look up the property's slot, if it has one */
+    prop->slot = H5P_SLOT_NONE;
+    for(u = 1; u < H5P_NSLOTS; u++)
+        if(!HDstrcmp(name, H5P_slot_name_g[u])) {
+            prop->slot = (H5P_prop_slot_t)u;
+            break;
+        } /* end if */
+
     /* Duplicate value, if it exists */
     if(value != NULL) {
         if(NULL == (prop->value = H5MM_malloc (prop->size)))
@@ -1233,26 +1287,30 @@ done:
  PURPOSE
     Internal routine to insert a property into a property skip list
  USAGE
-    herr_t H5P__add_prop(slist, prop)
+    herr_t H5P__add_prop(slist, slots, prop)
         H5SL_t *slist;          IN/OUT: Pointer to skip list of properties
+        H5P_genprop_t **slots;  IN/OUT: Slot array of the list or class
         H5P_genprop_t *prop;    IN: Pointer to property to insert
  RETURNS
     Returns non-negative on success, negative on failure.
  DESCRIPTION
-    Inserts a property into a skip list of properties.
+    Inserts a property into a skip list of properties, and records it in
+    the slot array of the property list or class owning the skip list if
+    the property has a slot.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
 herr_t
-H5P__add_prop(H5SL_t *slist, H5P_genprop_t *prop)
+H5P__add_prop(H5SL_t *slist, H5P_genprop_t **slots, H5P_genprop_t *prop)
 {
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_PACKAGE
 
     HDassert(slist);
+    HDassert(slots);
     HDassert(prop);
     HDassert(prop->type != H5P_PROP_WITHIN_UNKNOWN);
 
@@ -1260,6 +1318,10 @@ H5P__add_prop(H5SL_t *slist, H5P_genprop_t *prop)
     if(H5SL_insert(slist, prop, prop->name) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into skip list")
 
+    /* Record the property in its slot */
+    if(prop->slot != H5P_SLOT_NONE)
+        slots[prop->slot] = prop;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5P__add_prop() */
@@ -1809,7 +1871,7 @@ H5P__create(H5P_genclass_t *pclass)
                     /* Call property creation callback, if it exists */
                     if(tmp->create) {
                         /* Call the callback & insert changed value into skip list (if necessary) */
-                        if(H5P__do_prop_cb1(plist->props, tmp, tmp->create) < 0)
+                        if(H5P__do_prop_cb1(plist->props, plist->slots, tmp, tmp->create) < 0)
                             HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL,"Can't create property")
                     } /* end if */
 
@@ -2156,7 +2218,7 @@ H5P__register_real(H5P_genclass_t *pclass, const char *name, size_t size,
         HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL,"Can't create property")
 
     /* Insert property into property list class */
-    if(H5P__add_prop(pclass->props, new_prop) < 0)
+    if(H5P__add_prop(pclass->props, pclass->slots, new_prop) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into class")
 
     /* Increment property count for class */
@@ -2400,7 +2462,7 @@ H5P__register(H5P_genclass_t **ppclass, const char *name, size_t size,
                     HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL, "Can't copy property")
 
                 /* Insert the initialized property into the property class */
-                if(H5P__add_prop(new_class->props, pcopy) < 0)
+                if(H5P__add_prop(new_class->props, new_class->slots, pcopy) < 0)
                     HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into class")
 
                 /* Increment property count for class */
@@ -2659,7 +2721,7 @@ H5P_insert(H5P_genplist_t *plist, const char *name, size_t size,
         HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL, "Can't create property")
 
     /* Insert property into property list class */
-    if(H5P__add_prop(plist->props, new_prop) < 0)
+    if(H5P__add_prop(plist->props, plist->slots, new_prop) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "Can't insert property into class")
 
     /* Increment property count for class */
@@ -2757,6 +2819,86 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5P__do_prop() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__do_prop_slot
+ PURPOSE
+    Internal routine to perform an operation on a property with a slot in
+    a property list
+ USAGE
+    herr_t H5P__do_prop_slot(plist, slot, plist_op, pclass_op, udata)
+        H5P_genplist_t *plist;  IN: Property list to find property in
+        H5P_prop_slot_t slot;   IN: Slot of property
+        H5P_do_plist_op_t plist_op;  IN: Pointer to the callback to invoke when the
+                                    property is found in the property list
+        H5P_do_pclass_op_t pclass_op; IN: Pointer to the callback to invoke when the
+                                    property is found in the property class
+        void *udata;            IN: Pointer to the user data for the callback
+ RETURNS
+    Returns non-negative on success, negative on failure.
+ DESCRIPTION
+        Same as H5P__do_prop, but finds the property through the slot arrays
+    of the property list and its classes instead of searching their skip
+    lists by name.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+        Property lists with deleted properties go through H5P__do_prop, as
+    do properties that can't be found in any slot (to report the error).
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5P__do_prop_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot,
+    H5P_do_plist_op_t plist_op, H5P_do_pclass_op_t pclass_op, void *udata)
+{
+    H5P_genclass_t *tclass;     /* Temporary class pointer */
+    H5P_genprop_t *prop;        /* Temporary property pointer */
+    const char *name;           /* Name of property */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(plist);
+    HDassert(slot > H5P_SLOT_NONE && slot < H5P_NSLOTS);
+    HDassert(plist_op);
+    HDassert(pclass_op);
+
+    name = H5P_slot_name_g[slot];
+
+    /* Find property in changed list */
+    if(NULL != (prop = plist->slots[slot])) {
+        /* Call the 'found in property list' callback */
+        if((*plist_op)(plist, name, prop, udata) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
+    } /* end if */
+    else {
+        /* Look up the property by name if some were deleted from the list */
+        if(H5SL_count(plist->del) > 0)
+            prop = NULL;
+        else {
+            /* Check the slots of the class (& its parents) */
+            tclass = plist->pclass;
+            while(NULL != tclass && NULL == (prop = tclass->slots[slot]))
+                tclass = tclass->parent;
+        } /* end else */
+
+        if(NULL != prop) {
+            /* Call the 'found in class' callback */
+            if((*pclass_op)(plist, name, prop, udata) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
+        } /* end if */
+        else {
+            if(H5P__do_prop(plist, name, plist_op, pclass_op, udata) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
+        } /* end else */
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P__do_prop_slot() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -2853,7 +2995,7 @@ H5P__poke_pclass_cb(H5P_genplist_t *plist, const char H5_ATTR_NDEBUG_UNUSED *nam
     H5MM_memcpy(pcopy->value, udata->value, pcopy->size);
 
     /* Insert the changed property into the property list */
-    if(H5P__add_prop(plist->props, pcopy) < 0)
+    if(H5P__add_prop(plist->props, plist->slots, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
 
 done:
@@ -3059,7 +3201,7 @@ H5P__set_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     H5MM_memcpy(pcopy->value, prp_value, pcopy->size);
 
     /* Insert the changed property into the property list */
-    if(H5P__add_prop(plist->props, pcopy) < 0)
+    if(H5P__add_prop(plist->props, plist->slots, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
 
 done:
@@ -4467,6 +4609,48 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5P_peek() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P_peek_slot
+ PURPOSE
+    Internal routine to look at the value of a property with a slot in a
+    property list.
+ USAGE
+    herr_t H5P_peek_slot(plist, slot, value)
+        H5P_genplist_t *plist;  IN: Property list to check
+        H5P_prop_slot_t slot;   IN: Slot of property to query
+        void *value;            OUT: Pointer to the buffer for the property value
+ RETURNS
+    Returns non-negative on success, negative on failure.
+ DESCRIPTION
+        Same as H5P_peek, for one of the library's properties with a slot.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5P_peek_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot, void *value)
+{
+    H5P_prop_get_ud_t udata;       /* User data for callback */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(plist);
+    HDassert(value);
+
+    /* Find the property and peek at the value */
+    udata.value = value;
+    if(H5P__do_prop_slot(plist, slot, H5P__peek_cb, H5P__peek_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on plist to peek at value")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5P_peek_slot() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -4586,6 +4770,48 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5P_get() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P_get_slot
+ PURPOSE
+    Internal routine to query the value of a property with a slot in a
+    property list.
+ USAGE
+    herr_t H5P_get_slot(plist, slot, value)
+        H5P_genplist_t *plist;  IN: Property list to check
+        H5P_prop_slot_t slot;   IN: Slot of property to query
+        void *value;            OUT: Pointer to the buffer for the property value
+ RETURNS
+    Returns non-negative on success, negative on failure.
+ DESCRIPTION
+        Same as H5P_get, for one of the library's properties with a slot.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5P_get_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot, void *value)
+{
+    H5P_prop_get_ud_t udata;    /* User data for callback */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(plist);
+    HDassert(value);
+
+    /* Find the property and get the value */
+    udata.value = value;
+    if(H5P__do_prop_slot(plist, slot, H5P__get_cb, H5P__get_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on plist to get value")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P_get_slot() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -4640,6 +4866,8 @@ H5P__del_plist_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     /* Remove the property from the skip list */
     if(NULL == H5SL_remove(plist->props, prop->name))
         HGOTO_ERROR(H5E_PLIST, H5E_CANTDELETE, FAIL, "can't remove property from skip list")
+    if(prop->slot != H5P_SLOT_NONE)
+        plist->slots[prop->slot] = NULL;
 
     /* Free the property, ignoring return value, nothing we can do */
     H5P__free_prop(prop);
@@ -4844,7 +5072,7 @@ H5P__copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
         } /* end if */
 
         /* Insert the initialized property into the property list */
-        if(H5P__add_prop(dst_plist->props,new_prop) < 0)
+        if(H5P__add_prop(dst_plist->props, dst_plist->slots, new_prop) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into list")
 
         /* Increment the number of properties in list */
@@ -4868,7 +5096,7 @@ H5P__copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
         } /* end if */
 
         /* Insert property into property list class */
-        if(H5P__add_prop(dst_plist->props, new_prop) < 0)
+        if(H5P__add_prop(dst_plist->props, dst_plist->slots, new_prop) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into class")
 
         /* Increment property count for class */
@@ -5012,6 +5240,8 @@ H5P__unregister(H5P_genclass_t *pclass, const char *name)
     /* Remove the property from the skip list */
     if(H5SL_remove(pclass->props,prop->name) == NULL)
         HGOTO_ERROR(H5E_PLIST,H5E_CANTDELETE,FAIL,"can't remove property from skip list")
+    if(prop->slot != H5P_SLOT_NONE)
+        pclass->slots[prop->slot] = NULL;
 
     /* Free the property, ignoring return value, nothing we can do */
     H5P__free_prop(prop);
@@ -1239,6 +1239,120 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_deflate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lz4
+ *
+ * Purpose:     Sets the compression method for a dataset or group link
+ *              filter pipeline to H5Z_FILTER_LZ4.  A LEVEL of zero picks
+ *              the fast lz4 compressor and levels from one to
+ *              H5Z_LZ4_MAX_LEVEL the slower LZ4HC compressor, which
+ *              compresses better.  DICT, if not NULL, is a dictionary of
+ *              DICT_SIZE bytes (up to H5Z_MAX_DICT_SIZE) which primes the
+ *              compressor for small chunks of similar data; it is stored
+ *              with the filter in the pipeline message, and data written
+ *              with it can only be read by the built-in filter.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lz4(hid_t plist_id, unsigned level, const void *dict, size_t dict_size)
+{
+    H5P_genplist_t  *plist;                 /* Property list */
+    H5O_pline_t     pline;                  /* Filter pipeline */
+    unsigned        cd_values[2];           /* Filter parameters */
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIu*xz", plist_id, level, dict, dict_size);
+
+    /* Check arguments */
+    if(level > H5Z_LZ4_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid lz4 level")
+    if(NULL == dict && dict_size > 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no dictionary")
+    if(dict_size > H5Z_MAX_DICT_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dictionary is too large")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter, with the default block size */
+    cd_values[0] = 0;
+    cd_values[1] = level;
+    if(H5Z_append_dict(&pline, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, (size_t)2, cd_values, dict, dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add lz4 filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lz4() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_zstd
+ *
+ * Purpose:     Sets the compression method for a dataset or group link
+ *              filter pipeline to H5Z_FILTER_ZSTD at compression level
+ *              LEVEL, up to H5Z_ZSTD_MAX_LEVEL.  Negative levels are the
+ *              faster zstd levels and zero is the default level of the
+ *              library.  DICT and DICT_SIZE give an optional dictionary,
+ *              as for H5Pset_lz4.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_zstd(hid_t plist_id, int level, const void *dict, size_t dict_size)
+{
+    H5P_genplist_t  *plist;                 /* Property list */
+    H5O_pline_t     pline;                  /* Filter pipeline */
+    unsigned        cd_value;               /* Filter parameter */
+    herr_t          ret_value = SUCCEED;    /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIs*xz", plist_id, level, dict, dict_size);
+
+    /* Check arguments */
+    if(level > H5Z_ZSTD_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid zstd level")
+    if(NULL == dict && dict_size > 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no dictionary")
+    if(dict_size > H5Z_MAX_DICT_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dictionary is too large")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    cd_value = (unsigned)level;
+    if(H5Z_append_dict(&pline, H5Z_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, (size_t)1, &cd_value, dict, dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_zstd() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fletcher32
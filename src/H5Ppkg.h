@@ -68,6 +68,7 @@ typedef struct H5P_genprop_t {
     void *value;        /* Pointer to property value */
     H5P_prop_within_t type;     /* Type of object the property is within */
     hbool_t shared_name;   /* Whether the name is shared or not */
+    H5P_prop_slot_t slot;  /* Slot of a library property (H5P_SLOT_NONE for others) */
 
     /* Callback function pointers & info */
     H5P_prp_create_func_t create;   /* Function to call when a property is created */
@@ -93,6 +94,7 @@ struct H5P_genclass_t {
     hbool_t    deleted;    /* Whether this class has been deleted and is waiting for dependent classes & proplists to close */
     unsigned   revision;   /* Revision number of a particular class (global) */
     H5SL_t    *props;      /* Skip list containing properties */
+    H5P_genprop_t *slots[H5P_NSLOTS];  /* Properties in 'props' that have a slot, by slot */
 
     /* Callback function pointers & info */
     H5P_cls_create_func_t create_func;  /* Function to call when a property list is created */
@@ -111,6 +113,7 @@ struct H5P_genplist_t {
     hbool_t class_init; /* Whether the class initialization callback finished successfully */
     H5SL_t *del;        /* Skip list containing names of deleted properties */
     H5SL_t *props;      /* Skip list containing properties */
+    H5P_genprop_t *slots[H5P_NSLOTS];   /* Properties in 'props' that have a slot, by slot */
 };
 
 /* Property list/class iterator callback function pointer */
@@ -149,7 +152,7 @@ H5_DLL herr_t H5P__register(H5P_genclass_t **pclass, const char *name, size_t si
     H5P_prp_delete_func_t prp_delete,
     H5P_prp_copy_func_t prp_copy, H5P_prp_compare_func_t prp_cmp,
     H5P_prp_close_func_t prp_close);
-H5_DLL herr_t H5P__add_prop(H5SL_t *props, H5P_genprop_t *prop);
+H5_DLL herr_t H5P__add_prop(H5SL_t *props, H5P_genprop_t **slots, H5P_genprop_t *prop);
 H5_DLL herr_t H5P__access_class(H5P_genclass_t *pclass, H5P_class_mod_t mod);
 H5_DLL herr_t H5P__class_get(const H5P_genclass_t *pclass, const char *name,
     void *value);
@@ -85,6 +85,61 @@ typedef enum H5P_plist_type_t {
     H5P_TYPE_MAX_TYPE
 } H5P_plist_type_t;
 
+/*
+ * Slots for the library properties that are queried on every API call (by
+ * the API context, mostly).  Properties with one of these names are also
+ * kept in a flat array in their property list or class, so that
+ * H5P_get_slot/H5P_peek_slot can find them without searching skip lists by
+ * name.  All other properties (including any registered by applications)
+ * have no slot and are only found by name.
+ */
+typedef enum H5P_prop_slot_t {
+    H5P_SLOT_NONE = 0,                  /* Property without a slot */
+
+    /* Dataset transfer properties */
+    H5P_SLOT_DXFR_BTREE_SPLIT_RATIO,
+    H5P_SLOT_DXFR_MAX_TEMP_BUF,
+    H5P_SLOT_DXFR_TCONV_BUF,
+    H5P_SLOT_DXFR_BKGR_BUF,
+    H5P_SLOT_DXFR_BKGR_BUF_TYPE,
+    H5P_SLOT_DXFR_HYPER_VECTOR_SIZE,
+    H5P_SLOT_DXFR_IO_XFER_MODE,
+    H5P_SLOT_DXFR_MPIO_COLLECTIVE_OPT,
+    H5P_SLOT_DXFR_MPIO_CHUNK_OPT_HARD,
+    H5P_SLOT_DXFR_MPIO_CHUNK_OPT_NUM,
+    H5P_SLOT_DXFR_MPIO_CHUNK_OPT_RATIO,
+    H5P_SLOT_DXFR_MPIO_LOCAL_NO_COLL_CAUSE,
+    H5P_SLOT_DXFR_MPIO_GLOBAL_NO_COLL_CAUSE,
+    H5P_SLOT_DXFR_EDC,
+    H5P_SLOT_DXFR_FILTER_CB,
+    H5P_SLOT_DXFR_FILTER_NTHREADS,
+    H5P_SLOT_DXFR_CHUNK_READ_GAP,
+    H5P_SLOT_DXFR_XFORM,
+    H5P_SLOT_DXFR_VLEN_ALLOC,
+    H5P_SLOT_DXFR_VLEN_ALLOC_INFO,
+    H5P_SLOT_DXFR_VLEN_FREE,
+    H5P_SLOT_DXFR_VLEN_FREE_INFO,
+    H5P_SLOT_DXFR_CONV_CB,
+
+    /* Link creation & access properties */
+    H5P_SLOT_STRCRT_CHAR_ENCODING,
+    H5P_SLOT_LCRT_INTERMEDIATE_GROUP,
+    H5P_SLOT_LACS_NLINKS,
+
+    /* File access properties */
+    H5P_SLOT_FACS_LIBVER_LOW_BOUND,
+    H5P_SLOT_FACS_LIBVER_HIGH_BOUND,
+    H5P_SLOT_COLL_MD_READ_FLAG,
+
+    /* Dataset creation & access properties */
+    H5P_SLOT_DCRT_MIN_DSET_HDR_SIZE,
+    H5P_SLOT_OCRT_OHDR_FLAGS,
+    H5P_SLOT_DACS_EFILE_PREFIX,
+    H5P_SLOT_DACS_VDS_PREFIX,
+
+    H5P_NSLOTS                          /* Number of slots (must be last) */
+} H5P_prop_slot_t;
+
 /* Function pointer for library classes with properties to register */
 typedef herr_t (*H5P_reg_prop_func_t)(H5P_genclass_t *pclass);
 
@@ -168,6 +223,8 @@ H5_DLL herr_t H5P_get(H5P_genplist_t *plist, const char *name, void *value);
 H5_DLL herr_t H5P_set(H5P_genplist_t *plist, const char *name, const void *value);
 H5_DLL herr_t H5P_peek(H5P_genplist_t *plist, const char *name, void *value);
 H5_DLL herr_t H5P_poke(H5P_genplist_t *plist, const char *name, const void *value);
+H5_DLL herr_t H5P_get_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot, void *value);
+H5_DLL herr_t H5P_peek_slot(H5P_genplist_t *plist, H5P_prop_slot_t slot, void *value);
 H5_DLL herr_t H5P_insert(H5P_genplist_t *plist, const char *name, size_t size,
     void *value, H5P_prp_set_func_t prp_set, H5P_prp_get_func_t prp_get,
     H5P_prp_encode_func_t prp_encode, H5P_prp_decode_func_t prp_decode,
@@ -297,6 +297,10 @@ H5_DLL herr_t H5Pget_filter_by_id2(hid_t plist_id, H5Z_filter_t id,
 H5_DLL htri_t H5Pall_filters_avail(hid_t plist_id);
 H5_DLL herr_t H5Premove_filter(hid_t plist_id, H5Z_filter_t filter);
 H5_DLL herr_t H5Pset_deflate(hid_t plist_id, unsigned aggression);
+H5_DLL herr_t H5Pset_lz4(hid_t plist_id, unsigned level, const void *dict,
+       size_t dict_size);
+H5_DLL herr_t H5Pset_zstd(hid_t plist_id, int level, const void *dict,
+       size_t dict_size);
 H5_DLL herr_t H5Pset_fletcher32(hid_t plist_id);
 
 /* File creation property list (FCPL) routines */
@@ -344,10 +348,14 @@ H5_DLL herr_t H5Pget_cache(hid_t plist_id,
        int *mdc_nelmts, /* out */
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/, double *rdcc_w0);
+H5_DLL herr_t H5Pset_chunk_cache_budget(hid_t fapl_id, size_t nbytes);
+H5_DLL herr_t H5Pget_chunk_cache_budget(hid_t fapl_id, size_t *nbytes/*out*/);
 H5_DLL herr_t H5Pset_mdc_config(hid_t    plist_id,
        H5AC_cache_config_t * config_ptr);
 H5_DLL herr_t H5Pget_mdc_config(hid_t     plist_id,
        H5AC_cache_config_t * config_ptr);    /* out */
+H5_DLL herr_t H5Pset_mdc_flush_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_mdc_flush_nthreads(hid_t plist_id, unsigned *nthreads/*out*/);
 H5_DLL herr_t H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
 H5_DLL herr_t H5Pget_gc_references(hid_t fapl_id, unsigned *gc_ref/*out*/);
 H5_DLL herr_t H5Pset_fclose_degree(hid_t fapl_id, H5F_close_degree_t degree);
@@ -441,6 +449,10 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id,
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/,
        double *rdcc_w0/*out*/);
+H5_DLL herr_t H5Pset_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t policy);
+H5_DLL herr_t H5Pget_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t *policy/*out*/);
 H5_DLL herr_t H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
@@ -483,6 +495,10 @@ H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id,
                                        void **free_info);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/);
+H5_DLL herr_t H5Pset_chunk_read_gap(hid_t plist_id, size_t gap);
+H5_DLL herr_t H5Pget_chunk_read_gap(hid_t plist_id, size_t *gap/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void** operate_data);
 #ifdef H5_HAVE_PARALLEL
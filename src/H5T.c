@@ -1311,6 +1311,9 @@ H5T__init_package(void)
     /* Initialize the +/- Infinity values for floating-point types */
     status |= H5T__init_inf();
 
+    /* Pick the vector conversion kernels for this processor */
+    status |= H5T__simd_init();
+
     if(status < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to register conversion function(s)")
 
@@ -1795,6 +1798,7 @@ H5Tcopy(hid_t obj_id)
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
         case H5I_SPACE_SEL_ITER:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "not a datatype or dataset")
@@ -367,6 +367,97 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+#ifndef H5_HAVE_WIN_THREADS
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_release
+ *
+ * USAGE
+ *    H5TS_mutex_release(&mutex_var, &lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Releases a recursive lock held once by the calling thread, setting
+ *    LOCK_COUNT to 1 for passing to H5TS_mutex_acquire() when the thread
+ *    takes the lock back.
+ *
+ *    A lock acquired more than once is held for a call still in progress
+ *    further up the thread's stack (an application callback made during
+ *    an iteration, for example), so it is left held and LOCK_COUNT is set
+ *    to 0, which makes H5TS_mutex_acquire() do nothing.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_release(H5TS_mutex_t *mutex, unsigned int *lock_count)
+{
+    herr_t ret_value = pthread_mutex_lock(&mutex->atomic_lock);
+    int err;
+
+    if(ret_value)
+        return ret_value;
+
+    HDassert(mutex->lock_count && pthread_equal(pthread_self(), mutex->owner_thread));
+    if(mutex->lock_count > 1) {
+        *lock_count = 0;
+        return pthread_mutex_unlock(&mutex->atomic_lock);
+    } /* end if */
+    *lock_count = mutex->lock_count;
+    mutex->lock_count = 0;
+
+    ret_value = pthread_mutex_unlock(&mutex->atomic_lock);
+
+    err = pthread_cond_signal(&mutex->cond_var);
+    if(err != 0)
+        ret_value = err;
+
+    return ret_value;
+} /* H5TS_mutex_release */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_acquire
+ *
+ * USAGE
+ *    H5TS_mutex_acquire(&mutex_var, lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Takes back a recursive lock released with H5TS_mutex_release(),
+ *    as if it had been acquired LOCK_COUNT times (a LOCK_COUNT of 0
+ *    means the lock was never released).
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_acquire(H5TS_mutex_t *mutex, unsigned int lock_count)
+{
+    herr_t ret_value;
+
+    /* Check for the lock not having been released */
+    if(0 == lock_count)
+        return 0;
+
+    if((ret_value = pthread_mutex_lock(&mutex->atomic_lock)))
+        return ret_value;
+
+    /* Wait for any other thread to give up the lock */
+    while(mutex->lock_count)
+        pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
+
+    mutex->owner_thread = pthread_self();
+    mutex->lock_count = lock_count;
+
+    return pthread_mutex_unlock(&mutex->atomic_lock);
+} /* H5TS_mutex_acquire */
+#endif /* H5_HAVE_WIN_THREADS */
+
 
 /*--------------------------------------------------------------------------
  * NAME
@@ -656,6 +656,21 @@
 }
 #endif /* H5_WANT_DCONV_EXCEPTION */
 
+/* Class of each native type, for the vector conversion kernels */
+#define H5T_SIMD_CLASS_SCHAR    H5T_SIMD_SINT
+#define H5T_SIMD_CLASS_UCHAR    H5T_SIMD_UINT
+#define H5T_SIMD_CLASS_SHORT    H5T_SIMD_SINT
+#define H5T_SIMD_CLASS_USHORT   H5T_SIMD_UINT
+#define H5T_SIMD_CLASS_INT      H5T_SIMD_SINT
+#define H5T_SIMD_CLASS_UINT     H5T_SIMD_UINT
+#define H5T_SIMD_CLASS_LONG     H5T_SIMD_SINT
+#define H5T_SIMD_CLASS_ULONG    H5T_SIMD_UINT
+#define H5T_SIMD_CLASS_LLONG    H5T_SIMD_SINT
+#define H5T_SIMD_CLASS_ULLONG   H5T_SIMD_UINT
+#define H5T_SIMD_CLASS_FLOAT    H5T_SIMD_FLOAT
+#define H5T_SIMD_CLASS_DOUBLE   H5T_SIMD_FLOAT
+#define H5T_SIMD_CLASS_LDOUBLE  H5T_SIMD_FLOAT
+
 
 /* The main part of every integer hardware conversion macro */
 #define H5T_CONV(GUTS,STYPE,DTYPE,ST,DT,D_MIN,D_MAX,PREC)  		      \
@@ -731,6 +746,13 @@
 									      \
         H5T_CONV_SET_PREC(PREC)            /*init precision variables, or not */ \
                                                                               \
+        /* Convert packed elements with a vector kernel, when there is no */ \
+        /* exception callback to tell about overflows */                     \
+        if(NULL == cb_struct.func && 0 == buf_stride &&                       \
+                H5T__simd_conv(H5_GLUE(H5T_SIMD_CLASS_, STYPE), sizeof(ST),   \
+                    H5_GLUE(H5T_SIMD_CLASS_, DTYPE), sizeof(DT), buf, nelmts)) \
+            break;                                                            \
+                                                                              \
         /* The outer loop of the type conversion macro, controlling which */  \
         /* direction the buffer is walked */				      \
         while (nelmts>0) {						      \
@@ -1174,6 +1196,11 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+            /* Swap packed elements with a vector kernel, when there is one */
+            if(buf_stride == src->shared->size && H5T__simd_swap(buf, buf_stride, nelmts))
+                break;
+
             switch(src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -1562,6 +1589,11 @@ H5T__conv_order(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+            /* Swap packed elements with a vector kernel, when there is one */
+            if(buf_stride == src->shared->size && H5T__simd_swap(buf, buf_stride, nelmts))
+                break;
+
             md = src->shared->size / 2;
             for(i = 0; i < nelmts; i++, buf += buf_stride)
                 for(j = 0; j < md; j++)
@@ -370,6 +370,14 @@ typedef enum H5T_sdir_t {
     H5T_BIT_MSB				/*search msb toward lsb		     */
 } H5T_sdir_t;
 
+/* Classes of native numbers the vector conversion kernels handle */
+typedef enum H5T_simd_class_t {
+    H5T_SIMD_SINT = 0,                  /* Signed integer */
+    H5T_SIMD_UINT,                      /* Unsigned integer */
+    H5T_SIMD_FLOAT,                     /* Floating-point number */
+    H5T_SIMD_NCLASSES                   /* Must be last */
+} H5T_simd_class_t;
+
 /* Typedef for named datatype creation operation */
 typedef struct {
     H5T_t *dt;                  /* Datatype to commit */
@@ -481,6 +489,12 @@ H5_DLL herr_t H5T__visit(H5T_t *dt, unsigned visit_flags, H5T_operator_t op,
     void *op_value);
 H5_DLL herr_t H5T__upgrade_version(H5T_t *dt, unsigned new_version);
 
+/* Vector conversion kernels */
+H5_DLL herr_t H5T__simd_init(void);
+H5_DLL hbool_t H5T__simd_swap(void *buf, size_t size, size_t nelmts);
+H5_DLL hbool_t H5T__simd_conv(H5T_simd_class_t sclass, size_t ssize,
+    H5T_simd_class_t dclass, size_t dsize, void *buf, size_t nelmts);
+
 /* Committed / named datatype routines */
 H5_DLL herr_t H5T__commit_anon(H5F_t *file, H5T_t *type, hid_t tcpl_id);
 H5_DLL herr_t H5T__commit(H5F_t *file, H5T_t *type, hid_t tcpl_id);
@@ -0,0 +1,1181 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Module Info: This module contains the vector (SIMD) kernels used by the
+ *      datatype conversions on packed buffers of native numbers: swapping
+ *      the bytes of 2, 4 and 8 byte elements, and converting between native
+ *      integers and floating-point numbers when no conversion exception
+ *      callback is set.  The kernels for the instruction sets every
+ *      processor of the architecture has (SSE2 on x86-64, NEON on AArch64)
+ *      are always used; the AVX2 ones are picked at run time when the
+ *      processor supports them.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Tmodule.h"          /* This source code file is part of the H5T module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Tpkg.h"		/* Datatypes				*/
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define H5T_SIMD_SSE2
+#include <emmintrin.h>
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5T_SIMD_AVX2
+#include <immintrin.h>
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define H5T_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of element sizes the kernels are indexed by (1, 2, 4 and 8 bytes) */
+#define H5T_SIMD_NSIZES         4
+
+/* Attribute for the functions using AVX2 instructions */
+#define H5T_AVX2                __attribute__((target("avx2")))
+
+/* Define a kernel NAME that converts NELMTS packed elements of type ST in
+ * BUF to type DT, in place.  VEC converts N elements from S to D, loading
+ * all of them before storing any, and SCALAR converts the value 'x' of the
+ * elements left over the way the hard conversion functions do when there is
+ * no exception callback.  Like H5T_CONV, widening conversions repeatedly
+ * convert the elements at the end of the buffer whose destinations overlap
+ * no source element, and walk the last few backward, so that no source
+ * element is overwritten before it is read; other conversions walk the
+ * buffer forward.
+ */
+#define H5T_SIMD_KERNEL(ATTR, NAME, ST, DT, N, VEC, SCALAR)                   \
+ATTR static void                                                              \
+NAME(uint8_t *buf, size_t nelmts)                                             \
+{                                                                             \
+    ST x;                                                                     \
+    DT y;                                                                     \
+    size_t n, m, safe;                                                        \
+                                                                              \
+    if(sizeof(DT) > sizeof(ST)) {                                             \
+        for(n = nelmts; n >= (N); n -= safe) {                                \
+            safe = n - ((n * sizeof(ST)) + sizeof(DT) - 1) / sizeof(DT);      \
+            safe -= safe % (N);                                               \
+            if(0 == safe)                                                     \
+                break;                                                        \
+            for(m = n - safe; m < n; m += (N))                                \
+                VEC(buf + m * sizeof(ST), buf + m * sizeof(DT));              \
+        }                                                                     \
+        while(n >= (N)) {                                                     \
+            n -= (N);                                                         \
+            VEC(buf + n * sizeof(ST), buf + n * sizeof(DT));                  \
+        }                                                                     \
+        while(n > 0) {                                                        \
+            n--;                                                              \
+            H5MM_memcpy(&x, buf + n * sizeof(ST), sizeof(ST));                \
+            y = (SCALAR);                                                     \
+            H5MM_memcpy(buf + n * sizeof(DT), &y, sizeof(DT));                \
+        }                                                                     \
+    }                                                                         \
+    else {                                                                    \
+        for(n = 0; n + (N) <= nelmts; n += (N))                               \
+            VEC(buf + n * sizeof(ST), buf + n * sizeof(DT));                  \
+        for(/*void*/; n < nelmts; n++) {                                      \
+            H5MM_memcpy(&x, buf + n * sizeof(ST), sizeof(ST));                \
+            y = (SCALAR);                                                     \
+            H5MM_memcpy(buf + n * sizeof(DT), &y, sizeof(DT));                \
+        }                                                                     \
+    }                                                                         \
+}
+
+/* Scalar conversions matching the "no exception" cores in H5Tconv.c */
+#define H5T_SIMD_CAST(DT)               ((DT)x)
+#define H5T_SIMD_NONNEG(DT)             (x < 0 ? (DT)0 : (DT)x)
+#define H5T_SIMD_MAX(DT, MAX)           (x > (MAX) ? (DT)(MAX) : (DT)x)
+#define H5T_SIMD_RANGE(DT, MIN, MAX)    (x > (MAX) ? (DT)(MAX) : (x < (MIN) ? (DT)(MIN) : (DT)x))
+#define H5T_SIMD_FTOI(ST, DT, MIN, MAX) (x > (ST)(MAX) ? (DT)(MAX) : (x < (ST)(MIN) ? (DT)(MIN) : (DT)x))
+
+/* Scalar byte swaps */
+#define H5T_SIMD_SWAP16(X)      ((uint16_t)(((X) << 8) | ((X) >> 8)))
+#define H5T_SIMD_SWAP32(X)      ((((X) & 0x000000ffu) << 24) | (((X) & 0x0000ff00u) << 8) | \
+                                 (((X) & 0x00ff0000u) >> 8) | (((X) & 0xff000000u) >> 24))
+#define H5T_SIMD_SWAP64(X)      (((uint64_t)H5T_SIMD_SWAP32((uint32_t)(X)) << 32) | \
+                                 (uint64_t)H5T_SIMD_SWAP32((uint32_t)((X) >> 32)))
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A kernel, converting NELMTS packed elements in BUF in place */
+typedef void (*H5T_simd_func_t)(uint8_t *buf, size_t nelmts);
+
+/* Description of a conversion kernel */
+typedef struct H5T_simd_kernel_t {
+    H5T_simd_class_t sclass;            /* Class of source numbers */
+    size_t ssize;                       /* Size of source numbers */
+    H5T_simd_class_t dclass;            /* Class of destination numbers */
+    size_t dsize;                       /* Size of destination numbers */
+    H5T_simd_func_t func;               /* Kernel */
+} H5T_simd_kernel_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static int H5T__simd_index(size_t size);
+#if defined(H5T_SIMD_SSE2) || defined(H5T_SIMD_NEON)
+static void H5T__simd_register(const H5T_simd_kernel_t *kernels, size_t nkernels,
+    const H5T_simd_func_t *swaps);
+#endif
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Kernels in use for byte swaps, by log2 of the element size */
+static H5T_simd_func_t H5T_simd_swap_g[H5T_SIMD_NSIZES];
+
+/* Kernels in use for conversions, by source and destination index */
+static H5T_simd_func_t H5T_simd_conv_g[H5T_SIMD_NCLASSES * H5T_SIMD_NSIZES][H5T_SIMD_NCLASSES * H5T_SIMD_NSIZES];
+
+#ifdef H5T_SIMD_SSE2
+
+/*
+ * SSE2 kernels.  Every x86-64 processor has SSE2, so these need no check.
+ */
+
+/* Swap the bytes of each 16-bit lane */
+static H5_INLINE __m128i
+H5T__sse2_bswap16(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/* Replace the lanes of V selected by MASK with the lanes of W */
+static H5_INLINE __m128i
+H5T__sse2_select(__m128i mask, __m128i v, __m128i w)
+{
+    return _mm_or_si128(_mm_andnot_si128(mask, v), _mm_and_si128(mask, w));
+}
+
+/* Unsigned "greater than" comparison of 32-bit lanes */
+static H5_INLINE __m128i
+H5T__sse2_cmpgt_epu32(__m128i a, __m128i b)
+{
+    const __m128i bias = _mm_set1_epi32((int)0x80000000);
+
+    return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+}
+
+/* Pack 32-bit lanes holding values in [0, 65535] to unsigned 16-bit lanes */
+static H5_INLINE __m128i
+H5T__sse2_pack_u16(__m128i a, __m128i b)
+{
+    const __m128i off = _mm_set1_epi32(32768);
+
+    return _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(a, off), _mm_sub_epi32(b, off)),
+            _mm_set1_epi16((short)0x8000));
+}
+
+#define H5T_SSE2_LOAD(S)        _mm_loadu_si128((const __m128i *)(const void *)(S))
+#define H5T_SSE2_STORE(D, V)    _mm_storeu_si128((__m128i *)(void *)(D), (V))
+
+/* Byte swaps */
+static H5_INLINE void
+H5T__sse2_swap2(const uint8_t *s, uint8_t *d)
+{
+    H5T_SSE2_STORE(d, H5T__sse2_bswap16(H5T_SSE2_LOAD(s)));
+}
+
+static H5_INLINE void
+H5T__sse2_swap4(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+    H5T_SSE2_STORE(d, H5T__sse2_bswap16(v));
+}
+
+static H5_INLINE void
+H5T__sse2_swap8(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+    H5T_SSE2_STORE(d, H5T__sse2_bswap16(v));
+}
+
+/* Integer widening, 16, 8 or 4 elements at a time */
+static H5_INLINE void
+H5T__sse2_s8_s16(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+    __m128i sign = _mm_cmpgt_epi8(_mm_setzero_si128(), v);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi8(v, sign));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi8(v, sign));
+}
+
+static H5_INLINE void
+H5T__sse2_u8_u16(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+}
+
+static H5_INLINE void
+H5T__sse2_s8_u16(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    v = _mm_andnot_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), v), v);
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+}
+
+static H5_INLINE void
+H5T__sse2_s16_s32(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+    __m128i sign = _mm_srai_epi16(v, 15);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi16(v, sign));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi16(v, sign));
+}
+
+static H5_INLINE void
+H5T__sse2_u16_u32(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi16(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi16(v, _mm_setzero_si128()));
+}
+
+static H5_INLINE void
+H5T__sse2_s16_u32(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    v = _mm_andnot_si128(_mm_srai_epi16(v, 15), v);
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi16(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi16(v, _mm_setzero_si128()));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_s64(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+    __m128i sign = _mm_srai_epi32(v, 31);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi32(v, sign));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi32(v, sign));
+}
+
+static H5_INLINE void
+H5T__sse2_u32_u64(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi32(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi32(v, _mm_setzero_si128()));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_u64(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    v = _mm_andnot_si128(_mm_srai_epi32(v, 31), v);
+    H5T_SSE2_STORE(d, _mm_unpacklo_epi32(v, _mm_setzero_si128()));
+    H5T_SSE2_STORE(d + 16, _mm_unpackhi_epi32(v, _mm_setzero_si128()));
+}
+
+/* Integer narrowing with saturation, 16 or 8 elements at a time */
+static H5_INLINE void
+H5T__sse2_s16_s8(const uint8_t *s, uint8_t *d)
+{
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    H5T_SSE2_STORE(d, _mm_packs_epi16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_s16_u8(const uint8_t *s, uint8_t *d)
+{
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    H5T_SSE2_STORE(d, _mm_packus_epi16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_u16_u8(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi16(UCHAR_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    /* min(x, max) is x - (x -sat max) */
+    a = _mm_subs_epu16(a, _mm_subs_epu16(a, max));
+    b = _mm_subs_epu16(b, _mm_subs_epu16(b, max));
+    H5T_SSE2_STORE(d, _mm_packus_epi16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_u16_s8(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi16(SCHAR_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    a = _mm_subs_epu16(a, _mm_subs_epu16(a, max));
+    b = _mm_subs_epu16(b, _mm_subs_epu16(b, max));
+    H5T_SSE2_STORE(d, _mm_packus_epi16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_s16(const uint8_t *s, uint8_t *d)
+{
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    H5T_SSE2_STORE(d, _mm_packs_epi32(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_u16(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi32(USHRT_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    a = _mm_andnot_si128(_mm_srai_epi32(a, 31), a);
+    b = _mm_andnot_si128(_mm_srai_epi32(b, 31), b);
+    a = H5T__sse2_select(_mm_cmpgt_epi32(a, max), a, max);
+    b = H5T__sse2_select(_mm_cmpgt_epi32(b, max), b, max);
+    H5T_SSE2_STORE(d, H5T__sse2_pack_u16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_u32_u16(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi32(USHRT_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    a = H5T__sse2_select(H5T__sse2_cmpgt_epu32(a, max), a, max);
+    b = H5T__sse2_select(H5T__sse2_cmpgt_epu32(b, max), b, max);
+    H5T_SSE2_STORE(d, H5T__sse2_pack_u16(a, b));
+}
+
+static H5_INLINE void
+H5T__sse2_u32_s16(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi32(SHRT_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    a = H5T__sse2_select(H5T__sse2_cmpgt_epu32(a, max), a, max);
+    b = H5T__sse2_select(H5T__sse2_cmpgt_epu32(b, max), b, max);
+    H5T_SSE2_STORE(d, _mm_packs_epi32(a, b));
+}
+
+/* Sign changes between integers of the same size */
+static H5_INLINE void
+H5T__sse2_s8_u8(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_andnot_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), v), v));
+}
+
+static H5_INLINE void
+H5T__sse2_u8_s8(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, H5T__sse2_select(_mm_cmpgt_epi8(_mm_setzero_si128(), v), v, _mm_set1_epi8(SCHAR_MAX)));
+}
+
+static H5_INLINE void
+H5T__sse2_s16_u16(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_andnot_si128(_mm_srai_epi16(v, 15), v));
+}
+
+static H5_INLINE void
+H5T__sse2_u16_s16(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, H5T__sse2_select(_mm_srai_epi16(v, 15), v, _mm_set1_epi16(SHRT_MAX)));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_u32(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, _mm_andnot_si128(_mm_srai_epi32(v, 31), v));
+}
+
+static H5_INLINE void
+H5T__sse2_u32_s32(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    H5T_SSE2_STORE(d, H5T__sse2_select(_mm_srai_epi32(v, 31), v, _mm_set1_epi32(INT_MAX)));
+}
+
+/* Conversions between 32-bit integers and floating-point numbers, 4
+ * elements at a time
+ */
+static H5_INLINE void
+H5T__sse2_s32_f32(const uint8_t *s, uint8_t *d)
+{
+    _mm_storeu_ps((float *)(void *)d, _mm_cvtepi32_ps(H5T_SSE2_LOAD(s)));
+}
+
+static H5_INLINE void
+H5T__sse2_s32_f64(const uint8_t *s, uint8_t *d)
+{
+    __m128i v = H5T_SSE2_LOAD(s);
+
+    _mm_storeu_pd((double *)(void *)d, _mm_cvtepi32_pd(v));
+    _mm_storeu_pd((double *)(void *)(d + 16), _mm_cvtepi32_pd(_mm_unpackhi_epi64(v, v)));
+}
+
+static H5_INLINE void
+H5T__sse2_f32_s32(const uint8_t *s, uint8_t *d)
+{
+    __m128 x = _mm_loadu_ps((const float *)(const void *)s);
+    __m128i hi = _mm_castps_si128(_mm_cmpgt_ps(x, _mm_set1_ps((float)INT_MAX)));
+
+    /* Out of range and NaN values truncate to INT_MIN, as in C */
+    H5T_SSE2_STORE(d, H5T__sse2_select(hi, _mm_cvttps_epi32(x), _mm_set1_epi32(INT_MAX)));
+}
+
+static H5_INLINE void
+H5T__sse2_f64_s32(const uint8_t *s, uint8_t *d)
+{
+    __m128d x0 = _mm_loadu_pd((const double *)(const void *)s);
+    __m128d x1 = _mm_loadu_pd((const double *)(const void *)(s + 16));
+    __m128i r = _mm_unpacklo_epi64(_mm_cvttpd_epi32(x0), _mm_cvttpd_epi32(x1));
+    __m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(_mm_cmpgt_pd(x0, _mm_set1_pd((double)INT_MAX))),
+            _mm_castpd_ps(_mm_cmpgt_pd(x1, _mm_set1_pd((double)INT_MAX))), _MM_SHUFFLE(2, 0, 2, 0)));
+
+    H5T_SSE2_STORE(d, H5T__sse2_select(hi, r, _mm_set1_epi32(INT_MAX)));
+}
+
+static H5_INLINE void
+H5T__sse2_f32_f64(const uint8_t *s, uint8_t *d)
+{
+    __m128 x = _mm_loadu_ps((const float *)(const void *)s);
+
+    _mm_storeu_pd((double *)(void *)d, _mm_cvtps_pd(x));
+    _mm_storeu_pd((double *)(void *)(d + 16), _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+}
+
+static H5_INLINE void
+H5T__sse2_f64_f32(const uint8_t *s, uint8_t *d)
+{
+    __m128d x0 = _mm_loadu_pd((const double *)(const void *)s);
+    __m128d x1 = _mm_loadu_pd((const double *)(const void *)(s + 16));
+    __m128 r = _mm_movelh_ps(_mm_cvtpd_ps(x0), _mm_cvtpd_ps(x1));
+    __m128 hi = _mm_shuffle_ps(_mm_castpd_ps(_mm_cmpgt_pd(x0, _mm_set1_pd((double)FLT_MAX))),
+            _mm_castpd_ps(_mm_cmpgt_pd(x1, _mm_set1_pd((double)FLT_MAX))), _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 lo = _mm_shuffle_ps(_mm_castpd_ps(_mm_cmplt_pd(x0, _mm_set1_pd(-(double)FLT_MAX))),
+            _mm_castpd_ps(_mm_cmplt_pd(x1, _mm_set1_pd(-(double)FLT_MAX))), _MM_SHUFFLE(2, 0, 2, 0));
+
+    /* Overflows become infinities, as in H5T_CONV_Ff */
+    r = _mm_or_ps(_mm_andnot_ps(hi, r), _mm_and_ps(hi, _mm_set1_ps(H5T_NATIVE_FLOAT_POS_INF_g)));
+    r = _mm_or_ps(_mm_andnot_ps(lo, r), _mm_and_ps(lo, _mm_set1_ps(H5T_NATIVE_FLOAT_NEG_INF_g)));
+    _mm_storeu_ps((float *)(void *)d, r);
+}
+
+H5T_SIMD_KERNEL(, H5T__sse2_conv_swap2, uint16_t, uint16_t, 8, H5T__sse2_swap2, H5T_SIMD_SWAP16(x))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_swap4, uint32_t, uint32_t, 4, H5T__sse2_swap4, H5T_SIMD_SWAP32(x))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_swap8, uint64_t, uint64_t, 2, H5T__sse2_swap8, H5T_SIMD_SWAP64(x))
+
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s8_s16, int8_t, int16_t, 16, H5T__sse2_s8_s16, H5T_SIMD_CAST(int16_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u8_u16, uint8_t, uint16_t, 16, H5T__sse2_u8_u16, H5T_SIMD_CAST(uint16_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s8_u16, int8_t, uint16_t, 16, H5T__sse2_s8_u16, H5T_SIMD_NONNEG(uint16_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s16_s32, int16_t, int32_t, 8, H5T__sse2_s16_s32, H5T_SIMD_CAST(int32_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u16_u32, uint16_t, uint32_t, 8, H5T__sse2_u16_u32, H5T_SIMD_CAST(uint32_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s16_u32, int16_t, uint32_t, 8, H5T__sse2_s16_u32, H5T_SIMD_NONNEG(uint32_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_s64, int32_t, int64_t, 4, H5T__sse2_s32_s64, H5T_SIMD_CAST(int64_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u32_u64, uint32_t, uint64_t, 4, H5T__sse2_u32_u64, H5T_SIMD_CAST(uint64_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_u64, int32_t, uint64_t, 4, H5T__sse2_s32_u64, H5T_SIMD_NONNEG(uint64_t))
+
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s16_s8, int16_t, int8_t, 16, H5T__sse2_s16_s8, H5T_SIMD_RANGE(int8_t, SCHAR_MIN, SCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s16_u8, int16_t, uint8_t, 16, H5T__sse2_s16_u8, H5T_SIMD_RANGE(uint8_t, 0, UCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u16_u8, uint16_t, uint8_t, 16, H5T__sse2_u16_u8, H5T_SIMD_MAX(uint8_t, UCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u16_s8, uint16_t, int8_t, 16, H5T__sse2_u16_s8, H5T_SIMD_MAX(int8_t, SCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_s16, int32_t, int16_t, 8, H5T__sse2_s32_s16, H5T_SIMD_RANGE(int16_t, SHRT_MIN, SHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_u16, int32_t, uint16_t, 8, H5T__sse2_s32_u16, H5T_SIMD_RANGE(uint16_t, 0, USHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u32_u16, uint32_t, uint16_t, 8, H5T__sse2_u32_u16, H5T_SIMD_MAX(uint16_t, (uint32_t)USHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u32_s16, uint32_t, int16_t, 8, H5T__sse2_u32_s16, H5T_SIMD_MAX(int16_t, (uint32_t)SHRT_MAX))
+
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s8_u8, int8_t, uint8_t, 16, H5T__sse2_s8_u8, H5T_SIMD_NONNEG(uint8_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u8_s8, uint8_t, int8_t, 16, H5T__sse2_u8_s8, H5T_SIMD_MAX(int8_t, SCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s16_u16, int16_t, uint16_t, 8, H5T__sse2_s16_u16, H5T_SIMD_NONNEG(uint16_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u16_s16, uint16_t, int16_t, 8, H5T__sse2_u16_s16, H5T_SIMD_MAX(int16_t, SHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_u32, int32_t, uint32_t, 4, H5T__sse2_s32_u32, H5T_SIMD_NONNEG(uint32_t))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_u32_s32, uint32_t, int32_t, 4, H5T__sse2_u32_s32, H5T_SIMD_MAX(int32_t, (uint32_t)INT_MAX))
+
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_f32, int32_t, float, 4, H5T__sse2_s32_f32, H5T_SIMD_CAST(float))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_s32_f64, int32_t, double, 4, H5T__sse2_s32_f64, H5T_SIMD_CAST(double))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_f32_s32, float, int32_t, 4, H5T__sse2_f32_s32, H5T_SIMD_FTOI(float, int32_t, INT_MIN, INT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_f64_s32, double, int32_t, 4, H5T__sse2_f64_s32, H5T_SIMD_FTOI(double, int32_t, INT_MIN, INT_MAX))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_f32_f64, float, double, 4, H5T__sse2_f32_f64, H5T_SIMD_CAST(double))
+H5T_SIMD_KERNEL(, H5T__sse2_conv_f64_f32, double, float, 4, H5T__sse2_f64_f32,
+    (x > (double)FLT_MAX ? H5T_NATIVE_FLOAT_POS_INF_g : (x < -(double)FLT_MAX ? H5T_NATIVE_FLOAT_NEG_INF_g : (float)x)))
+
+/* Kernels available on every x86-64 processor */
+static const H5T_simd_func_t H5T_simd_base_swap_g[H5T_SIMD_NSIZES] = {
+    NULL, H5T__sse2_conv_swap2, H5T__sse2_conv_swap4, H5T__sse2_conv_swap8
+};
+static const H5T_simd_kernel_t H5T_simd_base_g[] = {
+    {H5T_SIMD_SINT, 1, H5T_SIMD_SINT, 2, H5T__sse2_conv_s8_s16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_UINT, 2, H5T__sse2_conv_u8_u16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_SINT, 2, H5T__sse2_conv_u8_u16},
+    {H5T_SIMD_SINT, 1, H5T_SIMD_UINT, 2, H5T__sse2_conv_s8_u16},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_SINT, 4, H5T__sse2_conv_s16_s32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_UINT, 4, H5T__sse2_conv_u16_u32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_SINT, 4, H5T__sse2_conv_u16_u32},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_UINT, 4, H5T__sse2_conv_s16_u32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_SINT, 8, H5T__sse2_conv_s32_s64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 8, H5T__sse2_conv_u32_u64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_SINT, 8, H5T__sse2_conv_u32_u64},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 8, H5T__sse2_conv_s32_u64},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_SINT, 1, H5T__sse2_conv_s16_s8},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_UINT, 1, H5T__sse2_conv_s16_u8},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_UINT, 1, H5T__sse2_conv_u16_u8},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_SINT, 1, H5T__sse2_conv_u16_s8},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_SINT, 2, H5T__sse2_conv_s32_s16},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 2, H5T__sse2_conv_s32_u16},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 2, H5T__sse2_conv_u32_u16},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_SINT, 2, H5T__sse2_conv_u32_s16},
+    {H5T_SIMD_SINT, 1, H5T_SIMD_UINT, 1, H5T__sse2_conv_s8_u8},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_SINT, 1, H5T__sse2_conv_u8_s8},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_UINT, 2, H5T__sse2_conv_s16_u16},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_SINT, 2, H5T__sse2_conv_u16_s16},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 4, H5T__sse2_conv_s32_u32},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_SINT, 4, H5T__sse2_conv_u32_s32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_FLOAT, 4, H5T__sse2_conv_s32_f32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_FLOAT, 8, H5T__sse2_conv_s32_f64},
+    {H5T_SIMD_FLOAT, 4, H5T_SIMD_SINT, 4, H5T__sse2_conv_f32_s32},
+    {H5T_SIMD_FLOAT, 8, H5T_SIMD_SINT, 4, H5T__sse2_conv_f64_s32},
+    {H5T_SIMD_FLOAT, 4, H5T_SIMD_FLOAT, 8, H5T__sse2_conv_f32_f64},
+    {H5T_SIMD_FLOAT, 8, H5T_SIMD_FLOAT, 4, H5T__sse2_conv_f64_f32}
+};
+#endif /* H5T_SIMD_SSE2 */
+
+#ifdef H5T_SIMD_AVX2
+
+/*
+ * AVX2 kernels, used in place of the SSE2 ones when the processor has AVX2.
+ */
+
+#define H5T_AVX2_LOAD(S)        _mm256_loadu_si256((const __m256i *)(const void *)(S))
+#define H5T_AVX2_STORE(D, V)    _mm256_storeu_si256((__m256i *)(void *)(D), (V))
+
+/* Byte swaps, 32 bytes at a time */
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_swap2(const uint8_t *s, uint8_t *d)
+{
+    const __m256i mask = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    H5T_AVX2_STORE(d, _mm256_shuffle_epi8(H5T_AVX2_LOAD(s), mask));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_swap4(const uint8_t *s, uint8_t *d)
+{
+    const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    H5T_AVX2_STORE(d, _mm256_shuffle_epi8(H5T_AVX2_LOAD(s), mask));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_swap8(const uint8_t *s, uint8_t *d)
+{
+    const __m256i mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    H5T_AVX2_STORE(d, _mm256_shuffle_epi8(H5T_AVX2_LOAD(s), mask));
+}
+
+/* Integer widening, 16, 8 or 4 elements at a time */
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s8_s16(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepi8_epi16(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_u8_u16(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu8_epi16(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s8_u16(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu8_epi16(_mm_max_epi8(H5T_SSE2_LOAD(s), _mm_setzero_si128())));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s16_s32(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepi16_epi32(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_u16_u32(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu16_epi32(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s16_u32(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu16_epi32(_mm_max_epi16(H5T_SSE2_LOAD(s), _mm_setzero_si128())));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s32_s64(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepi32_epi64(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_u32_u64(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu32_epi64(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s32_u64(const uint8_t *s, uint8_t *d)
+{
+    H5T_AVX2_STORE(d, _mm256_cvtepu32_epi64(_mm_max_epi32(H5T_SSE2_LOAD(s), _mm_setzero_si128())));
+}
+
+/* Narrowing to unsigned 16-bit integers, with the SSE4.1 instructions
+ * every AVX2 processor has, 8 elements at a time
+ */
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s32_u16(const uint8_t *s, uint8_t *d)
+{
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    H5T_SSE2_STORE(d, _mm_packus_epi32(a, b));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_u32_u16(const uint8_t *s, uint8_t *d)
+{
+    const __m128i max = _mm_set1_epi32(USHRT_MAX);
+    __m128i a = H5T_SSE2_LOAD(s);
+    __m128i b = H5T_SSE2_LOAD(s + 16);
+
+    H5T_SSE2_STORE(d, _mm_packus_epi32(_mm_min_epu32(a, max), _mm_min_epu32(b, max)));
+}
+
+/* Conversions between 32-bit integers and floating-point numbers, 8 or 4
+ * elements at a time
+ */
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s32_f32(const uint8_t *s, uint8_t *d)
+{
+    _mm256_storeu_ps((float *)(void *)d, _mm256_cvtepi32_ps(H5T_AVX2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_s32_f64(const uint8_t *s, uint8_t *d)
+{
+    _mm256_storeu_pd((double *)(void *)d, _mm256_cvtepi32_pd(H5T_SSE2_LOAD(s)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_f32_s32(const uint8_t *s, uint8_t *d)
+{
+    __m256 x = _mm256_loadu_ps((const float *)(const void *)s);
+    __m256 hi = _mm256_cmp_ps(x, _mm256_set1_ps((float)INT_MAX), _CMP_GT_OQ);
+
+    /* Out of range and NaN values truncate to INT_MIN, as in C */
+    H5T_AVX2_STORE(d, _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(_mm256_cvttps_epi32(x)),
+            _mm256_castsi256_ps(_mm256_set1_epi32(INT_MAX)), hi)));
+}
+
+H5T_AVX2 static H5_INLINE void
+H5T__avx2_f32_f64(const uint8_t *s, uint8_t *d)
+{
+    _mm256_storeu_pd((double *)(void *)d, _mm256_cvtps_pd(_mm_loadu_ps((const float *)(const void *)s)));
+}
+
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_swap2, uint16_t, uint16_t, 16, H5T__avx2_swap2, H5T_SIMD_SWAP16(x))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_swap4, uint32_t, uint32_t, 8, H5T__avx2_swap4, H5T_SIMD_SWAP32(x))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_swap8, uint64_t, uint64_t, 4, H5T__avx2_swap8, H5T_SIMD_SWAP64(x))
+
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s8_s16, int8_t, int16_t, 16, H5T__avx2_s8_s16, H5T_SIMD_CAST(int16_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_u8_u16, uint8_t, uint16_t, 16, H5T__avx2_u8_u16, H5T_SIMD_CAST(uint16_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s8_u16, int8_t, uint16_t, 16, H5T__avx2_s8_u16, H5T_SIMD_NONNEG(uint16_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s16_s32, int16_t, int32_t, 8, H5T__avx2_s16_s32, H5T_SIMD_CAST(int32_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_u16_u32, uint16_t, uint32_t, 8, H5T__avx2_u16_u32, H5T_SIMD_CAST(uint32_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s16_u32, int16_t, uint32_t, 8, H5T__avx2_s16_u32, H5T_SIMD_NONNEG(uint32_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s32_s64, int32_t, int64_t, 4, H5T__avx2_s32_s64, H5T_SIMD_CAST(int64_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_u32_u64, uint32_t, uint64_t, 4, H5T__avx2_u32_u64, H5T_SIMD_CAST(uint64_t))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s32_u64, int32_t, uint64_t, 4, H5T__avx2_s32_u64, H5T_SIMD_NONNEG(uint64_t))
+
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s32_u16, int32_t, uint16_t, 8, H5T__avx2_s32_u16, H5T_SIMD_RANGE(uint16_t, 0, USHRT_MAX))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_u32_u16, uint32_t, uint16_t, 8, H5T__avx2_u32_u16, H5T_SIMD_MAX(uint16_t, (uint32_t)USHRT_MAX))
+
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s32_f32, int32_t, float, 8, H5T__avx2_s32_f32, H5T_SIMD_CAST(float))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_s32_f64, int32_t, double, 4, H5T__avx2_s32_f64, H5T_SIMD_CAST(double))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_f32_s32, float, int32_t, 8, H5T__avx2_f32_s32, H5T_SIMD_FTOI(float, int32_t, INT_MIN, INT_MAX))
+H5T_SIMD_KERNEL(H5T_AVX2, H5T__avx2_conv_f32_f64, float, double, 4, H5T__avx2_f32_f64, H5T_SIMD_CAST(double))
+
+/* Kernels for processors with AVX2 */
+static const H5T_simd_func_t H5T_simd_avx2_swap_g[H5T_SIMD_NSIZES] = {
+    NULL, H5T__avx2_conv_swap2, H5T__avx2_conv_swap4, H5T__avx2_conv_swap8
+};
+static const H5T_simd_kernel_t H5T_simd_avx2_g[] = {
+    {H5T_SIMD_SINT, 1, H5T_SIMD_SINT, 2, H5T__avx2_conv_s8_s16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_UINT, 2, H5T__avx2_conv_u8_u16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_SINT, 2, H5T__avx2_conv_u8_u16},
+    {H5T_SIMD_SINT, 1, H5T_SIMD_UINT, 2, H5T__avx2_conv_s8_u16},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_SINT, 4, H5T__avx2_conv_s16_s32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_UINT, 4, H5T__avx2_conv_u16_u32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_SINT, 4, H5T__avx2_conv_u16_u32},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_UINT, 4, H5T__avx2_conv_s16_u32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_SINT, 8, H5T__avx2_conv_s32_s64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 8, H5T__avx2_conv_u32_u64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_SINT, 8, H5T__avx2_conv_u32_u64},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 8, H5T__avx2_conv_s32_u64},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 2, H5T__avx2_conv_s32_u16},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 2, H5T__avx2_conv_u32_u16},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_FLOAT, 4, H5T__avx2_conv_s32_f32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_FLOAT, 8, H5T__avx2_conv_s32_f64},
+    {H5T_SIMD_FLOAT, 4, H5T_SIMD_SINT, 4, H5T__avx2_conv_f32_s32},
+    {H5T_SIMD_FLOAT, 4, H5T_SIMD_FLOAT, 8, H5T__avx2_conv_f32_f64}
+};
+#endif /* H5T_SIMD_AVX2 */
+
+#ifdef H5T_SIMD_NEON
+
+/*
+ * NEON kernels.  Every AArch64 processor has NEON.
+ */
+
+/* Byte swaps */
+static H5_INLINE void
+H5T__neon_swap2(const uint8_t *s, uint8_t *d)
+{
+    vst1q_u8(d, vrev16q_u8(vld1q_u8(s)));
+}
+
+static H5_INLINE void
+H5T__neon_swap4(const uint8_t *s, uint8_t *d)
+{
+    vst1q_u8(d, vrev32q_u8(vld1q_u8(s)));
+}
+
+static H5_INLINE void
+H5T__neon_swap8(const uint8_t *s, uint8_t *d)
+{
+    vst1q_u8(d, vrev64q_u8(vld1q_u8(s)));
+}
+
+/* Integer widening, 16, 8 or 4 elements at a time */
+static H5_INLINE void
+H5T__neon_s8_s16(const uint8_t *s, uint8_t *d)
+{
+    int8x16_t v = vld1q_s8((const int8_t *)s);
+
+    vst1q_s16((int16_t *)(void *)d, vmovl_s8(vget_low_s8(v)));
+    vst1q_s16((int16_t *)(void *)(d + 16), vmovl_s8(vget_high_s8(v)));
+}
+
+static H5_INLINE void
+H5T__neon_u8_u16(const uint8_t *s, uint8_t *d)
+{
+    uint8x16_t v = vld1q_u8(s);
+
+    vst1q_u16((uint16_t *)(void *)d, vmovl_u8(vget_low_u8(v)));
+    vst1q_u16((uint16_t *)(void *)(d + 16), vmovl_u8(vget_high_u8(v)));
+}
+
+static H5_INLINE void
+H5T__neon_s16_s32(const uint8_t *s, uint8_t *d)
+{
+    int16x8_t v = vld1q_s16((const int16_t *)(const void *)s);
+
+    vst1q_s32((int32_t *)(void *)d, vmovl_s16(vget_low_s16(v)));
+    vst1q_s32((int32_t *)(void *)(d + 16), vmovl_s16(vget_high_s16(v)));
+}
+
+static H5_INLINE void
+H5T__neon_u16_u32(const uint8_t *s, uint8_t *d)
+{
+    uint16x8_t v = vld1q_u16((const uint16_t *)(const void *)s);
+
+    vst1q_u32((uint32_t *)(void *)d, vmovl_u16(vget_low_u16(v)));
+    vst1q_u32((uint32_t *)(void *)(d + 16), vmovl_u16(vget_high_u16(v)));
+}
+
+static H5_INLINE void
+H5T__neon_s32_s64(const uint8_t *s, uint8_t *d)
+{
+    int32x4_t v = vld1q_s32((const int32_t *)(const void *)s);
+
+    vst1q_s64((int64_t *)(void *)d, vmovl_s32(vget_low_s32(v)));
+    vst1q_s64((int64_t *)(void *)(d + 16), vmovl_s32(vget_high_s32(v)));
+}
+
+static H5_INLINE void
+H5T__neon_u32_u64(const uint8_t *s, uint8_t *d)
+{
+    uint32x4_t v = vld1q_u32((const uint32_t *)(const void *)s);
+
+    vst1q_u64((uint64_t *)(void *)d, vmovl_u32(vget_low_u32(v)));
+    vst1q_u64((uint64_t *)(void *)(d + 16), vmovl_u32(vget_high_u32(v)));
+}
+
+/* Integer narrowing with saturation, 16 or 8 elements at a time */
+static H5_INLINE void
+H5T__neon_s16_s8(const uint8_t *s, uint8_t *d)
+{
+    int16x8_t a = vld1q_s16((const int16_t *)(const void *)s);
+    int16x8_t b = vld1q_s16((const int16_t *)(const void *)(s + 16));
+
+    vst1q_s8((int8_t *)d, vcombine_s8(vqmovn_s16(a), vqmovn_s16(b)));
+}
+
+static H5_INLINE void
+H5T__neon_s16_u8(const uint8_t *s, uint8_t *d)
+{
+    int16x8_t a = vld1q_s16((const int16_t *)(const void *)s);
+    int16x8_t b = vld1q_s16((const int16_t *)(const void *)(s + 16));
+
+    vst1q_u8(d, vcombine_u8(vqmovun_s16(a), vqmovun_s16(b)));
+}
+
+static H5_INLINE void
+H5T__neon_u16_u8(const uint8_t *s, uint8_t *d)
+{
+    uint16x8_t a = vld1q_u16((const uint16_t *)(const void *)s);
+    uint16x8_t b = vld1q_u16((const uint16_t *)(const void *)(s + 16));
+
+    vst1q_u8(d, vcombine_u8(vqmovn_u16(a), vqmovn_u16(b)));
+}
+
+static H5_INLINE void
+H5T__neon_s32_s16(const uint8_t *s, uint8_t *d)
+{
+    int32x4_t a = vld1q_s32((const int32_t *)(const void *)s);
+    int32x4_t b = vld1q_s32((const int32_t *)(const void *)(s + 16));
+
+    vst1q_s16((int16_t *)(void *)d, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+}
+
+static H5_INLINE void
+H5T__neon_s32_u16(const uint8_t *s, uint8_t *d)
+{
+    int32x4_t a = vld1q_s32((const int32_t *)(const void *)s);
+    int32x4_t b = vld1q_s32((const int32_t *)(const void *)(s + 16));
+
+    vst1q_u16((uint16_t *)(void *)d, vcombine_u16(vqmovun_s32(a), vqmovun_s32(b)));
+}
+
+static H5_INLINE void
+H5T__neon_u32_u16(const uint8_t *s, uint8_t *d)
+{
+    uint32x4_t a = vld1q_u32((const uint32_t *)(const void *)s);
+    uint32x4_t b = vld1q_u32((const uint32_t *)(const void *)(s + 16));
+
+    vst1q_u16((uint16_t *)(void *)d, vcombine_u16(vqmovn_u32(a), vqmovn_u32(b)));
+}
+
+/* Conversion of 32-bit integers to floats, 4 elements at a time */
+static H5_INLINE void
+H5T__neon_s32_f32(const uint8_t *s, uint8_t *d)
+{
+    vst1q_f32((float *)(void *)d, vcvtq_f32_s32(vld1q_s32((const int32_t *)(const void *)s)));
+}
+
+H5T_SIMD_KERNEL(, H5T__neon_conv_swap2, uint16_t, uint16_t, 8, H5T__neon_swap2, H5T_SIMD_SWAP16(x))
+H5T_SIMD_KERNEL(, H5T__neon_conv_swap4, uint32_t, uint32_t, 4, H5T__neon_swap4, H5T_SIMD_SWAP32(x))
+H5T_SIMD_KERNEL(, H5T__neon_conv_swap8, uint64_t, uint64_t, 2, H5T__neon_swap8, H5T_SIMD_SWAP64(x))
+
+H5T_SIMD_KERNEL(, H5T__neon_conv_s8_s16, int8_t, int16_t, 16, H5T__neon_s8_s16, H5T_SIMD_CAST(int16_t))
+H5T_SIMD_KERNEL(, H5T__neon_conv_u8_u16, uint8_t, uint16_t, 16, H5T__neon_u8_u16, H5T_SIMD_CAST(uint16_t))
+H5T_SIMD_KERNEL(, H5T__neon_conv_s16_s32, int16_t, int32_t, 8, H5T__neon_s16_s32, H5T_SIMD_CAST(int32_t))
+H5T_SIMD_KERNEL(, H5T__neon_conv_u16_u32, uint16_t, uint32_t, 8, H5T__neon_u16_u32, H5T_SIMD_CAST(uint32_t))
+H5T_SIMD_KERNEL(, H5T__neon_conv_s32_s64, int32_t, int64_t, 4, H5T__neon_s32_s64, H5T_SIMD_CAST(int64_t))
+H5T_SIMD_KERNEL(, H5T__neon_conv_u32_u64, uint32_t, uint64_t, 4, H5T__neon_u32_u64, H5T_SIMD_CAST(uint64_t))
+
+H5T_SIMD_KERNEL(, H5T__neon_conv_s16_s8, int16_t, int8_t, 16, H5T__neon_s16_s8, H5T_SIMD_RANGE(int8_t, SCHAR_MIN, SCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__neon_conv_s16_u8, int16_t, uint8_t, 16, H5T__neon_s16_u8, H5T_SIMD_RANGE(uint8_t, 0, UCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__neon_conv_u16_u8, uint16_t, uint8_t, 16, H5T__neon_u16_u8, H5T_SIMD_MAX(uint8_t, UCHAR_MAX))
+H5T_SIMD_KERNEL(, H5T__neon_conv_s32_s16, int32_t, int16_t, 8, H5T__neon_s32_s16, H5T_SIMD_RANGE(int16_t, SHRT_MIN, SHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__neon_conv_s32_u16, int32_t, uint16_t, 8, H5T__neon_s32_u16, H5T_SIMD_RANGE(uint16_t, 0, USHRT_MAX))
+H5T_SIMD_KERNEL(, H5T__neon_conv_u32_u16, uint32_t, uint16_t, 8, H5T__neon_u32_u16, H5T_SIMD_MAX(uint16_t, (uint32_t)USHRT_MAX))
+
+H5T_SIMD_KERNEL(, H5T__neon_conv_s32_f32, int32_t, float, 4, H5T__neon_s32_f32, H5T_SIMD_CAST(float))
+
+/* Kernels available on every AArch64 processor */
+static const H5T_simd_func_t H5T_simd_base_swap_g[H5T_SIMD_NSIZES] = {
+    NULL, H5T__neon_conv_swap2, H5T__neon_conv_swap4, H5T__neon_conv_swap8
+};
+static const H5T_simd_kernel_t H5T_simd_base_g[] = {
+    {H5T_SIMD_SINT, 1, H5T_SIMD_SINT, 2, H5T__neon_conv_s8_s16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_UINT, 2, H5T__neon_conv_u8_u16},
+    {H5T_SIMD_UINT, 1, H5T_SIMD_SINT, 2, H5T__neon_conv_u8_u16},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_SINT, 4, H5T__neon_conv_s16_s32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_UINT, 4, H5T__neon_conv_u16_u32},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_SINT, 4, H5T__neon_conv_u16_u32},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_SINT, 8, H5T__neon_conv_s32_s64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 8, H5T__neon_conv_u32_u64},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_SINT, 8, H5T__neon_conv_u32_u64},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_SINT, 1, H5T__neon_conv_s16_s8},
+    {H5T_SIMD_SINT, 2, H5T_SIMD_UINT, 1, H5T__neon_conv_s16_u8},
+    {H5T_SIMD_UINT, 2, H5T_SIMD_UINT, 1, H5T__neon_conv_u16_u8},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_SINT, 2, H5T__neon_conv_s32_s16},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_UINT, 2, H5T__neon_conv_s32_u16},
+    {H5T_SIMD_UINT, 4, H5T_SIMD_UINT, 2, H5T__neon_conv_u32_u16},
+    {H5T_SIMD_SINT, 4, H5T_SIMD_FLOAT, 4, H5T__neon_conv_s32_f32}
+};
+#endif /* H5T_SIMD_NEON */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__simd_index
+ *
+ * Purpose:	Compute the index of the kernels for numbers of SIZE bytes,
+ *              log2 of SIZE.
+ *
+ * Return:	Success:	Non-negative index
+ *
+ *		Failure:	Negative, when there are no kernels for
+ *                              numbers of that size
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5T__simd_index(size_t size)
+{
+    int ret_value = -1;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch(size) {
+        case 1:
+            ret_value = 0;
+            break;
+        case 2:
+            ret_value = 1;
+            break;
+        case 4:
+            ret_value = 2;
+            break;
+        case 8:
+            ret_value = 3;
+            break;
+        default:
+            HGOTO_DONE(-1)
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__simd_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__simd_register
+ *
+ * Purpose:	Use the NKERNELS conversion kernels in KERNELS and the byte
+ *              swap kernels in SWAPS, in place of the ones used so far for
+ *              the same numbers.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+#if defined(H5T_SIMD_SSE2) || defined(H5T_SIMD_NEON)
+static void
+H5T__simd_register(const H5T_simd_kernel_t *kernels, size_t nkernels,
+    const H5T_simd_func_t *swaps)
+{
+    size_t u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < H5T_SIMD_NSIZES; u++)
+        if(swaps[u])
+            H5T_simd_swap_g[u] = swaps[u];
+
+    for(u = 0; u < nkernels; u++) {
+        int sidx = H5T__simd_index(kernels[u].ssize);
+        int didx = H5T__simd_index(kernels[u].dsize);
+
+        HDassert(sidx >= 0 && didx >= 0);
+        H5T_simd_conv_g[(int)kernels[u].sclass * H5T_SIMD_NSIZES + sidx][(int)kernels[u].dclass * H5T_SIMD_NSIZES + didx] = kernels[u].func;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__simd_register() */
+#endif /* defined(H5T_SIMD_SSE2) || defined(H5T_SIMD_NEON) */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__simd_init
+ *
+ * Purpose:	Pick the kernels for the instruction sets of the processor
+ *              the library runs on.  Setting the HDF5_DISABLE_SIMD
+ *              environment variable turns the kernels off, leaving the
+ *              conversions to the scalar code.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__simd_init(void)
+{
+    const char *s;
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDmemset(H5T_simd_swap_g, 0, sizeof(H5T_simd_swap_g));
+    HDmemset(H5T_simd_conv_g, 0, sizeof(H5T_simd_conv_g));
+
+    s = HDgetenv("HDF5_DISABLE_SIMD");
+    if(s && HDisdigit(*s) && HDstrtol(s, NULL, 0) != 0)
+        HGOTO_DONE(SUCCEED)
+
+#if defined(H5T_SIMD_SSE2) || defined(H5T_SIMD_NEON)
+    H5T__simd_register(H5T_simd_base_g, NELMTS(H5T_simd_base_g), H5T_simd_base_swap_g);
+#endif
+#ifdef H5T_SIMD_AVX2
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        H5T__simd_register(H5T_simd_avx2_g, NELMTS(H5T_simd_avx2_g), H5T_simd_avx2_swap_g);
+#endif /* H5T_SIMD_AVX2 */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__simd_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__simd_swap
+ *
+ * Purpose:	Swap the bytes of NELMTS packed elements of SIZE bytes in
+ *              BUF, with a vector kernel.
+ *
+ * Return:	TRUE if the bytes were swapped, FALSE if there is no kernel
+ *              for elements of that size
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T__simd_swap(void *buf, size_t size, size_t nelmts)
+{
+    int idx;
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(buf);
+
+    if((idx = H5T__simd_index(size)) >= 0 && H5T_simd_swap_g[idx]) {
+        (*H5T_simd_swap_g[idx])((uint8_t *)buf, nelmts);
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__simd_swap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__simd_conv
+ *
+ * Purpose:	Convert NELMTS packed native numbers of class SCLASS and
+ *              SSIZE bytes in BUF to numbers of class DCLASS and DSIZE
+ *              bytes, in place, with a vector kernel.  The results are the
+ *              ones the hard conversion functions give when no exception
+ *              callback is set: integers saturate, floating-point numbers
+ *              out of the range of integers become the smallest or largest
+ *              integer, and doubles out of the range of floats become
+ *              infinities.
+ *
+ * Return:	TRUE if the numbers were converted, FALSE if there is no
+ *              kernel for the conversion
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T__simd_conv(H5T_simd_class_t sclass, size_t ssize, H5T_simd_class_t dclass,
+    size_t dsize, void *buf, size_t nelmts)
+{
+    int sidx, didx;
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(buf);
+
+    if((sidx = H5T__simd_index(ssize)) >= 0 && (didx = H5T__simd_index(dsize)) >= 0) {
+        sidx += (int)sclass * H5T_SIMD_NSIZES;
+        didx += (int)dclass * H5T_SIMD_NSIZES;
+        if(H5T_simd_conv_g[sidx][didx]) {
+            (*H5T_simd_conv_g[sidx][didx])((uint8_t *)buf, nelmts);
+            ret_value = TRUE;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__simd_conv() */
@@ -49,6 +49,13 @@
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             7   /* H5Dchunk_write               */
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8   /* H5Dvlen_get_buf_size         */
 #define H5VL_NATIVE_DATASET_GET_OFFSET              9   /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_READ_MULTI              10  /* H5Dread_multi                */
+#define H5VL_NATIVE_DATASET_WRITE_MULTI             11  /* H5Dwrite_multi               */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS   12  /* H5Dget_chunk_cache_stats     */
+#define H5VL_NATIVE_DATASET_CHUNK_READ_MULTI        13  /* H5Dread_chunks               */
+#define H5VL_NATIVE_DATASET_CHUNK_MAP               14  /* H5Dmap_chunks                */
+#define H5VL_NATIVE_DATASET_CHUNK_ITER              15  /* H5Dchunk_iter                */
+#define H5VL_NATIVE_DATASET_PREPARE_READ            16  /* H5Dprepare_read              */
 
 /* Values for native VOL connector file optional VOL operations */
 #define H5VL_NATIVE_FILE_CLEAR_ELINK_CACHE             0   /* H5Fclear_elink_file_cache            */
@@ -80,6 +87,7 @@
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY             26  /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY             27  /* H5Fset_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_POST_OPEN                     28  /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_MDC_HR_BY_TYPE            29  /* H5Fget_mdc_hit_rate_by_type          */
 
 /* Values for native VOL connector group optional VOL operations */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
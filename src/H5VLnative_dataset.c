@@ -23,6 +23,7 @@
 #include "H5Fprivate.h"         /* Files                                    */
 #include "H5Gprivate.h"         /* Groups                                   */
 #include "H5Iprivate.h"         /* IDs                                      */
+#include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Pprivate.h"         /* Property lists                           */
 #include "H5Sprivate.h"         /* Dataspaces                               */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
@@ -148,6 +149,7 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id,
     H5D_t         *dset = (H5D_t *)obj;
     const H5S_t   *mem_space = NULL;
     const H5S_t   *file_space = NULL;
+    H5D_dset_io_info_t dset_info;                       /* Dataset I/O info */
     herr_t         ret_value = SUCCEED;                 /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -163,7 +165,12 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id,
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
 
     /* Read raw data */
-    if(H5D__read(dset, mem_type_id, mem_space, file_space, buf/*out*/) < 0)
+    dset_info.dset = dset;
+    dset_info.mem_type_id = mem_type_id;
+    dset_info.mem_space = mem_space;
+    dset_info.file_space = file_space;
+    dset_info.u.rbuf = buf;
+    if(H5D__read(1, &dset_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
@@ -188,6 +195,7 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id,
     H5D_t           *dset = (H5D_t *)obj;
     const H5S_t     *mem_space = NULL;
     const H5S_t     *file_space = NULL;
+    H5D_dset_io_info_t dset_info;                /* Dataset I/O info */
     herr_t           ret_value = SUCCEED;        /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -203,7 +211,12 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id,
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
 
     /* Write the data */
-    if(H5D__write(dset, mem_type_id, mem_space, file_space, buf) < 0)
+    dset_info.dset = dset;
+    dset_info.mem_type_id = mem_type_id;
+    dset_info.mem_space = mem_space;
+    dset_info.file_space = file_space;
+    dset_info.u.wbuf = buf;
+    if(H5D__write(1, &dset_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
 
 done:
@@ -366,6 +379,56 @@ done:
 } /* end H5VL__native_dataset_specific() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_multi_info
+ *
+ * Purpose:     Sets up the dataset I/O info for the datasets of a
+ *              multi-dataset read or write.  The buffers are filled in
+ *              by the caller.
+ *
+ * Return:      Success:    Array of COUNT dataset I/O info structs
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_dset_io_info_t *
+H5VL__native_dataset_multi_info(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[])
+{
+    H5D_dset_io_info_t *dset_info = NULL;       /* Dataset I/O info */
+    size_t u;                                   /* Local index variable */
+    H5D_dset_io_info_t *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (dset_info = (H5D_dset_io_info_t *)H5MM_malloc(count * sizeof(H5D_dset_io_info_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate dataset I/O info")
+
+    for(u = 0; u < count; u++) {
+        if(NULL == (dset_info[u].dset = (H5D_t *)H5VL_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataset")
+        if(NULL == dset_info[u].dset->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "dataset is not associated with a file")
+        dset_info[u].mem_type_id = mem_type_id[u];
+
+        /* Get validated dataspace pointers */
+        if(H5S_get_validated_dataspace(mem_space_id[u], &dset_info[u].mem_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "could not get a validated dataspace from mem_space_id")
+        if(H5S_get_validated_dataspace(file_space_id[u], &dset_info[u].file_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+    ret_value = dset_info;
+
+done:
+    if(NULL == ret_value)
+        H5MM_xfree(dset_info);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_multi_info() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_optional
  *
@@ -528,6 +591,24 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
                 break;
             }
 
+        case H5VL_NATIVE_DATASET_CHUNK_ITER:
+            {   /* H5Dchunk_iter */
+                H5D_chunk_iter_op_t op      = HDva_arg(arguments, H5D_chunk_iter_op_t);
+                void               *op_data = HDva_arg(arguments, void *);
+
+                HDassert(dset->shared);
+
+                /* Make sure the dataset is chunked */
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Call private function */
+                if(H5D__chunk_iter(dset, op, op_data) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+                break;
+            }
+
         case H5VL_NATIVE_DATASET_CHUNK_READ:
             {   /* H5Dread_chunk */
                 const       hsize_t *offset     = HDva_arg(arguments, hsize_t *);
@@ -604,6 +685,116 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
                 break;
             }
 
+        /* H5Dread_multi */
+        case H5VL_NATIVE_DATASET_READ_MULTI:
+            {
+                size_t count = HDva_arg(arguments, size_t);
+                const hid_t *dset_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *mem_type_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *mem_space_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+                void **buf = HDva_arg(arguments, void **);
+                H5D_dset_io_info_t *dset_info;
+                size_t u;
+
+                if(NULL == (dset_info = H5VL__native_dataset_multi_info(count, dset_id, mem_type_id, mem_space_id, file_space_id)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset read")
+                for(u = 0; u < count; u++)
+                    dset_info[u].u.rbuf = buf[u];
+
+                /* Read raw data */
+                if(H5D__read(count, dset_info) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+                H5MM_xfree(dset_info);
+                break;
+            }
+
+        /* H5Dwrite_multi */
+        case H5VL_NATIVE_DATASET_WRITE_MULTI:
+            {
+                size_t count = HDva_arg(arguments, size_t);
+                const hid_t *dset_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *mem_type_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *mem_space_id = HDva_arg(arguments, const hid_t *);
+                const hid_t *file_space_id = HDva_arg(arguments, const hid_t *);
+                const void **buf = HDva_arg(arguments, const void **);
+                H5D_dset_io_info_t *dset_info;
+                size_t u;
+
+                if(NULL == (dset_info = H5VL__native_dataset_multi_info(count, dset_id, mem_type_id, mem_space_id, file_space_id)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset write")
+                for(u = 0; u < count; u++)
+                    dset_info[u].u.wbuf = buf[u];
+
+                /* Write the data */
+                if(H5D__write(count, dset_info) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+                H5MM_xfree(dset_info);
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_GET_CHUNK_CACHE_STATS:
+            {   /* H5Dget_chunk_cache_stats */
+                H5D_chunk_cache_stats_t *stats = HDva_arg(arguments, H5D_chunk_cache_stats_t *);
+
+                /* Make sure the dataset is chunked */
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Call private function */
+                if(H5D__get_chunk_cache_stats(dset, stats) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk cache statistics")
+
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+        case H5VL_NATIVE_DATASET_CHUNK_MAP:
+            {   /* H5Dread_chunks / H5Dmap_chunks */
+                size_t          count       = HDva_arg(arguments, size_t);
+                const hsize_t  *offsets     = HDva_arg(arguments, const hsize_t *);
+                uint32_t       *filters     = HDva_arg(arguments, uint32_t *);
+                hsize_t        *sizes       = HDva_arg(arguments, hsize_t *);
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Read or map the raw chunks */
+                if(H5VL_NATIVE_DATASET_CHUNK_READ_MULTI == optional_type) {
+                    void **bufs = HDva_arg(arguments, void **);
+
+                    if(H5D__chunk_direct_read_multi(dset, count, offsets, filters, sizes, bufs, NULL) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+                } /* end if */
+                else {
+                    const void **ptrs = HDva_arg(arguments, const void **);
+
+                    if(H5D__chunk_direct_read_multi(dset, count, offsets, filters, sizes, NULL, ptrs) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't map unprocessed chunk data")
+                } /* end else */
+
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_PREPARE_READ:
+            {   /* H5Dprepare_read */
+                hid_t mem_type_id = HDva_arg(arguments, hid_t);
+                H5D_prepared_read_t **prep = HDva_arg(arguments, H5D_prepared_read_t **);
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+                /* Set up the prepared read */
+                if(NULL == (*prep = H5D__contig_prepare_read(dset, mem_type_id)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't prepare read")
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
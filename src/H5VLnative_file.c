@@ -551,6 +551,20 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type,
                 break;
             }
 
+        /* H5Fget_mdc_hit_rate_by_type */
+        case H5VL_NATIVE_FILE_GET_MDC_HR_BY_TYPE:
+            {
+                H5F_mem_t type         = (H5F_mem_t)HDva_arg(arguments, int); /* enum work-around */
+                double *hit_rate_ptr   = HDva_arg(arguments, double *);
+                hsize_t *hits_ptr      = HDva_arg(arguments, hsize_t *);
+                hsize_t *misses_ptr    = HDva_arg(arguments, hsize_t *);
+
+                /* Go get the hit rate for the type */
+                if(H5AC_get_cache_hit_rate_by_type(f->shared->cache, type, hit_rate_ptr, hits_ptr, misses_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5AC_get_cache_hit_rate_by_type() failed.")
+                break;
+            }
+
         /* H5Fget_mdc_size */
         case H5VL_NATIVE_FILE_GET_MDC_SIZE:
             {
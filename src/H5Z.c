@@ -104,6 +104,14 @@ H5Z__init_package(void)
     if (H5Z_register(H5Z_DEFLATE) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register deflate filter")
 #endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_LZ4
+    if (H5Z_register(H5Z_LZ4) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register lz4 filter")
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if (H5Z_register(H5Z_ZSTD) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register zstd filter")
+#endif /* H5_HAVE_FILTER_ZSTD */
 #ifdef H5_HAVE_FILTER_SZIP
     H5Z_SZIP->encoder_present = SZ_encoder_enabled();
     if (H5Z_register(H5Z_SZIP) < 0)
@@ -1506,6 +1514,159 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_all_filters_avail() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z_pipeline_reentrant
+ *
+ * Purpose:  Check whether the reverse (read) direction of a pipeline may
+ *           be run concurrently from several threads, i.e. whether every
+ *           filter in the pipeline is registered with one of the library's
+ *           internal filter classes that keep no global state.
+ *
+ *           Application-registered and dynamically loaded filters are
+ *           never assumed to be reentrant.
+ *
+ * Return:   TRUE/FALSE (can't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5Z_pipeline_reentrant(const H5O_pline_t *pline)
+{
+    size_t i;                   /* Local index variable */
+    hbool_t ret_value = TRUE;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(pline);
+
+    /* Iterate through all the filters in pipeline */
+    for (i = 0; i < pline->nused; i++) {
+        int fclass_idx;             /* Index of filter class in global table */
+        H5Z_func_t filter;          /* Registered filter callback */
+
+        /* The filter must already be registered */
+        if ((fclass_idx = H5Z_find_idx(pline->filter[i].id)) < 0)
+            HGOTO_DONE(FALSE)
+        filter = H5Z_table_g[fclass_idx].filter;
+
+        /* ... and the registered class must be one of the library's own */
+        if (filter != H5Z_SHUFFLE->filter && filter != H5Z_FLETCHER32->filter
+                && filter != H5Z_NBIT->filter
+#ifdef H5_HAVE_FILTER_DEFLATE
+                && filter != H5Z_DEFLATE->filter
+#endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_LZ4
+                && filter != H5Z_LZ4->filter
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+                && filter != H5Z_ZSTD->filter
+#endif /* H5_HAVE_FILTER_ZSTD */
+                )
+            HGOTO_DONE(FALSE)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline_reentrant() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z_append_dict
+ *
+ * Purpose:  Append a filter to the end of a pipeline, like H5Z_append,
+ *           with a compression dictionary after the CD_NELMTS client data
+ *           values in CD_VALUES.  The dictionary goes into the client data
+ *           as its size in bytes followed by its bytes, packed four to a
+ *           value in little-endian order, so that it is stored with the
+ *           pipeline message of the object.
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_append_dict(H5O_pline_t *pline, H5Z_filter_t filter, unsigned flags,
+    size_t cd_nelmts, const unsigned int cd_values[], const void *dict,
+    size_t dict_size)
+{
+    const uint8_t *p = (const uint8_t *)dict;
+    unsigned      *values = NULL;   /* Client data values with the dictionary */
+    size_t         nvalues;         /* Number of client data values */
+    size_t         u;               /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pline);
+    HDassert(0 == dict_size || dict);
+
+    if (dict_size > H5Z_MAX_DICT_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "compression dictionary is too large")
+
+    /* Build the client data values */
+    nvalues = cd_nelmts + 1 + (dict_size + 3) / 4;
+    if (NULL == (values = (unsigned *)H5MM_calloc(nvalues * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter parameters")
+    if (cd_nelmts > 0)
+        H5MM_memcpy(values, cd_values, cd_nelmts * sizeof(unsigned));
+    values[cd_nelmts] = (unsigned)dict_size;
+    for (u = 0; u < dict_size; u++)
+        values[cd_nelmts + 1 + u / 4] |= (unsigned)p[u] << (8 * (u % 4));
+
+    if (H5Z_append(pline, filter, flags, nvalues, values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add filter to pipeline")
+
+done:
+    H5MM_xfree(values);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_append_dict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__unpack_dict
+ *
+ * Purpose:  Get back the compression dictionary which H5Z_append_dict put
+ *           in the client data of a filter, starting at CD_VALUES[IDX].
+ *           A pipeline without a dictionary, from H5Pset_filter or from
+ *           another application, gives a size of zero.
+ *
+ * Return:   Non-negative on success, with *DICT set to a buffer to free
+ *           with H5MM_xfree (NULL when there is no dictionary)
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z__unpack_dict(size_t cd_nelmts, const unsigned cd_values[], size_t idx,
+    uint8_t **dict, size_t *dict_size)
+{
+    size_t  size = 0;               /* Size of the dictionary */
+    size_t  u;                      /* Local index variable */
+    herr_t  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dict);
+    HDassert(dict_size);
+
+    *dict = NULL;
+    if (cd_nelmts > idx)
+        size = cd_values[idx];
+    if (size > 0) {
+        if (size > H5Z_MAX_DICT_SIZE || cd_nelmts < idx + 1 + (size + 3) / 4)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "invalid compression dictionary")
+        if (NULL == (*dict = (uint8_t *)H5MM_malloc(size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for compression dictionary")
+        for (u = 0; u < size; u++)
+            (*dict)[u] = (uint8_t)(cd_values[idx + 1 + u / 4] >> (8 * (u % 4)));
+    } /* end if */
+    *dict_size = size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unpack_dict() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5Z_delete
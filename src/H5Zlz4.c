@@ -0,0 +1,254 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     The lz4 I/O filter, built into the library under the filter
+ *              id registered for lz4 with The HDF Group.  The data it
+ *              writes are in the format of the lz4 filter plugin, so that
+ *              data written without a dictionary can be read by either.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_LZ4
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+/* Client data values of the filter */
+#define H5Z_LZ4_PARM_BLOCK      0       /* Block size, 0 for the default */
+#define H5Z_LZ4_PARM_LEVEL      1       /* Level: 0 for the fast compressor, else LZ4HC */
+#define H5Z_LZ4_PARM_DICT       2       /* Dictionary size, then its bytes */
+
+/* Default block size, as in the lz4 filter plugin */
+#define H5Z_LZ4_DEFAULT_BLOCK   ((size_t)1 << 30)
+
+/* Size of the header of the compressed data: the size of the data as a
+ * 64-bit and the block size as a 32-bit big-endian integer */
+#define H5Z_LZ4_HDR_SIZE        12
+
+/* Big-endian encoding, as in the lz4 filter plugin */
+#define H5Z_LZ4_ENCODE32(p, n) {                                              \
+    *(p)++ = (uint8_t)((n) >> 24); *(p)++ = (uint8_t)((n) >> 16);             \
+    *(p)++ = (uint8_t)((n) >> 8); *(p)++ = (uint8_t)(n);                      \
+}
+#define H5Z_LZ4_DECODE32(p, n) {                                              \
+    (n) = ((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) |               \
+          ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3];                         \
+    (p) += 4;                                                                 \
+}
+
+/* Local function prototypes */
+static size_t H5Z__filter_lz4(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_LZ4[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_LZ4,             /* Filter id number		*/
+    1,                          /* encoder_present flag (set to true) */
+    1,                          /* decoder_present flag (set to true) */
+    "lz4",                      /* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z__filter_lz4,            /* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_lz4
+ *
+ * Purpose:	Implement an I/O filter around the lz4 algorithm.  The data
+ *              are compressed in blocks, each preceded by its compressed
+ *              size; a block which does not compress is stored as it is.
+ *              A dictionary in the client data primes the compressor and
+ *              decompressor for every block.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    uint8_t     *dict = NULL;           /* Compression dictionary */
+    size_t      dict_size;              /* Size of the dictionary */
+    void        *outbuf = NULL;         /* Pointer to new buffer */
+    LZ4_stream_t *stream = NULL;        /* Fast compressor state with a dictionary */
+    LZ4_streamHC_t *stream_hc = NULL;   /* LZ4HC compressor state with a dictionary */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    /* Check arguments */
+    if(cd_nelmts > H5Z_LZ4_PARM_LEVEL && cd_values[H5Z_LZ4_PARM_LEVEL] > H5Z_LZ4_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid lz4 level")
+    if(H5Z__unpack_dict(cd_nelmts, cd_values, (size_t)H5Z_LZ4_PARM_DICT, &dict, &dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get lz4 dictionary")
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        const uint8_t *p = (const uint8_t *)*buf;
+        const uint8_t *p_end = p + nbytes;
+        uint8_t     *dst;
+        uint64_t    orig_size;
+        uint32_t    block_size, hi, lo;
+        size_t      done;
+
+        if(nbytes < H5Z_LZ4_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "lz4 data too short")
+        H5Z_LZ4_DECODE32(p, hi);
+        H5Z_LZ4_DECODE32(p, lo);
+        orig_size = ((uint64_t)hi << 32) | lo;
+        H5Z_LZ4_DECODE32(p, block_size);
+        if(orig_size > (uint64_t)((size_t)-1) || (orig_size > 0 && 0 == block_size))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "invalid lz4 header")
+
+        /* Allocate space for the uncompressed buffer */
+        if(NULL == (outbuf = H5MM_malloc(MAX((size_t)orig_size, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for lz4 uncompression")
+        dst = (uint8_t *)outbuf;
+
+        for(done = 0; done < (size_t)orig_size; done += block_size) {
+            uint32_t    comp_size;
+
+            if(block_size > (size_t)orig_size - done)
+                block_size = (uint32_t)((size_t)orig_size - done);
+            if(p_end - p < 4)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "lz4 data too short")
+            H5Z_LZ4_DECODE32(p, comp_size);
+            if(comp_size > (size_t)(p_end - p) || comp_size > (uint32_t)LZ4_MAX_INPUT_SIZE)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "lz4 data too short")
+
+            /* A block stored as it is */
+            if(comp_size == block_size)
+                H5MM_memcpy(dst + done, p, (size_t)block_size);
+            else if((int)block_size != LZ4_decompress_safe_usingDict((const char *)p, (char *)(dst + done),
+                        (int)comp_size, (int)block_size, (const char *)dict, (int)dict_size))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "lz4 decompression failed")
+            p += comp_size;
+        } /* end for */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = MAX((size_t)orig_size, 1);
+        ret_value = (size_t)orig_size;
+    } /* end if */
+    else {
+        /*
+         * Output; compress.  The library doesn't provide in-place
+         * compression, so we must allocate a separate buffer for the result.
+         */
+        const uint8_t *src = (const uint8_t *)*buf;
+        uint8_t     *p;
+        unsigned    level = 0;
+        size_t      block_size = H5Z_LZ4_DEFAULT_BLOCK;
+        size_t      nblocks, out_size, done;
+
+        if(cd_nelmts > H5Z_LZ4_PARM_BLOCK && cd_values[H5Z_LZ4_PARM_BLOCK] > 0)
+            block_size = cd_values[H5Z_LZ4_PARM_BLOCK];
+        if(cd_nelmts > H5Z_LZ4_PARM_LEVEL)
+            level = cd_values[H5Z_LZ4_PARM_LEVEL];
+        if(block_size > nbytes)
+            block_size = nbytes;
+        if(block_size > (size_t)LZ4_MAX_INPUT_SIZE)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid lz4 block size")
+
+        /* Allocate output (compressed) buffer */
+        nblocks = block_size > 0 ? (nbytes + block_size - 1) / block_size : 0;
+        out_size = H5Z_LZ4_HDR_SIZE + nblocks * (4 + (size_t)LZ4_COMPRESSBOUND(block_size));
+        if(NULL == (outbuf = H5MM_malloc(out_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz4 destination buffer")
+        p = (uint8_t *)outbuf;
+
+        /* Set up the compressor for a dictionary */
+        if(dict_size > 0) {
+            if(level > 0) {
+                if(NULL == (stream_hc = LZ4_createStreamHC()))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to create lz4 stream")
+            } /* end if */
+            else if(NULL == (stream = LZ4_createStream()))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to create lz4 stream")
+        } /* end if */
+
+        /* Header */
+        H5Z_LZ4_ENCODE32(p, (uint32_t)((uint64_t)nbytes >> 32));
+        H5Z_LZ4_ENCODE32(p, (uint32_t)nbytes);
+        H5Z_LZ4_ENCODE32(p, (uint32_t)block_size);
+
+        for(done = 0; done < nbytes; done += block_size) {
+            size_t  cur = MIN(block_size, nbytes - done);
+            char    *dst = (char *)(p + 4);
+            int     cap = LZ4_COMPRESSBOUND(cur);
+            int     comp_size;
+
+            if(stream_hc) {
+                LZ4_resetStreamHC_fast(stream_hc, (int)level);
+                LZ4_loadDictHC(stream_hc, (const char *)dict, (int)dict_size);
+                comp_size = LZ4_compress_HC_continue(stream_hc, (const char *)(src + done), dst, (int)cur, cap);
+            } /* end if */
+            else if(stream) {
+                LZ4_loadDict(stream, (const char *)dict, (int)dict_size);
+                comp_size = LZ4_compress_fast_continue(stream, (const char *)(src + done), dst, (int)cur, cap, 1);
+            } /* end if */
+            else if(level > 0)
+                comp_size = LZ4_compress_HC((const char *)(src + done), dst, (int)cur, cap, (int)level);
+            else
+                comp_size = LZ4_compress_default((const char *)(src + done), dst, (int)cur, cap);
+
+            /* Store a block which does not compress as it is */
+            if(comp_size <= 0 || (size_t)comp_size >= cur) {
+                H5MM_memcpy(dst, src + done, cur);
+                comp_size = (int)cur;
+            } /* end if */
+            H5Z_LZ4_ENCODE32(p, (uint32_t)comp_size);
+            p += comp_size;
+        } /* end for */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = out_size;
+        ret_value = (size_t)(p - (uint8_t *)*buf);
+    } /* end else */
+
+done:
+    if(stream)
+        LZ4_freeStream(stream);
+    if(stream_hc)
+        LZ4_freeStreamHC(stream_hc);
+    H5MM_xfree(dict);
+    H5MM_xfree(outbuf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_lz4() */
+#endif /* H5_HAVE_FILTER_LZ4 */
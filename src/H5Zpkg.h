@@ -46,6 +46,16 @@ H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
 H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+/* lz4 filter */
+#ifdef H5_HAVE_FILTER_LZ4
+H5_DLLVAR const H5Z_class2_t H5Z_LZ4[1];
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+/* zstd filter */
+#ifdef H5_HAVE_FILTER_ZSTD
+H5_DLLVAR const H5Z_class2_t H5Z_ZSTD[1];
+#endif /* H5_HAVE_FILTER_ZSTD */
+
 /* szip filter */
 #ifdef H5_HAVE_FILTER_SZIP
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
@@ -53,6 +63,8 @@ H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 
 /* Package internal routines */
 H5_DLL herr_t H5Z__unregister(H5Z_filter_t filter_id);
+H5_DLL herr_t H5Z__unpack_dict(size_t cd_nelmts, const unsigned cd_values[],
+    size_t idx, uint8_t **dict, size_t *dict_size);
 
 #endif /* _H5Zpkg_H */
 
@@ -40,6 +40,8 @@ typedef int H5Z_filter_t;
 #define H5Z_FILTER_NBIT         5       /*nbit compression              */
 #define H5Z_FILTER_SCALEOFFSET  6       /*scale+offset compression      */
 #define H5Z_FILTER_RESERVED     256	/*filter ids below this value are reserved for library use */
+#define H5Z_FILTER_LZ4          32004   /*lz4 compression (registered id) */
+#define H5Z_FILTER_ZSTD         32015   /*zstd compression (registered id) */
 
 #define H5Z_FILTER_MAX		65535	/*maximum filter id		*/
 
@@ -91,6 +93,14 @@ typedef int H5Z_filter_t;
 /* Macros for the scale offset filter */
 #define H5Z_SCALEOFFSET_USER_NPARMS      2    /* Number of parameters that users can set */
 
+/* Macros for the lz4 and zstd filters */
+#define H5Z_LZ4_MAX_LEVEL       12      /* Highest lz4 level (LZ4HC); 0 is the fast compressor */
+#define H5Z_ZSTD_MAX_LEVEL      22      /* Highest zstd level */
+#define H5Z_MAX_DICT_SIZE       (48 * 1024) /* Largest compression dictionary, which is
+                                         * stored with the filter parameters in the
+                                         * pipeline message and so must fit in an
+                                         * object header message */
+
 
 /* Special parameters for ScaleOffset filter*/
 #define H5Z_SO_INT_MINBITS_DEFAULT 0
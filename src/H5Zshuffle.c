@@ -22,8 +22,23 @@
 #include "H5Tprivate.h"		/* Datatypes         			*/
 #include "H5Zpkg.h"		/* Data filters				*/
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define H5Z_SHUFFLE_SSE2
+#include <emmintrin.h>
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5Z_SHUFFLE_AVX2
+#include <immintrin.h>
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#endif
+
+/* Vector kernel which [un]shuffles the first elements of a buffer, returning
+ * how many it did */
+typedef size_t (*H5Z_shuffle_kernel_t)(unsigned char *dest,
+    const unsigned char *src, unsigned bytesoftype, size_t numofelements);
+
 /* Local function prototypes */
 static herr_t H5Z_set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static void H5Z__shuffle_init_kernels(void);
 static size_t H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts,
     const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
 
@@ -42,6 +57,26 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
 /* Local macros */
 #define H5Z_SHUFFLE_PARM_SIZE      0       /* "Local" parameter for shuffling size */
 
+/* Largest element size the vector kernels handle; they handle the sizes
+ * which are powers of two from 2 bytes to this */
+#define H5Z_SHUFFLE_SIMD_MAXSIZE   16
+
+/* Attribute for the functions using AVX2 instructions */
+#define H5Z_AVX2                   __attribute__((target("avx2")))
+
+/* Inline the block functions of the vector kernels into the kernels, so
+ * that their loops are unrolled for each element size */
+#if defined(__GNUC__) || defined(__clang__)
+#define H5Z_SHUFFLE_INLINE         H5_INLINE __attribute__((always_inline))
+#else
+#define H5Z_SHUFFLE_INLINE         H5_INLINE
+#endif
+
+/* Whether the vector kernels were picked yet, and the ones picked */
+static hbool_t H5Z_shuffle_kernels_init_g = FALSE;
+static H5Z_shuffle_kernel_t H5Z_shuffle_kernel_g = NULL;
+static H5Z_shuffle_kernel_t H5Z_unshuffle_kernel_g = NULL;
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z_set_local_shuffle
@@ -95,6 +130,266 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_set_local_shuffle() */
 
+
+#ifdef H5Z_SHUFFLE_SSE2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_sse2_round
+ *
+ * Purpose:	Interleave the bytes of the first half of the K vectors in
+ *              V with those of the second half: vector I of the first half
+ *              and vector I of the second half give vectors 2I and 2I+1.
+ *
+ *              Four such rounds transpose a block of 16 elements of K
+ *              bytes, held in K vectors, into K vectors each holding one
+ *              byte position of the 16 elements, in order; log2(K) rounds
+ *              undo that.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_SHUFFLE_INLINE void
+H5Z__shuffle_sse2_round(__m128i *v, unsigned k)
+{
+    __m128i t[H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i;
+
+    for(i = 0; i < k / 2; i++) {
+        t[2 * i] = _mm_unpacklo_epi8(v[i], v[i + k / 2]);
+        t[2 * i + 1] = _mm_unpackhi_epi8(v[i], v[i + k / 2]);
+    } /* end for */
+    for(i = 0; i < k; i++)
+        v[i] = t[i];
+} /* end H5Z__shuffle_sse2_round() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_sse2_block
+ *
+ * Purpose:	Shuffle a block of 64 elements of K bytes from SRC into
+ *              DEST, where the bytes of each byte position go STRIDE bytes
+ *              apart.  The block is transposed as four blocks of 16
+ *              elements, whose results are stored together so that each
+ *              byte position gets 64 bytes, a whole cache line, at once:
+ *              storing to many lines that far apart, one part at a time,
+ *              can make them evict each other from the cache.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_SHUFFLE_INLINE void
+H5Z__shuffle_sse2_block(unsigned char *dest, const unsigned char *src,
+    unsigned k, size_t stride)
+{
+    __m128i v[4][H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i, j;
+
+    for(j = 0; j < 4; j++) {
+        for(i = 0; i < k; i++)
+            v[j][i] = _mm_loadu_si128((const __m128i *)(src + 16 * (j * k + i)));
+        for(i = 0; i < 4; i++)
+            H5Z__shuffle_sse2_round(v[j], k);
+    } /* end for */
+    for(i = 0; i < k; i++)
+        for(j = 0; j < 4; j++)
+            _mm_storeu_si128((__m128i *)(dest + i * stride + 16 * j), v[j][i]);
+} /* end H5Z__shuffle_sse2_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_sse2_block
+ *
+ * Purpose:	Unshuffle a block of 16 elements of K bytes: gather the
+ *              bytes of each element, STRIDE bytes apart, from SRC into
+ *              DEST.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_SHUFFLE_INLINE void
+H5Z__unshuffle_sse2_block(unsigned char *dest, const unsigned char *src,
+    unsigned k, size_t stride)
+{
+    __m128i v[H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i;
+
+    for(i = 0; i < k; i++)
+        v[i] = _mm_loadu_si128((const __m128i *)(src + i * stride));
+    for(i = 1; i < k; i <<= 1)
+        H5Z__shuffle_sse2_round(v, k);
+    for(i = 0; i < k; i++)
+        _mm_storeu_si128((__m128i *)(dest + 16 * i), v[i]);
+} /* end H5Z__unshuffle_sse2_block() */
+
+/* Define a kernel NAME which [un]shuffles the whole blocks of N elements at
+ * the start of a buffer with BLOCK, specialized for each element size so
+ * that the compiler unrolls the loops over the vectors of a block */
+#define H5Z_SHUFFLE_LOOP(BLOCK, N, SHUFFLE, K)                                \
+    for(e = 0; e + (N) <= numofelements; e += (N))                            \
+        if(SHUFFLE)                                                           \
+            BLOCK(dest + e, src + e * (K), (K), numofelements);               \
+        else                                                                  \
+            BLOCK(dest + e * (K), src + e, (K), numofelements);
+#define H5Z_SHUFFLE_KERNEL(ATTR, NAME, BLOCK, N, SHUFFLE)                     \
+ATTR static size_t                                                            \
+NAME(unsigned char *dest, const unsigned char *src, unsigned bytesoftype,     \
+    size_t numofelements)                                                     \
+{                                                                             \
+    size_t e;                                                                 \
+                                                                              \
+    switch(bytesoftype) {                                                     \
+        case 2: H5Z_SHUFFLE_LOOP(BLOCK, N, SHUFFLE, 2) break;                 \
+        case 4: H5Z_SHUFFLE_LOOP(BLOCK, N, SHUFFLE, 4) break;                 \
+        case 8: H5Z_SHUFFLE_LOOP(BLOCK, N, SHUFFLE, 8) break;                 \
+        case 16: H5Z_SHUFFLE_LOOP(BLOCK, N, SHUFFLE, 16) break;               \
+        default: e = 0; break;                                                \
+    } /* end switch */                                                        \
+                                                                              \
+    return e;                                                                 \
+}
+
+H5Z_SHUFFLE_KERNEL(, H5Z__shuffle_sse2, H5Z__shuffle_sse2_block, 64, 1)
+H5Z_SHUFFLE_KERNEL(, H5Z__unshuffle_sse2, H5Z__unshuffle_sse2_block, 16, 0)
+
+#ifdef H5Z_SHUFFLE_AVX2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_avx2_round
+ *
+ * Purpose:	AVX2 version of H5Z__shuffle_sse2_round.  The AVX2 unpack
+ *              instructions work on each 128-bit half of the vectors on
+ *              its own, so the halves carry two independent blocks.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5Z_AVX2 static H5Z_SHUFFLE_INLINE void
+H5Z__shuffle_avx2_round(__m256i *v, unsigned k)
+{
+    __m256i t[H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i;
+
+    for(i = 0; i < k / 2; i++) {
+        t[2 * i] = _mm256_unpacklo_epi8(v[i], v[i + k / 2]);
+        t[2 * i + 1] = _mm256_unpackhi_epi8(v[i], v[i + k / 2]);
+    } /* end for */
+    for(i = 0; i < k; i++)
+        v[i] = t[i];
+} /* end H5Z__shuffle_avx2_round() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_avx2_block
+ *
+ * Purpose:	Shuffle a block of 64 elements of K bytes from SRC into
+ *              DEST, like H5Z__shuffle_sse2_block.  Each 32 elements go
+ *              through a set of vectors, the first 16 of them through the
+ *              low halves and the next 16 through the high halves, so that
+ *              each vector ends up with 32 bytes of one byte position, in
+ *              order.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5Z_AVX2 static H5Z_SHUFFLE_INLINE void
+H5Z__shuffle_avx2_block(unsigned char *dest, const unsigned char *src,
+    unsigned k, size_t stride)
+{
+    __m256i v[2][H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i, j;
+
+    for(j = 0; j < 2; j++) {
+        for(i = 0; i < k; i++)
+            v[j][i] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(src + 16 * (2 * j * k + i)))),
+                    _mm_loadu_si128((const __m128i *)(src + 16 * ((2 * j + 1) * k + i))), 1);
+        for(i = 0; i < 4; i++)
+            H5Z__shuffle_avx2_round(v[j], k);
+    } /* end for */
+    for(i = 0; i < k; i++)
+        for(j = 0; j < 2; j++)
+            _mm256_storeu_si256((__m256i *)(dest + i * stride + 32 * j), v[j][i]);
+} /* end H5Z__shuffle_avx2_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_avx2_block
+ *
+ * Purpose:	Unshuffle a block of 32 elements of K bytes: gather the
+ *              bytes of each element, STRIDE bytes apart, from SRC into
+ *              DEST.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5Z_AVX2 static H5Z_SHUFFLE_INLINE void
+H5Z__unshuffle_avx2_block(unsigned char *dest, const unsigned char *src,
+    unsigned k, size_t stride)
+{
+    __m256i v[H5Z_SHUFFLE_SIMD_MAXSIZE];
+    unsigned i;
+
+    for(i = 0; i < k; i++)
+        v[i] = _mm256_loadu_si256((const __m256i *)(src + i * stride));
+    for(i = 1; i < k; i <<= 1)
+        H5Z__shuffle_avx2_round(v, k);
+    for(i = 0; i < k; i += 2) {
+        _mm256_storeu_si256((__m256i *)(dest + 16 * i), _mm256_permute2x128_si256(v[i], v[i + 1], 0x20));
+        _mm256_storeu_si256((__m256i *)(dest + 16 * (k + i)), _mm256_permute2x128_si256(v[i], v[i + 1], 0x31));
+    } /* end for */
+} /* end H5Z__unshuffle_avx2_block() */
+
+H5Z_SHUFFLE_KERNEL(H5Z_AVX2, H5Z__shuffle_avx2, H5Z__shuffle_avx2_block, 64, 1)
+H5Z_SHUFFLE_KERNEL(H5Z_AVX2, H5Z__unshuffle_avx2, H5Z__unshuffle_avx2_block, 32, 0)
+
+#endif /* H5Z_SHUFFLE_AVX2 */
+#endif /* H5Z_SHUFFLE_SSE2 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_init_kernels
+ *
+ * Purpose:	Pick the vector kernels for the instruction sets of the
+ *              processor the library runs on.  Setting the
+ *              HDF5_DISABLE_SIMD environment variable turns them off,
+ *              leaving the filter to the scalar code.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_init_kernels(void)
+{
+    const char *s;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5Z_shuffle_kernels_init_g = TRUE;
+
+    s = HDgetenv("HDF5_DISABLE_SIMD");
+    if(!(s && HDisdigit(*s) && HDstrtol(s, NULL, 0) != 0)) {
+#ifdef H5Z_SHUFFLE_SSE2
+        H5Z_shuffle_kernel_g = H5Z__shuffle_sse2;
+        H5Z_unshuffle_kernel_g = H5Z__unshuffle_sse2;
+#endif /* H5Z_SHUFFLE_SSE2 */
+#ifdef H5Z_SHUFFLE_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")) {
+            H5Z_shuffle_kernel_g = H5Z__shuffle_avx2;
+            H5Z_unshuffle_kernel_g = H5Z__unshuffle_avx2;
+        } /* end if */
+#endif /* H5Z_SHUFFLE_AVX2 */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_init_kernels() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z_filter_shuffle
@@ -127,6 +422,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
     unsigned char *_dest=NULL;  /* Alias for destination buffer */
     unsigned bytesoftype;       /* Number of bytes per element */
     size_t numofelements;       /* Number of elements in buffer */
+    size_t vecelements = 0;     /* Number of elements done by a vector kernel */
+    size_t nelmts;              /* Number of elements left to the scalar code */
     size_t i;                   /* Local index variables */
 #ifdef NO_DUFFS_DEVICE
     size_t j;                   /* Local index variable */
@@ -155,18 +452,26 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         if (NULL==(dest = H5MM_malloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
+        /* Pick the vector kernels the first time through */
+        if(!H5Z_shuffle_kernels_init_g)
+            H5Z__shuffle_init_kernels();
+
         if(flags & H5Z_FLAG_REVERSE) {
-            /* Get the pointer to the source buffer */
-            _src =(unsigned char *)(*buf);
+            /* Unshuffle the leading elements with a vector kernel, if there
+             * is one for this element size */
+            if(H5Z_unshuffle_kernel_g)
+                vecelements = (*H5Z_unshuffle_kernel_g)((unsigned char *)dest, (const unsigned char *)(*buf), bytesoftype, numofelements);
+            nelmts = numofelements - vecelements;
 
             /* Input; unshuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _dest=((unsigned char *)dest)+i;
+            for(i=0; i<bytesoftype && nelmts>0; i++) {
+                _src=((unsigned char *)(*buf))+(i*numofelements)+vecelements;
+                _dest=((unsigned char *)dest)+(vecelements*bytesoftype)+i;
 #define DUFF_GUTS							    \
     *_dest=*_src++;                             \
     _dest+=bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
+                j = nelmts;
                 while(j > 0) {
                     DUFF_GUTS;
 
@@ -176,8 +481,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             {
                 size_t duffs_index; /* Counting index for Duff's device */
 
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
+                duffs_index = (nelmts + 7) / 8;
+                switch (nelmts % 8) {
                     default:
                         HDassert(0 && "This Should never be executed!");
                         break;
@@ -214,24 +519,25 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             } /* end for */
 
             /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _dest -= (bytesoftype - 1);     /*lint !e794 _dest is initialized */
-                H5MM_memcpy((void*)_dest, (void*)_src, leftover);
-            }
+            if(leftover>0)
+                H5MM_memcpy((unsigned char *)dest + (nbytes - leftover), (unsigned char *)(*buf) + (nbytes - leftover), leftover);
         } /* end if */
         else {
-            /* Get the pointer to the destination buffer */
-            _dest =(unsigned char *)dest;
+            /* Shuffle the leading elements with a vector kernel, if there
+             * is one for this element size */
+            if(H5Z_shuffle_kernel_g)
+                vecelements = (*H5Z_shuffle_kernel_g)((unsigned char *)dest, (const unsigned char *)(*buf), bytesoftype, numofelements);
+            nelmts = numofelements - vecelements;
 
             /* Output; shuffle */
-            for(i=0; i<bytesoftype; i++) {
-                _src=((unsigned char *)(*buf))+i;
+            for(i=0; i<bytesoftype && nelmts>0; i++) {
+                _dest=((unsigned char *)dest)+(i*numofelements)+vecelements;
+                _src=((unsigned char *)(*buf))+(vecelements*bytesoftype)+i;
 #define DUFF_GUTS							    \
     *_dest++=*_src;                             \
     _src+=bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
+                j = nelmts;
                 while(j > 0) {
                     DUFF_GUTS;
 
@@ -241,8 +547,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             {
                 size_t duffs_index; /* Counting index for Duff's device */
 
-                duffs_index = (numofelements + 7) / 8;
-                switch (numofelements % 8) {
+                duffs_index = (nelmts + 7) / 8;
+                switch (nelmts % 8) {
                     default:
                         HDassert(0 && "This Should never be executed!");
                         break;
@@ -279,11 +585,8 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
             } /* end for */
 
             /* Add leftover to the end of data */
-            if(leftover>0) {
-                /* Adjust back to end of shuffled bytes */
-                _src -= (bytesoftype - 1);      /*lint !e794 _src is initialized */
-                H5MM_memcpy((void*)_dest, (void*)_src, leftover);
-            }
+            if(leftover>0)
+                H5MM_memcpy((unsigned char *)dest + (nbytes - leftover), (unsigned char *)(*buf) + (nbytes - leftover), leftover);
         } /* end else */
 
         /* Free the input buffer */
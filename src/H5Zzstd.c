@@ -0,0 +1,191 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     The Zstandard I/O filter, built into the library under the
+ *              filter id registered for zstd with The HDF Group.  Each
+ *              chunk is one zstd frame, as with the zstd filter plugin.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_ZSTD
+
+#include <zstd.h>
+
+/* Client data values of the filter */
+#define H5Z_ZSTD_PARM_LEVEL     0       /* Level, a signed int */
+#define H5Z_ZSTD_PARM_DICT      1       /* Dictionary size, then its bytes */
+
+/* Local function prototypes */
+static size_t H5Z__filter_zstd(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_ZSTD[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_ZSTD,            /* Filter id number		*/
+    1,                          /* encoder_present flag (set to true) */
+    1,                          /* decoder_present flag (set to true) */
+    "zstd",                     /* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    H5Z__filter_zstd,           /* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_zstd
+ *
+ * Purpose:	Implement an I/O filter around the Zstandard algorithm,
+ *              with the dictionary in the client data, if any, loaded into
+ *              the compression and decompression contexts.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    uint8_t     *dict = NULL;           /* Compression dictionary */
+    size_t      dict_size;              /* Size of the dictionary */
+    void        *outbuf = NULL;         /* Pointer to new buffer */
+    ZSTD_CCtx   *cctx = NULL;           /* Compression context */
+    ZSTD_DCtx   *dctx = NULL;           /* Decompression context */
+    size_t      status;                 /* Status from zstd operation */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    if(H5Z__unpack_dict(cd_nelmts, cd_values, (size_t)H5Z_ZSTD_PARM_DICT, &dict, &dict_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get zstd dictionary")
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        ZSTD_inBuffer   in;
+        ZSTD_outBuffer  out;
+        unsigned long long content_size;
+        size_t          nalloc = *buf_size;     /* Number of bytes for output buffer */
+
+        if(NULL == (dctx = ZSTD_createDCtx()))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to create zstd decompression context")
+        if(dict_size > 0 && ZSTD_isError(ZSTD_DCtx_loadDictionary(dctx, dict, dict_size)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "unable to load zstd dictionary")
+
+        /* Size the output buffer from the frame header when it has the size */
+        content_size = ZSTD_getFrameContentSize(*buf, nbytes);
+        if(ZSTD_CONTENTSIZE_ERROR == content_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "invalid zstd frame")
+        if(ZSTD_CONTENTSIZE_UNKNOWN != content_size && content_size <= (unsigned long long)((size_t)-1))
+            nalloc = MAX((size_t)content_size, 1);
+
+        /* Allocate space for the uncompressed buffer */
+        if(NULL == (outbuf = H5MM_malloc(nalloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for zstd uncompression")
+
+        in.src = *buf;
+        in.size = nbytes;
+        in.pos = 0;
+        out.dst = outbuf;
+        out.size = nalloc;
+        out.pos = 0;
+
+        /* Loop to uncompress the buffer */
+        do {
+            if(ZSTD_isError(status = ZSTD_decompressStream(dctx, &out, &in)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "zstd decompression failed")
+
+            /* If we're not done and just ran out of buffer space, get more */
+            if(status > 0 && out.pos == out.size) {
+                void *new_outbuf;
+
+                nalloc *= 2;
+                if(NULL == (new_outbuf = H5MM_realloc(outbuf, nalloc)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for zstd uncompression")
+                outbuf = new_outbuf;
+                out.dst = outbuf;
+                out.size = nalloc;
+            } /* end if */
+            else if(status > 0 && in.pos == in.size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "truncated zstd frame")
+        } while(status > 0);
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = nalloc;
+        ret_value = out.pos;
+    } /* end if */
+    else {
+        /*
+         * Output; compress.  The library doesn't provide in-place
+         * compression, so we must allocate a separate buffer for the result.
+         */
+        size_t  out_size = ZSTD_compressBound(nbytes);
+        int     level = 0;
+
+        if(cd_nelmts > H5Z_ZSTD_PARM_LEVEL)
+            level = (int)cd_values[H5Z_ZSTD_PARM_LEVEL];
+
+        if(NULL == (cctx = ZSTD_createCCtx()))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to create zstd compression context")
+        if(ZSTD_isError(ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid zstd level")
+        if(dict_size > 0 && ZSTD_isError(ZSTD_CCtx_loadDictionary(cctx, dict, dict_size)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "unable to load zstd dictionary")
+
+        /* Allocate output (compressed) buffer */
+        if(NULL == (outbuf = H5MM_malloc(out_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate zstd destination buffer")
+
+        /* Perform compression from the source to the destination buffer */
+        if(ZSTD_isError(status = ZSTD_compress2(cctx, outbuf, out_size, *buf, nbytes)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "zstd compression failed")
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf = outbuf;
+        outbuf = NULL;
+        *buf_size = out_size;
+        ret_value = status;
+    } /* end else */
+
+done:
+    if(cctx)
+        ZSTD_freeCCtx(cctx);
+    if(dctx)
+        ZSTD_freeDCtx(dctx);
+    H5MM_xfree(dict);
+    H5MM_xfree(outbuf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_zstd() */
+#endif /* H5_HAVE_FILTER_ZSTD */
@@ -17,7 +17,8 @@
  *			Aug 21 2006
  *			Quincey Koziol <koziol@hdfgroup.org>
  *
- * Purpose:		Internal code for computing fletcher32 checksums
+ * Purpose:		Internal code for computing fletcher32, CRC and lookup3
+ *                      checksums
  *
  *-------------------------------------------------------------------------
  */
@@ -32,6 +33,13 @@
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
 
+#ifdef H5_HAVE_SSE42_CRC32C_DISPATCH
+#include <nmmintrin.h>
+#endif /* H5_HAVE_SSE42_CRC32C_DISPATCH */
+#ifdef __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#endif /* __ARM_FEATURE_CRC32 */
+
 
 /****************/
 /* Local Macros */
@@ -41,11 +49,23 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Polynomial quotient for CRC32C, bit-reversed */
+/* (the Castagnoli polynomial, as used by iSCSI (RFC 3720)) */
+#define H5_CRC32C_QUOTIENT 0x82F63B78
+
+/* Attribute for the functions using SSE4.2 instructions */
+#ifdef H5_HAVE_SSE42_CRC32C_DISPATCH
+#define H5_SSE42                __attribute__((target("sse4.2")))
+#endif /* H5_HAVE_SSE42_CRC32C_DISPATCH */
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Routine updating a running CRC32C with a buffer */
+typedef uint32_t (*H5_crc32c_update_func_t)(uint32_t crc, const uint8_t *buf, size_t len);
+
 
 /********************/
 /* Package Typedefs */
@@ -77,6 +97,12 @@ static uint32_t H5_crc_table[256];
 /* Flag: has the table been computed? */
 static hbool_t H5_crc_table_computed = FALSE;
 
+/* Table of CRC32Cs of all 8-bit messages. */
+static uint32_t H5_crc32c_table[256];
+
+/* Routine for updating CRC32Cs, picked at first use */
+static H5_crc32c_update_func_t H5_crc32c_update_g = NULL;
+
 
 
 /*-------------------------------------------------------------------------
@@ -250,6 +276,208 @@ H5_checksum_crc(const void *_data, size_t len)
     FUNC_LEAVE_NOAPI(H5_checksum_crc_update((uint32_t)0xffffffffL, (const uint8_t *)_data, len) ^ 0xffffffffL)
 } /* end H5_checksum_crc() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c_update_table
+ *
+ * Purpose:	Update a running CRC32C with the bytes buf[0..len-1], one
+ *              byte at a time through a table, for processors without
+ *              CRC32C instructions.
+ *
+ * Return:	32-bit CRC32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_checksum_crc32c_update_table(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    size_t n;           /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(n = 0; n < len; n++)
+        crc = H5_crc32c_table[(crc ^ buf[n]) & 0xff] ^ (crc >> 8);
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5_checksum_crc32c_update_table() */
+
+#ifdef H5_HAVE_SSE42_CRC32C_DISPATCH
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c_update_sse42
+ *
+ * Purpose:	Update a running CRC32C with the bytes buf[0..len-1], using
+ *              the SSE4.2 CRC32 instruction on eight bytes at a time once
+ *              the buffer is aligned.
+ *
+ * Return:	32-bit CRC32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_SSE42 static uint32_t
+H5_checksum_crc32c_update_sse42(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    while(len > 0 && ((uintptr_t)buf & 7) != 0) {
+        crc = _mm_crc32_u8(crc, *buf++);
+        len--;
+    } /* end while */
+#if defined(__x86_64__) || defined(_M_X64)
+    {
+        uint64_t crc64 = crc;
+        uint64_t word;
+
+        while(len >= 8) {
+            HDmemcpy(&word, buf, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            buf += 8;
+            len -= 8;
+        } /* end while */
+        crc = (uint32_t)crc64;
+    }
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+    while(len >= 4) {
+        uint32_t word;
+
+        HDmemcpy(&word, buf, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+        buf += 4;
+        len -= 4;
+    } /* end while */
+    while(len > 0) {
+        crc = _mm_crc32_u8(crc, *buf++);
+        len--;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5_checksum_crc32c_update_sse42() */
+#endif /* H5_HAVE_SSE42_CRC32C_DISPATCH */
+
+#ifdef __ARM_FEATURE_CRC32
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c_update_armv8
+ *
+ * Purpose:	Update a running CRC32C with the bytes buf[0..len-1], using
+ *              the ARMv8 CRC32C instructions on eight bytes at a time once
+ *              the buffer is aligned.
+ *
+ * Return:	32-bit CRC32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_checksum_crc32c_update_armv8(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    while(len > 0 && ((uintptr_t)buf & 7) != 0) {
+        crc = __crc32cb(crc, *buf++);
+        len--;
+    } /* end while */
+    while(len >= 8) {
+        uint64_t word;
+
+        HDmemcpy(&word, buf, sizeof(word));
+        crc = __crc32cd(crc, word);
+        buf += 8;
+        len -= 8;
+    } /* end while */
+    while(len > 0) {
+        crc = __crc32cb(crc, *buf++);
+        len--;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5_checksum_crc32c_update_armv8() */
+#endif /* __ARM_FEATURE_CRC32 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c_init
+ *
+ * Purpose:	Compute the CRC32C table and pick the routine updating
+ *              CRC32Cs for the processor the library runs on.  Setting
+ *              the HDF5_DISABLE_SIMD environment variable leaves the
+ *              checksum to the table.
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_checksum_crc32c_init(void)
+{
+    H5_crc32c_update_func_t update = H5_checksum_crc32c_update_table;
+    const char *s;      /* Environment variable value */
+    uint32_t c;         /* Checksum for each byte value */
+    unsigned n, k;      /* Local index variables */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Compute the checksum for each possible byte value */
+    for(n = 0; n < 256; n++) {
+        c = (uint32_t)n;
+        for(k = 0; k < 8; k++)
+            if(c & 1)
+                c = H5_CRC32C_QUOTIENT ^ (c >> 1);
+            else
+                c = c >> 1;
+        H5_crc32c_table[n] = c;
+    } /* end for */
+
+    s = HDgetenv("HDF5_DISABLE_SIMD");
+    if(!(s && HDisdigit(*s) && HDstrtol(s, NULL, 0) != 0)) {
+#ifdef H5_HAVE_SSE42_CRC32C_DISPATCH
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("sse4.2"))
+            update = H5_checksum_crc32c_update_sse42;
+#endif /* H5_HAVE_SSE42_CRC32C_DISPATCH */
+#ifdef __ARM_FEATURE_CRC32
+        update = H5_checksum_crc32c_update_armv8;
+#endif /* __ARM_FEATURE_CRC32 */
+    } /* end if */
+
+    /* Publish the routine last, once the table is ready */
+    H5_crc32c_update_g = update;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5_checksum_crc32c_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c
+ *
+ * Purpose:	Compute the CRC32C (Castagnoli) checksum of a buffer, with
+ *              the CRC32 instructions of SSE4.2 or ARMv8 when the
+ *              processor has them.
+ *
+ * Note:        Passing the checksum of a buffer as 'initval' continues
+ *              that checksum, so that checksumming two buffers one after
+ *              the other gives the checksum of their concatenation.  An
+ *              'initval' of zero starts a new checksum.
+ *
+ * Return:	32-bit CRC32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5_checksum_crc32c(const void *_data, size_t len, uint32_t initval)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(_data);
+    HDassert(len > 0);
+
+    /* Pick the CRC32C routine if necessary */
+    if(NULL == H5_crc32c_update_g)
+        H5_checksum_crc32c_init();
+
+    FUNC_LEAVE_NOAPI(~(*H5_crc32c_update_g)(~initval, (const uint8_t *)_data, len))
+} /* end H5_checksum_crc32c() */
+
 /*
 -------------------------------------------------------------------------------
 H5_lookup3_mix -- mix 3 32-bit values reversibly.
@@ -384,6 +612,24 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
+#ifndef WORDS_BIGENDIAN
+    /* The bytes of each 32-bit value are taken least significant first,
+     * so on little-endian machines the blocks can be read a word at a
+     * time.  (The copy compiles to plain loads, aligned or not.)
+     */
+    while (length > 12)
+    {
+      uint32_t w[3];
+
+      HDmemcpy(w, k, sizeof(w));
+      a += w[0];
+      b += w[1];
+      c += w[2];
+      H5_lookup3_mix(a, b, c);
+      length -= 12;
+      k += 12;
+    }
+#endif /* WORDS_BIGENDIAN */
     while (length > 12)
     {
       a += k[0];
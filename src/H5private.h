@@ -138,6 +138,14 @@
 #   include <sys/ioctl.h>
 #endif
 
+/*
+ * Memory mapped files.  These are used to read some metadata (e.g. the
+ * metadata cache image) without copying it, where available.
+ */
+#ifdef H5_HAVE_SYS_MMAN_H
+#   include <sys/mman.h>
+#endif
+
 /*
  * System information. These are needed on the DEC Alpha to turn off fixing
  * of unaligned accesses by the operating system during detection of
@@ -1189,9 +1197,15 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDmktime
     #define HDmktime(T)    mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+    #define HDmmap(A,L,P,F,D,O)    mmap(A,L,P,F,D,O)
+#endif /* HDmmap */
 #ifndef HDmodf
     #define HDmodf(X,Y)    modf(X,Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+    #define HDmunmap(A,L)    munmap(A,L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
     #define HDnanosleep(N, O)    nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1228,6 +1242,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpread
     #define HDpread(F,B,C,O)    pread(F,B,C,O)
 #endif /* HDpread */
+#ifndef HDpreadv
+    #define HDpreadv(F,V,C,O)    preadv(F,V,C,O)
+#endif /* HDpreadv */
 #ifndef HDprintf
     #define HDprintf(...)   HDfprintf(stdout, __VA_ARGS__)
 #endif /* HDprintf */
@@ -1243,6 +1260,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpwrite
     #define HDpwrite(F,B,C,O)    pwrite(F,B,C,O)
 #endif /* HDpwrite */
+#ifndef HDpwritev
+    #define HDpwritev(F,V,C,O)    pwritev(F,V,C,O)
+#endif /* HDpwritev */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
@@ -2011,6 +2031,19 @@ typedef struct H5_api_struct {
 #define H5_API_UNLOCK                                                         \
      H5TS_mutex_unlock(&H5_g.init_lock);
 
+/* Macros for giving up the API lock around a blocking operation that
+ * doesn't use library state, so other threads can enter the library
+ * meanwhile, and for taking it back.  The lock is only given up when it is
+ * held for a single API call (see H5TS_mutex_release).
+ * (Not available with Windows threads)
+ */
+#ifndef H5_HAVE_WIN_THREADS
+#define H5_API_RELEASE_LOCK(lock_count)                                       \
+     H5TS_mutex_release(&H5_g.init_lock, &(lock_count))
+#define H5_API_REACQUIRE_LOCK(lock_count)                                     \
+     H5TS_mutex_acquire(&H5_g.init_lock, (lock_count))
+#endif /* H5_HAVE_WIN_THREADS */
+
 /* Macros for thread cancellation-safe mechanism */
 #define H5_API_UNSET_CANCEL                                                   \
     H5TS_cancel_count_inc();
@@ -2703,6 +2736,8 @@ H5_DLL int H5CX_term_package(void);
 H5_DLL int H5D_term_package(void);
 H5_DLL int H5D_top_term_package(void);
 H5_DLL int H5E_term_package(void);
+H5_DLL int H5ES_term_package(void);
+H5_DLL int H5ES_top_term_package(void);
 H5_DLL int H5F_term_package(void);
 H5_DLL int H5FD_term_package(void);
 H5_DLL int H5FL_term_package(void);
@@ -2728,6 +2763,7 @@ H5_DLL int H5Z_term_package(void);
 /* Checksum functions */
 H5_DLL uint32_t H5_checksum_fletcher32(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_crc(const void *data, size_t len);
+H5_DLL uint32_t H5_checksum_crc32c(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_lookup3(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_metadata(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_hash_string(const char *str);
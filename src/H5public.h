@@ -391,6 +391,16 @@ typedef struct H5_alloc_stats_t {
     size_t peak_alloc_blocks_count;    /* Peak # of blocks allocated */
 } H5_alloc_stats_t;
 
+/*
+ * Free list statistics info struct
+ */
+typedef struct H5_free_list_stats_t {
+    unsigned long long total_alloc_count; /* Running count of total # of blocks handed out */
+    unsigned long long reuse_alloc_count; /* Running count of blocks handed out from a free list */
+    size_t curr_free_blocks_count;     /* Current # of blocks kept on the free lists */
+    size_t curr_free_bytes;            /* Current # of bytes kept on the free lists */
+} H5_free_list_stats_t;
+
 /* Functions in H5.c */
 H5_DLL herr_t H5open(void);
 H5_DLL herr_t H5close(void);
@@ -401,6 +411,9 @@ H5_DLL herr_t H5set_free_list_limits (int reg_global_lim, int reg_list_lim,
                 int blk_list_lim);
 H5_DLL herr_t H5get_free_list_sizes(size_t *reg_size, size_t *arr_size,
     size_t *blk_size, size_t *fac_size);
+H5_DLL herr_t H5get_free_list_stats(H5_free_list_stats_t *reg_stats,
+    H5_free_list_stats_t *arr_stats, H5_free_list_stats_t *blk_stats,
+    H5_free_list_stats_t *fac_stats);
 H5_DLL herr_t H5get_alloc_stats(H5_alloc_stats_t *stats);
 H5_DLL herr_t H5get_libversion(unsigned *majnum, unsigned *minnum,
 				unsigned *relnum);
@@ -660,6 +660,41 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'p':
+                        if(ptr) {
+                            if(vp)
+                               HDfprintf(out, "0x%p", vp);
+                            else
+                               HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5D_chunk_cache_policy_t policy = (H5D_chunk_cache_policy_t)HDva_arg(ap, int);
+
+                            switch(policy) {
+                                case H5D_CHUNK_CACHE_POLICY_ERROR:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_ERROR");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_DEFAULT:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_DEFAULT");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LRU:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_LRU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_ARC:
+                                   HDfprintf(out, "H5D_CHUNK_CACHE_POLICY_ARC");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_NTYPES:
+                                default:
+                                   HDfprintf(out, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 's':
                         if(ptr) {
                             if(vp)
@@ -1400,6 +1435,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 HDfprintf(out, "%ld (dataspace selection iterator)", (long)obj);
                                 break;
 
+                            case H5I_EVENTSET:
+                                HDfprintf(out, "%ld (event set)", (long)obj);
+                                break;
+
                             case H5I_NTYPES:
                                 HDfprintf (out, "%ld (ntypes - error)", (long)obj);
                                 break;
@@ -1589,6 +1628,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                     HDfprintf(out, "H5I_SPACE_SEL_ITER");
                                     break;
 
+                                case H5I_EVENTSET:
+                                    HDfprintf(out, "H5I_EVENTSET");
+                                    break;
+
                                 case H5I_NTYPES:
                                     HDfprintf(out, "H5I_NTYPES");
                                     break;
@@ -3641,6 +3684,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
 
                             if(H5Z_FILTER_DEFLATE == id)
                                 HDfprintf(out, "H5Z_FILTER_DEFLATE");
+                            else if(H5Z_FILTER_LZ4 == id)
+                                HDfprintf(out, "H5Z_FILTER_LZ4");
+                            else if(H5Z_FILTER_ZSTD == id)
+                                HDfprintf(out, "H5Z_FILTER_ZSTD");
                             else
                                 HDfprintf(out, "%ld", (long)id);
                         } /* end else */
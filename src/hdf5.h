@@ -24,6 +24,7 @@
 #include "H5ACpublic.h"         /* Metadata cache                           */
 #include "H5Dpublic.h"          /* Datasets                                 */
 #include "H5Epublic.h"          /* Errors                                   */
+#include "H5ESpublic.h"         /* Event Sets                               */
 #include "H5Fpublic.h"          /* Files                                    */
 #include "H5FDpublic.h"         /* File drivers                             */
 #include "H5Gpublic.h"          /* Groups                                   */
@@ -45,8 +46,10 @@
 #include "H5FDdirect.h"         /* Linux direct I/O                         */
 #include "H5FDfamily.h"         /* File families                            */
 #include "H5FDhdfs.h"           /* Hadoop HDFS                              */
+#include "H5FDiouring.h"        /* Linux io_uring I/O                       */
 #include "H5FDlog.h"            /* sec2 driver with I/O logging (for debugging) */
 #include "H5FDmirror.h"         /* Mirror VFD and IPC definitions           */
+#include "H5FDmmap.h"           /* Read-only memory-mapped files            */
 #include "H5FDmpi.h"            /* MPI-based file drivers                   */
 #include "H5FDmulti.h"          /* Usage-partitioned file family            */
 #include "H5FDros3.h"           /* R/O S3 "file" I/O                        */
@@ -404,6 +404,7 @@ set (test_CLEANFILES
     tbogus.h5.copy
     cache_image_test.h5
     direct_chunk.h5
+    direct_chunk_multi.h5
     native_vol_test.h5
     splitter*.h5
     splitter.log
@@ -35602,11 +35602,12 @@ cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr)
  *        slist and the index.  If this changes, the test will likely
  *        also cease to function correctly.
  *
- *        The test relies on a known hash function and hash table
- *        size to select a set of test entries that will all hash
- *        to the same hash bucket -- call it the test hash bucket.
- *        It also relies on known behavior of the cache to place
- *        the entries in the test bucket in a known order.
+ *        The index is now scanned via the index list, which keeps
+ *        the entries in the order in which they were inserted.  The
+ *        test loads a set of test entries in a row, so that they
+ *        are adjacent on the index list -- call it the test hash
+ *        bucket, as the test originally relied on a known hash
+ *        function to place them in the same bucket of the index.
  *
  *        To avoid pre-mature flushes of the entries in the
  *        test hash bucket, all entries are initially clean,
@@ -35663,9 +35664,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 {
     H5C_t *                    cache_ptr = file_ptr->shared->cache;
     int                       i;
-    int                       expected_hash_bucket = 0;
     herr_t                   result;
-    haddr_t                    entry_addr;
     test_entry_t *             entry_ptr;
     test_entry_t *             base_addr = NULL;
     struct H5C_cache_entry_t * scan_ptr;
@@ -35725,8 +35724,8 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
     H5C_stats__reset(cache_ptr);
 
 
-    /* load one dirty and three clean entries that should hash to the
-         * same hash bucket.
+    /* load one dirty and three clean entries that will be adjacent on the
+         * index list.
          */
 
         protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0);
@@ -35741,26 +35740,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
     if(pass) {
 
-        /* verify that the above entries hash to the same bucket */
         base_addr = entries[MONSTER_ENTRY_TYPE];
-        entry_ptr = &(base_addr[0]);
-        entry_addr = entry_ptr->header.addr;
-
-        HDassert(entry_addr == entry_ptr->addr);
-
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
-
-        for (i = 8; i <= 24; i += 8) {
-
-            entry_ptr = &(base_addr[i]);
-            entry_addr = entry_ptr->header.addr;
-
-            if(expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
-
-                pass = FALSE;
-                failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
-            }
-        }
     }
 
     if(pass) {
@@ -35785,22 +35765,6 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
     unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31, H5C__DIRTIED_FLAG);
     }
 
-    if(pass) {
-
-        /* verify that the dirty entry doesn't map to the same
-         * hash bucket as the clean entries.
-         */
-
-        entry_ptr = &(base_addr[31]);
-        entry_addr = entry_ptr->header.addr;
-
-        if(expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
-
-            pass = FALSE;
-            failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
-        }
-    }
-
     if(pass) {
 
     /* Next, create the flush dependency requiring (MET, 31) to
@@ -35834,25 +35798,10 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
     if(pass) {
 
-        /* now do some protect / unprotect cycles to force the
-         * entries into the desired order in the hash bucket.
-         * Recall that entries are moved to the head of the
-         * hash bucket list on lookup.
-         */
-
-    for (i = 24; i >= 0; i -= 8)
-    {
-        protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
-    }
-    }
-
-    if(pass) {
-
-        /* scan the hash bucket to verify that the expected entries appear
+        /* scan the index list to verify that the expected entries appear
          * in the expected order.
          */
-        scan_ptr = cache_ptr->index[expected_hash_bucket];
+        scan_ptr = cache_ptr->il_head;
 
         i = 0;
 
@@ -35863,7 +35812,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
             if(scan_ptr == NULL) {
 
                 pass = FALSE;
-                failure_mssg = "premature end of hash bucket list?!?!";
+                failure_mssg = "premature end of index list?!?!";
 
             } else if((scan_ptr == NULL) ||
                         (scan_ptr != &(entry_ptr->header))) {
@@ -35874,7 +35823,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
             if(pass) {
 
-                scan_ptr = scan_ptr->ht_next;
+                scan_ptr = scan_ptr->il_next;
                 i += 8;
             }
     }
@@ -31,6 +31,17 @@ const char *FILENAME[] = {
 
 /* macro definitions */
 
+/* Cache size and group counts for the replacement policy test */
+#define MDC_RP_CACHE_SIZE           (4 * 1024)
+#define MDC_RP_NUM_WS_GROUPS        4
+#define MDC_RP_NUM_SCAN_GROUPS      512     /* half of them per scan */
+#define MDC_RP_NUM_GROUPS           (MDC_RP_NUM_WS_GROUPS + MDC_RP_NUM_SCAN_GROUPS)
+
+/* Group and chunk counts for the flush thread test */
+#define MDC_FT_NTHREADS             4
+#define MDC_FT_NUM_GROUPS           300
+#define MDC_FT_NUM_CHUNKS           2000
+
 /* private function declarations: */
 
 static hbool_t check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id);
@@ -39,6 +50,11 @@ static hbool_t mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t
 static H5AC_cache_config_t * init_invalid_configs(void);
 static hbool_t check_fapl_mdc_api_errs(void);
 static hbool_t check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id);
+static hbool_t mdc_repl_policy_ohdr_misses(const char *filename,
+    enum H5C_cache_repl_policy policy, const H5O_token_t *tokens,
+    hsize_t *misses_ptr);
+static hbool_t check_mdc_repl_policy(hid_t fcpl_id);
+static hbool_t check_mdc_flush_nthreads(hbool_t latest);
 
 
 
@@ -110,7 +126,9 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t scratch;
     H5C_auto_size_ctl_t default_auto_size_ctl;
@@ -143,7 +161,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
 
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -177,7 +195,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
 
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -288,7 +306,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
      */
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -436,7 +454,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
      */
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(test_fapl_id, &scratch);
 
@@ -535,7 +553,7 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
     H5AC_cache_config_t default_config = H5AC__DEFAULT_CACHE_CONFIG;
     H5AC_cache_config_t mod_config_1 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -566,11 +584,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t mod_config_2 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ TRUE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -601,11 +621,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t mod_config_3 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -636,11 +658,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t mod_config_4 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -672,7 +696,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.1f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
 
     if(paged)
@@ -908,7 +934,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
     H5AC_cache_config_t default_config = H5AC__DEFAULT_CACHE_CONFIG;
     H5AC_cache_config_t mod_config_1 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -939,11 +965,13 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t mod_config_2 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -974,11 +1002,13 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
     H5AC_cache_config_t mod_config_3 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -1009,7 +1039,9 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int        metadata_write_strategy = */
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_repl_policy           */
+      /*                        repl_policy = */ H5C_repl__lru
     };
 
     if(paged)
@@ -1566,7 +1598,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
  *-------------------------------------------------------------------------
  */
 
-#define NUM_INVALID_CONFIGS    36
+#define NUM_INVALID_CONFIGS    37
 static H5AC_cache_config_t * invalid_configs = NULL;
 
 static H5AC_cache_config_t *
@@ -1585,7 +1617,7 @@ init_invalid_configs(void) {
     /* Set defaults for all configs */
     for ( i = 0; i < NUM_INVALID_CONFIGS; i++ ) {
 
-        configs[i].version                  = H5C__CURR_AUTO_SIZE_CTL_VER;
+        configs[i].version                  = H5AC__CURR_CACHE_CONFIG_VERSION;
         configs[i].rpt_fcn_enabled          = FALSE;
         configs[i].open_trace_file          = FALSE;
         configs[i].close_trace_file         = FALSE;
@@ -1615,6 +1647,7 @@ init_invalid_configs(void) {
         configs[i].empty_reserve            = 0.1F;
         configs[i].dirty_bytes_threshold    = (256 * 1024);
         configs[i].metadata_write_strategy  = H5AC__DEFAULT_METADATA_WRITE_STRATEGY;
+        configs[i].repl_policy              = H5C_repl__lru;
     }
 
     /* Set badness for each config */
@@ -1738,6 +1771,9 @@ init_invalid_configs(void) {
     /* 35 -- unknown metadata write strategy */
     configs[35].metadata_write_strategy     = -1;
 
+    /* 36 -- unknown replacement policy */
+    configs[36].repl_policy                 = (enum H5C_cache_repl_policy)-1;
+
     return configs;
 
 } /* initialize_invalid_configs() */
@@ -1773,7 +1809,7 @@ check_fapl_mdc_api_errs(void)
     /* first test H5Pget_mdc_config().
      */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if  ( pass ) {
 
         H5E_BEGIN_TRY {
@@ -1802,7 +1838,7 @@ check_fapl_mdc_api_errs(void)
         }
     }
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( ( pass ) &&
          ( ( H5Pget_mdc_config(fapl_id, &scratch) < 0) ||
            ( !CACHE_CONFIGS_EQUAL(default_config, scratch, TRUE, TRUE) ) ) ) {
@@ -1844,7 +1880,7 @@ check_fapl_mdc_api_errs(void)
     /* now test H5Pset_mdc_config()
      */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( pass ) {
 
         H5E_BEGIN_TRY {
@@ -1891,7 +1927,7 @@ check_fapl_mdc_api_errs(void)
     /* verify that none of the above calls to H5Pset_mdc_config() changed
      * the configuration in the FAPL.
      */
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( ( pass ) &&
          ( ( H5Pget_mdc_config(fapl_id, &scratch) < 0 ) ||
            ( !CACHE_CONFIGS_EQUAL(default_config, scratch, TRUE, TRUE) ) ) ) {
@@ -1997,7 +2033,7 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
     /* test H5Fget_mdc_config().  */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if  ( pass ) {
 
         if ( show_progress ) {
@@ -2056,7 +2092,7 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
     /* test H5Fset_mdc_config() */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( pass ) {
 
         if ( show_progress ) {
@@ -2265,6 +2301,422 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 } /* check_file_mdc_api_errs() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    mdc_repl_policy_ohdr_misses()
+ *
+ * Purpose:     Helper for check_mdc_repl_policy().  Open the file
+ *              built by that function read only with a small, fixed
+ *              size metadata cache using the supplied replacement
+ *              policy.  Alternate between re-opening a small working
+ *              set of groups and scanning through a large number of
+ *              groups that are only opened once, and then return the number
+ *              of object header misses incurred by a final pass over
+ *              the working set.  The groups are opened by token, so
+ *              that only their object headers pass through the cache.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+mdc_repl_policy_ohdr_misses(const char *filename, enum H5C_cache_repl_policy policy,
+    const H5O_token_t *tokens, hsize_t *misses_ptr)
+{
+    hid_t fapl_id = -1;
+    hid_t file_id = -1;
+    hid_t gid = -1;
+    int pass_num;
+    int i;
+    H5AC_cache_config_t config = H5AC__DEFAULT_CACHE_CONFIG;
+
+    config.set_initial_size = TRUE;
+    config.initial_size = MDC_RP_CACHE_SIZE;
+    config.min_size = MDC_RP_CACHE_SIZE;
+    config.max_size = MDC_RP_CACHE_SIZE;
+    config.incr_mode = H5C_incr__off;
+    config.flash_incr_mode = H5C_flash_incr__off;
+    config.decr_mode = H5C_decr__off;
+    config.repl_policy = policy;
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        CACHE_ERROR("H5Pcreate() failed")
+    if(H5Pset_mdc_config(fapl_id, &config) < 0)
+        CACHE_ERROR("H5Pset_mdc_config() failed")
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        CACHE_ERROR("H5Fopen() failed")
+
+    /* Working set, scan, working set, scan, then the measured pass over
+     * the working set.
+     */
+    for(pass_num = 0; pass_num < 5; pass_num++) {
+        hbool_t scan = (hbool_t)(pass_num % 2 == 1);
+        int start = 0;
+        int end = MDC_RP_NUM_WS_GROUPS;
+
+        if(scan) {
+            start = MDC_RP_NUM_WS_GROUPS + (pass_num / 2) * (MDC_RP_NUM_SCAN_GROUPS / 2);
+            end = start + (MDC_RP_NUM_SCAN_GROUPS / 2);
+        } /* end if */
+
+        if(pass_num == 4 && H5Freset_mdc_hit_rate_stats(file_id) < 0)
+            CACHE_ERROR("H5Freset_mdc_hit_rate_stats() failed")
+
+        for(i = start; i < end; i++) {
+            if((gid = H5Oopen_by_token(file_id, tokens[i])) < 0)
+                CACHE_ERROR("H5Oopen_by_token() failed")
+            if(H5Gclose(gid) < 0)
+                CACHE_ERROR("H5Gclose() failed")
+            gid = -1;
+        } /* end for */
+    } /* end for */
+
+    if(H5Fget_mdc_hit_rate_by_type(file_id, H5FD_MEM_OHDR, NULL, NULL, misses_ptr) < 0)
+        CACHE_ERROR("H5Fget_mdc_hit_rate_by_type() failed")
+
+done:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+
+    return pass;
+} /* mdc_repl_policy_ohdr_misses() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_mdc_repl_policy()
+ *
+ * Purpose:     Verify that the replacement policy field of the
+ *              metadata cache configuration makes it to the cache and
+ *              back through both the FAPL and file level API calls,
+ *              that version 1 configurations are still accepted, that
+ *              the per type hit rate statistics add up to the overall
+ *              hit rate, and that the 2Q and ARC policies keep a
+ *              working set resident across a scan that evicts it
+ *              under LRU.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+check_mdc_repl_policy(hid_t fcpl_id)
+{
+    char filename[512];
+    char name[32];
+    hid_t fapl_id = -1;
+    hid_t file_id = -1;
+    hid_t gid = -1;
+    int i;
+    herr_t result;
+    double hit_rate;
+    double type_hit_rate;
+    hsize_t hits;
+    hsize_t misses;
+    hsize_t total_hits = 0;
+    hsize_t total_misses = 0;
+    hsize_t lru_misses = 0;
+    hsize_t twoq_misses = 0;
+    hsize_t arc_misses = 0;
+    H5O_info2_t oinfo;
+    H5O_token_t *tokens = NULL;
+    H5AC_cache_config_t config = H5AC__DEFAULT_CACHE_CONFIG;
+    H5AC_cache_config_t scratch;
+
+    TESTING("MDC replacement policy and per type hit rate API calls")
+
+    pass = TRUE;
+
+    if(h5_fixname(FILENAME[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL)
+        CACHE_ERROR("h5_fixname() failed")
+    if(NULL == (tokens = (H5O_token_t *)HDcalloc(MDC_RP_NUM_GROUPS, sizeof(H5O_token_t))))
+        CACHE_ERROR("can't allocate tokens")
+
+    /* Round trip the replacement policy through a FAPL */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        CACHE_ERROR("H5Pcreate() failed")
+
+    config.repl_policy = H5C_repl__2q;
+    if(H5Pset_mdc_config(fapl_id, &config) < 0)
+        CACHE_ERROR("H5Pset_mdc_config() failed")
+
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if(H5Pget_mdc_config(fapl_id, &scratch) < 0)
+        CACHE_ERROR("H5Pget_mdc_config() failed")
+    if(!CACHE_CONFIGS_EQUAL(config, scratch, TRUE, TRUE))
+        CACHE_ERROR("FAPL config doesn't match the one set")
+
+    /* A version 1 caller gets the fields it knows about, and the
+     * replacement policy is left alone.
+     */
+    scratch.version = H5AC__CACHE_CONFIG_VERSION_1;
+    scratch.repl_policy = (enum H5C_cache_repl_policy)-1;
+    if(H5Pget_mdc_config(fapl_id, &scratch) < 0)
+        CACHE_ERROR("H5Pget_mdc_config() failed for version 1")
+    if(scratch.version != H5AC__CACHE_CONFIG_VERSION_1)
+        CACHE_ERROR("H5Pget_mdc_config() changed the version")
+    if(scratch.repl_policy != (enum H5C_cache_repl_policy)-1)
+        CACHE_ERROR("H5Pget_mdc_config() wrote past a version 1 config")
+    if(scratch.max_size != config.max_size || scratch.metadata_write_strategy != config.metadata_write_strategy)
+        CACHE_ERROR("version 1 FAPL config doesn't match the one set")
+
+    /* ...and a version 1 config is set with the default LRU policy,
+     * whatever happens to follow it in memory.
+     */
+    if(H5Pset_mdc_config(fapl_id, &scratch) < 0)
+        CACHE_ERROR("H5Pset_mdc_config() failed for version 1")
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if(H5Pget_mdc_config(fapl_id, &scratch) < 0)
+        CACHE_ERROR("H5Pget_mdc_config() failed")
+    if(scratch.repl_policy != H5C_repl__lru)
+        CACHE_ERROR("version 1 config didn't select LRU")
+
+    /* Round trip the replacement policy through an open file */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT)) < 0)
+        CACHE_ERROR("H5Fcreate() failed")
+
+    config.repl_policy = H5C_repl__arc;
+    if(H5Fset_mdc_config(file_id, &config) < 0)
+        CACHE_ERROR("H5Fset_mdc_config() failed")
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if(H5Fget_mdc_config(file_id, &scratch) < 0)
+        CACHE_ERROR("H5Fget_mdc_config() failed")
+    if(scratch.repl_policy != H5C_repl__arc)
+        CACHE_ERROR("file config has the wrong replacement policy")
+
+    /* Build the working set and scan groups used below */
+    for(i = 0; i < MDC_RP_NUM_GROUPS; i++) {
+        if(i < MDC_RP_NUM_WS_GROUPS)
+            HDsnprintf(name, sizeof(name), "ws%d", i);
+        else
+            HDsnprintf(name, sizeof(name), "scan%d", i - MDC_RP_NUM_WS_GROUPS);
+        if((gid = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            CACHE_ERROR("H5Gcreate2() failed")
+        if(H5Oget_info3(gid, &oinfo, H5O_INFO_BASIC) < 0)
+            CACHE_ERROR("H5Oget_info3() failed")
+        tokens[i] = oinfo.token;
+        if(H5Gclose(gid) < 0)
+            CACHE_ERROR("H5Gclose() failed")
+        gid = -1;
+    } /* end for */
+
+    /* The per type statistics must add up to the overall ones */
+    if(H5Fget_mdc_hit_rate(file_id, &hit_rate) < 0)
+        CACHE_ERROR("H5Fget_mdc_hit_rate() failed")
+    for(i = (int)H5FD_MEM_DEFAULT; i < (int)H5FD_MEM_NTYPES; i++) {
+        if(H5Fget_mdc_hit_rate_by_type(file_id, (H5F_mem_t)i, &type_hit_rate, &hits, &misses) < 0)
+            CACHE_ERROR("H5Fget_mdc_hit_rate_by_type() failed")
+        if(hits + misses > 0 && !H5_DBL_ABS_EQUAL(type_hit_rate, (double)hits / (double)(hits + misses)))
+            CACHE_ERROR("per type hit rate doesn't match its counts")
+        if(i == (int)H5FD_MEM_OHDR && hits + misses == 0)
+            CACHE_ERROR("no object header accesses counted")
+        total_hits += hits;
+        total_misses += misses;
+    } /* end for */
+    if(total_hits + total_misses == 0)
+        CACHE_ERROR("no accesses counted")
+    if(!H5_DBL_ABS_EQUAL(hit_rate, (double)total_hits / (double)(total_hits + total_misses)))
+        CACHE_ERROR("per type counts don't add up to the overall hit rate")
+
+    H5E_BEGIN_TRY {
+        result = H5Fget_mdc_hit_rate_by_type(file_id, H5FD_MEM_NTYPES, &type_hit_rate, NULL, NULL);
+    } H5E_END_TRY;
+    if(result >= 0)
+        CACHE_ERROR("H5Fget_mdc_hit_rate_by_type() accepted invalid type")
+
+    if(H5Fclose(file_id) < 0)
+        CACHE_ERROR("H5Fclose() failed")
+    file_id = -1;
+
+    /* A scan must not push the working set out of the cache under 2Q
+     * or ARC, as it does under LRU.
+     */
+    if(!mdc_repl_policy_ohdr_misses(filename, H5C_repl__lru, tokens, &lru_misses))
+        goto done;
+    if(!mdc_repl_policy_ohdr_misses(filename, H5C_repl__2q, tokens, &twoq_misses))
+        goto done;
+    if(!mdc_repl_policy_ohdr_misses(filename, H5C_repl__arc, tokens, &arc_misses))
+        goto done;
+
+    if(lru_misses == 0)
+        CACHE_ERROR("scan didn't evict the working set under LRU")
+    if(twoq_misses >= lru_misses)
+        CACHE_ERROR("2Q didn't protect the working set from the scan")
+    if(arc_misses >= lru_misses)
+        CACHE_ERROR("ARC didn't protect the working set from the scan")
+
+done:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    if(tokens)
+        HDfree(tokens);
+
+    if(pass)
+        PASSED();
+    else {
+        H5_FAILED();
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+        HDfprintf(stdout, "%s: OHDR misses LRU/2Q/ARC = %llu/%llu/%llu.\n", FUNC,
+                (unsigned long long)lru_misses, (unsigned long long)twoq_misses,
+                (unsigned long long)arc_misses);
+    } /* end else */
+
+    return pass;
+} /* check_mdc_repl_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_mdc_flush_nthreads()
+ *
+ * Purpose:     Verify the H5Pset/get_mdc_flush_nthreads API calls, and
+ *              that a file whose dirty metadata (group B-trees, symbol
+ *              table nodes and local heaps, or their latest format
+ *              counterparts, and a chunk index) is flushed with several
+ *              threads in batches reads back correctly after H5Fflush
+ *              and H5Fclose.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+check_mdc_flush_nthreads(hbool_t latest)
+{
+    char filename[512];
+    char name[32];
+    hid_t fapl_id = -1;
+    hid_t fapl2_id = -1;
+    hid_t file_id = -1;
+    hid_t gid = -1;
+    hid_t sid = -1;
+    hid_t dcpl_id = -1;
+    hid_t did = -1;
+    hsize_t dims[1] = {MDC_FT_NUM_CHUNKS};
+    hsize_t chunk_dims[1] = {1};
+    int *buf = NULL;
+    unsigned nthreads = 0;
+    herr_t result;
+    int i;
+
+    if(latest)
+        TESTING("MDC flush threads API calls (latest format)")
+    else
+        TESTING("MDC flush threads API calls")
+
+    pass = TRUE;
+
+    if(h5_fixname(FILENAME[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL)
+        CACHE_ERROR("h5_fixname() failed")
+    if(NULL == (buf = (int *)HDmalloc(MDC_FT_NUM_CHUNKS * sizeof(int))))
+        CACHE_ERROR("can't allocate buffer")
+
+    /* Check the default, an invalid value, and a round trip */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        CACHE_ERROR("H5Pcreate() failed")
+    if(H5Pget_mdc_flush_nthreads(fapl_id, &nthreads) < 0)
+        CACHE_ERROR("H5Pget_mdc_flush_nthreads() failed")
+    if(nthreads != 1)
+        CACHE_ERROR("wrong default number of flush threads")
+    H5E_BEGIN_TRY {
+        result = H5Pset_mdc_flush_nthreads(fapl_id, 0);
+    } H5E_END_TRY;
+    if(result >= 0)
+        CACHE_ERROR("H5Pset_mdc_flush_nthreads() accepted 0 threads")
+    if(H5Pset_mdc_flush_nthreads(fapl_id, MDC_FT_NTHREADS) < 0)
+        CACHE_ERROR("H5Pset_mdc_flush_nthreads() failed")
+    if(latest && H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        CACHE_ERROR("H5Pset_libver_bounds() failed")
+
+    /* Build plenty of dirty metadata, flushing it half way */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        CACHE_ERROR("H5Fcreate() failed")
+
+    if((fapl2_id = H5Fget_access_plist(file_id)) < 0)
+        CACHE_ERROR("H5Fget_access_plist() failed")
+    nthreads = 0;
+    if(H5Pget_mdc_flush_nthreads(fapl2_id, &nthreads) < 0)
+        CACHE_ERROR("H5Pget_mdc_flush_nthreads() failed")
+    if(nthreads != MDC_FT_NTHREADS)
+        CACHE_ERROR("file's FAPL has the wrong number of flush threads")
+
+    for(i = 0; i < MDC_FT_NUM_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%d", i);
+        if((gid = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            CACHE_ERROR("H5Gcreate2() failed")
+        if(H5Gclose(gid) < 0)
+            CACHE_ERROR("H5Gclose() failed")
+        gid = -1;
+        if(i == MDC_FT_NUM_GROUPS / 2 && H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0)
+            CACHE_ERROR("H5Fflush() failed")
+    } /* end for */
+
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        CACHE_ERROR("H5Screate_simple() failed")
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        CACHE_ERROR("H5Pcreate() failed")
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        CACHE_ERROR("H5Pset_chunk() failed")
+    if((did = H5Dcreate2(file_id, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        CACHE_ERROR("H5Dcreate2() failed")
+    for(i = 0; i < MDC_FT_NUM_CHUNKS; i++)
+        buf[i] = i * 3 + 1;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        CACHE_ERROR("H5Dwrite() failed")
+    if(H5Dclose(did) < 0)
+        CACHE_ERROR("H5Dclose() failed")
+    did = -1;
+    if(H5Fclose(file_id) < 0)
+        CACHE_ERROR("H5Fclose() failed")
+    file_id = -1;
+
+    /* Read everything back */
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        CACHE_ERROR("H5Fopen() failed")
+    for(i = 0; i < MDC_FT_NUM_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%d", i);
+        if((gid = H5Gopen2(file_id, name, H5P_DEFAULT)) < 0)
+            CACHE_ERROR("H5Gopen2() failed")
+        if(H5Gclose(gid) < 0)
+            CACHE_ERROR("H5Gclose() failed")
+        gid = -1;
+    } /* end for */
+    if((did = H5Dopen2(file_id, "dset", H5P_DEFAULT)) < 0)
+        CACHE_ERROR("H5Dopen2() failed")
+    HDmemset(buf, 0, MDC_FT_NUM_CHUNKS * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        CACHE_ERROR("H5Dread() failed")
+    for(i = 0; i < MDC_FT_NUM_CHUNKS; i++)
+        if(buf[i] != i * 3 + 1)
+            CACHE_ERROR("wrong data read back")
+
+done:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl_id);
+        H5Sclose(sid);
+        H5Gclose(gid);
+        H5Fclose(file_id);
+        H5Pclose(fapl2_id);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+
+    if(pass)
+        PASSED();
+    else {
+        H5_FAILED();
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+    } /* end else */
+
+    return pass;
+} /* check_mdc_flush_nthreads() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -2348,6 +2800,15 @@ main(void)
     if(!check_fapl_mdc_api_errs())
         nerrs += 1;
 
+    if(!check_mdc_repl_policy(fcpl_id))
+        nerrs += 1;
+
+    if(!check_mdc_flush_nthreads(FALSE))
+        nerrs += 1;
+
+    if(!check_mdc_flush_nthreads(TRUE))
+        nerrs += 1;
+
     if(invalid_configs)
         HDfree(invalid_configs);
 
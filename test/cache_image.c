@@ -53,6 +53,7 @@ static unsigned cache_image_smoke_check_3(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_4(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_5(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_6(hbool_t single_file_vfd);
+static unsigned cache_image_smoke_check_7(hbool_t single_file_vfd);
 
 static unsigned cache_image_api_error_check_1(hbool_t single_file_vfd);
 static unsigned cache_image_api_error_check_2(hbool_t single_file_vfd);
@@ -5607,6 +5608,371 @@ cache_image_smoke_check_6(hbool_t single_file_vfd)
 } /* cache_image_smoke_check_6() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_smoke_check_7()
+ *
+ * Purpose:     Verify that read only opens of a file with a metadata
+ *        cache image only create prefetched entries for the
+ *        entries of the image that are used, and that the image
+ *        stays in the file for later opens.
+ *
+ *        1) Create a HDF5 file with the cache image FAPL entry.
+ *
+ *        2) Create some datasets in the file.
+ *
+ *        3) Close the file.
+ *
+ *        4) Open the file read only.
+ *
+ *           Verify that the file contains a metadata cache
+ *           image superblock extension message.
+ *
+ *        5) Open one dataset, and verify that it contains the
+ *           expected data.
+ *
+ *           Verify that the image was loaded, and that some of
+ *           its entries are still pending.
+ *
+ *        6) Close the file.
+ *
+ *        7) Open the file read only again.
+ *
+ *           Verify that the file still contains a metadata cache
+ *           image superblock extension message.
+ *
+ *        8) Open all datasets, and verify that they contain the
+ *           expected data.
+ *
+ *        9) Close the file.
+ *
+ *       10) Open the file R/W.
+ *
+ *           Verify that the file still contains a metadata cache
+ *           image superblock extension message.
+ *
+ *       11) Open all datasets, and verify that they contain the
+ *           expected data.
+ *
+ *       12) Close the file.
+ *
+ *       13) Delete the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+cache_image_smoke_check_7(hbool_t single_file_vfd)
+{
+    const char * fcn_name = "cache_image_smoke_check_7()";
+    char filename[512];
+    hbool_t show_progress = FALSE;
+    hid_t file_id = -1;
+    H5F_t *file_ptr = NULL;
+    H5C_t *cache_ptr = NULL;
+    int cp = 0;
+
+    TESTING("metadata cache image smoke check 7");
+
+    /* Check for VFD that is a single file */
+    if(!single_file_vfd) {
+        SKIPPED();
+        HDputs("    Cache image not supported with the current VFD.");
+        return 0;
+    }
+
+    pass = TRUE;
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 1) Create a HDF5 file with the cache image FAPL entry. */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ TRUE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+                       /* config_fsm         */ TRUE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 2) Create some datasets in the file. */
+
+    if ( pass ) {
+
+        create_datasets(file_id, 0, 10);
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 3) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 4) Open the file read only. */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 5) Open one dataset, and verify that only part of the image
+     *    has been turned into prefetched entries.
+     */
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 0, 0);
+    }
+
+    if ( pass ) {
+
+        if ( ! cache_ptr->image_loaded ) {
+
+            pass = FALSE;
+            failure_mssg = "metadata cache image block not loaded(1).";
+
+        } else if ( cache_ptr->num_pending_image_entries !=
+                    (size_t)cache_ptr->num_entries_in_image ) {
+
+            pass = FALSE;
+            failure_mssg = "image entries not indexed on read only open.";
+
+        } else if ( ( cache_ptr->pending_image_entries_left == 0 ) ||
+                    ( cache_ptr->pending_image_entries_left >=
+                      cache_ptr->num_pending_image_entries ) ) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected number of pending image entries.";
+        }
+    }
+
+#if H5C_COLLECT_CACHE_STATS
+    if ( pass ) {
+
+        if ( cache_ptr->images_loaded != 1 ) {
+
+            pass = FALSE;
+            failure_mssg = "metadata cache image block not loaded(2).";
+
+        } else if ( cache_ptr->prefetches !=
+                    (int64_t)(cache_ptr->num_pending_image_entries -
+                              cache_ptr->pending_image_entries_left) ) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected number of prefetches.";
+        }
+    }
+#endif /* H5C_COLLECT_CACHE_STATS */
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 6) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 7) Open the file read only again. */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 8) Open all datasets, and verify their contents. */
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if ( pass ) {
+
+        if ( ! cache_ptr->image_loaded ) {
+
+            pass = FALSE;
+            failure_mssg = "metadata cache image block not loaded(3).";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 9) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 10) Open the file R/W -- the image must still be there. */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 11) Open all datasets, and verify their contents. */
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if ( pass ) {
+
+        if ( cache_ptr->pending_image_entries != NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "image entries indexed on R/W open.";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 12) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress )
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 13) Delete the file */
+
+    if ( pass ) {
+
+        if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( pass ) { PASSED(); } else { H5_FAILED(); }
+
+    if ( ! pass )
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+
+    return !pass;
+
+} /* cache_image_smoke_check_7() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    cache_image_api_error_check_1()
  *
@@ -8198,6 +8564,7 @@ main(void)
     nerrs += cache_image_smoke_check_4(single_file_vfd);
     nerrs += cache_image_smoke_check_5(single_file_vfd);
     nerrs += cache_image_smoke_check_6(single_file_vfd);
+    nerrs += cache_image_smoke_check_7(single_file_vfd);
 
     nerrs += cache_image_api_error_check_1(single_file_vfd);
     nerrs += cache_image_api_error_check_2(single_file_vfd);
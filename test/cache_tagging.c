@@ -157,24 +157,16 @@ verify_no_unknown_tags(hid_t fid)
 
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5VL_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(!entry_ptr->dirtied)
-                TEST_ERROR;
-
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(!entry_ptr->dirtied)
+            TEST_ERROR;
 
     return 0;
 
@@ -205,24 +197,16 @@ mark_all_entries_investigated(hid_t fid)
 {
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5VL_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(!entry_ptr->dirtied)
-                entry_ptr->dirtied = TRUE;
-
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(!entry_ptr->dirtied)
+            entry_ptr->dirtied = TRUE;
 
     return 0;
 
@@ -251,24 +235,16 @@ reset_all_entries_investigated(hid_t fid)
 {
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5VL_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(entry_ptr->dirtied)
-                entry_ptr->dirtied = FALSE;
-
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->dirtied)
+            entry_ptr->dirtied = FALSE;
 
     return 0;
 
@@ -299,37 +275,30 @@ verify_tag(hid_t fid, int id, haddr_t tag)
 {
     H5F_t *f;                   /* File Pointer */
     H5C_t *cache_ptr;           /* Cache Pointer */
-    int i;                      /* Iterator */
+    H5C_cache_entry_t *entry_ptr; /* entry pointer */
+    H5C_cache_entry_t *found_ptr = NULL; /* entry with the tag to check */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5VL_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr; /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(entry_ptr->type->id == id && !entry_ptr->dirtied) {
-                if(entry_ptr->tag_info->tag != tag)
-                    TEST_ERROR;
+    /* Look for the unchecked entry of this type at the lowest address */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->type->id == id && !entry_ptr->dirtied)
+            if(NULL == found_ptr || H5F_addr_lt(entry_ptr->addr, found_ptr->addr))
+                found_ptr = entry_ptr;
 
-                /* Mark the entry/tag pair as found */
-                entry_ptr->dirtied = TRUE;
-
-                /* leave now that we've found the entry */
-                goto done;
-            } /* end if */
+    /* Didn't find the tagged entry, throw an error */
+    if(NULL == found_ptr)
+        TEST_ERROR;
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+    if(found_ptr->tag_info->tag != tag)
+        TEST_ERROR;
 
-    /* Didn't find the tagged entry, throw an error */
-    TEST_ERROR;
+    /* Mark the entry/tag pair as found */
+    found_ptr->dirtied = TRUE;
 
-done:
     return 0;
 
 error:
@@ -35,6 +35,7 @@
  *          verify_get_chunk_info()
  *          verify_get_chunk_info_by_coord()
  *          verify_empty_chunk_info()
+ *          verify_chunk_iter()
  *          index_type_str()
  *
  */
@@ -134,6 +135,7 @@ static int verify_idx_nchunks(hid_t dset, hid_t dspace, H5D_chunk_index_t exp_id
 static int verify_get_chunk_info(hid_t dset, hid_t dspace, hsize_t chk_index, hsize_t exp_chk_size, hsize_t *exp_offset, unsigned exp_flt_msk);
 static int verify_get_chunk_info_by_coord(hid_t dset, hsize_t *offset, hsize_t exp_chk_size, unsigned exp_flt_msk);
 static int verify_empty_chunk_info(hid_t dset, hsize_t *offset);
+static int verify_chunk_iter(hid_t dset, hid_t dspace, hsize_t exp_num_chunks);
 static const char* index_type_str(H5D_chunk_index_t idx_type);
 
 /*-------------------------------------------------------------------------
@@ -254,6 +256,114 @@ error:
     return FAIL;
 }
 
+/* User data for the H5Dchunk_iter callbacks */
+typedef struct chunk_iter_udata_t {
+    hid_t    dset;              /* Dataset being iterated over */
+    hid_t    dspace;            /* Its dataspace */
+    hsize_t  nvisited;          /* Number of chunks visited so far */
+    hsize_t  stop_after;        /* Stop after this many chunks (0 to never stop) */
+    hbool_t  mismatch;          /* Whether a chunk differed from H5Dget_chunk_info */
+} chunk_iter_udata_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    chunk_iter_cb (helper function)
+ *
+ * Purpose:     H5Dchunk_iter callback that compares each chunk with what
+ *              H5Dget_chunk_info returns for the same index.
+ *
+ * Return:      0 to continue, 1 to stop the iteration
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_iter_cb(const hsize_t *offset, unsigned filter_mask, haddr_t addr, hsize_t size, void *op_data)
+{
+    chunk_iter_udata_t *udata = (chunk_iter_udata_t *)op_data;
+    hsize_t  exp_offset[2] = {0, 0};    /* Offset from H5Dget_chunk_info */
+    unsigned exp_flt_msk = 0;           /* Filter mask from H5Dget_chunk_info */
+    haddr_t  exp_addr = HADDR_UNDEF;    /* Address from H5Dget_chunk_info */
+    hsize_t  exp_size = 0;              /* Size from H5Dget_chunk_info */
+
+    if(H5Dget_chunk_info(udata->dset, udata->dspace, udata->nvisited, exp_offset, &exp_flt_msk, &exp_addr, &exp_size) < 0
+            || offset[0] != exp_offset[0] || offset[1] != exp_offset[1]
+            || filter_mask != exp_flt_msk || addr != exp_addr || size != exp_size)
+        udata->mismatch = TRUE;
+
+    udata->nvisited++;
+
+    return (udata->nvisited == udata->stop_after) ? 1 : 0;
+} /* chunk_iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    chunk_iter_fail_cb (helper function)
+ *
+ * Purpose:     H5Dchunk_iter callback that always fails.
+ *
+ * Return:      -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_iter_fail_cb(const hsize_t H5_ATTR_UNUSED *offset, unsigned H5_ATTR_UNUSED filter_mask,
+    haddr_t H5_ATTR_UNUSED addr, hsize_t H5_ATTR_UNUSED size, void H5_ATTR_UNUSED *op_data)
+{
+    return -1;
+} /* chunk_iter_fail_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    verify_chunk_iter (helper function)
+ *
+ * Purpose:     Verifies that H5Dchunk_iter visits exp_num_chunks chunks,
+ *              in the same order and with the same values as
+ *              H5Dget_chunk_info, and that the callback can stop or fail
+ *              the iteration.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+verify_chunk_iter(hid_t dset, hid_t dspace, hsize_t exp_num_chunks)
+{
+    chunk_iter_udata_t udata;   /* User data for the callback */
+    herr_t   ret;               /* Temporary returned value for verifying failure */
+
+    /* Visit all the chunks */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.dset = dset;
+    udata.dspace = dspace;
+    if(H5Dchunk_iter(dset, H5P_DEFAULT, chunk_iter_cb, &udata) < 0)
+        TEST_ERROR
+    VERIFY(udata.mismatch, FALSE, "H5Dchunk_iter, chunk info");
+    VERIFY(udata.nvisited, exp_num_chunks, "H5Dchunk_iter, number of chunks");
+
+    /* Stop after the first chunk */
+    if(exp_num_chunks > 1) {
+        HDmemset(&udata, 0, sizeof(udata));
+        udata.dset = dset;
+        udata.dspace = dspace;
+        udata.stop_after = 1;
+        if(H5Dchunk_iter(dset, H5P_DEFAULT, chunk_iter_cb, &udata) < 0)
+            TEST_ERROR
+        VERIFY(udata.nvisited, 1, "H5Dchunk_iter, stopping early");
+    } /* end if */
+
+    /* A failing callback makes the iteration fail */
+    if(exp_num_chunks > 0) {
+        H5E_BEGIN_TRY {
+            ret = H5Dchunk_iter(dset, H5P_DEFAULT, chunk_iter_fail_cb, NULL);
+        } H5E_END_TRY;
+        if(ret != FAIL)
+            FAIL_PUTS_ERROR("    H5Dchunk_iter succeeded with a failing callback.");
+    } /* end if */
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    index_type_str (helper function)
  *
@@ -632,6 +742,10 @@ test_get_chunk_info_highest_v18(hid_t fapl)
                 FAIL_PUTS_ERROR("Verification of H5Dget_chunk_info_by_coord failed\n");
         }
 
+    /* Iterate over all written chunks and verify their info */
+    if(verify_chunk_iter(dset, dspace, NUM_CHUNKS_WRITTEN) == FAIL)
+        FAIL_PUTS_ERROR("Verification of H5Dchunk_iter failed\n");
+
     /* Close the first dataset */
     if(H5Dclose(dset) < 0) TEST_ERROR
 
@@ -965,6 +1079,10 @@ test_chunk_info_implicit(char *filename, hid_t fapl)
                 FAIL_PUTS_ERROR("Verification of H5Dget_chunk_info_by_coord failed\n");
         }
 
+    /* Iterate over all chunks and verify their info */
+    if(verify_chunk_iter(dset, dspace, NUM_CHUNKS) == FAIL)
+        FAIL_PUTS_ERROR("Verification of H5Dchunk_iter failed\n");
+
     /* Release resourse */
     if(H5Dclose(dset) < 0) TEST_ERROR
     if(H5Sclose(dspace) < 0) TEST_ERROR
@@ -1076,6 +1194,10 @@ test_chunk_info_fixed_array(const char *filename, hid_t fapl)
                 FAIL_PUTS_ERROR("Verification of H5Dget_chunk_info failed\n");
         }
 
+    /* Iterate over all written chunks and verify their info */
+    if(verify_chunk_iter(dset, dspace, NUM_CHUNKS_WRITTEN) == FAIL)
+        FAIL_PUTS_ERROR("Verification of H5Dchunk_iter failed\n");
+
     /* Attempt to get info using an out-of-range index, chk_index is now > NUM_CHUNKS_WRITTEN.  should fail */
     H5E_BEGIN_TRY {
         ret = H5Dget_chunk_info(dset, dspace, chk_index, out_offset, &read_flt_msk, &addr, &size);
@@ -1212,6 +1334,10 @@ test_chunk_info_extensible_array(const char *filename, hid_t fapl)
                 FAIL_PUTS_ERROR("Verification of H5Dget_chunk_info_by_coord failed\n");
         }
 
+    /* Iterate over all written chunks and verify their info */
+    if(verify_chunk_iter(dset, dspace, NUM_CHUNKS_WRITTEN) == FAIL)
+        FAIL_PUTS_ERROR("Verification of H5Dchunk_iter failed\n");
+
     /* Attempt to get info using an out-of-range index, should fail */
     chk_index = OUTOFRANGE_CHK_INDEX;
     H5E_BEGIN_TRY {
@@ -1349,6 +1475,10 @@ test_chunk_info_version2_btrees(const char *filename, hid_t fapl)
                 FAIL_PUTS_ERROR("Verification of H5Dget_chunk_info_by_coord failed\n");
         }
 
+    /* Iterate over all written chunks and verify their info */
+    if(verify_chunk_iter(dset, dspace, NUM_CHUNKS_WRITTEN) == FAIL)
+        FAIL_PUTS_ERROR("Verification of H5Dchunk_iter failed\n");
+
     /* Attempt to provide out-of-range offsets, should fail */
     chk_index = OUTOFRANGE_CHK_INDEX;
     H5E_BEGIN_TRY {
@@ -21,6 +21,7 @@
 #endif
 
 #define FILE_NAME "direct_chunk.h5"
+#define FILE_NAME2 "direct_chunk_multi.h5"
 
 /* Datasets for Direct Write tests */
 #define DATASETNAME1        "direct_write"
@@ -36,6 +37,7 @@
 #define DATASETNAME10       "read_w_valid_cache"
 #define DATASETNAME11       "unallocated_chunk"
 #define DATASETNAME12       "unfiltered_data"
+#define DATASETNAME13       "read_multi"
 
 #define RANK         2
 #define NX     16
@@ -43,6 +45,9 @@
 #define CHUNK_NX     4
 #define CHUNK_NY     4
 
+/* Number of chunk offsets passed to H5Dread_chunks */
+#define MULTI_NCHUNKS ((NX/CHUNK_NX) * (NY/CHUNK_NY) + 2)
+
 #define DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s))*1.001)+12.0)
 
 /* Temporary filter IDs used for testing */
@@ -1980,6 +1985,166 @@ error:
     return 1;
 } /* test_read_unallocated_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunk_read_multi
+ *
+ * Purpose:     Test H5Dread_chunks and H5Dmap_chunks: several chunks
+ *              (some of them unwritten, one of them asked for twice) are
+ *              read with one call and compared with the data written
+ *              with H5Dwrite_chunk.  The file is then reopened read-only
+ *              and the same chunks are mapped.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_read_multi(void)
+{
+    hid_t       file = -1, dataspace = -1, dataset = -1;
+    hid_t       cparms = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    size_t      chunk_nbytes = CHUNK_NX*CHUNK_NY*sizeof(int);
+    herr_t      status;                 /* status from H5 function calls */
+    int         direct_buf[CHUNK_NX][CHUNK_NY];
+    int         bufs_data[MULTI_NCHUNKS][CHUNK_NX][CHUNK_NY];
+    void       *bufs[MULTI_NCHUNKS];
+    const void *ptrs[MULTI_NCHUNKS];
+    hsize_t     offsets[MULTI_NCHUNKS][2];
+    hsize_t     sizes[MULTI_NCHUNKS];
+    uint32_t    filters[MULTI_NCHUNKS];
+    size_t      count = 0;
+    size_t      u;
+    int         i, j, k, l;             /* local index variables */
+
+    TESTING("H5Dread_chunks and H5Dmap_chunks");
+
+    if((file = H5Fcreate(FILE_NAME2, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if((dataspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if((status = H5Pset_chunk(cparms, RANK, chunk_dims)) < 0)
+        goto error;
+    if((dataset = H5Dcreate2(file, DATASETNAME13, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+            cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Write the chunks on and above the diagonal, leave the others unwritten */
+    for(i = 0; i < NX/CHUNK_NX; i++)
+        for(j = 0; j < NY/CHUNK_NY; j++) {
+            offsets[count][0] = (hsize_t)i * CHUNK_NX;
+            offsets[count][1] = (hsize_t)j * CHUNK_NY;
+            count++;
+
+            if(j < i)
+                continue;
+            for(k = 0; k < CHUNK_NX; k++)
+                for(l = 0; l < CHUNK_NY; l++)
+                    direct_buf[k][l] = ((i * CHUNK_NX + k) * NY) + (j * CHUNK_NY + l);
+            if(H5Dwrite_chunk(dataset, H5P_DEFAULT, 0, offsets[count - 1], chunk_nbytes, direct_buf) < 0)
+                goto error;
+        } /* end for */
+
+    /* Ask for the last chunk and an unwritten one a second time */
+    offsets[count][0] = (NX/CHUNK_NX - 1) * CHUNK_NX;
+    offsets[count][1] = (NY/CHUNK_NY - 1) * CHUNK_NY;
+    count++;
+    offsets[count][0] = CHUNK_NX;
+    offsets[count][1] = 0;
+    count++;
+
+    /* Query the sizes without reading */
+    for(u = 0; u < count; u++) {
+        sizes[u] = (hsize_t)-1;
+        filters[u] = (uint32_t)-1;
+    } /* end for */
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, count, &offsets[0][0], filters, sizes, NULL) < 0)
+        goto error;
+    for(u = 0; u < count; u++) {
+        if(offsets[u][1] >= offsets[u][0]) {
+            if(sizes[u] != chunk_nbytes || filters[u] != 0)
+                goto error;
+        } /* end if */
+        else if(sizes[u] != 0)
+            goto error;
+    } /* end for */
+
+    /* Read the chunks (skipping the first one) and check the data */
+    HDmemset(bufs_data, 0, sizeof(bufs_data));
+    for(u = 0; u < count; u++)
+        bufs[u] = u > 0 ? bufs_data[u] : NULL;
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, count, &offsets[0][0], NULL, sizes, bufs) < 0)
+        goto error;
+    for(u = 1; u < count; u++) {
+        if(0 == sizes[u])
+            continue;
+        for(k = 0; k < CHUNK_NX; k++)
+            for(l = 0; l < CHUNK_NY; l++)
+                if(bufs_data[u][k][l] != (int)(((offsets[u][0] + (hsize_t)k) * NY) + offsets[u][1] + (hsize_t)l)) {
+                    HDprintf("\n    Read different values than written.");
+                    HDprintf("    Chunk %u at index %d,%d\n", (unsigned)u, k, l);
+                    goto error;
+                } /* end if */
+    } /* end for */
+
+    /* Mapping needs a file that is open read-only */
+    H5E_BEGIN_TRY {
+        status = H5Dmap_chunks(dataset, count, &offsets[0][0], NULL, NULL, ptrs);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+
+    if(H5Dclose(dataset) < 0)
+        goto error;
+    if(H5Fclose(file) < 0)
+        goto error;
+
+#ifdef H5_HAVE_SYS_MMAN_H
+    /* Reopen the file read-only and map the chunks */
+    if((file = H5Fopen(FILE_NAME2, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+    if((dataset = H5Dopen2(file, DATASETNAME13, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dmap_chunks(dataset, count, &offsets[0][0], filters, sizes, ptrs) < 0)
+        goto error;
+    for(u = 1; u < count; u++) {
+        if(0 == sizes[u]) {
+            if(ptrs[u] != NULL)
+                goto error;
+        } /* end if */
+        else if(NULL == ptrs[u] || filters[u] != 0 || HDmemcmp(ptrs[u], bufs_data[u], chunk_nbytes) != 0)
+            goto error;
+    } /* end for */
+
+    if(H5Dclose(dataset) < 0)
+        goto error;
+    if(H5Fclose(file) < 0)
+        goto error;
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+    /* Close/release resources. */
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* test_direct_chunk_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_single_chunk
  *
@@ -2182,6 +2347,7 @@ int main( void )
 #endif /* H5_HAVE_FILTER_DEFLATE */
     nerrors += test_read_unfiltered_dset(file_id);
     nerrors += test_read_unallocated_chunk(file_id);
+    nerrors += test_direct_chunk_read_multi();
 
     /* Loop over test configurations */
     for(config = 0; config < CONFIG_END; config++) {
@@ -84,6 +84,11 @@ const char *FILENAME[] = {
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
     "alloc_0sized",     /* 26 */
+    "filter_nthreads",  /* 27 */
+    "multi_dset_io",    /* 28 */
+    "multi_dset_io2",   /* 29 */
+    "chunk_read_gap",   /* 30 */
+    "prepared_read",    /* 31 */
     NULL
 };
 
@@ -112,6 +117,12 @@ const char *FILENAME[] = {
 #define DSET_FLETCHER32_NAME_3      "fletcher32_3"
 #define DSET_SHUF_DEF_FLET_NAME     "shuffle+deflate+fletcher32"
 #define DSET_SHUF_DEF_FLET_NAME_2   "shuffle+deflate+fletcher32_2"
+#define DSET_LZ4_NAME               "lz4"
+#define DSET_LZ4HC_DICT_NAME        "lz4hc_dict"
+#define DSET_LZ4_DICT_NAME          "lz4_dict"
+#define DSET_ZSTD_NAME              "zstd"
+#define DSET_ZSTD_DICT_NAME         "zstd_dict"
+#define FILTER_DICT_SIZE            4096
 #ifdef H5_HAVE_FILTER_SZIP
 #define DSET_SZIP_NAME              "szip"
 #define DSET_SHUF_SZIP_FLET_NAME    "shuffle+szip+fletcher32"
@@ -2268,6 +2279,22 @@ test_get_filter_info(void)
       TEST_ERROR
 #endif
 
+#ifdef H5_HAVE_FILTER_LZ4
+  if(H5Zget_filter_info(H5Z_FILTER_LZ4, &flags) < 0) TEST_ERROR
+
+  if(((flags & H5Z_FILTER_CONFIG_ENCODE_ENABLED) == 0) ||
+     ((flags & H5Z_FILTER_CONFIG_DECODE_ENABLED) == 0))
+      TEST_ERROR
+#endif
+
+#ifdef H5_HAVE_FILTER_ZSTD
+  if(H5Zget_filter_info(H5Z_FILTER_ZSTD, &flags) < 0) TEST_ERROR
+
+  if(((flags & H5Z_FILTER_CONFIG_ENCODE_ENABLED) == 0) ||
+     ((flags & H5Z_FILTER_CONFIG_DECODE_ENABLED) == 0))
+      TEST_ERROR
+#endif
+
 #ifdef H5_HAVE_FILTER_SZIP
     if(H5Zget_filter_info(H5Z_FILTER_SZIP, &flags) < 0) TEST_ERROR
 
@@ -2324,6 +2351,15 @@ H5_ATTR_UNUSED
     hsize_t     deflate_size;        /* Size of dataset with deflate filter */
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+    hsize_t     dict_filter_size;    /* Size of dataset with lz4 or zstd filter */
+    int         dict[FILTER_DICT_SIZE / sizeof(int)]; /* Compression dictionary */
+    unsigned    dict_cd_values[4];   /* Filter parameters */
+    size_t      dict_cd_nelmts;      /* Number of filter parameters */
+    herr_t      dict_ret;            /* Return value of calls which should fail */
+    size_t      u;                   /* Local index variable */
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+
 #ifdef H5_HAVE_FILTER_SZIP
     hsize_t     szip_size;           /* Size of dataset with szip filter */
     unsigned    szip_options_mask = H5_SZIP_NN_OPTION_MASK;
@@ -2418,6 +2454,92 @@ H5_ATTR_UNUSED
     HDputs("    Deflate filter not enabled");
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+    /*----------------------------------------------------------
+     * STEP 2a: Test lz4 and zstd compression, with and without
+     *          a dictionary.
+     *----------------------------------------------------------
+     */
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+    /* A dictionary like the data the tests write */
+    for(u = 0; u < NELMTS(dict); u++)
+        dict[u] = (int)(u % 100);
+#endif /* defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD) */
+
+#ifdef H5_HAVE_FILTER_LZ4
+    HDputs("Testing lz4 filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_lz4 (dc, 0, NULL, 0) < 0) goto error;
+    if(test_filter_internal(file,DSET_LZ4_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&dict_filter_size) < 0) goto error;
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing lz4 filter (high compression, with a dictionary)");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_lz4 (dc, 9, dict, sizeof(dict)) < 0) goto error;
+
+    /* The dictionary is stored with the level and block size */
+    dict_cd_nelmts = NELMTS(dict_cd_values);
+    if(H5Pget_filter_by_id2(dc, H5Z_FILTER_LZ4, NULL, &dict_cd_nelmts, dict_cd_values, (size_t)0, NULL, NULL) < 0) goto error;
+    if(dict_cd_nelmts != 3 + sizeof(dict) / 4 || dict_cd_values[1] != 9 || dict_cd_values[2] != sizeof(dict)) goto error;
+
+    if(test_filter_internal(file,DSET_LZ4HC_DICT_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&dict_filter_size) < 0) goto error;
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing lz4 filter (with a dictionary)");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_lz4 (dc, 0, dict, sizeof(dict)) < 0) goto error;
+    if(test_filter_internal(file,DSET_LZ4_DICT_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&dict_filter_size) < 0) goto error;
+
+    /* Bad levels and dictionaries are refused */
+    H5E_BEGIN_TRY {
+        dict_ret = H5Pset_lz4(dc, H5Z_LZ4_MAX_LEVEL + 1, NULL, 0);
+    } H5E_END_TRY;
+    if(dict_ret >= 0) goto error;
+    H5E_BEGIN_TRY {
+        dict_ret = H5Pset_lz4(dc, 0, dict, (size_t)H5Z_MAX_DICT_SIZE + 1);
+    } H5E_END_TRY;
+    if(dict_ret >= 0) goto error;
+    if(H5Pclose (dc) < 0) goto error;
+#else /* H5_HAVE_FILTER_LZ4 */
+    TESTING("lz4 filter");
+    SKIPPED();
+    HDputs("    LZ4 filter not enabled");
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+    HDputs("Testing zstd filter");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_zstd (dc, 3, NULL, 0) < 0) goto error;
+    if(test_filter_internal(file,DSET_ZSTD_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&dict_filter_size) < 0) goto error;
+    if(H5Pclose (dc) < 0) goto error;
+
+    HDputs("Testing zstd filter (with a dictionary)");
+    if((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_chunk (dc, 2, chunk_size) < 0) goto error;
+    if(H5Pset_zstd (dc, -1, dict, sizeof(dict)) < 0) goto error;
+
+    /* The dictionary is stored with the level */
+    dict_cd_nelmts = NELMTS(dict_cd_values);
+    if(H5Pget_filter_by_id2(dc, H5Z_FILTER_ZSTD, NULL, &dict_cd_nelmts, dict_cd_values, (size_t)0, NULL, NULL) < 0) goto error;
+    if(dict_cd_nelmts != 2 + sizeof(dict) / 4 || (int)dict_cd_values[0] != -1 || dict_cd_values[1] != sizeof(dict)) goto error;
+
+    if(test_filter_internal(file,DSET_ZSTD_DICT_NAME,dc,DISABLE_FLETCHER32,DATA_NOT_CORRUPTED,&dict_filter_size) < 0) goto error;
+
+    /* Bad levels are refused */
+    H5E_BEGIN_TRY {
+        dict_ret = H5Pset_zstd(dc, H5Z_ZSTD_MAX_LEVEL + 1, NULL, 0);
+    } H5E_END_TRY;
+    if(dict_ret >= 0) goto error;
+    if(H5Pclose (dc) < 0) goto error;
+#else /* H5_HAVE_FILTER_ZSTD */
+    TESTING("zstd filter");
+    SKIPPED();
+    HDputs("    ZSTD filter not enabled");
+#endif /* H5_HAVE_FILTER_ZSTD */
+
     /*----------------------------------------------------------
      * STEP 3: Test szip compression by itself.
      *----------------------------------------------------------
@@ -2912,6 +3034,102 @@ error:
 } /* end test_onebyte_shuffle() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:  test_shuffle_sizes
+ *
+ * Purpose:   Tests that the shuffle filter gives the same bytes as the
+ *            plain byte transposition for elements of many sizes and
+ *            buffers of many lengths, including buffers whose length is
+ *            not a multiple of the element size, and that unshuffling
+ *            restores the data.  This covers the vector code the filter
+ *            uses for some element sizes as well as the scalar code for
+ *            the elements left over.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_shuffle_sizes(void)
+{
+    const size_t     max_nbytes = 1200;
+    unsigned char    *orig = NULL, *expect = NULL;
+    void             *buf = NULL;
+    unsigned         cd_values[H5Z_SHUFFLE_TOTAL_NPARMS];
+    size_t           buf_size;
+    size_t           nbytes, nelmts, e, b;
+    unsigned         k;
+
+    TESTING("shuffling elements of all sizes");
+
+    if(NULL == (orig = (unsigned char *)HDmalloc(max_nbytes)))
+        goto error;
+    if(NULL == (expect = (unsigned char *)HDmalloc(max_nbytes)))
+        goto error;
+    for(b = 0; b < max_nbytes; b++)
+        orig[b] = (unsigned char)HDrandom();
+
+    for(k = 1; k <= 33; k++) {
+        cd_values[0] = k;
+
+        for(nbytes = 0; nbytes <= max_nbytes; nbytes += (nbytes < 160 ? 1 : 37)) {
+            /* The bytes the filter should give */
+            nelmts = nbytes / k;
+            if(k > 1 && nelmts > 1) {
+                for(e = 0; e < nelmts; e++)
+                    for(b = 0; b < k; b++)
+                        expect[b * nelmts + e] = orig[e * k + b];
+                HDmemcpy(expect + nelmts * k, orig + nelmts * k, nbytes - nelmts * k);
+            } /* end if */
+            else
+                HDmemcpy(expect, orig, nbytes);
+
+            /* Shuffle */
+            if(NULL == (buf = H5allocate_memory(MAX(nbytes, 1), FALSE)))
+                goto error;
+            HDmemcpy(buf, orig, nbytes);
+            buf_size = MAX(nbytes, 1);
+            if(nbytes != (H5Z_SHUFFLE->filter)(0, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS, cd_values, nbytes, &buf_size, &buf))
+                goto error;
+            if(HDmemcmp(buf, expect, nbytes)) {
+                H5_FAILED();
+                HDprintf("    Wrong shuffled bytes for %u-byte elements in %lu bytes\n", k, (unsigned long)nbytes);
+                goto error;
+            } /* end if */
+
+            /* Unshuffle */
+            if(nbytes != (H5Z_SHUFFLE->filter)(H5Z_FLAG_REVERSE, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS, cd_values, nbytes, &buf_size, &buf))
+                goto error;
+            if(HDmemcmp(buf, orig, nbytes)) {
+                H5_FAILED();
+                HDprintf("    Wrong unshuffled bytes for %u-byte elements in %lu bytes\n", k, (unsigned long)nbytes);
+                goto error;
+            } /* end if */
+
+            H5free_memory(buf);
+            buf = NULL;
+        } /* end for */
+    } /* end for */
+
+    HDfree(expect);
+    HDfree(orig);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    if(buf)
+        H5free_memory(buf);
+    if(expect)
+        HDfree(expect);
+    if(orig)
+        HDfree(orig);
+
+    return FAIL;
+} /* end test_shuffle_sizes() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_nbit_int
  *
@@ -8481,6 +8699,200 @@ error:
 } /* end test_big_chunks_bypass_cache() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_cache_policy_read
+ *
+ * Purpose:     Helper routine for test_chunk_cache_policy: reads the
+ *              chunk with index CHUNK of a 1-D dataset with chunks of
+ *              CHUNK_CACHE_POLICY_CHUNK elements.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CHUNK_CACHE_POLICY_CHUNK        10
+#define CHUNK_CACHE_POLICY_NCHUNKS      10
+static herr_t
+test_chunk_cache_policy_read(hid_t dsid, hsize_t chunk)
+{
+    hid_t       sid = -1, mid = -1;     /* Dataspace IDs */
+    hsize_t     start = chunk * CHUNK_CACHE_POLICY_CHUNK;
+    hsize_t     count = CHUNK_CACHE_POLICY_CHUNK;
+    int         rbuf[CHUNK_CACHE_POLICY_CHUNK];
+    int         u;
+
+    if((sid = H5Dget_space(dsid)) < 0) TEST_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) TEST_ERROR
+    if((mid = H5Screate_simple(1, &count, NULL)) < 0) TEST_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0) TEST_ERROR
+    for(u = 0; u < CHUNK_CACHE_POLICY_CHUNK; u++)
+        if(rbuf[u] != (int)start + u) TEST_ERROR
+    if(H5Sclose(mid) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mid);
+        H5Sclose(sid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_cache_policy_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_cache_policy
+ *
+ * Purpose:     Tests the chunk cache's replacement policies, that chunks
+ *              whose hash values collide can be cached together, the
+ *              file-wide chunk cache budget and H5Dget_chunk_cache_stats.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_cache_policy(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;               /* File ID */
+    hid_t       fapl_local = -1;        /* Local fapl */
+    hid_t       dcpl = -1;              /* Dataset creation property list ID */
+    hid_t       dapl = -1;              /* Dataset access property list ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       dsid = -1, dsid2 = -1;  /* Dataset IDs */
+    hsize_t     dim = CHUNK_CACHE_POLICY_CHUNK * CHUNK_CACHE_POLICY_NCHUNKS;
+    hsize_t     chunk_dim = CHUNK_CACHE_POLICY_CHUNK;
+    size_t      chunk_nbytes = CHUNK_CACHE_POLICY_CHUNK * sizeof(int);
+    size_t      budget;                 /* File's chunk cache budget */
+    H5D_chunk_cache_policy_t policy;    /* Chunk cache replacement policy */
+    H5D_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    hsize_t     nhits;                  /* # of hits before the last reads */
+    herr_t      ret;                    /* Generic return value */
+    int         wbuf[CHUNK_CACHE_POLICY_CHUNK * CHUNK_CACHE_POLICY_NCHUNKS];
+    int         u;
+
+    TESTING("dataset chunk cache replacement policies");
+
+    /* Check the replacement policy property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_DEFAULT) TEST_ERROR
+    if(H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_LRU) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_LRU) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_NTYPES);
+    } H5E_END_TRY;
+    if(ret >= 0) FAIL_PUTS_ERROR("    Invalid replacement policy accepted.")
+
+    /* Check the budget property */
+    if((fapl_local = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_budget(fapl_local, &budget) < 0) FAIL_STACK_ERROR
+    if(budget != 0) TEST_ERROR
+
+    /* Create the file, with two datasets */
+    h5_fixname(FILENAME[8], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < (int)dim; u++)
+        wbuf[u] = u;
+    if((dsid = H5Dcreate2(fid, "dset1", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Chunks 0 and 4 have the same hash value with 4 slots, but are both
+     * kept in the cache */
+    if(H5Pset_chunk_cache(dapl, (size_t)4, 4 * chunk_nbytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset1", dapl)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++)
+        if(test_chunk_cache_policy_read(dsid, (hsize_t)((u % 2) * 4)) < 0) TEST_ERROR
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nmisses != 2 || stats.nhits != 2 || stats.nevictions != 0) TEST_ERROR
+    if(stats.nentries != 2 || stats.nbytes_used != 2 * chunk_nbytes) TEST_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read two chunks twice, scan the other chunks once, then read the first
+     * two chunks again.  The scan preempts them under LRU but not under ARC */
+    for(policy = H5D_CHUNK_CACHE_POLICY_LRU; policy <= H5D_CHUNK_CACHE_POLICY_ARC; policy++) {
+        if(H5Pset_chunk_cache(dapl, (size_t)64, 4 * chunk_nbytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk_cache_policy(dapl, policy) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, "dset1", dapl)) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < 4; u++)
+            if(test_chunk_cache_policy_read(dsid, (hsize_t)(u % 2)) < 0) TEST_ERROR
+        for(u = 2; u < CHUNK_CACHE_POLICY_NCHUNKS; u++)
+            if(test_chunk_cache_policy_read(dsid, (hsize_t)u) < 0) TEST_ERROR
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nevictions != CHUNK_CACHE_POLICY_NCHUNKS - 4) TEST_ERROR
+        nhits = stats.nhits;
+        for(u = 0; u < 2; u++)
+            if(test_chunk_cache_policy_read(dsid, (hsize_t)u) < 0) TEST_ERROR
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nhits - nhits != (policy == H5D_CHUNK_CACHE_POLICY_ARC ? 2 : 0)) TEST_ERROR
+        if(stats.nbytes_used > 4 * chunk_nbytes) TEST_ERROR
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Limit the chunk caches of all the datasets in the file to one chunk
+     * (the chunk cache is turned off on the fapl passed in) */
+    if(H5Pset_cache(fapl_local, 0, (size_t)521, (size_t)(1024 * 1024), 0.75) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache_budget(fapl_local, chunk_nbytes) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_budget(fapl_local, &budget) < 0) FAIL_STACK_ERROR
+    if(budget != chunk_nbytes) TEST_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_local)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset1", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((dsid2 = H5Dopen2(fid, "dset2", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(test_chunk_cache_policy_read(dsid, (hsize_t)0) < 0) TEST_ERROR
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nbytes_used != chunk_nbytes) TEST_ERROR
+
+    /* Reading a chunk of the second dataset preempts the first's */
+    if(test_chunk_cache_policy_read(dsid2, (hsize_t)0) < 0) TEST_ERROR
+    if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nbytes_used != 0 || stats.nentries != 0 || stats.nevictions != 1) TEST_ERROR
+    if(H5Dget_chunk_cache_stats(dsid2, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nbytes_used != chunk_nbytes || stats.nentries != 1) TEST_ERROR
+
+    /* A NULL statistics buffer is rejected */
+    H5E_BEGIN_TRY {
+        ret = H5Dget_chunk_cache_stats(dsid, NULL);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    if(H5Dclose(dsid2) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl_local) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid2);
+        H5Dclose(dsid);
+        H5Fclose(fid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(fapl_local);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_cache_policy() */
+
+
 /*-------------------------------------------------------------------------
  * Function: test_chunk_fast
  *
@@ -11811,6 +12223,669 @@ error:
 } /* end test_power2up() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_nthreads
+ *
+ * Purpose:     Tests reading filtered chunked datasets with the chunk
+ *              filter pipeline run by several threads (H5Pset_filter_nthreads),
+ *              including partial edge chunks that aren't filtered and a
+ *              chunk cache too small to hold a whole batch of chunks.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define FILTER_NTHREADS_DSET    "filter_nthreads"
+#define FILTER_NTHREADS_DIM0    210
+#define FILTER_NTHREADS_DIM1    205
+#define FILTER_NTHREADS_CHUNK   20
+static herr_t
+test_filter_nthreads(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       dapl = -1;      /* Dataset access property list */
+    hid_t       dxpl = -1;      /* Dataset transfer property list */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       mid = -1;       /* Memory dataspace ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hsize_t     dims[2] = {FILTER_NTHREADS_DIM0, FILTER_NTHREADS_DIM1};         /* Dataset dimension sizes */
+    hsize_t     chunk_dims[2] = {FILTER_NTHREADS_CHUNK, FILTER_NTHREADS_CHUNK}; /* Chunk dimensions */
+    hsize_t     start[2] = {15, 35};    /* Start of hyperslab read */
+    hsize_t     count[2] = {150, 160};  /* Size of hyperslab read */
+    unsigned    opts;           /* Chunk options */
+    unsigned    nthreads;       /* # of filter threads */
+    int        *wbuf = NULL;    /* Write buffer */
+    int        *rbuf = NULL;    /* Read buffer */
+    herr_t      status;         /* Error status */
+    size_t      i, j;           /* Local index variables */
+
+    TESTING("reading filtered chunks with multiple threads");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * FILTER_NTHREADS_DIM0 * FILTER_NTHREADS_DIM1)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(sizeof(int), FILTER_NTHREADS_DIM0 * FILTER_NTHREADS_DIM1)))
+        TEST_ERROR
+    for(i = 0; i < FILTER_NTHREADS_DIM0 * FILTER_NTHREADS_DIM1; i++)
+        wbuf[i] = (int)(i % 1000) - 500;
+
+    /* Check the property's default & that invalid values are rejected */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Pset_filter_nthreads(dxpl, 0);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    if(H5Pset_filter_nthreads(dxpl, 4) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 4) TEST_ERROR
+
+    /* Create file & dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(H5Pset_deflate(dcpl, 6) < 0) FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_opts(dcpl, &opts) < 0) FAIL_STACK_ERROR
+    opts |= H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS;
+    if(H5Pset_chunk_opts(dcpl, opts) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, FILTER_NTHREADS_DSET, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the dataset with a chunk cache that holds only a few chunks */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)7, (size_t)(3 * FILTER_NTHREADS_CHUNK * FILTER_NTHREADS_CHUNK * sizeof(int)), 0.75F) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(fid, FILTER_NTHREADS_DSET, dapl)) < 0) FAIL_STACK_ERROR
+
+    /* Read the whole dataset, twice, so that the second read finds some chunks in the cache */
+    for(j = 0; j < 2; j++) {
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < FILTER_NTHREADS_DIM0 * FILTER_NTHREADS_DIM1; i++)
+            if(rbuf[i] != wbuf[i])
+                TEST_ERROR
+    } /* end for */
+
+    /* Read a hyperslab that covers partial chunks */
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * FILTER_NTHREADS_DIM0 * FILTER_NTHREADS_DIM1);
+    if(H5Dread(did, H5T_NATIVE_INT, mid, sid, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < count[0]; i++)
+        for(j = 0; j < count[1]; j++)
+            if(rbuf[i * count[1] + j] != wbuf[(start[0] + i) * FILTER_NTHREADS_DIM1 + start[1] + j])
+                TEST_ERROR
+
+    /* Close everything */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_read_gap
+ *
+ * Purpose:     Tests reading many small unfiltered chunks, whose reads
+ *              are merged when they are near each other in the file
+ *              (H5Pset_chunk_read_gap), including missing chunks, partial
+ *              edge chunks, partially selected chunks and chunks written
+ *              around a disabled chunk cache.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CHUNK_READ_GAP_DSET     "chunk_read_gap"
+#define CHUNK_READ_GAP_DIM0     203
+#define CHUNK_READ_GAP_DIM1     301
+#define CHUNK_READ_GAP_CHUNK0   4
+#define CHUNK_READ_GAP_CHUNK1   5
+static herr_t
+test_chunk_read_gap(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       dapl = -1;      /* Dataset access property list */
+    hid_t       dxpl = -1;      /* Dataset transfer property list */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       mid = -1;       /* Memory dataspace ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hsize_t     dims[2] = {CHUNK_READ_GAP_DIM0, CHUNK_READ_GAP_DIM1};         /* Dataset dimension sizes */
+    hsize_t     chunk_dims[2] = {CHUNK_READ_GAP_CHUNK0, CHUNK_READ_GAP_CHUNK1}; /* Chunk dimensions */
+    hsize_t     start[2];       /* Start of hyperslab */
+    hsize_t     count[2];       /* Size of hyperslab */
+    size_t      gaps[3] = {0, 4096, (size_t)1 << 20};   /* Merge gaps to read with */
+    size_t      gap;            /* Merge gap */
+    int         fill = -1;      /* Fill value */
+    int        *wbuf = NULL;    /* Write buffer */
+    int        *rbuf = NULL;    /* Read buffer */
+    size_t      i, j, k, n;     /* Local index variables */
+
+    TESTING("merged reads of unfiltered chunks");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(sizeof(int), CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1)))
+        TEST_ERROR
+
+    /* Check the property's default & that it can be changed */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_read_gap(dxpl, &gap) < 0) FAIL_STACK_ERROR
+    if(gap != 4096) TEST_ERROR
+    if(H5Pset_chunk_read_gap(dxpl, (size_t)0) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_read_gap(dxpl, &gap) < 0) FAIL_STACK_ERROR
+    if(gap != 0) TEST_ERROR
+
+    /* Create file & dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, CHUNK_READ_GAP_DSET, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Write every other band of chunk rows, leaving the chunks between missing */
+    for(i = 0; i < CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1; i++)
+        wbuf[i] = (int)(i % 100000);
+    for(i = 0; i < CHUNK_READ_GAP_DIM0; i += 4 * CHUNK_READ_GAP_CHUNK0) {
+        start[0] = i;
+        start[1] = 0;
+        count[0] = MIN(2 * CHUNK_READ_GAP_CHUNK0, CHUNK_READ_GAP_DIM0 - i);
+        count[1] = CHUNK_READ_GAP_DIM1;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    for(i = 0; i < CHUNK_READ_GAP_DIM0; i++)
+        if((i / (2 * CHUNK_READ_GAP_CHUNK0)) % 2)
+            for(j = 0; j < CHUNK_READ_GAP_DIM1; j++)
+                wbuf[i * CHUNK_READ_GAP_DIM1 + j] = fill;
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the dataset with a chunk cache that holds only a few chunks */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)7, (size_t)(3 * CHUNK_READ_GAP_CHUNK0 * CHUNK_READ_GAP_CHUNK1 * sizeof(int)), 0.75F) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(fid, CHUNK_READ_GAP_DSET, dapl)) < 0) FAIL_STACK_ERROR
+
+    for(n = 0; n < NELMTS(gaps); n++) {
+        if(H5Pset_chunk_read_gap(dxpl, gaps[n]) < 0) FAIL_STACK_ERROR
+
+        /* Read the whole dataset */
+        HDmemset(rbuf, 0, sizeof(int) * CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1);
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1; i++)
+            if(rbuf[i] != wbuf[i])
+                TEST_ERROR
+
+        /* Read hyperslabs that select whole and partial chunks */
+        for(k = 0; k < 2; k++) {
+            start[0] = k ? 13 : 20;
+            start[1] = k ? 7 : 0;
+            count[0] = k ? 150 : 100;
+            count[1] = k ? 203 : CHUNK_READ_GAP_DIM1;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+            if((mid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+            HDmemset(rbuf, 0, sizeof(int) * CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1);
+            if(H5Dread(did, H5T_NATIVE_INT, mid, sid, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+            for(i = 0; i < count[0]; i++)
+                for(j = 0; j < count[1]; j++)
+                    if(rbuf[i * count[1] + j] != wbuf[(start[0] + i) * CHUNK_READ_GAP_DIM1 + start[1] + j])
+                        TEST_ERROR
+            if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+            mid = -1;
+        } /* end for */
+    } /* end for */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the dataset without a chunk cache, overwrite part of it and
+     * read it back, so that the merged reads must see the data written
+     * around the chunk cache
+     */
+    if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, 0.75F) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(fid, CHUNK_READ_GAP_DSET, dapl)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1; i++)
+        wbuf[i] = (int)(i % 1000) - 500;
+    start[0] = 0;
+    start[1] = 0;
+    count[0] = 2 * CHUNK_READ_GAP_CHUNK0;
+    count[1] = CHUNK_READ_GAP_DIM1;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * CHUNK_READ_GAP_DIM0 * CHUNK_READ_GAP_DIM1);
+    if(H5Dread(did, H5T_NATIVE_INT, sid, sid, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < count[0] * count[1]; i++)
+        if(rbuf[i] != wbuf[i])
+            TEST_ERROR
+
+    /* Close everything */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_read_gap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_prepared_read
+ *
+ * Purpose:     Tests repeated small reads of a contiguous dataset with a
+ *              prepared read handle (H5Dprepare_read / H5Dread_prepared),
+ *              with and without datatype conversion, after writes to the
+ *              dataset and after the dataset's own ID is closed, and that
+ *              datasets which can't be read that way are rejected.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define PREPARED_READ_DSET      "prepared_read"
+#define PREPARED_READ_DIM0      20
+#define PREPARED_READ_DIM1      30
+#define PREPARED_READ_NPOINTS   (PREPARED_READ_DIM0 * PREPARED_READ_DIM1)
+static herr_t
+test_prepared_read(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hid_t       did2 = -1;      /* Dataset ID */
+    hid_t       tid = -1;       /* Datatype ID */
+    hsize_t     dims[2] = {PREPARED_READ_DIM0, PREPARED_READ_DIM1};   /* Dataset dimension sizes */
+    hsize_t     chunk_dims[2] = {4, 5};                             /* Chunk dimensions */
+    H5D_prepared_read_t *prep = NULL;       /* Prepared read */
+    H5D_prepared_read_t *prep_short = NULL; /* Prepared read, into shorts */
+    H5D_prepared_read_t *prep_llong = NULL; /* Prepared read, into long longs */
+    int         wbuf[PREPARED_READ_NPOINTS];    /* Write buffer */
+    int         rbuf[PREPARED_READ_NPOINTS];    /* Read buffer */
+    short       sbuf[PREPARED_READ_NPOINTS];    /* Read buffer for shorts */
+    long long   lbuf[PREPARED_READ_NPOINTS];    /* Read buffer for long longs */
+    hsize_t     off;            /* Offset of elements read */
+    size_t      n;              /* Number of elements read */
+    herr_t      ret;            /* Generic return value */
+    size_t      i;              /* Local index variable */
+
+    TESTING("prepared reads of contiguous datasets");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+
+    /* Create file & dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, PREPARED_READ_DSET, H5T_STD_I32BE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Datasets without allocated storage can't be prepared */
+    H5E_BEGIN_TRY {
+        prep = H5Dprepare_read(did, H5T_NATIVE_INT);
+    } H5E_END_TRY;
+    if(prep) TEST_ERROR
+
+    for(i = 0; i < PREPARED_READ_NPOINTS; i++)
+        wbuf[i] = (int)i - 100;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Prepare reads into the same size, a smaller and a larger memory type */
+    if(NULL == (prep = H5Dprepare_read(did, H5T_NATIVE_INT))) FAIL_STACK_ERROR
+    if(NULL == (prep_short = H5Dprepare_read(did, H5T_NATIVE_SHORT))) FAIL_STACK_ERROR
+    if(NULL == (prep_llong = H5Dprepare_read(did, H5T_NATIVE_LLONG))) FAIL_STACK_ERROR
+
+    /* Read single elements, part of a row, runs across rows & everything */
+    for(off = 0; off < PREPARED_READ_NPOINTS; off += 7)
+        for(n = 0; n <= PREPARED_READ_NPOINTS - off; n = n ? n * 5 : 1) {
+            HDmemset(rbuf, 0, sizeof(rbuf));
+            HDmemset(sbuf, 0, sizeof(sbuf));
+            HDmemset(lbuf, 0, sizeof(lbuf));
+            if(H5Dread_prepared(prep, off, n, rbuf) < 0) FAIL_STACK_ERROR
+            if(H5Dread_prepared(prep_short, off, n, sbuf) < 0) FAIL_STACK_ERROR
+            if(H5Dread_prepared(prep_llong, off, n, lbuf) < 0) FAIL_STACK_ERROR
+            for(i = 0; i < n; i++)
+                if(rbuf[i] != wbuf[off + i] || (int)sbuf[i] != wbuf[off + i] || (int)lbuf[i] != wbuf[off + i])
+                    TEST_ERROR
+            if(n < PREPARED_READ_NPOINTS && (rbuf[n] != 0 || sbuf[n] != 0 || lbuf[n] != 0))
+                TEST_ERROR
+        } /* end for */
+    if(H5Dread_prepared(prep, (hsize_t)0, (size_t)PREPARED_READ_NPOINTS, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, wbuf, sizeof(wbuf)) != 0) TEST_ERROR
+
+    /* Reads past the end of the dataset must fail */
+    H5E_BEGIN_TRY {
+        ret = H5Dread_prepared(prep, (hsize_t)(PREPARED_READ_NPOINTS - 2), (size_t)3, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dread_prepared(prep, (hsize_t)(PREPARED_READ_NPOINTS + 1), (size_t)0, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Data written through the library after the reads were prepared must
+     * be read back */
+    for(i = 0; i < PREPARED_READ_NPOINTS; i++)
+        wbuf[i] = 1000 - (int)i;
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    for(off = 3; off < PREPARED_READ_NPOINTS; off += 31) {
+        if(H5Dread_prepared(prep, off, (size_t)1, rbuf) < 0) FAIL_STACK_ERROR
+        if(rbuf[0] != wbuf[off]) TEST_ERROR
+    } /* end for */
+
+    /* The handles keep the dataset open after its own ID is closed */
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    did = -1;
+    if(H5Dread_prepared(prep_short, (hsize_t)PREPARED_READ_DIM1, (size_t)PREPARED_READ_DIM1, sbuf) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < PREPARED_READ_DIM1; i++)
+        if((int)sbuf[i] != wbuf[PREPARED_READ_DIM1 + i])
+            TEST_ERROR
+    if(H5Dclose_prepared(prep) < 0) FAIL_STACK_ERROR
+    prep = NULL;
+    if(H5Dclose_prepared(prep_short) < 0) FAIL_STACK_ERROR
+    prep_short = NULL;
+    if(H5Dclose_prepared(prep_llong) < 0) FAIL_STACK_ERROR
+    prep_llong = NULL;
+
+    /* Chunked & variable-length datasets can't be prepared */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if((tid = H5Tcopy(H5T_C_S1)) < 0) FAIL_STACK_ERROR
+    if(H5Tset_size(tid, H5T_VARIABLE) < 0) FAIL_STACK_ERROR
+    if(H5Pset_layout(dcpl, H5D_CONTIGUOUS) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+    if((did2 = H5Dcreate2(fid, "vlen", tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        prep = H5Dprepare_read(did, H5T_NATIVE_INT);
+    } H5E_END_TRY;
+    if(prep) TEST_ERROR
+    H5E_BEGIN_TRY {
+        prep = H5Dprepare_read(did2, tid);
+    } H5E_END_TRY;
+    if(prep) TEST_ERROR
+
+    /* Close everything */
+    if(H5Dclose(did2) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(tid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        if(prep)
+            H5Dclose_prepared(prep);
+        if(prep_short)
+            H5Dclose_prepared(prep_short);
+        if(prep_llong)
+            H5Dclose_prepared(prep_llong);
+        H5Dclose(did2);
+        H5Dclose(did);
+        H5Tclose(tid);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_prepared_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests reading & writing several datasets with one call
+ *              (H5Dread_multi / H5Dwrite_multi): contiguous, chunked,
+ *              compact and type-converted datasets in two files, with
+ *              hyperslab selections and with overlapping writes to the
+ *              same dataset.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NDSETS        8
+#define MULTI_NCONTIG       5
+#define MULTI_DIM           120
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    char        filename2[FILENAME_BUF_SIZE];
+    char        dset_name[32];
+    hid_t       fid = -1, fid2 = -1;    /* File IDs */
+    hid_t       dcpl = -1;              /* Dataset creation property list */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       mid = -1;               /* Memory dataspace ID */
+    hid_t       dset_id[MULTI_NDSETS + 1];      /* Dataset IDs */
+    hid_t       mem_type_id[MULTI_NDSETS + 1];  /* Memory datatypes */
+    hid_t       mem_space_id[MULTI_NDSETS + 1]; /* Memory dataspaces */
+    hid_t       file_space_id[MULTI_NDSETS + 1];/* File dataspaces */
+    int         wbuf[MULTI_NDSETS + 1][MULTI_DIM];  /* Write buffers */
+    int         rbuf[MULTI_NDSETS + 1][MULTI_DIM];  /* Read buffers */
+    const void *wbufs[MULTI_NDSETS + 1];
+    void       *rbufs[MULTI_NDSETS + 1];
+    hsize_t     dims[1] = {MULTI_DIM};  /* Dataset dimensions */
+    hsize_t     chunk_dims[1] = {17};   /* Chunk dimensions */
+    hsize_t     start[1], stride[1], count[1], block[1];    /* Hyperslab parameters */
+    herr_t      status;                 /* Error status */
+    size_t      u;                      /* Local index variable */
+    int         i;                      /* Local index variable */
+
+    TESTING("reading & writing multiple datasets with one call");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+    h5_fixname(FILENAME[29], fapl, filename2, sizeof filename2);
+
+    for(u = 0; u <= MULTI_NDSETS; u++) {
+        dset_id[u] = -1;
+        mem_type_id[u] = H5T_NATIVE_INT;
+        mem_space_id[u] = H5S_ALL;
+        file_space_id[u] = H5S_ALL;
+        for(i = 0; i < MULTI_DIM; i++)
+            wbuf[u][i] = (int)(u * 1000) + i;
+        wbufs[u] = wbuf[u];
+        rbufs[u] = rbuf[u];
+    } /* end for */
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((fid2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Contiguous datasets, created in the opposite order from their
+     * position in the arrays
+     */
+    for(u = MULTI_NCONTIG; u > 0; u--) {
+        HDsprintf(dset_name, "multi_contig_%u", (unsigned)(u - 1));
+        if((dset_id[u - 1] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Chunked dataset */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((dset_id[5] = H5Dcreate2(fid, "multi_chunk", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+
+    /* Compact dataset */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_layout(dcpl, H5D_COMPACT) < 0) FAIL_STACK_ERROR
+    if((dset_id[6] = H5Dcreate2(fid, "multi_compact", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    dcpl = -1;
+
+    /* Contiguous dataset which needs type conversion */
+    if((dset_id[7] = H5Dcreate2(fid, "multi_conv", H5T_STD_I64BE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Contiguous dataset in the other file */
+    if((dset_id[8] = H5Dcreate2(fid2, "multi_other", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Write & read all the datasets */
+    if(H5Dwrite_multi((size_t)(MULTI_NDSETS + 1), dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, wbufs) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread_multi((size_t)(MULTI_NDSETS + 1), dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, rbufs) < 0) FAIL_STACK_ERROR
+    for(u = 0; u <= MULTI_NDSETS; u++)
+        for(i = 0; i < MULTI_DIM; i++)
+            if(rbuf[u][i] != wbuf[u][i])
+                TEST_ERROR
+    if(H5Dclose(dset_id[MULTI_NDSETS]) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid2) < 0) FAIL_STACK_ERROR
+    dset_id[MULTI_NDSETS] = -1;
+    fid2 = -1;
+
+    /* Read every third element of the contiguous datasets, packed in memory */
+    start[0] = 1;
+    stride[0] = 3;
+    count[0] = MULTI_DIM / 3;
+    block[0] = 1;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block) < 0) FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(1, count, NULL)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_NCONTIG; u++) {
+        mem_space_id[u] = mid;
+        file_space_id[u] = sid;
+    } /* end for */
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread_multi((size_t)MULTI_NCONTIG, dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, rbufs) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_NCONTIG; u++)
+        for(i = 0; i < (int)count[0]; i++)
+            if(rbuf[u][i] != wbuf[u][1 + 3 * i])
+                TEST_ERROR
+
+    /* Write overlapping parts of the same dataset: the later write must win */
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    mid = -1;
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    start[0] = 0;
+    count[0] = 60;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    start[0] = 30;
+    if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < MULTI_DIM; i++) {
+        wbuf[0][i] = -1;
+        wbuf[MULTI_NDSETS][i] = -2;
+    } /* end for */
+    mem_space_id[0] = sid;
+    file_space_id[0] = sid;
+    mem_space_id[1] = mid;
+    file_space_id[1] = mid;
+    {
+        hid_t ovl_dset_id[2];
+        const void *ovl_wbufs[2];
+
+        ovl_dset_id[0] = ovl_dset_id[1] = dset_id[0];
+        ovl_wbufs[0] = wbuf[0];
+        ovl_wbufs[1] = wbuf[MULTI_NDSETS];
+        if(H5Dwrite_multi((size_t)2, ovl_dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, ovl_wbufs) < 0) FAIL_STACK_ERROR
+    }
+    if(H5Dread(dset_id[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[0]) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < MULTI_DIM; i++)
+        if(rbuf[0][i] != (i < 30 ? -1 : (i < 90 ? -2 : i)))
+            TEST_ERROR
+
+    /* Check that a count of zero is allowed & that invalid arguments fail */
+    if(H5Dread_multi((size_t)0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0) FAIL_STACK_ERROR
+    mem_space_id[0] = H5S_ALL;
+    file_space_id[0] = H5S_ALL;
+    mem_space_id[1] = H5S_ALL;
+    file_space_id[1] = H5S_ALL;
+    dset_id[MULTI_NDSETS] = sid;
+    H5E_BEGIN_TRY {
+        status = H5Dread_multi((size_t)(MULTI_NDSETS + 1), dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, rbufs);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Dwrite_multi((size_t)2, dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, NULL);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    dset_id[MULTI_NDSETS] = -1;
+
+    /* Close everything */
+    for(u = 0; u < MULTI_NDSETS; u++)
+        if(H5Dclose(dset_id[u]) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        for(u = 0; u <= MULTI_NDSETS; u++)
+            H5Dclose(dset_id[u]);
+        H5Pclose(dcpl);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Fclose(fid2);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_multi_dset_io() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -13841,6 +14916,7 @@ main(void)
                 nerrors += (test_tconv(file) < 0            ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0         ? 1 : 0);
+                nerrors += (test_shuffle_sizes() < 0              ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0                 ? 1 : 0);
                 nerrors += (test_nbit_float(file) < 0                     ? 1 : 0);
                 nerrors += (test_nbit_double(file) < 0                     ? 1 : 0);
@@ -13879,6 +14955,7 @@ main(void)
                 nerrors += (test_huge_chunks(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_chunk_cache(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0   ? 1 : 0);
+                nerrors += (test_chunk_cache_policy(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_chunk_fast(envval, my_fapl) < 0    ? 1 : 0);
                 nerrors += (test_reopen_chunk_fast(my_fapl) < 0        ? 1 : 0);
                 nerrors += (test_chunk_fast_bug1(my_fapl) < 0           ? 1 : 0);
@@ -13892,6 +14969,10 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0              ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0                  ? 1 : 0);
+                nerrors += (test_filter_nthreads(my_fapl) < 0           ? 1 : 0);
+                nerrors += (test_multi_dset_io(my_fapl) < 0             ? 1 : 0);
+                nerrors += (test_chunk_read_gap(my_fapl) < 0            ? 1 : 0);
+                nerrors += (test_prepared_read(my_fapl) < 0             ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0   ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0     ? 1 : 0);
@@ -880,6 +880,139 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_hard_packed
+ *
+ * Purpose:     Tests that converting a packed buffer of many elements at
+ *              once, which the library may do with vector instructions,
+ *              gives the same results as converting the elements one at a
+ *              time, for buffers of all lengths up to a few vectors and
+ *              with values out of the range of the destination.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_hard_packed(void)
+{
+    struct {
+        hid_t src, dst;
+    } conv[] = {
+        {H5T_NATIVE_SCHAR,  H5T_NATIVE_SHORT},
+        {H5T_NATIVE_SCHAR,  H5T_NATIVE_USHORT},
+        {H5T_NATIVE_UCHAR,  H5T_NATIVE_SCHAR},
+        {H5T_NATIVE_SHORT,  H5T_NATIVE_INT},
+        {H5T_NATIVE_SHORT,  H5T_NATIVE_SCHAR},
+        {H5T_NATIVE_SHORT,  H5T_NATIVE_UCHAR},
+        {H5T_NATIVE_USHORT, H5T_NATIVE_UCHAR},
+        {H5T_NATIVE_USHORT, H5T_NATIVE_SHORT},
+        {H5T_NATIVE_INT,    H5T_NATIVE_LLONG},
+        {H5T_NATIVE_INT,    H5T_NATIVE_ULLONG},
+        {H5T_NATIVE_INT,    H5T_NATIVE_SHORT},
+        {H5T_NATIVE_INT,    H5T_NATIVE_USHORT},
+        {H5T_NATIVE_UINT,   H5T_NATIVE_USHORT},
+        {H5T_NATIVE_UINT,   H5T_NATIVE_INT},
+        {H5T_NATIVE_INT,    H5T_NATIVE_FLOAT},
+        {H5T_NATIVE_INT,    H5T_NATIVE_DOUBLE},
+        {H5T_NATIVE_FLOAT,  H5T_NATIVE_INT},
+        {H5T_NATIVE_DOUBLE, H5T_NATIVE_INT},
+        {H5T_NATIVE_FLOAT,  H5T_NATIVE_DOUBLE},
+        {H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT},
+        {H5T_STD_I16BE,     H5T_STD_I16LE},
+        {H5T_STD_U32BE,     H5T_STD_U32LE},
+        {H5T_IEEE_F64BE,    H5T_IEEE_F64LE}
+    };
+    const size_t max_nelmts = 70;
+    unsigned char *saved = NULL, *buf = NULL, *one = NULL;
+    size_t      src_size, dst_size;
+    size_t      nelmts, u, v;
+    int         i;
+    unsigned int fails_this_test = 0;
+
+    TESTING("hard conversions of packed buffers");
+
+    if(NULL == (saved = (unsigned char *)HDmalloc(max_nelmts * 8)))
+        goto error;
+    if(NULL == (buf = (unsigned char *)HDmalloc(max_nelmts * 8)))
+        goto error;
+    if(NULL == (one = (unsigned char *)HDmalloc(8)))
+        goto error;
+
+    for(u = 0; u < NELMTS(conv); u++) {
+        src_size = H5Tget_size(conv[u].src);
+        dst_size = H5Tget_size(conv[u].dst);
+
+        /* Source values: integers of all magnitudes, including ones out of
+         * the range of the destination, and finite floating-point numbers
+         * of all magnitudes */
+        for(v = 0; v < max_nelmts; v++) {
+            i = (int)HDrandom() % 61 - 30;
+            if(H5T_FLOAT == H5Tget_class(conv[u].src)) {
+                if(src_size == sizeof(float)) {
+                    float f = (float)HDldexp((double)HDrandom() / RAND_MAX, i * 2) * (i % 2 ? -1.0F : 1.0F);
+
+                    HDmemcpy(saved + v * src_size, &f, src_size);
+                } /* end if */
+                else {
+                    double d = HDldexp((double)HDrandom() / RAND_MAX, i * 10) * (i % 2 ? -1.0 : 1.0);
+
+                    HDmemcpy(saved + v * src_size, &d, src_size);
+                } /* end else */
+            } /* end if */
+            else {
+                long long ll = (long long)HDrandom() * (long long)HDrandom() * (i % 2 ? -1 : 1);
+
+                HDmemcpy(saved + v * src_size, &ll, src_size);
+            } /* end else */
+        } /* end for */
+
+        for(nelmts = 0; nelmts <= max_nelmts; nelmts++) {
+            /* Convert the buffer at once */
+            HDmemcpy(buf, saved, nelmts * src_size);
+            if(H5Tconvert(conv[u].src, conv[u].dst, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+                goto error;
+
+            /* Compare with the elements converted one at a time */
+            for(v = 0; v < nelmts; v++) {
+                HDmemcpy(one, saved + v * src_size, src_size);
+                if(H5Tconvert(conv[u].src, conv[u].dst, (size_t)1, one, NULL, H5P_DEFAULT) < 0)
+                    goto error;
+                if(HDmemcmp(one, buf + v * dst_size, dst_size)) {
+                    if(0 == fails_this_test++)
+                        H5_FAILED();
+                    HDprintf("    conversion %u of %u elements differs at element %u\n",
+                            (unsigned)u, (unsigned)nelmts, (unsigned)v);
+                    break;
+                } /* end if */
+            } /* end for */
+        } /* end for */
+    } /* end for */
+
+    if(fails_this_test)
+        goto error;
+
+    HDfree(one);
+    HDfree(buf);
+    HDfree(saved);
+
+    PASSED();
+    return 0;
+
+error:
+    HDfflush(stdout);
+    if(one)
+        HDfree(one);
+    if(buf)
+        HDfree(buf);
+    if(saved)
+        HDfree(saved);
+
+    return MAX((int)fails_this_test, 1);
+}
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5271,6 +5404,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test hardware conversions of packed buffers of many elements */
+    nerrors += (unsigned long)test_hard_packed();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
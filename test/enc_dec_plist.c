@@ -178,7 +178,8 @@ main(void)
         FALSE,
         0.2f,
         (256 * 2048),
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        H5C_repl__arc};
 
     H5AC_cache_image_config_t my_cache_image_config = {
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
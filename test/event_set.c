@@ -0,0 +1,420 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Tests event sets and the asynchronous API routines
+ *              (H5Dread_async, H5Dwrite_async, H5Fflush_async and
+ *              H5Oclose_async).
+ */
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "event_set_1",
+    NULL
+};
+
+#define DSET_NAME       "dset"
+#define DSET_DIM        1000
+#define NUM_OPS         8
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_basic
+ *
+ * Purpose:     Tests creating, waiting on and closing empty event sets.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_basic(void)
+{
+    hid_t       es_id = H5I_INVALID_HID;
+    size_t      count;
+    size_t      num_in_progress;
+    hbool_t     op_failed;
+    herr_t      ret;
+
+    TESTING("event set creation and waiting");
+
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+
+    /* An empty event set has nothing in progress */
+    count = 1;
+    if(H5ESget_count(es_id, &count) < 0) FAIL_STACK_ERROR
+    if(0 != count) TEST_ERROR
+
+    num_in_progress = 1;
+    op_failed = TRUE;
+    if(H5ESwait(es_id, H5ES_WAIT_NONE, &num_in_progress, &op_failed) < 0) FAIL_STACK_ERROR
+    if(0 != num_in_progress || op_failed) TEST_ERROR
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0) FAIL_STACK_ERROR
+    if(0 != num_in_progress || op_failed) TEST_ERROR
+
+    /* Invalid arguments */
+    H5E_BEGIN_TRY {
+        ret = H5ESwait(es_id, H5ES_WAIT_FOREVER, NULL, &op_failed);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5ESwait(H5P_DEFAULT, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+
+    /* The event set is gone */
+    H5E_BEGIN_TRY {
+        ret = H5ESclose(es_id);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_es_basic() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_dataset_io
+ *
+ * Purpose:     Tests asynchronous dataset writes and reads, flushing the
+ *              file and closing the dataset through an event set.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_dataset_io(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       fid = H5I_INVALID_HID;
+    hid_t       sid = H5I_INVALID_HID;
+    hid_t       mem_sid = H5I_INVALID_HID;
+    hid_t       did = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hsize_t     dims[1] = {DSET_DIM};
+    hsize_t     mem_dims[1] = {DSET_DIM / NUM_OPS};
+    hsize_t     start[1], count[1];
+    int         *wbuf = NULL;
+    int         *rbuf = NULL;
+    size_t      num_in_progress;
+    hbool_t     op_failed;
+    unsigned    u;
+
+    TESTING("asynchronous dataset I/O");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(DSET_DIM * sizeof(int)))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(DSET_DIM, sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM; u++)
+        wbuf[u] = (int)(u * 3);
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((mem_sid = H5Screate_simple(1, mem_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+
+    /* Write the dataset in pieces.  The selection on the file dataspace is
+     * changed after each insert, which must not affect the operations
+     * already in the event set.
+     */
+    for(u = 0; u < NUM_OPS; u++) {
+        start[0] = u * mem_dims[0];
+        count[0] = mem_dims[0];
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite_async(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, wbuf + start[0], es_id) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Sselect_none(sid) < 0) FAIL_STACK_ERROR
+
+    /* Flush the file, then read the whole dataset back */
+    if(H5Fflush_async(fid, H5F_SCOPE_LOCAL, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Dread_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf, es_id) < 0) FAIL_STACK_ERROR
+
+    /* Close the dataset through the event set too; the operation holds
+     * the dataset open until it runs.
+     */
+    if(H5Oclose_async(did, es_id) < 0) FAIL_STACK_ERROR
+    did = H5I_INVALID_HID;
+
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0) FAIL_STACK_ERROR
+    if(0 != num_in_progress) TEST_ERROR
+    if(op_failed) TEST_ERROR
+
+    for(u = 0; u < DSET_DIM; u++)
+        if(rbuf[u] != wbuf[u]) {
+            HDprintf("    rbuf[%u] = %d, wbuf[%u] = %d\n", u, rbuf[u], u, wbuf[u]);
+            TEST_ERROR
+        } /* end if */
+
+    /* The dataset was closed by the event set */
+    if(0 != H5Fget_obj_count(fid, H5F_OBJ_DATASET)) TEST_ERROR
+
+    if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mem_sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+        H5Dclose(did);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_es_dataset_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_failure
+ *
+ * Purpose:     Tests that a failed operation is reported by H5ESwait and
+ *              doesn't keep later operations from running.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_failure(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       fid = H5I_INVALID_HID;
+    hid_t       sid = H5I_INVALID_HID;
+    hid_t       big_sid = H5I_INVALID_HID;
+    hid_t       did = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hsize_t     dims[1] = {DSET_DIM};
+    hsize_t     big_dims[1] = {DSET_DIM * 2};
+    int         *buf = NULL;
+    size_t      count;
+    size_t      num_in_progress;
+    hbool_t     op_failed;
+    herr_t      ret;
+    unsigned    u;
+
+    TESTING("failed asynchronous operations");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (buf = (int *)HDcalloc(DSET_DIM * 2, sizeof(int)))) TEST_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((big_sid = H5Screate_simple(1, big_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+
+    /* Arguments that can be checked up front are rejected immediately */
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, sid);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_async(did, H5T_NATIVE_INT, H5S_ALL, H5T_NATIVE_INT, H5P_DEFAULT, buf, es_id);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5ESget_count(es_id, &count) < 0) FAIL_STACK_ERROR
+    if(0 != count) TEST_ERROR
+
+    /* A selection mismatch is only found when the write is performed */
+    for(u = 0; u < DSET_DIM; u++)
+        buf[u] = (int)u;
+    if(H5Dwrite_async(did, H5T_NATIVE_INT, big_sid, H5S_ALL, H5P_DEFAULT, buf, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id) < 0) FAIL_STACK_ERROR
+
+    if(H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0) FAIL_STACK_ERROR
+    if(0 != num_in_progress) TEST_ERROR
+    if(!op_failed) TEST_ERROR
+
+    /* The failure stays recorded in the event set */
+    if(H5ESwait(es_id, H5ES_WAIT_NONE, &num_in_progress, &op_failed) < 0) FAIL_STACK_ERROR
+    if(!op_failed) TEST_ERROR
+
+    /* The second write went through */
+    HDmemset(buf, 0, DSET_DIM * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < DSET_DIM; u++)
+        if(buf[u] != (int)u) TEST_ERROR
+
+    if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(big_sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+        H5Dclose(did);
+        H5Sclose(big_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    HDfree(buf);
+    return -1;
+} /* end test_es_failure() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_es_close_pending
+ *
+ * Purpose:     Tests that closing an event set, or the library, completes
+ *              the operations still in it.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_close_pending(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       fid = H5I_INVALID_HID;
+    hid_t       sid = H5I_INVALID_HID;
+    hid_t       did = H5I_INVALID_HID;
+    hid_t       es_id = H5I_INVALID_HID;
+    hid_t       core_fapl = H5I_INVALID_HID;
+    hsize_t     dims[1] = {DSET_DIM};
+    int         *buf = NULL;
+    unsigned    u;
+
+    TESTING("closing event sets with pending operations");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    if(NULL == (buf = (int *)HDmalloc(DSET_DIM * sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM; u++)
+        buf[u] = (int)(DSET_DIM - u);
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+
+    /* Closing the event set waits for the write */
+    if(H5Dwrite_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Oclose_async(did, es_id) < 0) FAIL_STACK_ERROR
+    did = H5I_INVALID_HID;
+    if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+    es_id = H5I_INVALID_HID;
+
+    HDmemset(buf, 0, DSET_DIM * sizeof(int));
+    if((did = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < DSET_DIM; u++)
+        if(buf[u] != (int)(DSET_DIM - u)) TEST_ERROR
+
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Leave an operation on an in-memory file in an open event set, for
+     * library shutdown to complete.
+     */
+    if((core_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fapl_core(core_fapl, (size_t)4096, FALSE) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, core_fapl)) < 0) FAIL_STACK_ERROR
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+    if(H5Fflush_async(fid, H5F_SCOPE_GLOBAL, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(core_fapl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(core_fapl);
+    } H5E_END_TRY;
+    HDfree(buf);
+    return -1;
+} /* end test_es_close_pending() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Tests event sets
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t       fapl = H5I_INVALID_HID;
+    int         nerrors = 0;
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    nerrors += test_es_basic() < 0 ? 1 : 0;
+    nerrors += test_es_dataset_io(fapl) < 0 ? 1 : 0;
+    nerrors += test_es_failure(fapl) < 0 ? 1 : 0;
+    nerrors += test_es_close_pending(fapl) < 0 ? 1 : 0;
+
+    if(nerrors)
+        goto error;
+
+    h5_cleanup(FILENAME, fapl);
+
+    HDprintf("All event set tests passed.\n");
+
+    /* Shuts down the library, which completes the operation left in an
+     * event set by test_es_close_pending.
+     */
+    H5close();
+
+    HDexit(EXIT_SUCCESS);
+
+error:
+    nerrors = MAX(1, nerrors);
+    HDprintf("***** %d EVENT SET TEST%s FAILED! *****\n",
+            nerrors, 1 == nerrors ? "" : "S");
+    HDexit(EXIT_FAILURE);
+} /* end main() */
@@ -94,22 +94,14 @@ static H5_ATTR_PURE hbool_t
 verify_tag_not_in_cache(const H5F_t *f, haddr_t tag)
 {
     H5C_t *cache_ptr = NULL;                /* cache pointer                */
-    int i = 0;                              /* iterator                     */
+    H5C_cache_entry_t *entry_ptr;           /* entry pointer                */
 
     /* Get Internal Cache Pointers */
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;    /* entry pointer                */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(tag == entry_ptr->tag_info->tag)
-                return TRUE;
-            else
-                entry_ptr = entry_ptr->ht_next;
-        }
-    }
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(tag == entry_ptr->tag_info->tag)
+            return TRUE;
 
     return FALSE;
 } /* end verify_tag_not_in_cache() */
@@ -55,6 +55,9 @@ test_chksum_size_one(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xfa2568b7, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x96e9f0d5, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0xa209c931, "H5_checksum_lookup3");
 
@@ -66,6 +69,9 @@ test_chksum_size_one(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xfa60fb57, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x527d5351, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x8ba9414b, "H5_checksum_lookup3");
 } /* test_chksum_size_one() */
@@ -89,6 +95,9 @@ test_chksum_size_two(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xfc856608, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x9f5596e4, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x8ba7a6c9, "H5_checksum_lookup3");
 
@@ -100,6 +109,9 @@ test_chksum_size_two(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xfc7e9b20, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0xf16177d2, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x62cd61b3, "H5_checksum_lookup3");
 } /* test_chksum_size_two() */
@@ -123,6 +135,9 @@ test_chksum_size_three(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xfebc5d70, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0xf6b5da57, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0xcebdf4f0, "H5_checksum_lookup3");
 
@@ -134,6 +149,9 @@ test_chksum_size_three(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xf9cc4c7a, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x6064a37a, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x6bd0060f, "H5_checksum_lookup3");
 } /* test_chksum_size_three() */
@@ -157,6 +175,9 @@ test_chksum_size_four(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xff398a46, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x7c0562d4, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x2c88bb51, "H5_checksum_lookup3");
 
@@ -168,6 +189,9 @@ test_chksum_size_four(void)
     chksum = H5_checksum_crc(buf, sizeof(buf));
     VERIFY(chksum, 0xff117081, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(buf, sizeof(buf), 0);
+    VERIFY(chksum, 0x48674bc7, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(buf, sizeof(buf), 0);
     VERIFY(chksum, 0x049396b8, "H5_checksum_lookup3");
 } /* test_chksum_size_four() */
@@ -200,6 +224,9 @@ test_chksum_large(void)
     chksum = H5_checksum_crc(large_buf, (size_t)BUF_LEN);
     VERIFY(chksum, 0xfbd0f7c0, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(large_buf, (size_t)BUF_LEN, 0);
+    VERIFY(chksum, 0x1fb99cdb, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(large_buf, (size_t)BUF_LEN, 0);
     VERIFY(chksum, 0x1bd2ee7b, "H5_checksum_lookup3");
 
@@ -211,6 +238,9 @@ test_chksum_large(void)
     chksum = H5_checksum_crc(large_buf, (size_t)BUF_LEN);
     VERIFY(chksum, 0xfac8b4c4, "H5_checksum_crc");
 
+    chksum = H5_checksum_crc32c(large_buf, (size_t)BUF_LEN, 0);
+    VERIFY(chksum, 0xbe1c8d5e, "H5_checksum_crc32c");
+
     chksum = H5_checksum_lookup3(large_buf, (size_t)BUF_LEN, 0);
     VERIFY(chksum, 0x930c7afc, "H5_checksum_lookup3");
 
@@ -218,6 +248,69 @@ test_chksum_large(void)
     HDfree(large_buf);
 } /* test_chksum_large() */
 
+
+/****************************************************************
+**
+**  test_chksum_unaligned(): Checksum buffers of all small lengths
+**      at all alignments, checking the word-at-a-time and
+**      instruction set paths against plain byte-wise results.
+**
+****************************************************************/
+static void
+test_chksum_unaligned(void)
+{
+    const char *check = "123456789";    /* Standard CRC check string */
+    uint8_t *buf;               /* Buffer for checksum calculations */
+    uint8_t *aligned;           /* Aligned copy of part of the buffer */
+    uint32_t chksum;            /* Checksum value */
+    uint32_t crc;               /* Bit-wise CRC32C */
+    size_t off, len, u;         /* Local index variables */
+    unsigned k;                 /* Local index variable */
+
+    /* The CRC32C check value of RFC 3720 */
+    chksum = H5_checksum_crc32c(check, HDstrlen(check), 0);
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    /* Continuing a checksum gives the one of the concatenated buffers */
+    chksum = H5_checksum_crc32c(check, (size_t)4, 0);
+    chksum = H5_checksum_crc32c(check + 4, HDstrlen(check) - 4, chksum);
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    /* Allocate the buffers */
+    buf = (uint8_t *)HDmalloc((size_t)BUF_LEN);
+    CHECK_PTR(buf, "HDmalloc");
+    aligned = (uint8_t *)HDmalloc((size_t)BUF_LEN);
+    CHECK_PTR(aligned, "HDmalloc");
+
+    /* Initialize buffer w/known data */
+    for(u = 0; u < BUF_LEN; u++)
+        buf[u] = (uint8_t)((u * 7) ^ (u >> 3));
+
+    for(off = 0; off < 8; off++)
+        for(len = 1; len <= 80; len++) {
+            HDmemcpy(aligned, buf + off, len);
+
+            /* Bit-wise CRC32C, for reference */
+            crc = 0xffffffff;
+            for(u = 0; u < len; u++) {
+                crc ^= aligned[u];
+                for(k = 0; k < 8; k++)
+                    crc = (crc >> 1) ^ ((crc & 1) ? 0x82f63b78 : 0);
+            } /* end for */
+            crc = ~crc;
+
+            chksum = H5_checksum_crc32c(buf + off, len, 0);
+            VERIFY(chksum, crc, "H5_checksum_crc32c");
+
+            chksum = H5_checksum_lookup3(buf + off, len, 0);
+            VERIFY(chksum, H5_checksum_lookup3(aligned, len, 0), "H5_checksum_lookup3");
+        } /* end for */
+
+    /* Release memory for buffers */
+    HDfree(aligned);
+    HDfree(buf);
+} /* test_chksum_unaligned() */
+
 
 /****************************************************************
 **
@@ -236,6 +329,7 @@ test_checksum(void)
     test_chksum_size_three();		/* Test buffer w/only 3 bytes */
     test_chksum_size_four();		/* Test buffer w/only 4 bytes */
     test_chksum_large();		/* Test buffer w/larger # of bytes */
+    test_chksum_unaligned();		/* Test buffers at all alignments */
 
 } /* test_checksum() */
 
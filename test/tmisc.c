@@ -336,6 +336,11 @@ typedef struct
 #define MISC35_SPACE_DIM3       13
 #define MISC35_NPOINTS          10
 
+/* Definitions for misc. test #36 */
+#define MISC36_NITER            20
+#define MISC36_GLB_LIM          8192
+#define MISC36_LST_LIM          1024
+
 
 /****************************************************************
 **
@@ -3091,6 +3096,7 @@ test_misc19(void)
     hid_t esid = -1;                /* Error Stack ID           */
     hid_t vfdid = -1;               /* Virtual File Driver ID   */
     hid_t volid = -1;               /* Virtual Object Layer ID  */
+    hid_t evsid = -1;               /* Event Set ID             */
     H5FD_class_t *vfd_cls = NULL;   /* VFD class                */
     H5VL_class_t *vol_cls = NULL;   /* VOL class                */
     int rc;                         /* Reference count          */
@@ -3581,6 +3587,38 @@ test_misc19(void)
 
     HDfree(vol_cls);
 
+/* Check H5I operations on event sets */
+
+    /* Create an event set */
+    evsid = H5EScreate();
+    CHECK(evsid, FAIL, "H5EScreate");
+
+    /* Check the reference count */
+    rc = H5Iget_ref(evsid);
+    VERIFY(rc, 1, "H5Iget_ref");
+
+    /* Inc the reference count */
+    rc = H5Iinc_ref(evsid);
+    VERIFY(rc, 2, "H5Iinc_ref");
+
+    /* Close the event set normally */
+    ret = H5ESclose(evsid);
+    CHECK(ret, FAIL, "H5ESclose");
+
+    /* Check the reference count */
+    rc = H5Iget_ref(evsid);
+    VERIFY(rc, 1, "H5Iget_ref");
+
+    /* Close the event set by decrementing the reference count */
+    rc = H5Idec_ref(evsid);
+    VERIFY(rc, 0, "H5Idec_ref");
+
+    /* Try closing the event set again (should fail) */
+    H5E_BEGIN_TRY {
+        ret = H5ESclose(evsid);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5ESclose");
+
 } /* end test_misc19() */
 
 /****************************************************************
@@ -5802,6 +5840,110 @@ test_misc35(void)
 } /* end test_misc35() */
 
 
+/****************************************************************
+**
+**  test_misc36(): Check free-list statistics and that the free
+**      list limits bound the memory kept on the free lists.
+**
+****************************************************************/
+static void
+test_misc36(void)
+{
+    hid_t sid = H5I_INVALID_HID; /* Dataspace ID */
+    hsize_t dims[] = {MISC35_SPACE_DIM1, MISC35_SPACE_DIM2, MISC35_SPACE_DIM3};   /* Dataspace dims */
+    hsize_t start[MISC35_SPACE_RANK] = {0, 0, 0};       /* Hyperslab start */
+    hsize_t count[MISC35_SPACE_RANK] = {1, 2, 2};       /* Hyperslab count */
+    H5_free_list_stats_t reg_stats;     /* "Regular" free list statistics */
+    H5_free_list_stats_t arr_stats;     /* "Array" free list statistics */
+    H5_free_list_stats_t blk_stats;     /* "Block" free list statistics */
+    H5_free_list_stats_t fac_stats;     /* "Factory" free list statistics */
+    unsigned u;                 /* Local index variable */
+    herr_t ret;                 /* Return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Free-list statistics & limits"));
+
+    /* Create & release dataspaces with selections, to use the free lists */
+    for(u = 0; u < MISC36_NITER; u++) {
+        sid = H5Screate_simple(MISC35_SPACE_RANK, dims, NULL);
+        CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+        ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Retrieve the statistics (NULL pointers are allowed) */
+    ret = H5get_free_list_stats(&reg_stats, NULL, NULL, NULL);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    ret = H5get_free_list_stats(&reg_stats, &arr_stats, &blk_stats, &fac_stats);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+
+#if !defined H5_USING_MEMCHECKER
+    /* Blocks were handed out & the repeated calls recycled some of them */
+    CHECK(reg_stats.total_alloc_count, 0, "H5get_free_list_stats");
+    CHECK(reg_stats.reuse_alloc_count, 0, "H5get_free_list_stats");
+#else /* H5_USING_MEMCHECKER */
+    VERIFY(reg_stats.total_alloc_count, 0, "H5get_free_list_stats");
+    VERIFY(reg_stats.reuse_alloc_count, 0, "H5get_free_list_stats");
+#endif /* H5_USING_MEMCHECKER */
+    if(reg_stats.reuse_alloc_count > reg_stats.total_alloc_count)
+        ERROR("reg_stats.reuse_alloc_count > reg_stats.total_alloc_count");
+    if(blk_stats.reuse_alloc_count > blk_stats.total_alloc_count)
+        ERROR("blk_stats.reuse_alloc_count > blk_stats.total_alloc_count");
+
+    /* Set small limits on the free lists */
+    ret = H5set_free_list_limits(MISC36_GLB_LIM, MISC36_LST_LIM, MISC36_GLB_LIM,
+            MISC36_LST_LIM, MISC36_GLB_LIM, MISC36_LST_LIM);
+    CHECK(ret, FAIL, "H5set_free_list_limits");
+
+    /* Use the free lists again */
+    for(u = 0; u < MISC36_NITER; u++) {
+        sid = H5Screate_simple(MISC35_SPACE_RANK, dims, NULL);
+        CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+        ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* The memory kept on the free lists must be within the limits */
+    ret = H5get_free_list_stats(&reg_stats, &arr_stats, &blk_stats, &fac_stats);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    if(reg_stats.curr_free_bytes > MISC36_GLB_LIM)
+        ERROR("reg_stats.curr_free_bytes > limit");
+    if(arr_stats.curr_free_bytes > MISC36_GLB_LIM)
+        ERROR("arr_stats.curr_free_bytes > limit");
+    if(blk_stats.curr_free_bytes > MISC36_GLB_LIM)
+        ERROR("blk_stats.curr_free_bytes > limit");
+    if(fac_stats.curr_free_bytes > MISC36_GLB_LIM)
+        ERROR("fac_stats.curr_free_bytes > limit");
+
+    /* Keep nothing on the free lists */
+    ret = H5set_free_list_limits(0, 0, 0, 0, 0, 0);
+    CHECK(ret, FAIL, "H5set_free_list_limits");
+
+    sid = H5Screate_simple(MISC35_SPACE_RANK, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    ret = H5get_free_list_stats(&reg_stats, &arr_stats, &blk_stats, &fac_stats);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    VERIFY(reg_stats.curr_free_bytes, 0, "H5get_free_list_stats");
+    VERIFY(reg_stats.curr_free_blocks_count, 0, "H5get_free_list_stats");
+    VERIFY(arr_stats.curr_free_bytes, 0, "H5get_free_list_stats");
+    VERIFY(blk_stats.curr_free_bytes, 0, "H5get_free_list_stats");
+    VERIFY(blk_stats.curr_free_blocks_count, 0, "H5get_free_list_stats");
+    VERIFY(fac_stats.curr_free_bytes, 0, "H5get_free_list_stats");
+
+    /* Restore the default limits */
+    ret = H5set_free_list_limits(1024 * 1024, 64 * 1024, 4 * 1024 * 1024,
+            256 * 1024, 16 * 1024 * 1024, 1024 * 1024);
+    CHECK(ret, FAIL, "H5set_free_list_limits");
+} /* end test_misc36() */
+
+
 /****************************************************************
 **
 **  test_misc(): Main misc. test routine.
@@ -5852,6 +5994,7 @@ test_misc(void)
     test_misc33();      /* Test to verify that H5HL_offset_into() returns error if offset exceeds heap block */
     test_misc34();      /* Test behavior of 0 and NULL in H5MM API calls */
     test_misc35();      /* Test behavior of free-list & allocation statistics API calls */
+    test_misc36();      /* Test free-list statistics & limits */
 
 } /* test_misc() */
 
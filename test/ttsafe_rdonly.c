@@ -0,0 +1,275 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing concurrent reads of a file opened read-only
+ * ---------------------------------------------------
+ *
+ * The raw data of a file opened read-only is read without holding the
+ * library's lock.  Several threads read contiguous and chunked datasets
+ * (whole, by hyperslab and with H5Dread_multi) from the same file at
+ * once, while the main thread keeps using the library, and check the
+ * data they get back.
+ *
+ * Temporary files generated:
+ *   ttsafe_rdonly.h5
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME        "ttsafe_rdonly.h5"
+#define NUM_THREAD      8
+#define NUM_ITER        4
+#define DSET_SIZE       (128 * 1024)
+#define CHUNK_SIZE      (16 * 1024)
+#define SLAB_START      1000
+#define SLAB_SIZE       5000
+
+typedef struct rdonly_info_t {
+    int id;                     /* Thread's index */
+    hid_t file;                 /* File to read from */
+    int nerrors;                /* Number of errors the thread saw */
+} rdonly_info_t;
+
+static void *tts_rdonly_reader(void *_info);
+
+/* Value of element I in dataset N */
+static int
+rdonly_value(int n, size_t i)
+{
+    return n * DSET_SIZE + (int)i;
+}
+
+/* Check NELMTS elements read from dataset N, starting at element START */
+static int
+rdonly_check(int n, const int *buf, size_t start, size_t nelmts)
+{
+    size_t u;
+
+    for(u = 0; u < nelmts; u++)
+        if(buf[u] != rdonly_value(n, start + u))
+            return 1;
+
+    return 0;
+}
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent reads of a read-only file
+ **********************************************************************
+ */
+void
+tts_rdonly_read(void)
+{
+    H5TS_thread_t threads[NUM_THREAD];
+    rdonly_info_t info[NUM_THREAD];
+    H5TS_attr_t attribute;
+    hid_t   file = H5I_INVALID_HID;
+    hid_t   space = H5I_INVALID_HID;
+    hid_t   dcpl = H5I_INVALID_HID;
+    hid_t   dset = H5I_INVALID_HID;
+    hsize_t dims[1] = {DSET_SIZE};
+    hsize_t chunk_dims[1] = {CHUNK_SIZE};
+    char    name[32];
+    int     *buf;
+    ssize_t nobjs;
+    size_t  u;
+    int     i;
+    herr_t  status;
+
+    buf = (int *)HDmalloc(DSET_SIZE * sizeof(int));
+    CHECK_PTR(buf, "HDmalloc");
+
+    /* Create a contiguous and a chunked dataset for each thread */
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    space = H5Screate_simple(1, dims, NULL);
+    CHECK(space, H5I_INVALID_HID, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+
+    for(i = 0; i < 2 * NUM_THREAD; i++) {
+        for(u = 0; u < DSET_SIZE; u++)
+            buf[u] = rdonly_value(i, u);
+
+        HDsnprintf(name, sizeof(name), "%s%d", (i % 2) ? "chunked" : "contig", i / 2);
+        dset = H5Dcreate2(file, name, H5T_NATIVE_INT, space, H5P_DEFAULT, (i % 2) ? dcpl : H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dset, H5I_INVALID_HID, "H5Dcreate2");
+        status = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(status, FAIL, "H5Dwrite");
+        status = H5Dclose(dset);
+        CHECK(status, FAIL, "H5Dclose");
+    }
+
+    status = H5Pclose(dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Sclose(space);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    /* Read the datasets from several threads at once */
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fopen");
+
+    H5TS_attr_init(&attribute);
+#ifdef H5_HAVE_SYSTEM_SCOPE_THREADS
+    H5TS_attr_setscope(&attribute, H5TS_SCOPE_SYSTEM);
+#endif /* H5_HAVE_SYSTEM_SCOPE_THREADS */
+
+    for(i = 0; i < NUM_THREAD; i++) {
+        info[i].id = i;
+        info[i].file = file;
+        info[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_rdonly_reader, &attribute, &info[i]);
+    }
+
+    /* Keep using the library from this thread meanwhile */
+    for(i = 0; i < NUM_ITER; i++) {
+        nobjs = H5Fget_obj_count(file, H5F_OBJ_ALL);
+        CHECK(nobjs, FAIL, "H5Fget_obj_count");
+    }
+
+    for(i = 0; i < NUM_THREAD; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i < NUM_THREAD; i++)
+        if(info[i].nerrors)
+            TestErrPrintf("Thread %d read wrong data or failed - test failed\n", i);
+
+    /* Only the file should still be open */
+    nobjs = H5Fget_obj_count(file, H5F_OBJ_ALL);
+    VERIFY(nobjs, 1, "H5Fget_obj_count");
+
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+
+    H5TS_attr_destroy(&attribute);
+    HDfree(buf);
+} /* end tts_rdonly_read() */
+
+static void *
+tts_rdonly_reader(void *_info)
+{
+    rdonly_info_t *info = (rdonly_info_t *)_info;
+    hid_t   dset[2] = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t   mem_type[2] = {H5T_NATIVE_INT, H5T_NATIVE_INT};
+    hid_t   mem_space[2] = {H5S_ALL, H5S_ALL};
+    hid_t   file_space[2] = {H5S_ALL, H5S_ALL};
+    hid_t   dapl = H5I_INVALID_HID;
+    hid_t   slab_space = H5I_INVALID_HID;
+    hid_t   mem_slab_space = H5I_INVALID_HID;
+    hsize_t start[1] = {SLAB_START};
+    hsize_t count[1] = {SLAB_SIZE};
+    char    name[32];
+    int     *buf[2] = {NULL, NULL};
+    int     iter;
+
+    buf[0] = (int *)HDmalloc(DSET_SIZE * sizeof(int));
+    buf[1] = (int *)HDmalloc(DSET_SIZE * sizeof(int));
+    if(NULL == buf[0] || NULL == buf[1])
+        goto error;
+
+    /* Open the thread's datasets, with no chunk cache for half the
+     * threads, so that those read chunks straight into the buffer
+     */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        goto error;
+    if((info->id % 2) && H5Pset_chunk_cache(dapl, 0, 0, 0.0) < 0)
+        goto error;
+    HDsnprintf(name, sizeof(name), "contig%d", info->id);
+    if((dset[0] = H5Dopen2(info->file, name, H5P_DEFAULT)) < 0)
+        goto error;
+    HDsnprintf(name, sizeof(name), "chunked%d", info->id);
+    if((dset[1] = H5Dopen2(info->file, name, dapl)) < 0)
+        goto error;
+
+    /* Set up a hyperslab */
+    if((slab_space = H5Dget_space(dset[0])) < 0)
+        goto error;
+    if(H5Sselect_hyperslab(slab_space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        goto error;
+    if((mem_slab_space = H5Screate_simple(1, count, NULL)) < 0)
+        goto error;
+
+    for(iter = 0; iter < NUM_ITER; iter++) {
+        /* Whole datasets */
+        HDmemset(buf[0], 0, DSET_SIZE * sizeof(int));
+        if(H5Dread(dset[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf[0]) < 0)
+            goto error;
+        info->nerrors += rdonly_check(2 * info->id, buf[0], 0, DSET_SIZE);
+        HDmemset(buf[1], 0, DSET_SIZE * sizeof(int));
+        if(H5Dread(dset[1], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf[1]) < 0)
+            goto error;
+        info->nerrors += rdonly_check(2 * info->id + 1, buf[1], 0, DSET_SIZE);
+
+        /* Hyperslabs */
+        HDmemset(buf[0], 0, SLAB_SIZE * sizeof(int));
+        if(H5Dread(dset[0], H5T_NATIVE_INT, mem_slab_space, slab_space, H5P_DEFAULT, buf[0]) < 0)
+            goto error;
+        info->nerrors += rdonly_check(2 * info->id, buf[0], SLAB_START, SLAB_SIZE);
+        HDmemset(buf[1], 0, SLAB_SIZE * sizeof(int));
+        if(H5Dread(dset[1], H5T_NATIVE_INT, mem_slab_space, slab_space, H5P_DEFAULT, buf[1]) < 0)
+            goto error;
+        info->nerrors += rdonly_check(2 * info->id + 1, buf[1], SLAB_START, SLAB_SIZE);
+
+        /* Both datasets at once */
+        HDmemset(buf[0], 0, DSET_SIZE * sizeof(int));
+        HDmemset(buf[1], 0, DSET_SIZE * sizeof(int));
+        if(H5Dread_multi(2, dset, mem_type, mem_space, file_space, H5P_DEFAULT, (void **)buf) < 0)
+            goto error;
+        info->nerrors += rdonly_check(2 * info->id, buf[0], 0, DSET_SIZE);
+        info->nerrors += rdonly_check(2 * info->id + 1, buf[1], 0, DSET_SIZE);
+    }
+
+    if(H5Sclose(mem_slab_space) < 0)
+        goto error;
+    if(H5Sclose(slab_space) < 0)
+        goto error;
+    if(H5Dclose(dset[1]) < 0)
+        goto error;
+    if(H5Dclose(dset[0]) < 0)
+        goto error;
+    if(H5Pclose(dapl) < 0)
+        goto error;
+    HDfree(buf[1]);
+    HDfree(buf[0]);
+
+    return NULL;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mem_slab_space);
+        H5Sclose(slab_space);
+        H5Dclose(dset[1]);
+        H5Dclose(dset[0]);
+        H5Pclose(dapl);
+    } H5E_END_TRY;
+    HDfree(buf[1]);
+    HDfree(buf[0]);
+    info->nerrors++;
+
+    return NULL;
+} /* end tts_rdonly_reader() */
+
+void
+cleanup_rdonly(void)
+{
+    HDunlink(FILENAME);
+}
+#endif /*H5_HAVE_THREADSAFE*/
+
@@ -63,6 +63,9 @@ const char *FILENAME[] = {
     "splitter_rw_file",  /*11*/
     "splitter_wo_file",  /*12*/
     "splitter.log",      /*13*/
+    "vector_file",       /*14*/
+    "iouring_file",      /*15*/
+    "mmap_file",         /*16*/
     NULL
 };
 
@@ -72,6 +75,29 @@ const char *FILENAME[] = {
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
 #define SPLITTER_DATASET_NAME "dataset"
 
+#define VECTOR_NEXTENTS     64
+#define VECTOR_EXTENT_SIZE  48
+#define VECTOR_FILE_SIZE    (16*KB)
+#define VECTOR_DSET_NAME    "vector dset"
+#define VECTOR_DSET_DIM1    64
+#define VECTOR_DSET_DIM2    1024
+#define VECTOR_DSET_COLS    4
+
+/* Macros for io_uring VFD */
+#define IOURING_QUEUE_DEPTH 4
+#define IOURING_ALIGNMENT   (4*KB)
+#define IOURING_DSET_NAME   "iouring dset"
+#define IOURING_DSET_DIM    (64*KB)
+#define IOURING_CHUNK_DIM   (1*KB)
+
+/* Macros for mmap VFD */
+#define MMAP_CONTIG_NAME    "mmap contig"
+#define MMAP_CHUNKED_NAME   "mmap chunked"
+#define MMAP_DSET_DIM1      64
+#define MMAP_DSET_DIM2      256
+#define MMAP_CHUNK_DIM1     8
+#define MMAP_CHUNK_DIM2     32
+
 /* Macro: HEXPRINT()
  * Helper macro to pretty-print hexadecimal output of a buffer of known size.
  * Each line has the address of the first printed byte, and four columns of
@@ -157,6 +183,9 @@ test_sec2(void)
     if(!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))     TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))        TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))  TEST_ERROR
+#ifdef H5_HAVE_PREADWRITE
+    if(!(driver_flags & H5FD_FEAT_CONCURRENT_READ))         TEST_ERROR
+#endif /* H5_HAVE_PREADWRITE */
     /* Check for extra flags not accounted for above */
     if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
                         | H5FD_FEAT_ACCUMULATE_METADATA
@@ -164,7 +193,11 @@ test_sec2(void)
                         | H5FD_FEAT_AGGREGATE_SMALLDATA
                         | H5FD_FEAT_POSIX_COMPAT_HANDLE
                         | H5FD_FEAT_SUPPORTS_SWMR_IO
-                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE
+#ifdef H5_HAVE_PREADWRITE
+                        | H5FD_FEAT_CONCURRENT_READ
+#endif /* H5_HAVE_PREADWRITE */
+                        ))
         TEST_ERROR
 
     if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
@@ -3268,6 +3301,738 @@ error:
 #undef SPLITTER_TEST_FAULT
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Tests vector I/O through the driver set up in FAPL_ID,
+ *              both directly with H5FDwrite_vector/H5FDread_vector and
+ *              through strided hyperslab I/O on a contiguous dataset,
+ *              which hands its sequence lists to the driver as vectors.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(const char *name, hid_t fapl_id)
+{
+    H5FD_t      *lf = NULL;                 /* VFD struct ptr               */
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       dset_fapl_id = -1;          /* fapl for dataset tests       */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    hid_t       mspace_id = -1;             /* memory dataspace ID          */
+    hid_t       did = -1;                   /* dataset ID                   */
+    char        filename[1024];             /* filename                     */
+    char        testname[64];               /* test description             */
+    haddr_t     addrs[VECTOR_NEXTENTS];     /* extent addresses             */
+    size_t      sizes[VECTOR_NEXTENTS];     /* extent sizes                 */
+    const void  *wbufs[VECTOR_NEXTENTS];    /* extent write buffers         */
+    void        *rbufs[VECTOR_NEXTENTS];    /* extent read buffers          */
+    unsigned char *wbuf = NULL;             /* write data                   */
+    unsigned char *rbuf = NULL;             /* read data                    */
+    int         *data = NULL;               /* dataset data                 */
+    int         *cols = NULL;               /* dataset column block         */
+    hsize_t     dims[2] = {VECTOR_DSET_DIM1, VECTOR_DSET_DIM2};
+    hsize_t     start[2], count[2], stride[2], block[2];
+    haddr_t     addr;
+    size_t      u, v;
+
+    HDsnprintf(testname, sizeof(testname), "vector I/O with %s file driver", name);
+    TESTING(testname);
+
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (wbuf = (unsigned char *)HDmalloc(VECTOR_NEXTENTS * VECTOR_EXTENT_SIZE)))
+        TEST_ERROR
+    if(NULL == (rbuf = (unsigned char *)HDcalloc(VECTOR_NEXTENTS, VECTOR_EXTENT_SIZE)))
+        TEST_ERROR
+    for(u = 0; u < VECTOR_NEXTENTS * VECTOR_EXTENT_SIZE; u++)
+        wbuf[u] = (unsigned char)((u % 251) + 1);
+
+    /* Set up extents: runs of four adjacent extents, separated by gaps
+     * (so the driver has both runs to coalesce and separate runs), and
+     * with the buffers in a different order than in the file.
+     */
+    addr = 0;
+    for(u = 0; u < VECTOR_NEXTENTS; u++) {
+        if(u > 0 && (u % 4) == 0)
+            addr += 100;
+        addrs[u] = addr;
+        sizes[u] = VECTOR_EXTENT_SIZE;
+        wbufs[u] = wbuf + ((VECTOR_NEXTENTS - 1) - u) * VECTOR_EXTENT_SIZE;
+        rbufs[u] = rbuf + ((VECTOR_NEXTENTS - 1) - u) * VECTOR_EXTENT_SIZE;
+        addr += VECTOR_EXTENT_SIZE;
+    } /* end for */
+
+    if(NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if(H5FDset_eoa(lf, H5FD_MEM_DEFAULT, (haddr_t)VECTOR_FILE_SIZE) < 0)
+        TEST_ERROR
+
+    /* Write the extents, then read them back */
+    if(H5FDwrite_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (size_t)VECTOR_NEXTENTS, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+    if(H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (size_t)VECTOR_NEXTENTS, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wbuf, rbuf, VECTOR_NEXTENTS * VECTOR_EXTENT_SIZE) != 0)
+        FAIL_PUTS_ERROR("vector read didn't return data written")
+
+    /* Check the layout in the file with single reads */
+    for(u = 0; u < VECTOR_NEXTENTS; u++) {
+        if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[u], sizes[u], rbuf) < 0)
+            TEST_ERROR
+        if(HDmemcmp(wbufs[u], rbuf, VECTOR_EXTENT_SIZE) != 0)
+            FAIL_PUTS_ERROR("vector write put data in wrong place")
+    } /* end for */
+
+    /* Extents past the end of the file (but not the EOA) read as zeros,
+     * including a run which starts before the end of the file.
+     */
+    addrs[0] = addrs[VECTOR_NEXTENTS - 1];
+    addrs[1] = addrs[0] + VECTOR_EXTENT_SIZE;
+    addrs[2] = VECTOR_FILE_SIZE - 2 * VECTOR_EXTENT_SIZE;
+    HDmemset(rbuf, 0xff, 3 * VECTOR_EXTENT_SIZE);
+    rbufs[0] = rbuf;
+    rbufs[1] = rbuf + VECTOR_EXTENT_SIZE;
+    rbufs[2] = rbuf + 2 * VECTOR_EXTENT_SIZE;
+    if(H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (size_t)3, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wbufs[VECTOR_NEXTENTS - 1], rbuf, VECTOR_EXTENT_SIZE) != 0)
+        FAIL_PUTS_ERROR("vector read at end of file returned wrong data")
+    for(u = VECTOR_EXTENT_SIZE; u < 3 * VECTOR_EXTENT_SIZE; u++)
+        if(rbuf[u] != 0)
+            FAIL_PUTS_ERROR("vector read past end of file didn't return zeros")
+
+    /* Extents past the EOA are rejected */
+    addrs[0] = VECTOR_FILE_SIZE - 1;
+    H5E_BEGIN_TRY {
+        if(H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (size_t)1, addrs, sizes, rbufs) >= 0)
+            FAIL_PUTS_ERROR("vector read past EOA succeeded")
+    } H5E_END_TRY;
+
+    if(H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    /* Strided hyperslab I/O on a dataset, with a sieve buffer too small to
+     * cover two rows so the sequences go to the driver as vectors.
+     */
+    if((dset_fapl_id = H5Pcopy(fapl_id)) < 0)
+        TEST_ERROR
+    if(H5Pset_sieve_buf_size(dset_fapl_id, (size_t)KB) < 0)
+        TEST_ERROR
+    if(NULL == (data = (int *)HDmalloc(VECTOR_DSET_DIM1 * VECTOR_DSET_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (cols = (int *)HDmalloc(VECTOR_DSET_DIM1 * VECTOR_DSET_COLS * 2 * sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < VECTOR_DSET_DIM1 * VECTOR_DSET_DIM2; u++)
+        data[u] = (int)u;
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, dset_fapl_id)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, VECTOR_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+
+    /* Select a block of columns in the file, and every other element of
+     * a buffer in memory, so that each row is split into several extents.
+     */
+    start[0] = 0;
+    start[1] = VECTOR_DSET_DIM2 / 2;
+    count[0] = VECTOR_DSET_DIM1;
+    count[1] = 1;
+    block[0] = 1;
+    block[1] = VECTOR_DSET_COLS;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+        TEST_ERROR
+    dims[0] = VECTOR_DSET_DIM1 * VECTOR_DSET_COLS * 2;
+    if((mspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    start[0] = 0;
+    stride[0] = 2;
+    count[0] = VECTOR_DSET_DIM1 * VECTOR_DSET_COLS;
+    block[0] = 1;
+    if(H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, stride, count, block) < 0)
+        TEST_ERROR
+
+    /* Read the columns */
+    HDmemset(cols, 0, VECTOR_DSET_DIM1 * VECTOR_DSET_COLS * 2 * sizeof(int));
+    if(H5Dread(did, H5T_NATIVE_INT, mspace_id, sid, H5P_DEFAULT, cols) < 0)
+        TEST_ERROR
+    for(u = 0; u < VECTOR_DSET_DIM1; u++)
+        for(v = 0; v < VECTOR_DSET_COLS; v++) {
+            if(cols[2 * (u * VECTOR_DSET_COLS + v)] != data[u * VECTOR_DSET_DIM2 + (VECTOR_DSET_DIM2 / 2) + v])
+                FAIL_PUTS_ERROR("strided read returned wrong data")
+            if(cols[2 * (u * VECTOR_DSET_COLS + v) + 1] != 0)
+                FAIL_PUTS_ERROR("strided read overwrote unselected memory")
+        } /* end for */
+
+    /* Overwrite the columns, then check the whole dataset */
+    for(u = 0; u < VECTOR_DSET_DIM1 * VECTOR_DSET_COLS * 2; u++)
+        cols[u] = -(int)u;
+    if(H5Dwrite(did, H5T_NATIVE_INT, mspace_id, sid, H5P_DEFAULT, cols) < 0)
+        TEST_ERROR
+    for(u = 0; u < VECTOR_DSET_DIM1; u++)
+        for(v = 0; v < VECTOR_DSET_COLS; v++)
+            data[u * VECTOR_DSET_DIM2 + (VECTOR_DSET_DIM2 / 2) + v] = cols[2 * (u * VECTOR_DSET_COLS + v)];
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    did = -1;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, dset_fapl_id)) < 0)
+        TEST_ERROR
+    if((did = H5Dopen2(fid, VECTOR_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(NULL == (rbuf = (unsigned char *)HDrealloc(rbuf, VECTOR_DSET_DIM1 * VECTOR_DSET_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(HDmemcmp(data, rbuf, VECTOR_DSET_DIM1 * VECTOR_DSET_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("strided write put data in wrong place")
+
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Sclose(mspace_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    if(H5Pclose(dset_fapl_id) < 0)
+        TEST_ERROR
+
+    h5_delete_test_file(FILENAME[14], fapl_id);
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(data);
+    HDfree(cols);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(mspace_id);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(dset_fapl_id);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(data);
+    HDfree(cols);
+    return -1;
+} /* end test_vector_io_driver() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O with drivers that implement the vector
+ *              callbacks (sec2, core) and one that relies on the library
+ *              issuing the extents one at a time (stdio).
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    int         nerrors = 0;                /* number of failed drivers     */
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+
+    if(H5Pset_fapl_sec2(fapl_id) < 0)
+        goto error;
+    nerrors += test_vector_io_driver("SEC2", fapl_id) < 0 ? 1 : 0;
+
+    if(H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        goto error;
+    nerrors += test_vector_io_driver("CORE", fapl_id) < 0 ? 1 : 0;
+
+    if(H5Pset_fapl_stdio(fapl_id) < 0)
+        goto error;
+    nerrors += test_vector_io_driver("STDIO", fapl_id) < 0 ? 1 : 0;
+
+    if(H5Pclose(fapl_id) < 0)
+        goto error;
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_vector_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring_dset
+ *
+ * Purpose:     Private function for test_iouring() which writes a chunked
+ *              dataset through FAPL_ID and checks that it reads back.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_IOURING
+static herr_t
+test_iouring_dset(const char *filename, hid_t fapl_id)
+{
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    hid_t       dcpl_id = -1;               /* dataset creation plist ID    */
+    hid_t       did = -1;                   /* dataset ID                   */
+    hid_t       access_fapl_id = -1;        /* file's access plist ID       */
+    hsize_t     dims[1] = {IOURING_DSET_DIM};
+    hsize_t     chunk_dims[1] = {IOURING_CHUNK_DIM};
+    hsize_t     file_size;                  /* size of the file             */
+    int         *fhandle = NULL;            /* pointer to file descriptor   */
+    int         *wbuf = NULL;               /* data written                 */
+    int         *rbuf = NULL;               /* data read                    */
+    size_t      u;
+
+    if(NULL == (wbuf = (int *)HDmalloc(IOURING_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(IOURING_DSET_DIM, sizeof(int))))
+        TEST_ERROR
+    for(u = 0; u < IOURING_DSET_DIM; u++)
+        wbuf[u] = (int)(u * 7);
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+
+    /* Check that the driver is correct */
+    if((access_fapl_id = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if(H5FD_IOURING != H5Pget_driver(access_fapl_id))
+        TEST_ERROR
+    if(H5Pclose(access_fapl_id) < 0)
+        TEST_ERROR
+
+    /* Check file handle API */
+    if(H5Fget_vfd_handle(fid, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR
+    if(*fhandle < 0)
+        TEST_ERROR
+
+    /* Write a dataset of many chunks */
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, IOURING_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    did = -1;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    /* Read it back */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if(H5Fget_filesize(fid, &file_size) < 0)
+        TEST_ERROR
+    if(file_size < IOURING_DSET_DIM * sizeof(int))
+        TEST_ERROR
+    if((did = H5Dopen2(fid, IOURING_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(HDmemcmp(wbuf, rbuf, IOURING_DSET_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("dataset read returned wrong data")
+
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl_id);
+        H5Pclose(access_fapl_id);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+} /* end test_iouring_dset() */
+#endif /* H5_HAVE_IOURING */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the io_uring file driver, with buffered I/O and (if
+ *              the file system supports it) with O_DIRECT I/O.  The queue
+ *              depth is kept small so that vector requests reuse their
+ *              request slots.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       fid = -1;                   /* file ID                      */
+    char        filename[1024];             /* filename                     */
+    unsigned    queue_depth;                /* queue depth from fapl        */
+    size_t      alignment;                  /* alignment from fapl          */
+    herr_t      ret;                        /* generic return value         */
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("IOURING file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING */
+
+    /* Verify the file access properties */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_iouring(fapl_id, 0, 0) < 0)
+        TEST_ERROR
+    if(H5Pget_fapl_iouring(fapl_id, &queue_depth, &alignment) < 0)
+        TEST_ERROR
+    if(queue_depth != H5FD_IOURING_QUEUE_DEPTH_DEF || alignment != 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, (size_t)3);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("alignment which isn't a power of two was accepted")
+    if(H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, 0) < 0)
+        TEST_ERROR
+    if(H5Pget_fapl_iouring(fapl_id, &queue_depth, &alignment) < 0)
+        TEST_ERROR
+    if(queue_depth != IOURING_QUEUE_DEPTH || alignment != 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[15], fapl_id, filename, sizeof(filename));
+
+    /* The kernel may not allow io_uring (e.g. in some containers) */
+    H5E_BEGIN_TRY {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    } H5E_END_TRY;
+    if(fid < 0) {
+        H5Pclose(fapl_id);
+        SKIPPED();
+        HDprintf("  Probably the kernel doesn't allow io_uring\n");
+        return 0;
+    } /* end if */
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    if(test_iouring_dset(filename, fapl_id) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[15], fapl_id);
+    PASSED();
+
+    if(test_vector_io_driver("IOURING", fapl_id) < 0)
+        goto error;
+
+    /* O_DIRECT I/O, with unaligned requests staged through bounce buffers */
+    TESTING("IOURING file driver with O_DIRECT");
+    if(H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, (size_t)IOURING_ALIGNMENT) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    } H5E_END_TRY;
+    if(fid < 0) {
+        H5Pclose(fapl_id);
+        SKIPPED();
+        HDprintf("  Probably the file system doesn't support Direct I/O\n");
+        return 0;
+    } /* end if */
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    if(test_iouring_dset(filename, fapl_id) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[15], fapl_id);
+    PASSED();
+
+    if(test_vector_io_driver("IOURING (O_DIRECT)", fapl_id) < 0)
+        goto error;
+
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    return -1;
+#endif /* H5_HAVE_IOURING */
+} /* end test_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only memory-mapped file driver: a file
+ *              written with the default driver is opened through the map,
+ *              and its contiguous and chunked datasets are read back with
+ *              and without type conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_SYS_MMAN_H
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    hid_t       access_fapl_id = -1;        /* file's access plist ID       */
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    hid_t       mem_sid = -1;               /* memory dataspace ID          */
+    hid_t       dcpl_id = -1;               /* dataset creation plist ID    */
+    hid_t       did = -1;                   /* dataset ID                   */
+    char        filename[1024];             /* filename                     */
+    hsize_t     dims[2] = {MMAP_DSET_DIM1, MMAP_DSET_DIM2};
+    hsize_t     chunk_dims[2] = {MMAP_CHUNK_DIM1, MMAP_CHUNK_DIM2};
+    hsize_t     start[2] = {3, 5};          /* hyperslab start              */
+    hsize_t     count[2] = {40, 200};       /* hyperslab count              */
+    hsize_t     chunk_offset[2] = {MMAP_CHUNK_DIM1, 2 * MMAP_CHUNK_DIM2};
+    hsize_t     chunk_size;                 /* size of a mapped chunk       */
+    hsize_t     file_size;                  /* size of the file             */
+    const void  *chunk_ptr;                 /* pointer to a mapped chunk    */
+    void        **map_ptr = NULL;           /* pointer to the file's map    */
+    int         *wbuf = NULL;               /* data written                 */
+    int         *rbuf = NULL;               /* data read                    */
+    long long   *lbuf = NULL;               /* data read, converted         */
+    const char  *names[2] = {MMAP_CONTIG_NAME, MMAP_CHUNKED_NAME};
+    unsigned    u;
+    size_t      i, j;
+    herr_t      ret;                        /* generic return value         */
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+    TESTING("MMAP file driver");
+
+#ifndef H5_HAVE_SYS_MMAN_H
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_SYS_MMAN_H */
+
+    if(NULL == (wbuf = (int *)HDmalloc(MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (lbuf = (long long *)HDmalloc(MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(long long))))
+        TEST_ERROR
+    for(i = 0; i < MMAP_DSET_DIM1 * MMAP_DSET_DIM2; i++)
+        wbuf[i] = (int)(i * 3) - 1000;
+
+    /* Write the file with the default driver */
+    h5_fixname(FILENAME[16], H5P_DEFAULT, filename, sizeof(filename));
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, MMAP_CONTIG_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+    if((did = H5Dcreate2(fid, MMAP_CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(did) < 0)
+        TEST_ERROR
+    did = -1;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    /* The driver only opens existing files read-only */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5Pset_fapl_mmap(fapl_id) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id);
+    } H5E_END_TRY;
+    if(fid >= 0)
+        FAIL_PUTS_ERROR("file was opened read-write")
+    H5E_BEGIN_TRY {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    } H5E_END_TRY;
+    if(fid >= 0)
+        FAIL_PUTS_ERROR("file was created")
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+
+    /* Check that the driver is correct */
+    if((access_fapl_id = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if(H5FD_MMAP != H5Pget_driver(access_fapl_id))
+        TEST_ERROR
+    if(H5Pclose(access_fapl_id) < 0)
+        TEST_ERROR
+    access_fapl_id = -1;
+
+    /* The file handle is the map, which starts with the file signature */
+    if(H5Fget_vfd_handle(fid, H5P_DEFAULT, (void **)&map_ptr) < 0)
+        TEST_ERROR
+    if(NULL == map_ptr || NULL == *map_ptr)
+        TEST_ERROR
+    if(HDmemcmp(*map_ptr, "\211HDF\r\n\032\n", (size_t)8) != 0)
+        FAIL_PUTS_ERROR("map doesn't start with the file signature")
+    if(H5Fget_filesize(fid, &file_size) < 0)
+        TEST_ERROR
+    if(file_size < 2 * MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(int))
+        TEST_ERROR
+
+    /* Read back both datasets */
+    if((mem_sid = H5Scopy(sid)) < 0)
+        TEST_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if(H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    for(u = 0; u < 2; u++) {
+        if((did = H5Dopen2(fid, names[u], H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+        /* Whole dataset, without conversion */
+        HDmemset(rbuf, 0, MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        if(HDmemcmp(wbuf, rbuf, MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("dataset read returned wrong data")
+
+        /* Hyperslab, converted to a larger type */
+        HDmemset(lbuf, 0, MMAP_DSET_DIM1 * MMAP_DSET_DIM2 * sizeof(long long));
+        if(H5Dread(did, H5T_NATIVE_LLONG, mem_sid, sid, H5P_DEFAULT, lbuf) < 0)
+            TEST_ERROR
+        for(i = 0; i < MMAP_DSET_DIM1; i++)
+            for(j = 0; j < MMAP_DSET_DIM2; j++) {
+                size_t  idx = i * MMAP_DSET_DIM2 + j;
+                hbool_t selected = (i >= start[0] && i < start[0] + count[0]
+                        && j >= start[1] && j < start[1] + count[1]);
+
+                if(lbuf[idx] != (selected ? (long long)wbuf[idx] : 0))
+                    FAIL_PUTS_ERROR("hyperslab read returned wrong data")
+            } /* end for */
+
+        /* Chunks can be mapped straight out of the driver's map */
+        if(u == 1) {
+            if(H5Dmap_chunks(did, (size_t)1, chunk_offset, NULL, &chunk_size, &chunk_ptr) < 0)
+                TEST_ERROR
+            if(chunk_size != MMAP_CHUNK_DIM1 * MMAP_CHUNK_DIM2 * sizeof(int))
+                TEST_ERROR
+            for(i = 0; i < MMAP_CHUNK_DIM1; i++)
+                if(HDmemcmp((const int *)chunk_ptr + i * MMAP_CHUNK_DIM2,
+                        &wbuf[(chunk_offset[0] + i) * MMAP_DSET_DIM2 + chunk_offset[1]],
+                        MMAP_CHUNK_DIM2 * sizeof(int)) != 0)
+                    FAIL_PUTS_ERROR("mapped chunk has wrong data")
+        } /* end if */
+
+        if(H5Dclose(did) < 0)
+            TEST_ERROR
+        did = -1;
+    } /* end for */
+
+    /* The file can't be written */
+    H5E_BEGIN_TRY {
+        ret = H5Gclose(H5Gcreate2(fid, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("object was created in a read-only file")
+
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR
+    fid = -1;
+
+    h5_delete_test_file(FILENAME[16], fapl_id);
+
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(mem_sid) < 0)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Pclose(dcpl_id);
+        H5Pclose(access_fapl_id);
+        H5Pclose(fapl_id);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+    return -1;
+#endif /* H5_HAVE_SYS_MMAN_H */
+} /* end test_mmap() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -3300,6 +4065,9 @@ main(void)
     nerrors += test_windows() < 0        ? 1 : 0;
     nerrors += test_ros3() < 0           ? 1 : 0;
     nerrors += test_splitter() < 0       ? 1 : 0;
+    nerrors += test_vector_io() < 0      ? 1 : 0;
+    nerrors += test_iouring() < 0        ? 1 : 0;
+    nerrors += test_mmap() < 0           ? 1 : 0;
 
     if(nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
@@ -1135,7 +1135,7 @@ open_hdf5_file(const hbool_t create_file,
         /* set the desired parallel metadata write strategy */
         H5AC_cache_config_t mdc_config;
 
-        mdc_config.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         if ( H5Pget_mdc_config(fapl_id, &mdc_config) < 0 ) {
 
@@ -694,12 +694,12 @@ open_file(const char *filename, hid_t fapl, int metadata_write_strategy,
     /* flush invalidate each ring, starting from the outermost ring and
      * working inward.
      */
-    for ( i = 0; i < H5C__HASH_TABLE_LEN; i++ ) {
-        H5C_cache_entry_t * entry_ptr = NULL;
-
-        entry_ptr = cache_ptr->index[i];
+    {
+        H5C_cache_entry_t * entry_ptr = cache_ptr->il_head;
 
         while ( entry_ptr != NULL ) {
+            H5C_cache_entry_t * next_ptr = entry_ptr->il_next;
+
             HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
             HDassert(entry_ptr->is_dirty == FALSE);
 
@@ -708,7 +708,7 @@ open_file(const char *filename, hid_t fapl, int metadata_write_strategy,
                 VRFY((ret == 0), "");
             }
 
-            entry_ptr = entry_ptr->ht_next;
+            entry_ptr = next_ptr;
         }
     }
     MPI_Barrier(MPI_COMM_WORLD);
@@ -157,6 +157,18 @@ h5tools_can_encode(H5Z_filter_t filtn)
 #endif
             break;
 
+    case H5Z_FILTER_LZ4:
+#ifndef H5_HAVE_FILTER_LZ4
+        H5TOOLS_GOTO_DONE(0);
+#endif
+            break;
+
+    case H5Z_FILTER_ZSTD:
+#ifndef H5_HAVE_FILTER_ZSTD
+        H5TOOLS_GOTO_DONE(0);
+#endif
+            break;
+
     case H5Z_FILTER_SZIP:
 #ifndef H5_HAVE_FILTER_SZIP
         H5TOOLS_GOTO_DONE(0);
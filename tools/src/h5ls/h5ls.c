@@ -118,6 +118,14 @@ typedef struct {
     size_t name_start;                  /* # of leading characters to strip off path names on output */
 }iter_t;
 
+/* Struct to pass through to chunk_addr_cb() */
+typedef struct {
+    h5tools_str_t *buffer;              /* String into which to render */
+    h5tools_context_t *ctx;             /* Print context */
+    hsize_t *curr_pos;                  /* Total data element position */
+    int ndims;                          /* Rank of the dataset */
+} chunk_iter_t;
+
 /* Command-line switches */
 static int      verbose_g = 0;            /* lots of extra output */
 static int      width_g = 80;             /* output width in characters */
@@ -2034,6 +2042,34 @@ dataset_list1(hid_t dset)
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    chunk_addr_cb
+ *
+ * Purpose:     H5Dchunk_iter callback that prints the filter mask, size,
+ *              address and logical offset of one chunk.
+ *
+ * Return:      Success: 0
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_addr_cb(const hsize_t *offset, unsigned filter_mask, haddr_t addr, hsize_t size, void *op_data)
+{
+    chunk_iter_t       *chunk_iter = (chunk_iter_t *)op_data;
+    h5tool_format_t    *info = &ls_dataformat;
+    int                 i;
+
+    h5tools_str_reset(chunk_iter->buffer);
+    h5tools_str_append(chunk_iter->buffer, "        0x%08x %10"H5_PRINTF_LL_WIDTH"u %10"H5_PRINTF_LL_WIDTH"u [",
+            filter_mask, size, (hsize_t)addr);
+    for (i = 0; i < chunk_iter->ndims; i++)
+        h5tools_str_append(chunk_iter->buffer, "%s"HSIZE_T_FORMAT, i?", ":"", offset[i]);
+    h5tools_str_append(chunk_iter->buffer, "]\n");
+    h5tools_render_element(rawoutstream, info, chunk_iter->ctx, chunk_iter->buffer, chunk_iter->curr_pos, (size_t)info->line_ncols, (hsize_t)0, (hsize_t)0);
+
+    return 0;
+} /* end chunk_addr_cb() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    dataset_list2
  *
@@ -2233,9 +2269,31 @@ dataset_list2(hid_t dset, const char H5_ATTR_UNUSED *name)
         h5tools_str_append(&buffer, "\n");
         h5tools_render_element(rawoutstream, info, &ctx, &buffer, &curr_pos, (size_t)info->line_ncols, (hsize_t)0, (hsize_t)0);
 
-        /* Print address information */
-        if (address_g)
-            H5Ddebug(dset);
+        /* Print address information.  The chunks of a chunked dataset are
+         * listed with a single pass over its chunk index. */
+        if (address_g) {
+            if (H5D_CHUNKED == stl) {
+                chunk_iter_t chunk_iter;
+
+                h5tools_str_reset(&buffer);
+                h5tools_str_append(&buffer, "    Address:\n");
+                h5tools_str_append(&buffer, "           Flags      Bytes    Address Logical Offset\n");
+                h5tools_str_append(&buffer, "        ========== ========== ========== ==============================\n");
+                h5tools_render_element(rawoutstream, info, &ctx, &buffer, &curr_pos, (size_t)info->line_ncols, (hsize_t)0, (hsize_t)0);
+
+                chunk_iter.buffer = &buffer;
+                chunk_iter.ctx = &ctx;
+                chunk_iter.curr_pos = &curr_pos;
+                chunk_iter.ndims = H5Sget_simple_extent_ndims(space);
+                if (H5Dchunk_iter(dset, H5P_DEFAULT, chunk_addr_cb, &chunk_iter) < 0) {
+                    h5tools_str_reset(&buffer);
+                    h5tools_str_append(&buffer, "        ***ERROR*** unable to list chunk addresses\n");
+                    h5tools_render_element(rawoutstream, info, &ctx, &buffer, &curr_pos, (size_t)info->line_ncols, (hsize_t)0, (hsize_t)0);
+                }
+            }
+            else
+                H5Ddebug(dset);
+        }
 
         /* Close stuff */
         H5Tclose(type);
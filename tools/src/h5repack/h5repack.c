@@ -650,6 +650,8 @@ check_options(pack_opt_t *options)
                     break;
                 case H5Z_FILTER_SZIP:
                 case H5Z_FILTER_DEFLATE:
+                case H5Z_FILTER_LZ4:
+                case H5Z_FILTER_ZSTD:
                     HDprintf(" All with %s, parameter %d\n", get_sfilter(filtn), options->filter_g[k].cd_values[0]);
                     break;
                 default:
@@ -669,7 +671,8 @@ check_options(pack_opt_t *options)
         for (j = 0; j < pack.nfilters; j++) {
             if (options->verbose) {
                 if (pack.filter[j].filtn >= 0) {
-                    if (pack.filter[j].filtn > H5Z_FILTER_SCALEOFFSET) {
+                    if (pack.filter[j].filtn > H5Z_FILTER_SCALEOFFSET
+                            && pack.filter[j].filtn != H5Z_FILTER_LZ4 && pack.filter[j].filtn != H5Z_FILTER_ZSTD) {
                         HDprintf(" <%s> with %s filter %d\n", name, get_sfilter(pack.filter[j].filtn), pack.filter[j].filtn);
                     }
                     else {
@@ -898,6 +901,10 @@ get_sfilter(H5Z_filter_t filtn)
         return "NBIT";
     else if (filtn == H5Z_FILTER_SCALEOFFSET)
         return "SOFF";
+    else if (filtn == H5Z_FILTER_LZ4)
+        return "LZ4";
+    else if (filtn == H5Z_FILTER_ZSTD)
+        return "ZSTD";
     else
         return "UD";
 } /* end get_sfilter() */
@@ -55,6 +55,8 @@ typedef struct {
  H5Z_FILTER_SZIP        4 , szip compression
  H5Z_FILTER_NBIT        5 , nbit compression
  H5Z_FILTER_SCALEOFFSET 6 , scaleoffset compression
+ H5Z_FILTER_LZ4         32004 , lz4 compression
+ H5Z_FILTER_ZSTD        32015 , zstd compression
 */
 
 #define CD_VALUES 20
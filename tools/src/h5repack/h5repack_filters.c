@@ -316,6 +316,8 @@ int apply_filters(const char* name, /* object name from traverse list */
      * H5Z_FILTER_SZIP        4 , szip compression
      * H5Z_FILTER_NBIT        5 , nbit compression
      * H5Z_FILTER_SCALEOFFSET 6 , scaleoffset compression
+     * H5Z_FILTER_LZ4         32004 , lz4 compression
+     * H5Z_FILTER_ZSTD        32015 , zstd compression
      *-------------------------------------------------------------------------
      */
 
@@ -451,6 +453,26 @@ int apply_filters(const char* name, /* object name from traverse list */
                         H5TOOLS_GOTO_ERROR((-1), "H5Pset_scaleoffset failed");
                 }
                 break;
+            /*-------------------------------------------------------------------------
+             * H5Z_FILTER_LZ4 , lz4 compression
+             *-------------------------------------------------------------------------
+             */
+            case H5Z_FILTER_LZ4:
+                if (H5Pset_chunk(dcpl_id, obj.chunk.rank, obj.chunk.chunk_lengths) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Pset_chunk failed");
+                if (H5Pset_lz4(dcpl_id, obj.filter[i].cd_values[0], NULL, 0) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Pset_lz4 failed");
+                break;
+            /*-------------------------------------------------------------------------
+             * H5Z_FILTER_ZSTD , zstd compression
+             *-------------------------------------------------------------------------
+             */
+            case H5Z_FILTER_ZSTD:
+                if (H5Pset_chunk(dcpl_id, obj.chunk.rank, obj.chunk.chunk_lengths) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Pset_chunk failed");
+                if (H5Pset_zstd(dcpl_id, (int)obj.filter[i].cd_values[0], NULL, 0) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Pset_zstd failed");
+                break;
             default:
                 {
                     if (H5Pset_chunk(dcpl_id, obj.chunk.rank, obj.chunk.chunk_lengths) < 0)
@@ -203,10 +203,14 @@ static void usage(const char *prog) {
     PRINTVALSTREAM(rawoutstream, "        FLET, to apply the HDF5 checksum filter\n");
     PRINTVALSTREAM(rawoutstream, "        NBIT, to apply the HDF5 NBIT filter (NBIT compression)\n");
     PRINTVALSTREAM(rawoutstream, "        SOFF, to apply the HDF5 Scale/Offset filter\n");
+    PRINTVALSTREAM(rawoutstream, "        LZ4,  to apply the HDF5 LZ4 filter (LZ4 compression)\n");
+    PRINTVALSTREAM(rawoutstream, "        ZSTD, to apply the HDF5 ZSTD filter (Zstandard compression)\n");
     PRINTVALSTREAM(rawoutstream, "        UD,   to apply a user defined filter\n");
     PRINTVALSTREAM(rawoutstream, "        NONE, to remove all filters\n");
     PRINTVALSTREAM(rawoutstream, "      <filter parameters> is optional filter parameter information\n");
     PRINTVALSTREAM(rawoutstream, "        GZIP=<deflation level> from 1-9\n");
+    PRINTVALSTREAM(rawoutstream, "        LZ4=<level> 0 for fast compression or 1-12 for high compression\n");
+    PRINTVALSTREAM(rawoutstream, "        ZSTD=<level> from 1-22, or 0 for the default level\n");
     PRINTVALSTREAM(rawoutstream, "        SZIP=<pixels per block,coding> pixels per block is a even number in\n");
     PRINTVALSTREAM(rawoutstream, "            2-32 and coding method is either EC or NN\n");
     PRINTVALSTREAM(rawoutstream, "        SHUF (no parameter)\n");
@@ -29,6 +29,8 @@
  *  FLET, to apply the HDF5 checksum filter
  *  NBIT, to apply the HDF5 NBIT filter (NBIT compression)
  *  SOFF, to apply the HDF5 scale+offset filter (compression)
+ *  LZ4, to apply the HDF5 LZ4 filter (LZ4 compression)
+ *  ZSTD, to apply the HDF5 ZSTD filter (Zstandard compression)
  *  UD, to apply a User Defined filter k,m,n1[,…,nm]
  *  NONE, to remove the filter
  *
@@ -318,6 +320,36 @@ obj_list_t* parse_filter(const char *str, unsigned *n_objs, filter_info_t *filt,
                 }
             }
 
+            /*-------------------------------------------------------------------------
+            * H5Z_FILTER_LZ4
+            *-------------------------------------------------------------------------
+            */
+            else if (HDstrcmp(scomp, "LZ4") == 0) {
+                filt->filtn = H5Z_FILTER_LZ4;
+                filt->cd_nelmts = 1;
+                if (no_param) { /*no more parameters, LZ4 must have parameter */
+                    if (obj_list)
+                        HDfree(obj_list);
+                    error_msg("missing compression parameter in <%s>\n", str);
+                    HDexit(EXIT_FAILURE);
+                }
+            }
+
+            /*-------------------------------------------------------------------------
+            * H5Z_FILTER_ZSTD
+            *-------------------------------------------------------------------------
+            */
+            else if (HDstrcmp(scomp, "ZSTD") == 0) {
+                filt->filtn = H5Z_FILTER_ZSTD;
+                filt->cd_nelmts = 1;
+                if (no_param) { /*no more parameters, ZSTD must have parameter */
+                    if (obj_list)
+                        HDfree(obj_list);
+                    error_msg("missing compression parameter in <%s>\n", str);
+                    HDexit(EXIT_FAILURE);
+                }
+            }
+
             /*-------------------------------------------------------------------------
             * H5Z_FILTER_SZIP
             *-------------------------------------------------------------------------
@@ -431,6 +463,30 @@ obj_list_t* parse_filter(const char *str, unsigned *n_objs, filter_info_t *filt,
         }
         break;
         /*-------------------------------------------------------------------------
+        * H5Z_FILTER_LZ4
+        *-------------------------------------------------------------------------
+        */
+    case H5Z_FILTER_LZ4:
+        if (filt->cd_values[0] > H5Z_LZ4_MAX_LEVEL) {
+            if (obj_list)
+                HDfree(obj_list);
+            error_msg("invalid compression parameter in <%s>\n", str);
+            HDexit(EXIT_FAILURE);
+        }
+        break;
+        /*-------------------------------------------------------------------------
+        * H5Z_FILTER_ZSTD
+        *-------------------------------------------------------------------------
+        */
+    case H5Z_FILTER_ZSTD:
+        if (filt->cd_values[0] > H5Z_ZSTD_MAX_LEVEL) {
+            if (obj_list)
+                HDfree(obj_list);
+            error_msg("invalid compression parameter in <%s>\n", str);
+            HDexit(EXIT_FAILURE);
+        }
+        break;
+        /*-------------------------------------------------------------------------
         * H5Z_FILTER_SZIP
         *-------------------------------------------------------------------------
         */
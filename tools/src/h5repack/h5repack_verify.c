@@ -576,6 +576,17 @@ int verify_filters(hid_t pid, hid_t tid, int nfilters, filter_info_t *filter)
                         return 0;
                 break;
 
+            /* only the level checked; h5repack sets the other values */
+            case H5Z_FILTER_LZ4:
+                if (cd_nelmts < 2 || cd_values[1] != filter[i].cd_values[0])
+                    return 0;
+                break;
+
+            case H5Z_FILTER_ZSTD:
+                if (cd_nelmts < 1 || cd_values[0] != filter[i].cd_values[0])
+                    return 0;
+                break;
+
             /* for these filters values must match, no local values set in DCPL */
             case H5Z_FILTER_FLETCHER32:
             case H5Z_FILTER_DEFLATE:
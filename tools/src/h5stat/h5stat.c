@@ -114,9 +114,16 @@ typedef struct iter_t {
     hsize_t datasets_index_storage_size;/* meta size for chunked dataset's indexing type */
     hsize_t datasets_heap_storage_size; /* heap size for dataset with external storage */
     unsigned long nexternal;            /* Number of external files for a dataset */
+    hsize_t dset_nchunks;               /* Number of allocated chunks in chunked datasets */
     int           local;                /* Flag to indicate iteration over the object*/
 } iter_t;
 
+/* Statistics gathered by chunk_stats_cb() for one dataset */
+typedef struct chunk_stats_t {
+    hsize_t nchunks;                    /* Number of allocated chunks */
+    hsize_t storage;                    /* Total size of the allocated chunks */
+} chunk_stats_t;
+
 
 static const char *drivername = NULL;
 
@@ -494,6 +501,28 @@ done:
 } /* end group_stats() */
 
 
+/*-------------------------------------------------------------------------
+ * Function: chunk_stats_cb
+ *
+ * Purpose: H5Dchunk_iter callback that counts the allocated chunks of a
+ *          dataset and adds up their sizes
+ *
+ * Return:  Success: 0
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_stats_cb(const hsize_t H5_ATTR_UNUSED *offset, unsigned H5_ATTR_UNUSED filter_mask,
+    haddr_t H5_ATTR_UNUSED addr, hsize_t size, void *op_data)
+{
+    chunk_stats_t *stats = (chunk_stats_t *)op_data;
+
+    stats->nchunks++;
+    stats->storage += size;
+
+    return 0;
+} /* end chunk_stats_cb() */
+
+
 /*-------------------------------------------------------------------------
  * Function: dataset_stats
  *
@@ -545,10 +574,6 @@ dataset_stats(iter_t *iter, const char *name, const H5O_info2_t *oi, const H5O_n
     if((ret_value = attribute_stats(iter, oi, native_oi)) < 0)
         H5TOOLS_GOTO_ERROR(FAIL, "attribute_stats() failed");
 
-    /* Get storage info */
-    /* Failure 0 indistinguishable from no-data-stored 0 */
-    storage = H5Dget_storage_size(did);
-
     /* Gather layout statistics */
     if((dcpl = H5Dget_create_plist(did)) < 0)
         H5TOOLS_GOTO_ERROR(FAIL, "H5Dget_create_plist() failed");
@@ -556,6 +581,22 @@ dataset_stats(iter_t *iter, const char *name, const H5O_info2_t *oi, const H5O_n
     if((lout = H5Pget_layout(dcpl)) < 0)
         H5TOOLS_GOTO_ERROR(FAIL, "H5Pget_layout() failed");
 
+    /* Get storage info */
+    if(lout == H5D_CHUNKED) {
+        chunk_stats_t chunk_stats;  /* Statistics for the dataset's chunks */
+
+        /* Visit all the allocated chunks in one pass over the chunk index */
+        HDmemset(&chunk_stats, 0, sizeof(chunk_stats));
+        if(H5Dchunk_iter(did, H5P_DEFAULT, chunk_stats_cb, &chunk_stats) < 0)
+            H5TOOLS_GOTO_ERROR(FAIL, "H5Dchunk_iter() failed");
+
+        iter->dset_nchunks += chunk_stats.nchunks;
+        storage = chunk_stats.storage;
+    } /* end if */
+    else
+        /* Failure 0 indistinguishable from no-data-stored 0 */
+        storage = H5Dget_storage_size(did);
+
     /* Object header's total size for H5D_COMPACT layout includes raw data size */
     /* "storage" also includes H5D_COMPACT raw data size */
     if(lout == H5D_COMPACT)
@@ -1425,6 +1466,7 @@ print_dataset_info(const iter_t *iter)
             HDprintf("\tDataset layout counts[%s]: %lu\n", (u == H5D_COMPACT ? "COMPACT" :
                 (u == H5D_CONTIGUOUS ? "CONTIG" : (u == H5D_CHUNKED ? "CHUNKED" : "VIRTUAL"))), iter->dset_layouts[u]);
         HDprintf("\tNumber of external files : %lu\n", iter->nexternal);
+        HDfprintf(stdout, "\tNumber of allocated chunks : %Hu\n", iter->dset_nchunks);
 
         HDprintf("Dataset filters information:\n");
         HDprintf("\tNumber of datasets with:\n");
@@ -940,9 +940,11 @@
         out-layout.h5repack_layout.h5
         out-layout_long_switches.h5repack_layout.h5
         out-layout_short_switches.h5repack_layout.h5
+        out-lz4_individual.h5repack_layout.h5
         out-old_style_layout_short_switches.h5repack_layout.h5
         out-plugin_test.h5repack_layout.h5
         out-shuffle_all.h5repack_layout.h5
+        out-zstd_all.h5repack_layout.h5
         out-shuffle_individual.h5repack_layout.h5
         out-upgrade_layout.h5repack_layouto.h5
         out-contig_small_compa.h5repack_layout2.h5
@@ -1063,6 +1065,14 @@
     set (USE_FILTER_SZIP 1)
   endif ()
 
+  if (H5_HAVE_FILTER_LZ4)
+    set (USE_FILTER_LZ4 1)
+  endif ()
+
+  if (H5_HAVE_FILTER_ZSTD)
+    set (USE_FILTER_ZSTD 1)
+  endif ()
+
 # copy files (these files have no filters)
   ADD_H5_TEST (fill "TEST" ${FILE0})
   ADD_H5_TEST (objs "TEST" ${FILE1})
@@ -1096,6 +1106,22 @@
   endif ()
   ADD_H5_TEST (gzip_all ${TESTTYPE} ${arg})
 
+# lz4 with individual object
+  set (arg ${FILE4} -f dset1:LZ4=9  -l dset1:CHUNK=20x10)
+  set (TESTTYPE "TEST")
+  if (NOT USE_FILTER_LZ4)
+    set (TESTTYPE "SKIP")
+  endif ()
+  ADD_H5_TEST (lz4_individual ${TESTTYPE} ${arg})
+
+# zstd for all
+  set (arg ${FILE4} -f ZSTD=3)
+  set (TESTTYPE "TEST")
+  if (NOT USE_FILTER_ZSTD)
+    set (TESTTYPE "SKIP")
+  endif ()
+  ADD_H5_TEST (zstd_all ${TESTTYPE} ${arg})
+
 # szip with individual object
   set (arg ${FILE4} -f dset2:SZIP=8,EC  -l dset2:CHUNK=20x10)
   set (TESTTYPE "TEST")
@@ -44,6 +44,18 @@ if (HDF5_TEST_SERIAL)
           iopipe.txt.err
           overhead.txt
           overhead.txt.err
+          tsafe_read.txt
+          tsafe_read.txt.err
+          shuffle_perf.txt
+          shuffle_perf.txt.err
+          checksum_perf.txt
+          checksum_perf.txt.err
+          mdc_index_perf.txt
+          mdc_index_perf.txt.err
+          mdc_index_perf.h5
+          small_read.txt
+          small_read.txt.err
+          small_read.h5
           perf_meta.txt
           perf_meta.txt.err
           zip_perf-h.txt
@@ -133,6 +145,101 @@ if (HDF5_TEST_SERIAL)
       DEPENDS "PERFORM_h5perform-clearall-objects"
   )
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_tsafe_read COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:tsafe_read> -t 4 -s 2 -n 2)
+  else ()
+    add_test (NAME PERFORM_tsafe_read COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:tsafe_read>"
+        -D "TEST_ARGS:STRING=-t;4;-s;2;-n;2"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=tsafe_read.txt"
+        #-D "TEST_REFERENCE=tsafe_read.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_tsafe_read PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_shuffle_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:shuffle_perf> -s 256 -n 4)
+  else ()
+    add_test (NAME PERFORM_shuffle_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:shuffle_perf>"
+        -D "TEST_ARGS:STRING=-s;256;-n;4"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=shuffle_perf.txt"
+        #-D "TEST_REFERENCE=shuffle_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_shuffle_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_checksum_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:checksum_perf> -m 4)
+  else ()
+    add_test (NAME PERFORM_checksum_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:checksum_perf>"
+        -D "TEST_ARGS:STRING=-m;4"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=checksum_perf.txt"
+        #-D "TEST_REFERENCE=checksum_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_checksum_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_mdc_index_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:mdc_index_perf> -m 100000 -n 100000)
+  else ()
+    add_test (NAME PERFORM_mdc_index_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:mdc_index_perf>"
+        -D "TEST_ARGS:STRING=-m;100000;-n;100000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=mdc_index_perf.txt"
+        #-D "TEST_REFERENCE=mdc_index_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_mdc_index_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_small_read COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:small_read> -n 1000)
+  else ()
+    add_test (NAME PERFORM_small_read COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:small_read>"
+        -D "TEST_ARGS:STRING=-n;1000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=small_read.txt"
+        #-D "TEST_REFERENCE=small_read.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_small_read PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_perf_meta COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:perf_meta>)
   else ()
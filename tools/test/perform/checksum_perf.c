@@ -0,0 +1,203 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the throughput of the checksums of the library, in
+ *           GB/s, for buffers the sizes of small and large metadata
+ *           blocks: the lookup3 checksum of the file format metadata,
+ *           the same checksum computed a byte at a time (as the library
+ *           did before it read words; some compilers merge the byte
+ *           loads themselves), CRC32C and Fletcher32.  The lookup3
+ *           results of both versions are compared.  Run with
+ *           HDF5_DISABLE_SIMD=1 in the environment to measure the table
+ *           version of CRC32C instead of the CRC32 instructions.
+ *
+ *  Usage:   checksum_perf [-m MBYTES]
+ *
+ *           -m  number of MB checksummed for each buffer size and
+ *               checksum (default 256)
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define DEF_MBYTES      256
+#define MAX_BUF_SIZE    65536
+
+/* Checksums measured */
+typedef enum {
+    CK_LOOKUP3,
+    CK_LOOKUP3_BYTES,
+    CK_CRC32C,
+    CK_FLETCHER32,
+    CK_NTYPES
+} ck_type_t;
+
+/* lookup3 mixing, as in H5checksum.c */
+#define ROT(x,k) (((x)<<(k)) ^ ((x)>>(32-(k))))
+#define MIX(a,b,c) \
+{ \
+  a -= c;  a ^= ROT(c, 4);  c += b; \
+  b -= a;  b ^= ROT(a, 6);  a += c; \
+  c -= b;  c ^= ROT(b, 8);  b += a; \
+  a -= c;  a ^= ROT(c,16);  c += b; \
+  b -= a;  b ^= ROT(a,19);  a += c; \
+  c -= b;  c ^= ROT(b, 4);  b += a; \
+}
+#define FINAL(a,b,c) \
+{ \
+  c ^= b; c -= ROT(b,14); \
+  a ^= c; a -= ROT(c,11); \
+  b ^= a; b -= ROT(a,25); \
+  c ^= b; c -= ROT(b,16); \
+  a ^= c; a -= ROT(c,4);  \
+  b ^= a; b -= ROT(a,14); \
+  c ^= b; c -= ROT(b,24); \
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-m MBYTES]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static uint32_t
+lookup3_bytes(const uint8_t *k, size_t length, uint32_t initval)
+{
+    uint32_t a, b, c;
+    size_t u;
+
+    a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
+    while (length > 12) {
+        a += k[0] + ((uint32_t)k[1] << 8) + ((uint32_t)k[2] << 16) + ((uint32_t)k[3] << 24);
+        b += k[4] + ((uint32_t)k[5] << 8) + ((uint32_t)k[6] << 16) + ((uint32_t)k[7] << 24);
+        c += k[8] + ((uint32_t)k[9] << 8) + ((uint32_t)k[10] << 16) + ((uint32_t)k[11] << 24);
+        MIX(a, b, c);
+        length -= 12;
+        k += 12;
+    }
+    if (0 == length)
+        return c;
+    for (u = 0; u < length; u++) {
+        uint32_t v = (uint32_t)k[u] << (8 * (u % 4));
+
+        if (u < 4)
+            a += v;
+        else if (u < 8)
+            b += v;
+        else
+            c += v;
+    }
+    FINAL(a, b, c);
+
+    return c;
+}
+
+/*---------------------------------------------------------------------------*/
+static uint32_t
+checksum(ck_type_t type, const uint8_t *buf, size_t len)
+{
+    switch (type) {
+        case CK_LOOKUP3:
+            return H5_checksum_lookup3(buf, len, 0);
+        case CK_LOOKUP3_BYTES:
+            return lookup3_bytes(buf, len, 0);
+        case CK_CRC32C:
+            return H5_checksum_crc32c(buf, len, 0);
+        case CK_FLETCHER32:
+        case CK_NTYPES:
+        default:
+            return H5_checksum_fletcher32(buf, len);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static double
+measure(ck_type_t type, const uint8_t *buf, size_t len, size_t total)
+{
+    size_t niter = total / len;
+    uint32_t sum = 0;
+    double start, elapsed;
+    size_t u;
+
+    /* Vary the start of the buffer, as metadata blocks aren't aligned */
+    start = H5_get_time();
+    for (u = 0; u < niter; u++)
+        sum += checksum(type, buf + (u & 7), len);
+    elapsed = H5_get_time() - start;
+
+    /* Keep the checksums from being optimized away */
+    if (sum == 0xdeadbeef)
+        printf(" ");
+
+    return elapsed > 0.0 ? ((double)niter * (double)len) / (1024.0 * 1024.0 * 1024.0 * elapsed) : 0.0;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    const size_t sizes[] = {64, 512, 4096, MAX_BUF_SIZE};
+    unsigned mbytes = DEF_MBYTES;
+    const char *simd = getenv("HDF5_DISABLE_SIMD");
+    uint8_t *buf = NULL;
+    double gbps[CK_NTYPES];
+    size_t total, u, v;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-m") && i + 1 < argc)
+            mbytes = (unsigned)atoi(argv[++i]);
+        else
+            usage(argv[0]);
+    }
+    if (0 == mbytes)
+        usage(argv[0]);
+
+    if (H5open() < 0)
+        goto error;
+
+    if (NULL == (buf = (uint8_t *)HDmalloc(MAX_BUF_SIZE + 8)))
+        goto error;
+    for (u = 0; u < MAX_BUF_SIZE + 8; u++)
+        buf[u] = (uint8_t)HDrandom();
+
+    /* The word-at-a-time lookup3 must match the byte-wise one */
+    for (u = 0; u < 8; u++)
+        for (v = 1; v <= 1000; v++)
+            if (H5_checksum_lookup3(buf + u, v, 0) != lookup3_bytes(buf + u, v, 0)) {
+                fprintf(stderr, "lookup3 mismatch at offset %u, length %u\n", (unsigned)u, (unsigned)v);
+                nerrors++;
+            }
+
+    total = (size_t)mbytes * 1024 * 1024;
+    printf("Checksumming %u MB for each size (%s)\n", mbytes,
+           simd && atoi(simd) ? "CRC32C table" : "CRC32C instructions if available");
+    printf("%8s %12s %12s %12s %12s\n", "bytes", "lookup3", "bytewise", "crc32c", "fletcher32");
+    for (u = 0; u < NELMTS(sizes); u++) {
+        for (v = 0; v < CK_NTYPES; v++)
+            gbps[v] = measure((ck_type_t)v, buf, sizes[u], total);
+        printf("%8u %12.2f %12.2f %12.2f %12.2f\n", (unsigned)sizes[u], gbps[CK_LOOKUP3],
+               gbps[CK_LOOKUP3_BYTES], gbps[CK_CRC32C], gbps[CK_FLETCHER32]);
+    }
+
+    HDfree(buf);
+    if (nerrors > 0)
+        goto error;
+    return 0;
+
+error:
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
@@ -0,0 +1,171 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the cost of the library's ID table as the number of live
+ *           IDs grows: registering IDs, looking them up (as every API call
+ *           does with its ID arguments), iterating over them and removing
+ *           them, with 10^3 IDs and ten times more at each step up to the
+ *           given number of IDs.
+ *
+ *  Usage:   id_index_perf [-n MAX_IDS] [-l LOOKUPS]
+ *
+ *           -n  largest number of live IDs (default 1000000)
+ *           -l  number of lookups of random IDs at each step (default 1000000)
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define MIN_IDS         1000
+#define DEF_MAX_IDS     1000000
+#define DEF_LOOKUPS     1000000
+
+/* Pseudo-random numbers, the same on all platforms */
+static uint64_t rand_state = 88172645463325252ULL;
+
+/*---------------------------------------------------------------------------*/
+static size_t
+next_rand(size_t n)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 7;
+    rand_state ^= rand_state << 17;
+
+    return (size_t)(rand_state % (uint64_t)n);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n MAX_IDS] [-l LOOKUPS]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+count_cb(hid_t id, void *udata)
+{
+    size_t *count = (size_t *)udata;
+
+    if (id < 0)
+        return H5_ITER_ERROR;
+    (*count)++;
+
+    return H5_ITER_CONT;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure(H5I_type_t type, size_t nids, size_t nlookups, int *objs, hid_t *ids)
+{
+    double t0, t_reg, t_look, t_iter, t_rem;
+    size_t count = 0;
+    size_t i, j;
+    hid_t tmp;
+
+    /* Register the IDs */
+    t0 = H5_get_time();
+    for (i = 0; i < nids; i++)
+        if ((ids[i] = H5Iregister(type, &objs[i])) < 0)
+            goto error;
+    t_reg = H5_get_time() - t0;
+
+    /* Look up random IDs */
+    t0 = H5_get_time();
+    for (i = 0; i < nlookups; i++) {
+        j = next_rand(nids);
+        if (H5Iobject_verify(ids[j], type) != &objs[j])
+            goto error;
+    }
+    t_look = H5_get_time() - t0;
+
+    /* Iterate over all the IDs */
+    t0 = H5_get_time();
+    if (H5Iiterate(type, count_cb, &count) < 0)
+        goto error;
+    t_iter = H5_get_time() - t0;
+    if (count != nids)
+        goto error;
+
+    /* Remove the IDs in random order */
+    for (i = nids - 1; i > 0; i--) {
+        j = next_rand(i + 1);
+        tmp = ids[i];
+        ids[i] = ids[j];
+        ids[j] = tmp;
+    }
+    t0 = H5_get_time();
+    for (i = 0; i < nids; i++)
+        if (NULL == H5Iremove_verify(ids[i], type))
+            goto error;
+    t_rem = H5_get_time() - t0;
+
+    printf("%10lu %12.1f %12.1f %12.1f %12.1f\n", (unsigned long)nids,
+           t_reg * 1.0e9 / (double)nids, t_look * 1.0e9 / (double)nlookups,
+           t_iter * 1.0e9 / (double)nids, t_rem * 1.0e9 / (double)nids);
+
+    return 0;
+
+error:
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    size_t max_ids = DEF_MAX_IDS;
+    size_t nlookups = DEF_LOOKUPS;
+    H5I_type_t type = H5I_BADID;
+    int *objs = NULL;
+    hid_t *ids = NULL;
+    size_t nids;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            max_ids = (size_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+            nlookups = (size_t)atol(argv[++i]);
+        else
+            usage(argv[0]);
+    }
+    if (max_ids < MIN_IDS || 0 == nlookups)
+        usage(argv[0]);
+
+    if (NULL == (objs = (int *)calloc(max_ids, sizeof(int))))
+        goto error;
+    if (NULL == (ids = (hid_t *)malloc(max_ids * sizeof(hid_t))))
+        goto error;
+    if ((type = H5Iregister_type((size_t)0, 0, NULL)) < 0)
+        goto error;
+
+    printf("Times in ns per ID (per lookup for lookups)\n");
+    printf("%10s %12s %12s %12s %12s\n", "live IDs", "register", "lookup", "iterate", "remove");
+    for (nids = MIN_IDS; nids <= max_ids; nids *= 10)
+        if (measure(type, nids, nlookups, objs, ids))
+            nerrors++;
+
+    if (H5Idestroy_type(type) < 0)
+        goto error;
+    free(ids);
+    free(objs);
+    if (nerrors > 0)
+        goto error;
+
+    return 0;
+
+error:
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
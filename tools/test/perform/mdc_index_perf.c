@@ -0,0 +1,284 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the speed of the metadata cache index, in protect /
+ *           unprotect pairs per second, with 10^4 entries in the cache and
+ *           then ten times as many up to the maximum given.  As in the
+ *           cache tests, the entries are inserted into an instance of H5C_t
+ *           substituted for the one of an open file, so that nothing is
+ *           read or written.  The entries are laid out in the file like
+ *           metadata of random sizes, and are protected in random order,
+ *           so that every protect is a hit.  Each entry starts on a cache
+ *           line, so that the results don't depend on how the size of
+ *           H5C_cache_entry_t lines up with the cache lines.
+ *
+ *  Usage:   mdc_index_perf [-m MAX_ENTRIES] [-n OPERATIONS]
+ *
+ *           -m  largest number of entries in the cache (default 1000000,
+ *               at most 10000000)
+ *           -n  number of protect / unprotect pairs timed for each number
+ *               of entries (default 2000000)
+ */
+#define H5C_FRIEND              /* Suppress error about including H5Cpkg */
+#define H5F_FRIEND              /* Suppress error about including H5Fpkg */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5CXprivate.h"
+#include "H5Cpkg.h"
+#include "H5Fpkg.h"
+#include "H5VLprivate.h"
+
+#define FILENAME        "mdc_index_perf.h5"
+#define MIN_ENTRIES     10000
+#define DEF_MAX_ENTRIES 1000000
+#define MAX_MAX_ENTRIES 10000000
+#define DEF_OPERATIONS  2000000
+#define ENTRY_SIZE      8       /* Size of the entries in the cache */
+#define MIN_ENTRY_SPAN  64      /* Range of the file space between entries */
+#define MAX_ENTRY_SPAN  4096
+#define LINE_SIZE       64      /* Entries start on cache line boundaries */
+
+/* Benchmark entries don't need anything but the cache's own header */
+typedef struct bench_entry_t {
+    H5C_cache_entry_t header;
+} bench_entry_t;
+
+static herr_t bench_get_initial_load_size(void *udata, size_t *image_len);
+static void *bench_deserialize(const void *image, size_t len, void *udata, hbool_t *dirty);
+static herr_t bench_image_len(const void *thing, size_t *image_len);
+static herr_t bench_serialize(const H5F_t *f, void *image, size_t len, void *thing);
+static herr_t bench_free_icr(void *thing);
+
+static const H5C_class_t BENCH_CLASS[1] = {{
+    0,                                  /* Metadata client ID */
+    "benchmark entry",                  /* Metadata client name (for debugging) */
+    H5FD_MEM_DEFAULT,                   /* File space memory type for client */
+    H5C__CLASS_SKIP_READS | H5C__CLASS_SKIP_WRITES, /* Client class behavior flags */
+    bench_get_initial_load_size,        /* 'get_initial_load_size' callback */
+    NULL,                               /* 'get_final_load_size' callback */
+    NULL,                               /* 'verify_chksum' callback */
+    bench_deserialize,                  /* 'deserialize' callback */
+    bench_image_len,                    /* 'image_len' callback */
+    NULL,                               /* 'pre_serialize' callback */
+    bench_serialize,                    /* 'serialize' callback */
+    NULL,                               /* 'notify' callback */
+    bench_free_icr,                     /* 'free_icr' callback */
+    NULL,                               /* 'fsf_size' callback */
+}};
+
+static const H5C_class_t *bench_types[1] = {BENCH_CLASS};
+
+/*---------------------------------------------------------------------------*/
+static herr_t
+bench_get_initial_load_size(void H5_ATTR_UNUSED *udata, size_t *image_len)
+{
+    *image_len = ENTRY_SIZE;
+    return SUCCEED;
+}
+
+/*---------------------------------------------------------------------------*/
+static void *
+bench_deserialize(const void H5_ATTR_UNUSED *image, size_t H5_ATTR_UNUSED len,
+    void H5_ATTR_UNUSED *udata, hbool_t H5_ATTR_UNUSED *dirty)
+{
+    /* All entries are inserted, so nothing is ever loaded */
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static herr_t
+bench_image_len(const void H5_ATTR_UNUSED *thing, size_t *image_len)
+{
+    *image_len = ENTRY_SIZE;
+    return SUCCEED;
+}
+
+/*---------------------------------------------------------------------------*/
+static herr_t
+bench_serialize(const H5F_t H5_ATTR_UNUSED *f, void *image, size_t len, void H5_ATTR_UNUSED *thing)
+{
+    HDmemset(image, 0, len);
+    return SUCCEED;
+}
+
+/*---------------------------------------------------------------------------*/
+static herr_t
+bench_free_icr(void H5_ATTR_UNUSED *thing)
+{
+    /* The entries are freed all at once by main() */
+    return SUCCEED;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-m MAX_ENTRIES] [-n OPERATIONS]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static uint64_t
+next_random(uint64_t *state)
+{
+    /* xorshift64, as HDrandom() is too slow and too narrow here */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure(H5F_t *f, unsigned char *entries, size_t stride, const haddr_t *addrs,
+    size_t nentries, size_t nops, double *insert_rate, double *protect_rate)
+{
+    H5C_t *saved_cache = f->shared->cache;
+    H5C_t *cache_ptr = NULL;
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    double start, elapsed;
+    size_t u;
+    int ret_value = 0;
+
+    /* Substitute a cache large enough to hold all the entries */
+    f->shared->cache = NULL;
+    if (NULL == (cache_ptr = H5C_create(H5C__MAX_MAX_CACHE_SIZE, (size_t)0, 0, bench_types,
+            NULL, TRUE, NULL, NULL))) {
+        f->shared->cache = saved_cache;
+        return 1;
+    }
+    cache_ptr->ignore_tags = TRUE;
+    f->shared->cache = cache_ptr;
+
+    HDmemset(entries, 0, nentries * stride);
+    start = H5_get_time();
+    for (u = 0; u < nentries; u++)
+        if (H5C_insert_entry(f, BENCH_CLASS, addrs[u], entries + u * stride, H5C__NO_FLAGS_SET) < 0) {
+            ret_value = 1;
+            goto done;
+        }
+    elapsed = H5_get_time() - start;
+    *insert_rate = elapsed > 0.0 ? (double)nentries / elapsed : 0.0;
+
+    start = H5_get_time();
+    for (u = 0; u < nops; u++) {
+        haddr_t addr = addrs[next_random(&state) % nentries];
+        void *thing;
+
+        if (NULL == (thing = H5C_protect(f, BENCH_CLASS, addr, NULL, H5C__NO_FLAGS_SET)) ||
+                H5C_unprotect(f, addr, thing, H5C__NO_FLAGS_SET) < 0) {
+            ret_value = 1;
+            goto done;
+        }
+    }
+    elapsed = H5_get_time() - start;
+    *protect_rate = elapsed > 0.0 ? (double)nops / elapsed : 0.0;
+
+done:
+    if (H5C_prep_for_file_close(f) < 0 ||
+            H5C_flush_cache(f, H5C__FLUSH_INVALIDATE_FLAG | H5C__FLUSH_CLEAR_ONLY_FLAG) < 0 ||
+            H5C_dest(f) < 0)
+        ret_value = 1;
+    f->shared->cache = saved_cache;
+
+    return ret_value;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    size_t max_entries = DEF_MAX_ENTRIES;
+    size_t nops = DEF_OPERATIONS;
+    unsigned char *buf = NULL;
+    unsigned char *entries;
+    size_t stride = (sizeof(bench_entry_t) + LINE_SIZE - 1) & ~(size_t)(LINE_SIZE - 1);
+    haddr_t *addrs = NULL;
+    hid_t fapl = H5I_INVALID_HID;
+    hid_t fid = H5I_INVALID_HID;
+    H5F_t *f;
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    haddr_t addr;
+    double insert_rate, protect_rate;
+    size_t nentries, u;
+    hbool_t api_ctx_pushed = FALSE;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-m") && i + 1 < argc)
+            max_entries = (size_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            nops = (size_t)atol(argv[++i]);
+        else
+            usage(argv[0]);
+    }
+    if (max_entries < MIN_ENTRIES || max_entries > MAX_MAX_ENTRIES || 0 == nops)
+        usage(argv[0]);
+
+    if (H5open() < 0)
+        goto error;
+
+    /* The entries are never written, so a core file without a backing
+     * store is enough to drive the cache.
+     */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_core(fapl, (size_t)(1024 * 1024), FALSE) < 0)
+        goto error;
+    if ((fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if (NULL == (f = (H5F_t *)H5VL_object_verify(fid, H5I_FILE)))
+        goto error;
+
+    if (NULL == (buf = (unsigned char *)HDmalloc(max_entries * stride + LINE_SIZE)))
+        goto error;
+    entries = buf + (LINE_SIZE - (size_t)((uintptr_t)buf % LINE_SIZE)) % LINE_SIZE;
+    if (NULL == (addrs = (haddr_t *)HDmalloc(max_entries * sizeof(haddr_t))))
+        goto error;
+    addr = (haddr_t)MAX_ENTRY_SPAN;
+    for (u = 0; u < max_entries; u++) {
+        addrs[u] = addr;
+        addr += MIN_ENTRY_SPAN + next_random(&state) % (MAX_ENTRY_SPAN - MIN_ENTRY_SPAN);
+    }
+
+    H5CX_push();
+    api_ctx_pushed = TRUE;
+
+    printf("%u protect / unprotect pairs per cache size\n", (unsigned)nops);
+    printf("%12s %16s %16s\n", "entries", "inserts/s", "protects/s");
+    for (nentries = MIN_ENTRIES; nentries <= max_entries; nentries *= 10) {
+        if (measure(f, entries, stride, addrs, nentries, nops, &insert_rate, &protect_rate)) {
+            nerrors++;
+            break;
+        }
+        printf("%12u %16.0f %16.0f\n", (unsigned)nentries, insert_rate, protect_rate);
+    }
+
+    H5CX_pop();
+    api_ctx_pushed = FALSE;
+
+    HDfree(addrs);
+    HDfree(buf);
+    if (H5Fclose(fid) < 0 || H5Pclose(fapl) < 0)
+        goto error;
+    if (nerrors > 0)
+        goto error;
+    return 0;
+
+error:
+    if (api_ctx_pushed)
+        H5CX_pop();
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
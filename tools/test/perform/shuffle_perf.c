@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the throughput of the shuffle filter, in GB/s, for
+ *           elements of 2, 4, 8 and 16 bytes and a few other sizes, by
+ *           shuffling and unshuffling a buffer the size of a chunk over
+ *           and over.  Run with HDF5_DISABLE_SIMD=1 in the environment to
+ *           measure the scalar code instead of the vector kernels.
+ *
+ *  Usage:   shuffle_perf [-s KBYTES] [-n ITERATIONS]
+ *
+ *           -s  size of the buffer, in KB (default 1024)
+ *           -n  number of times the buffer is shuffled (default 100)
+ */
+#define H5Z_FRIEND              /* Suppress error about including H5Zpkg */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5Zpkg.h"
+
+#define DEF_KBYTES      1024
+#define DEF_ITERATIONS  100
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-s KBYTES] [-n ITERATIONS]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure(unsigned flags, unsigned size, void **buf, size_t nbytes, unsigned niter, double *gbps)
+{
+    unsigned cd_values[H5Z_SHUFFLE_TOTAL_NPARMS];
+    size_t buf_size = nbytes;
+    double start, elapsed;
+    unsigned i;
+
+    /* Warm up the caches and the page mappings of the buffers first */
+    cd_values[0] = size;
+    if (nbytes != (H5Z_SHUFFLE->filter)(flags, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS, cd_values, nbytes, &buf_size, buf))
+        return 1;
+
+    start = H5_get_time();
+    for (i = 0; i < niter; i++)
+        if (nbytes != (H5Z_SHUFFLE->filter)(flags, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS, cd_values, nbytes, &buf_size, buf))
+            return 1;
+    elapsed = H5_get_time() - start;
+
+    *gbps = elapsed > 0.0 ? ((double)niter * (double)nbytes) / (1024.0 * 1024.0 * 1024.0 * elapsed) : 0.0;
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    const unsigned sizes[] = {2, 4, 8, 16, 3, 12};
+    unsigned kbytes = DEF_KBYTES;
+    unsigned niter = DEF_ITERATIONS;
+    const char *simd = getenv("HDF5_DISABLE_SIMD");
+    size_t nbytes, u;
+    void *buf = NULL;
+    double shuf, unshuf;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            kbytes = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            niter = (unsigned)atoi(argv[++i]);
+        else
+            usage(argv[0]);
+    }
+    if (0 == kbytes || 0 == niter)
+        usage(argv[0]);
+
+    if (H5open() < 0)
+        goto error;
+
+    nbytes = (size_t)kbytes * 1024;
+    if (NULL == (buf = H5allocate_memory(nbytes, FALSE)))
+        goto error;
+    for (u = 0; u < nbytes; u++)
+        ((unsigned char *)buf)[u] = (unsigned char)HDrandom();
+
+    printf("Shuffling %u KB %u times (%s)\n", kbytes, niter,
+           simd && atoi(simd) ? "scalar code" : "vector kernels if available");
+    printf("%8s %12s %12s\n", "size", "shuf GB/s", "unshuf GB/s");
+    for (u = 0; u < NELMTS(sizes); u++) {
+        if (measure(0, sizes[u], &buf, nbytes, niter, &shuf))
+            nerrors++;
+        if (measure(H5Z_FLAG_REVERSE, sizes[u], &buf, nbytes, niter, &unshuf))
+            nerrors++;
+        printf("%8u %12.2f %12.2f\n", sizes[u], shuf, unshuf);
+    }
+
+    H5free_memory(buf);
+    if (nerrors > 0)
+        goto error;
+    return 0;
+
+error:
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
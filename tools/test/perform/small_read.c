@@ -0,0 +1,237 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the per-call overhead of the library for tiny reads:
+ *           the time taken by H5Dread calls that each read a few elements
+ *           of a dataset, with the default transfer property list and with
+ *           one whose properties were changed (whose properties the library
+ *           has to look up on each call), and the time taken by reads of the
+ *           same elements with a prepared read handle (H5Dread_prepared).
+ *
+ *  Usage:   small_read [-n ITERATIONS] [-e ELEMENTS]
+ *
+ *           -n  number of reads of each kind (default 1000000)
+ *           -e  number of elements read by each call (default 1)
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME        "small_read.h5"
+#define DSET_SIZE       4096
+#define DEF_ITERATIONS  1000000
+#define DEF_ELEMENTS    1
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n ITERATIONS] [-e ELEMENTS]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+cleanup(void)
+{
+    if (!getenv("HDF5_NOCLEANUP"))
+        remove(FILENAME);
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+create_file(void)
+{
+    hid_t file = H5I_INVALID_HID, space = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hsize_t dims[1] = {DSET_SIZE};
+    int buf[DSET_SIZE];
+    int u;
+
+    for (u = 0; u < DSET_SIZE; u++)
+        buf[u] = u;
+
+    if ((file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if (H5Dclose(dset) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure(hid_t dset, hid_t dxpl, unsigned niter, hsize_t nelmts, double *nsec)
+{
+    hid_t fspace = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    hsize_t start[1], count[1];
+    int buf[DSET_SIZE];
+    double t0;
+    unsigned i;
+
+    *nsec = 0.0;
+    count[0] = nelmts;
+    if ((fspace = H5Dget_space(dset)) < 0)
+        goto error;
+    if ((mspace = H5Screate_simple(1, count, NULL)) < 0)
+        goto error;
+
+    t0 = H5_get_time();
+    for (i = 0; i < niter; i++) {
+        start[0] = (hsize_t)i % (DSET_SIZE - nelmts + 1);
+        if (H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto error;
+        if (H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, dxpl, buf) < 0)
+            goto error;
+        if (buf[0] != (int)start[0])
+            goto error;
+    }
+    *nsec = (H5_get_time() - t0) * 1.0e9 / (double)niter;
+
+    if (H5Sclose(mspace) < 0)
+        goto error;
+    if (H5Sclose(fspace) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure_prepared(hid_t dset, unsigned niter, size_t nelmts, double *nsec)
+{
+    H5D_prepared_read_t *prep = NULL;
+    hsize_t start;
+    int buf[DSET_SIZE];
+    double t0;
+    unsigned i;
+
+    *nsec = 0.0;
+    if (NULL == (prep = H5Dprepare_read(dset, H5T_NATIVE_INT)))
+        goto error;
+
+    t0 = H5_get_time();
+    for (i = 0; i < niter; i++) {
+        start = (hsize_t)i % (DSET_SIZE - nelmts + 1);
+        if (H5Dread_prepared(prep, start, nelmts, buf) < 0)
+            goto error;
+        if (buf[0] != (int)start)
+            goto error;
+    }
+    *nsec = (H5_get_time() - t0) * 1.0e9 / (double)niter;
+
+    if (H5Dclose_prepared(prep) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if (prep)
+            H5Dclose_prepared(prep);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    unsigned niter = DEF_ITERATIONS;
+    unsigned nelmts = DEF_ELEMENTS;
+    hid_t file = H5I_INVALID_HID, dset = H5I_INVALID_HID, dxpl = H5I_INVALID_HID;
+    double nsec = 0.0;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            niter = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+            nelmts = (unsigned)atoi(argv[++i]);
+        else
+            usage(argv[0]);
+    }
+    if (0 == niter || 0 == nelmts || nelmts > DSET_SIZE)
+        usage(argv[0]);
+
+    if (create_file())
+        goto error;
+    if ((file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Change a few properties, so that the library can't use its cached
+     * values for the default property list */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+    if (H5Pset_buffer(dxpl, (size_t)2 * 1024 * 1024, NULL, NULL) < 0)
+        goto error;
+    if (H5Pset_edc_check(dxpl, H5Z_DISABLE_EDC) < 0)
+        goto error;
+    if (H5Pset_hyper_vector_size(dxpl, 2048) < 0)
+        goto error;
+
+    printf("Reading %u element(s) of a contiguous dataset %u times\n", nelmts, niter);
+    printf("%-24s %12s\n", "transfer property list", "ns/call");
+    if (measure(dset, H5P_DEFAULT, niter, (hsize_t)nelmts, &nsec))
+        nerrors++;
+    printf("%-24s %12.1f\n", "default", nsec);
+    if (measure(dset, dxpl, niter, (hsize_t)nelmts, &nsec))
+        nerrors++;
+    printf("%-24s %12.1f\n", "changed", nsec);
+    if (measure_prepared(dset, niter, (size_t)nelmts, &nsec))
+        nerrors++;
+    printf("%-24s %12.1f\n", "prepared", nsec);
+
+    if (H5Pclose(dxpl) < 0)
+        goto error;
+    if (H5Dclose(dset) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+    if (nerrors > 0)
+        goto error;
+    cleanup();
+    return 0;
+
+error:
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
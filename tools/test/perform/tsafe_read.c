@@ -0,0 +1,271 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the read throughput of the thread-safe library when
+ *           1, 2, 4, ... threads each read their own dataset from the same
+ *           file opened read-only, whose raw data is read without holding
+ *           the library's lock.
+ *
+ *  Usage:   tsafe_read [-t MAXTHREADS] [-s MBYTES] [-n ITERATIONS] [-c]
+ *
+ *           -t  largest number of threads to use (default 8)
+ *           -s  size of each thread's dataset, in MB (default 8)
+ *           -n  number of times each thread reads its dataset (default 8)
+ *           -c  use chunked datasets instead of contiguous ones
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME        "tsafe_read.h5"
+#define DEF_MAXTHREADS  8
+#define DEF_MBYTES      8
+#define DEF_ITERATIONS  8
+#define CHUNK_BYTES     (1024 * 1024)
+
+#ifdef H5_HAVE_THREADSAFE
+
+/* Arguments of a reader thread */
+typedef struct reader_t {
+    hid_t dset;                 /* Dataset to read */
+    size_t nbytes;              /* Size of the dataset */
+    unsigned niter;             /* Number of reads */
+    unsigned char *buf;         /* Buffer to read into */
+    int failed;                 /* Whether a read failed */
+} reader_t;
+
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-t MAXTHREADS] [-s MBYTES] [-n ITERATIONS] [-c]\n", prog);
+    exit(1);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+cleanup(void)
+{
+    if (!getenv("HDF5_NOCLEANUP"))
+        remove(FILENAME);
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+create_file(unsigned ndsets, size_t nbytes, hbool_t chunked)
+{
+    hid_t file = H5I_INVALID_HID, space = H5I_INVALID_HID, dcpl = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hsize_t dims[1], chunk_dims[1];
+    unsigned char *buf = NULL;
+    char name[32];
+    size_t u;
+    unsigned i;
+
+    if (NULL == (buf = (unsigned char *)malloc(nbytes)))
+        goto error;
+    for (u = 0; u < nbytes; u++)
+        buf[u] = (unsigned char)u;
+
+    if ((file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    dims[0] = nbytes;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (chunked) {
+        chunk_dims[0] = MIN(nbytes, CHUNK_BYTES);
+        if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+            goto error;
+    }
+
+    for (i = 0; i < ndsets; i++) {
+        HDsnprintf(name, sizeof(name), "dset%u", i);
+        if ((dset = H5Dcreate2(file, name, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            goto error;
+        if (H5Dwrite(dset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+        if (H5Dclose(dset) < 0)
+            goto error;
+    }
+
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+    free(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    free(buf);
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+static void *
+reader(void *_arg)
+{
+    reader_t *arg = (reader_t *)_arg;
+    unsigned i;
+
+    for (i = 0; i < arg->niter; i++)
+        if (H5Dread(arg->dset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, arg->buf) < 0) {
+            arg->failed = 1;
+            break;
+        }
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+measure(hid_t file, unsigned nthreads, size_t nbytes, unsigned niter, double *mbps)
+{
+    H5TS_thread_t *threads = NULL;
+    reader_t *args = NULL;
+    hid_t dapl = H5I_INVALID_HID;
+    char name[32];
+    double start, elapsed;
+    unsigned i;
+    int nerrors = 0;
+
+    *mbps = 0.0;
+    if (NULL == (threads = (H5TS_thread_t *)calloc(nthreads, sizeof(H5TS_thread_t))))
+        goto error;
+    if (NULL == (args = (reader_t *)calloc(nthreads, sizeof(reader_t))))
+        goto error;
+
+    /* Read chunks straight into the application's buffer */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_chunk_cache(dapl, 0, 0, 0.0) < 0)
+        goto error;
+
+    for (i = 0; i < nthreads; i++) {
+        HDsnprintf(name, sizeof(name), "dset%u", i);
+        if ((args[i].dset = H5Dopen2(file, name, dapl)) < 0)
+            goto error;
+        if (NULL == (args[i].buf = (unsigned char *)malloc(nbytes)))
+            goto error;
+        args[i].nbytes = nbytes;
+        args[i].niter = niter;
+    }
+
+    start = H5_get_time();
+    for (i = 0; i < nthreads; i++)
+        threads[i] = H5TS_create_thread(reader, NULL, &args[i]);
+    for (i = 0; i < nthreads; i++)
+        H5TS_wait_for_thread(threads[i]);
+    elapsed = H5_get_time() - start;
+
+    for (i = 0; i < nthreads; i++)
+        nerrors += args[i].failed;
+    *mbps = elapsed > 0.0 ? ((double)nthreads * (double)niter * (double)nbytes) / (1024.0 * 1024.0 * elapsed) : 0.0;
+
+done:
+    if (args)
+        for (i = 0; i < nthreads; i++) {
+            if (args[i].dset > 0)
+                H5Dclose(args[i].dset);
+            free(args[i].buf);
+        }
+    if (dapl > 0)
+        H5Pclose(dapl);
+    free(args);
+    free(threads);
+
+    return nerrors;
+
+error:
+    nerrors++;
+    goto done;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    unsigned maxthreads = DEF_MAXTHREADS;
+    unsigned mbytes = DEF_MBYTES;
+    unsigned niter = DEF_ITERATIONS;
+    hbool_t chunked = FALSE;
+    hid_t file = H5I_INVALID_HID;
+    double mbps = 0.0, base = 0.0;
+    unsigned nthreads;
+    int i, nerrors = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-t") && i + 1 < argc)
+            maxthreads = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            mbytes = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            niter = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c"))
+            chunked = TRUE;
+        else
+            usage(argv[0]);
+    }
+    if (0 == maxthreads || 0 == mbytes || 0 == niter)
+        usage(argv[0]);
+
+    if (create_file(maxthreads, (size_t)mbytes * 1024 * 1024, chunked))
+        goto error;
+    if ((file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+
+    printf("Reading %u MB %s datasets %u times from a read-only file\n", mbytes,
+           chunked ? "chunked" : "contiguous", niter);
+    printf("%8s %12s %8s\n", "threads", "MB/s", "speedup");
+    for (nthreads = 1; ; nthreads = MIN(2 * nthreads, maxthreads)) {
+        if (measure(file, nthreads, (size_t)mbytes * 1024 * 1024, niter, &mbps))
+            nerrors++;
+        if (1 == nthreads)
+            base = mbps;
+        printf("%8u %12.1f %8.2f\n", nthreads, mbps, base > 0.0 ? mbps / base : 0.0);
+        if (nthreads == maxthreads)
+            break;
+    }
+
+    if (H5Fclose(file) < 0)
+        goto error;
+    if (nerrors > 0)
+        goto error;
+    cleanup();
+    return 0;
+
+error:
+    fprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
+
+#else /* H5_HAVE_THREADSAFE */
+
+int
+main(void)
+{
+    printf("Test skipped because THREADSAFE not enabled\n");
+    return 0;
+}
+
+#endif /* H5_HAVE_THREADSAFE */
+